@@ -164,10 +164,10 @@ public:
      */
 
     fastrtps::rtps::SampleIdentity get_type_dependencies(
-            const fastrtps::types::TypeIdentifierSeq& in) const;
+            const fastrtps::types::TypeIdentifierSeq& in);
 
     fastrtps::rtps::SampleIdentity get_types(
-            const fastrtps::types::TypeIdentifierSeq& in) const;
+            const fastrtps::types::TypeIdentifierSeq& in);
 
 private:
 
@@ -177,6 +177,13 @@ private:
      */
     bool create_endpoints();
 
+    /**
+     * Create the endpoints used in the TypeLookupManager when they were not created on initialization
+     * (see RTPSParticipantImpl::lazy_builtin_endpoints), matching them with the known participants.
+     * @return true if correct.
+     */
+    bool enable_endpoints();
+
     /**
      * Get the RTPS participant
      * @return RTPS participant
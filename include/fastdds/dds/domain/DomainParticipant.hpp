@@ -32,6 +32,7 @@
 #include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/SampleIdentity.h>
 #include <fastrtps/types/TypesBase.h>
 
@@ -604,6 +605,14 @@ public:
 
     // DomainParticipant methods specific from Fast-DDS
 
+    /**
+     * Get the memory allocated by this participant, by subsystem and by each of its endpoints.
+     * @param [out] usage Memory usage of the participant.
+     * @return RETCODE_NOT_ENABLED if the participant is not enabled, RETCODE_OK otherwise.
+     */
+    RTPS_DllAPI ReturnCode_t get_memory_usage(
+            fastrtps::rtps::ParticipantMemoryUsage& usage) const;
+
     /**
      * Register a type in this participant.
      * @param type TypeSupport.
@@ -19,6 +19,8 @@
 #ifndef _FASTDDS_DDS_PUBLISHER_DATAWRITER_HPP_
 #define _FASTDDS_DDS_PUBLISHER_DATAWRITER_HPP_
 
+#include <vector>
+
 #include <fastdds/dds/builtin/topic/SubscriptionBuiltinTopicData.hpp>
 #include <fastdds/dds/core/Entity.hpp>
 #include <fastdds/dds/core/status/BaseStatus.hpp>
@@ -43,6 +45,7 @@ namespace rtps {
 
 class WriteParams;
 struct GUID_t;
+struct SerializedPayload_t;
 
 } // namespace rtps
 } // namespace fastrtps
@@ -162,6 +165,56 @@ public:
             void* data,
             const InstanceHandle_t& handle);
 
+    /**
+     * Write a batch of samples to the topic.
+     *
+     * Equivalent to calling @ref write for each of the samples, in order, but the writer is blocked only once
+     * and the whole batch is handed at once to the flow controller, so several samples may share a network message.
+     * Loaned samples are accepted.
+     *
+     * All the samples are checked before writing any of them. The writing itself is not atomic: when a sample
+     * cannot be added to the history (e.g. RETCODE_OUT_OF_RESOURCES or RETCODE_TIMEOUT), the samples before it
+     * remain written and are published. Use the overload reporting the number of written samples to know which ones.
+     *
+     * @param data Pointers to the samples.
+     * @return RETCODE_BAD_PARAMETER if any of the samples is not valid, in which case none is written.
+     * RETCODE_OK if all the samples were written. RETCODE_ERROR if they were written but some of them could not be
+     * delivered by a synchronous flow controller. Otherwise, the error of the first sample that could not be written.
+     */
+    RTPS_DllAPI ReturnCode_t write_batch(
+            const std::vector<void*>& data);
+
+    /**
+     * Write a batch of samples to the topic, reporting how many of them were written.
+     *
+     * @param data Pointers to the samples.
+     * @param[out] written Number of samples written, from the beginning of the batch.
+     * @return Same as write_batch(const std::vector<void*>&).
+     */
+    RTPS_DllAPI ReturnCode_t write_batch(
+            const std::vector<void*>& data,
+            size_t& written);
+
+    /**
+     * Write a sample which is already serialized.
+     *
+     * The payload must hold the CDR encapsulation and the serialized data, as produced by
+     * TopicDataType::serialize. It is copied to the history of the writer, skipping the serialization.
+     *
+     * On keyed topics the payload is deserialized once to compute the key. As in write(void*, const InstanceHandle_t&),
+     * the special value HANDLE_NIL can be used for the parameter handle; any other value must correspond to the key
+     * of the payload.
+     *
+     * @param payload Serialized sample.
+     * @param handle InstanceHandle_t of the sample.
+     * @return RETCODE_BAD_PARAMETER if the payload is empty or cannot be deserialized, RETCODE_PRECONDITION_NOT_MET
+     * if the handle does not correspond to the payload, RETCODE_OK if the sample is correctly written,
+     * or the error of the writing otherwise.
+     */
+    RTPS_DllAPI ReturnCode_t write_serialized(
+            const fastrtps::rtps::SerializedPayload_t& payload,
+            const InstanceHandle_t& handle = HANDLE_NIL);
+
     /** NOT YET IMPLEMENTED
      * @brief This operation performs the same function as write except that it also provides the value for the
      * @ref eprosima::fastdds::dds::SampleInfo::source_timestamp "source_timestamp" that is made available to DataReader
@@ -0,0 +1,107 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Replayer.hpp
+ */
+
+#ifndef _FASTDDS_DDS_RECORDING_REPLAYER_HPP_
+#define _FASTDDS_DDS_RECORDING_REPLAYER_HPP_
+
+#include <cstdint>
+#include <string>
+
+#include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
+#include <fastdds/rtps/common/Time_t.h>
+#include <fastrtps/fastrtps_dll.h>
+#include <fastrtps/types/TypesBase.h>
+
+using eprosima::fastrtps::types::ReturnCode_t;
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class DomainParticipant;
+class ReplayerImpl;
+
+/**
+ * Republishes a recording made by a participant with the fastdds.recorder properties.
+ *
+ * Each recorded topic is published by a DataWriter created on the given participant, where the types of the
+ * recorded topics should be registered with their recorded names. Samples are written with
+ * DataWriter::write_serialized, so they are not serialized again, and keep their recorded instance handle.
+ * Only the samples of ALIVE changes are replayed.
+ */
+class Replayer
+{
+public:
+
+    /**
+     * @param participant Participant where the entities publishing the recording are created.
+     * @param file_name Path of the recording, as given on the fastdds.recorder.file property.
+     * @param qos DataWriterQos of the DataWriters publishing the recording.
+     */
+    RTPS_DllAPI Replayer(
+            DomainParticipant* participant,
+            const std::string& file_name,
+            const DataWriterQos& qos = DATAWRITER_QOS_DEFAULT);
+
+    //! Deletes the entities created on the participant.
+    RTPS_DllAPI ~Replayer();
+
+    // Non-copyable
+    Replayer(
+            const Replayer&) = delete;
+    Replayer& operator = (
+            const Replayer&) = delete;
+
+    /**
+     * Opens the recording and creates the Publisher, Topics and DataWriters publishing it.
+     * Calling it before replay allows waiting for the DataWriters to be matched.
+     * @return RETCODE_PRECONDITION_NOT_MET if the recording cannot be opened or a type is not registered,
+     * RETCODE_ERROR if an entity cannot be created, RETCODE_OK otherwise.
+     */
+    RTPS_DllAPI ReturnCode_t enable();
+
+    /**
+     * Republishes the recording, blocking until its end or a call to stop.
+     * @param speed Pace of the replay relative to the recording (2.0 replays twice as fast).
+     *              A value of 0 or lower replays as fast as possible.
+     * @param start_offset Time from the beginning of the recording where the replay starts.
+     * @return The error of enable if it had not been called, RETCODE_OK otherwise.
+     */
+    RTPS_DllAPI ReturnCode_t replay(
+            double speed = 1.0,
+            const fastrtps::Duration_t& start_offset = fastrtps::c_TimeZero);
+
+    //! Makes a running replay return. It can be called from any thread.
+    RTPS_DllAPI void stop();
+
+    //! @return Number of samples written on the last replay.
+    RTPS_DllAPI uint64_t replayed_samples() const;
+
+    //! @return Time between the first and the last sample of the recording, once enabled.
+    RTPS_DllAPI fastrtps::Duration_t duration() const;
+
+private:
+
+    ReplayerImpl* impl_;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_DDS_RECORDING_REPLAYER_HPP_
@@ -34,6 +34,7 @@
 #include <fastdds/dds/core/status/StatusMask.hpp>
 #include <fastdds/dds/core/status/SubscriptionMatchedStatus.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/SampleRing.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 
 #include <fastrtps/fastrtps_dll.h>
@@ -57,6 +58,7 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 struct GUID_t;
+struct SerializedPayload_t;
 } // namespace rtps
 } // namespace fastrtps
 
@@ -688,8 +690,62 @@ public:
             void* data,
             SampleInfo* info);
 
+    /**
+     * @brief This operation takes the next, non-previously accessed sample from the DataReader as
+     * @ref take_next_sample does, but copies its serialized data (CDR encapsulation included) instead of
+     * deserializing it.
+     *
+     * The payload grows when it is not big enough for the sample. The result can be given to
+     * DataWriter::write_serialized, or to TopicDataType::deserialize later on.
+     *
+     * If there is no unread data in the DataReader, the operation will return RETCODE_NO_DATA and nothing is copied.
+     *
+     * @param [out] payload Payload to store the serialized sample
+     * @param [out] info SampleInfo pointer to store the sample information
+     *
+     * @return Any of the standard return codes.
+     */
+    RTPS_DllAPI ReturnCode_t take_serialized(
+            fastrtps::rtps::SerializedPayload_t* payload,
+            SampleInfo* info);
+
+    /**
+     * @brief This operation takes samples from the DataReader into the free slots of a SampleRing.
+     *
+     * The samples are taken as with @ref take, with <tt> sample_states = ANY_SAMPLE_STATE </tt>,
+     * <tt> view_states = ANY_VIEW_STATE </tt> and <tt> instance_states = ANY_INSTANCE_STATE </tt>, but the
+     * DataReader is locked only once for the whole call, and the samples are deserialized straight into the
+     * slots of the ring, so no loans have to be returned afterwards.
+     * The limit of ResourceLimitsQosPolicy::max_samples_per_read does not apply.
+     *
+     * @param [in,out] ring Ring where the samples are stored.
+     * @param [in] max_samples The maximum number of samples to be taken. LENGTH_UNLIMITED means as many as
+     *                         free slots in the ring.
+     *
+     * @return RETCODE_OK if some sample with valid data was taken, RETCODE_NO_DATA if there was nothing to take
+     * or the ring was full. Any of the standard return codes otherwise.
+     */
+    RTPS_DllAPI ReturnCode_t take_to_ring(
+            SampleRing& ring,
+            int32_t max_samples = LENGTH_UNLIMITED);
+
     ///@}
 
+    /**
+     * @brief Attaches a SampleRing which is filled on the reception of new samples.
+     *
+     * Each new sample, and those already in the DataReader, are taken into the ring from the reception thread,
+     * before the listener is notified. The samples that do not fit are kept in the DataReader, and are moved to
+     * the ring on the next reception or with @ref take_to_ring.
+     * The ring must outlive the attachment.
+     *
+     * @param [in] ring Ring to attach, or nullptr to detach the current one.
+     *
+     * @return RETCODE_OK if the ring was attached. Any of the standard return codes otherwise.
+     */
+    RTPS_DllAPI ReturnCode_t set_sample_ring(
+            SampleRing* ring);
+
     /**
      * This operation indicates to the DataReader that the application is done accessing the collection of
      * @c data_values and @c sample_infos obtained by some earlier invocation of @ref read or @ref take on the
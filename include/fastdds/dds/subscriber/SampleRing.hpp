@@ -0,0 +1,188 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SampleRing.hpp
+ */
+
+#ifndef _FASTDDS_DDS_SUBSCRIBER_SAMPLERING_HPP_
+#define _FASTDDS_DDS_SUBSCRIBER_SAMPLERING_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include <fastdds/dds/core/LoanableCollection.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class DataReaderImpl;
+
+/**
+ * A ring of preallocated sample and SampleInfo slots, owned by the application, which a DataReader fills
+ * in bulk.
+ *
+ * The DataReader is the only producer, either from @ref DataReader::take_to_ring or, when the ring has been
+ * attached with @ref DataReader::set_sample_ring, from the reception thread.
+ * The application is the only consumer: it accesses the oldest samples with @ref data and @ref info, and
+ * gives the slots back with @ref pop. Producer and consumer may run on different threads.
+ *
+ * The slots keep the samples passed on construction, which are never released by the ring.
+ */
+class SampleRing
+{
+public:
+
+    using size_type = LoanableCollection::size_type;
+
+    /**
+     * @param samples Samples of the slots, of the type of the DataReader (e.g. created with
+     *                TypeSupport::create_data). Its size is the capacity of the ring.
+     */
+    explicit SampleRing(
+            const std::vector<void*>& samples)
+        : samples_(samples)
+        , infos_(samples.size())
+        , info_slots_(samples.size())
+    {
+        for (size_t n = 0; n < infos_.size(); ++n)
+        {
+            info_slots_[n] = &infos_[n];
+        }
+    }
+
+    // Non-copyable
+    SampleRing(
+            const SampleRing&) = delete;
+    SampleRing& operator = (
+            const SampleRing&) = delete;
+
+    /**
+     * @return Number of slots of the ring.
+     */
+    size_type capacity() const
+    {
+        return static_cast<size_type>(samples_.size());
+    }
+
+    /**
+     * @return Number of samples ready to be consumed.
+     */
+    size_type size() const
+    {
+        return static_cast<size_type>(tail_.load(std::memory_order_acquire) -
+               head_.load(std::memory_order_relaxed));
+    }
+
+    /**
+     * @return Whether there are no samples ready to be consumed.
+     */
+    bool empty() const
+    {
+        return 0 == size();
+    }
+
+    /**
+     * @param n Position of the sample, 0 being the oldest one. Must be less than size().
+     * @return Pointer to the sample. Its content is only meaningful when info(n).valid_data is true.
+     */
+    void* data(
+            size_type n = 0) const
+    {
+        assert(n < size());
+        return samples_[slot(head_.load(std::memory_order_relaxed) + n)];
+    }
+
+    /**
+     * @param n Position of the sample, 0 being the oldest one. Must be less than size().
+     * @return Information of the sample.
+     */
+    const SampleInfo& info(
+            size_type n = 0) const
+    {
+        assert(n < size());
+        return infos_[slot(head_.load(std::memory_order_relaxed) + n)];
+    }
+
+    /**
+     * Gives the slots of the oldest samples back to the DataReader.
+     * @param n Number of samples consumed. Must not be greater than size().
+     */
+    void pop(
+            size_type n = 1)
+    {
+        assert(n <= size());
+        head_.fetch_add(static_cast<uint64_t>(n), std::memory_order_release);
+    }
+
+private:
+
+    friend class DataReaderImpl;
+
+    size_t slot(
+            uint64_t position) const
+    {
+        return static_cast<size_t>(position % samples_.size());
+    }
+
+    /**
+     * Producer side. Gets the free slots after the newest sample which are contiguous in memory.
+     * @param [out] first Index of the first free slot.
+     * @return Number of contiguous free slots.
+     */
+    size_type free_slots(
+            size_type& first) const
+    {
+        uint64_t tail = tail_.load(std::memory_order_relaxed);
+        uint64_t used = tail - head_.load(std::memory_order_acquire);
+        first = static_cast<size_type>(slot(tail));
+        return std::min(capacity() - static_cast<size_type>(used), capacity() - first);
+    }
+
+    /**
+     * Producer side. Makes the samples written in the free slots available to the consumer.
+     * @param n Number of slots written, from the first free one.
+     */
+    void push(
+            size_type n)
+    {
+        tail_.fetch_add(static_cast<uint64_t>(n), std::memory_order_release);
+    }
+
+    //! Samples of each slot
+    std::vector<void*> samples_;
+
+    //! Information of each slot
+    std::vector<SampleInfo> infos_;
+
+    //! Pointers to infos_, as the buffer of a SampleInfo collection
+    std::vector<void*> info_slots_;
+
+    //! Position of the oldest sample. Only written by the consumer.
+    std::atomic<uint64_t> head_ {0};
+
+    //! Position after the newest sample. Only written by the producer.
+    std::atomic<uint64_t> tail_ {0};
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_DDS_SUBSCRIBER_SAMPLERING_HPP_
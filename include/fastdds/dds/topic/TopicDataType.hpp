@@ -131,6 +131,28 @@ public:
             fastrtps::rtps::InstanceHandle_t* ihandle,
             bool force_md5 = false) = 0;
 
+    /**
+     * Serialize the key of the data, in big endian CDR, as it is hashed to get its instance handle.
+     * Lets the writers of the type remember the handles of the keys already hashed.
+     * Types not implementing it always have their keys hashed by @ref getKey.
+     *
+     * @param[in] data Pointer to the data.
+     * @param[out] key Payload where the key is serialized, which is reserved as needed.
+     * @param[out] max_key_length Maximum serialized size of the key of the type.
+     *
+     * @return True if the key was serialized, false if the type does not support it.
+     */
+    RTPS_DllAPI virtual inline bool serialize_key(
+            void* data,
+            fastrtps::rtps::SerializedPayload_t* key,
+            size_t& max_key_length)
+    {
+        static_cast<void>(data);
+        static_cast<void>(key);
+        static_cast<void>(max_key_length);
+        return false;
+    }
+
     /**
      * Set topic data type name
      * @param nam Topic data type name
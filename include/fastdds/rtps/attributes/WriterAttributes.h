@@ -142,6 +142,9 @@ public:
 
     //! Flow controller name. Default: fastdds::rtps::FASTDDS_FLOW_CONTROLLER_DEFAULT.
     const char* flow_controller_name = fastdds::rtps::FASTDDS_FLOW_CONTROLLER_DEFAULT;
+
+    //! Transport priority, selecting the send resources of the writer. Default: 0 (default send resources).
+    int32_t transport_priority = 0;
 };
 
 } /* namespace rtps */
@@ -0,0 +1,125 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AnnouncementDigest.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_BUILTIN_DATA_ANNOUNCEMENTDIGEST_HPP_
+#define _FASTDDS_RTPS_BUILTIN_DATA_ANNOUNCEMENTDIGEST_HPP_
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <array>
+#include <cstring>
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastdds/rtps/common/Types.h>
+#include <fastrtps/utils/md5.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Digest of the serialized parameter list of a discovery announcement.
+ * Comparing it with the digest of the announcement a proxy was read from tells whether a received announcement
+ * carries new information, without parsing it.
+ * Announcements sent again as the same change are recognized by their writer and sequence number, before hashing.
+ * @ingroup BUILTIN_MODULE
+ */
+class AnnouncementDigest
+{
+public:
+
+    //! Constructs an empty digest, which is not equal to any other.
+    AnnouncementDigest() = default;
+
+    /**
+     * Computes the digest of an announcement.
+     * @param payload Serialized announcement.
+     */
+    explicit AnnouncementDigest(
+            const SerializedPayload_t& payload)
+        : length_(payload.length)
+        , is_set_(true)
+    {
+        MD5 md5;
+        md5.update(payload.data, payload.length);
+        md5.finalize();
+        memcpy(value_.data(), md5.digest, value_.size());
+    }
+
+    /**
+     * Computes the digest of an announcement, remembering the change it was received on.
+     * @param change Received announcement.
+     */
+    explicit AnnouncementDigest(
+            const CacheChange_t& change)
+        : AnnouncementDigest(change.serializedPayload)
+    {
+        writer_guid_ = change.writerGUID;
+        sequence_number_ = change.sequenceNumber;
+    }
+
+    /**
+     * Checks whether a change is the same one this digest was computed from, without hashing it.
+     * @param change Received announcement.
+     * @return True if the change was sent by the same writer with the same sequence number.
+     */
+    bool is_same_change(
+            const CacheChange_t& change) const
+    {
+        return is_set_ && SequenceNumber_t::unknown() != sequence_number_ &&
+               sequence_number_ == change.sequenceNumber && writer_guid_ == change.writerGUID;
+    }
+
+    //! Makes this digest empty.
+    void clear()
+    {
+        is_set_ = false;
+    }
+
+    bool operator ==(
+            const AnnouncementDigest& other) const
+    {
+        return is_set_ && other.is_set_ && length_ == other.length_ && value_ == other.value_;
+    }
+
+    bool operator !=(
+            const AnnouncementDigest& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+
+    std::array<octet, 16> value_ {};
+
+    uint32_t length_ = 0;
+
+    GUID_t writer_guid_;
+
+    SequenceNumber_t sequence_number_ = SequenceNumber_t::unknown();
+
+    bool is_set_ = false;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_RTPS_BUILTIN_DATA_ANNOUNCEMENTDIGEST_HPP_
@@ -27,6 +27,7 @@
 #include <fastdds/rtps/attributes/WriterAttributes.h>
 #include <fastdds/rtps/attributes/ReaderAttributes.h>
 #include <fastdds/rtps/common/Token.h>
+#include <fastdds/rtps/builtin/data/AnnouncementDigest.hpp>
 #include <fastdds/rtps/common/RemoteLocators.hpp>
 
 #if HAVE_SECURITY
@@ -141,6 +142,8 @@ public:
     ProxyHashTable<ReaderProxyData>* m_readers = nullptr;
     //!
     ProxyHashTable<WriterProxyData>* m_writers = nullptr;
+    //! Digest of the announcement this information was read from
+    AnnouncementDigest announcement_digest;
 
     /**
      * Update the data.
@@ -31,6 +31,7 @@
 #include <fastdds/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
 #endif // if HAVE_SECURITY
 
+#include <fastdds/rtps/builtin/data/AnnouncementDigest.hpp>
 #include <fastdds/rtps/common/RemoteLocators.hpp>
 
 namespace eprosima {
@@ -88,6 +89,17 @@ public:
         return m_guid;
     }
 
+    void announcement_digest(
+            const AnnouncementDigest& digest)
+    {
+        announcement_digest_ = digest;
+    }
+
+    const AnnouncementDigest& announcement_digest() const
+    {
+        return announcement_digest_;
+    }
+
     RTPS_DllAPI bool has_locators() const
     {
         return !remote_locators_.unicast.empty() || !remote_locators_.multicast.empty();
@@ -361,6 +373,44 @@ public:
         return fastdds::dds::get_proxy_property<SampleIdentity>("PID_CLIENT_SERVER_KEY", m_properties);
     }
 
+    /**
+     * Set the payload compression algorithms the reader restores.
+     * @param algorithms Comma separated names of the algorithms.
+     */
+    void accepted_compression(
+            const std::string& algorithms)
+    {
+        auto it = std::find_if(m_properties.begin(), m_properties.end(),
+                        [](const ParameterPropertyList_t::const_iterator::reference p)
+                        {
+                            return "fastdds.compression.accepted" == p.first();
+                        });
+
+        if (it != m_properties.end())
+        {
+            m_properties.set_property(it, std::make_pair("fastdds.compression.accepted", algorithms));
+        }
+        else
+        {
+            m_properties.push_back("fastdds.compression.accepted", algorithms);
+        }
+    }
+
+    /**
+     * Retrieve the payload compression algorithms the reader restores.
+     * @return Comma separated names of the algorithms. Empty if the reader did not announce any.
+     */
+    std::string accepted_compression() const
+    {
+        auto it = std::find_if(m_properties.begin(), m_properties.end(),
+                        [](const ParameterPropertyList_t::const_iterator::reference p)
+                        {
+                            return "fastdds.compression.accepted" == p.first();
+                        });
+
+        return it != m_properties.end() ? it->second() : std::string();
+    }
+
     /**
      * Get the size in bytes of the CDR serialization of this object.
      * @param include_encapsulation Whether to include the size of the encapsulation info.
@@ -458,6 +508,8 @@ private:
     xtypes::TypeInformation* m_type_information;
     //!
     ParameterPropertyList_t m_properties;
+    //!Digest of the announcement this information was read from
+    AnnouncementDigest announcement_digest_;
 };
 
 } // namespace rtps
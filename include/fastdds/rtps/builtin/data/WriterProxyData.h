@@ -31,6 +31,7 @@
 #include <fastdds/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
 #endif // if HAVE_SECURITY
 
+#include <fastdds/rtps/builtin/data/AnnouncementDigest.hpp>
 #include <fastdds/rtps/common/RemoteLocators.hpp>
 
 namespace eprosima {
@@ -109,6 +110,17 @@ public:
         return persistence_guid_;
     }
 
+    void announcement_digest(
+            const AnnouncementDigest& digest)
+    {
+        announcement_digest_ = digest;
+    }
+
+    const AnnouncementDigest& announcement_digest() const
+    {
+        return announcement_digest_;
+    }
+
     RTPS_DllAPI void set_persistence_entity_id(
             const EntityId_t& nid)
     {
@@ -478,6 +490,9 @@ private:
 
     //!
     ParameterPropertyList_t m_properties;
+
+    //!Digest of the announcement this information was read from
+    AnnouncementDigest announcement_digest_;
 };
 
 } /* namespace rtps */
@@ -25,6 +25,12 @@
 #include <fastdds/rtps/builtin/data/WriterProxyData.h>
 #include <fastdds/rtps/builtin/data/ReaderProxyData.h>
 
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -149,8 +155,58 @@ public:
     bool removeLocalWriter(
             RTPSWriter* W) override;
 
+    /**
+     * Check whether the announcement of a remote writer should be kept aside instead of being processed, as there
+     * are no local readers on its topic (see RTPSParticipantImpl::edp_interest_filter).
+     * Announcements kept aside are processed when a local reader on their topic is created.
+     * @param change Change with the ALIVE announcement of the remote writer.
+     * @return true if the announcement has been kept aside, so it should not be processed.
+     */
+    bool skip_remote_writer_announcement(
+            const CacheChange_t& change);
+
+    /**
+     * Check whether the announcement of a remote reader should be kept aside instead of being processed, as there
+     * are no local writers on its topic (see RTPSParticipantImpl::edp_interest_filter).
+     * Announcements kept aside are processed when a local writer on their topic is created.
+     * @param change Change with the ALIVE announcement of the remote reader.
+     * @return true if the announcement has been kept aside, so it should not be processed.
+     */
+    bool skip_remote_reader_announcement(
+            const CacheChange_t& change);
+
+    /**
+     * Forget the announcement of a remote writer kept aside, as the writer has been disposed.
+     * @param writer_guid GUID of the remote writer.
+     */
+    void forget_skipped_writer(
+            const GUID_t& writer_guid);
+
+    /**
+     * Forget the announcement of a remote reader kept aside, as the reader has been disposed.
+     * @param reader_guid GUID of the remote reader.
+     */
+    void forget_skipped_reader(
+            const GUID_t& reader_guid);
+
 protected:
 
+    /**
+     * Record that there is a local reader on a topic, processing the announcements of remote writers on it that
+     * were kept aside.
+     * @param topic_name Topic of the local reader.
+     */
+    void add_local_reader_interest(
+            const string_255& topic_name);
+
+    /**
+     * Record that there is a local writer on a topic, processing the announcements of remote readers on it that
+     * were kept aside.
+     * @param topic_name Topic of the local writer.
+     */
+    void add_local_writer_interest(
+            const string_255& topic_name);
+
     /**
      * Initialization of history attributes for EDP built-in readers
      *
@@ -264,6 +320,43 @@ private:
             const ReaderProxyData& remote_reader_data) override;
 #endif // if HAVE_SECURITY
 
+    //! Announcement of a remote endpoint kept aside, as there was no local endpoint that could match it
+    struct SkippedAnnouncement
+    {
+        std::string topic_name;
+        std::vector<octet> payload;
+    };
+
+    using SkippedAnnouncementMap = std::map<GUID_t, SkippedAnnouncement>;
+
+    bool skip_remote_announcement(
+            const CacheChange_t& change,
+            const std::set<std::string>& local_topics,
+            SkippedAnnouncementMap& skipped);
+
+    void take_skipped_announcements(
+            const std::string& topic_name,
+            SkippedAnnouncementMap& skipped,
+            std::vector<std::vector<octet>>& announcements);
+
+    //! Whether the announcements of remote endpoints are filtered by the topics of the local endpoints
+    bool interest_filter_ = false;
+
+    //! Protects the local topics and the announcements kept aside
+    std::mutex interest_mutex_;
+
+    //! Topics with local readers. Topics are never removed, so remote writers on them are always processed.
+    std::set<std::string> local_reader_topics_;
+
+    //! Topics with local writers. Topics are never removed, so remote readers on them are always processed.
+    std::set<std::string> local_writer_topics_;
+
+    //! Announcements of remote writers on topics without local readers
+    SkippedAnnouncementMap skipped_writers_;
+
+    //! Announcements of remote readers on topics without local writers
+    SkippedAnnouncementMap skipped_readers_;
+
 protected:
 
     std::mutex temp_data_lock_;
@@ -25,6 +25,7 @@
 #include <functional>
 
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
 #include <fastdds/rtps/builtin/data/ReaderProxyData.h>
 #include <fastdds/rtps/builtin/data/WriterProxyData.h>
@@ -123,6 +124,29 @@ public:
             bool dispose = false,
             WriteParams& wparams = WriteParams::WRITE_PARAM_DEFAULT);
 
+    /**
+     * Add builtin endpoints to the ones of the local participant, announcing it if they were not already there.
+     * Used for the builtin endpoints created lazily (see RTPSParticipantImpl::lazy_builtin_endpoints).
+     * @param endpoints Mask of the builtin endpoints created.
+     */
+    void add_builtin_endpoints(
+            uint32_t endpoints);
+
+    /**
+     * Match the WLP and TypeLookup builtin endpoints with a remote participant that has announced
+     * a different mask of builtin endpoints.
+     * @param pdata ParticipantProxyData of the remote participant, already updated.
+     */
+    void builtin_endpoints_changed(
+            const ParticipantProxyData& pdata);
+
+    /**
+     * Get the memory of the proxies of the discovered participants, readers and writers.
+     * @param [out] usage Bytes of all the allocated proxies, and bytes of the ones not kept in the pools.
+     */
+    void get_memory_usage(
+            MemoryUsage& usage);
+
     //!Stop the RTPSParticipantAnnouncement (only used in tests).
     virtual void stopParticipantAnnouncement();
 
@@ -175,6 +199,20 @@ public:
             const GUID_t& reader,
             ReaderProxyData& rdata);
 
+    /**
+     * Check if the information of a remote reader was read from the same announcement.
+     * The writer and sequence number of the change are compared first, and its payload is only hashed when they
+     * differ.
+     * @param reader GUID_t of the reader.
+     * @param change Received announcement.
+     * @param [out] digest Digest of the received announcement. Always computed when false is returned.
+     * @return True if the reader is known and the announcement carries no new information.
+     */
+    bool has_reader_announcement(
+            const GUID_t& reader,
+            const CacheChange_t& change,
+            AnnouncementDigest& digest);
+
     /**
      * This method returns whether a WriterProxyData exists among the registered RTPSParticipants
      * (including the local RTPSParticipant).
@@ -195,6 +233,20 @@ public:
             const GUID_t& writer,
             WriterProxyData& wdata);
 
+    /**
+     * Check if the information of a remote writer was read from the same announcement.
+     * The writer and sequence number of the change are compared first, and its payload is only hashed when they
+     * differ.
+     * @param writer GUID_t of the writer.
+     * @param change Received announcement.
+     * @param [out] digest Digest of the received announcement. Always computed when false is returned.
+     * @return True if the writer is known and the announcement carries no new information.
+     */
+    bool has_writer_announcement(
+            const GUID_t& writer,
+            const CacheChange_t& change,
+            AnnouncementDigest& digest);
+
     /**
      * This method returns the name of a participant if it is found among the registered RTPSParticipants.
      * @param [in]  guid  GUID_t of the RTPSParticipant we are looking for.
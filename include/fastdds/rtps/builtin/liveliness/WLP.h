@@ -174,6 +174,13 @@ private:
      */
     bool createEndpoints();
 
+    /**
+     * Create the endpoints used in the WLP when they were not created on initialization
+     * (see RTPSParticipantImpl::lazy_builtin_endpoints), matching them with the known participants.
+     * @return true if correct.
+     */
+    bool enable_endpoints();
+
     //! Minimum time among liveliness periods of automatic writers, in milliseconds
     double min_automatic_ms_;
     //! Minimum time among liveliness periods of manual by participant writers, in milliseconds
@@ -57,6 +57,8 @@ struct CacheChangeReaderInfo_t
 {
     //!Reception TimeStamp (only used in Readers)
     Time_t receptionTimestamp;
+    //!Ownership strength of the writer when the change was received (only used in Readers)
+    uint32_t writer_ownership_strength;
 };
 
 /**
@@ -73,10 +75,11 @@ struct RTPS_DllAPI CacheChange_t
     InstanceHandle_t instanceHandle{};
     //!SequenceNumber of the change
     SequenceNumber_t sequenceNumber{};
-    //!Serialized Payload associated with the change.
-    SerializedPayload_t serializedPayload{};
     //!Indicates if the cache has been read (only used in READERS)
     bool isRead = false;
+    // The fields above are the ones checked when scanning a history, and share the first cache line.
+    //!Serialized Payload associated with the change.
+    SerializedPayload_t serializedPayload{};
     //!Source TimeStamp
     Time_t sourceTimestamp{};
     union
@@ -128,6 +131,7 @@ struct RTPS_DllAPI CacheChange_t
         sequenceNumber = ch_ptr->sequenceNumber;
         sourceTimestamp = ch_ptr->sourceTimestamp;
         reader_info.receptionTimestamp = ch_ptr->reader_info.receptionTimestamp;
+        reader_info.writer_ownership_strength = ch_ptr->reader_info.writer_ownership_strength;
         write_params = ch_ptr->write_params;
         isRead = ch_ptr->isRead;
         fragment_size_ = ch_ptr->fragment_size_;
@@ -151,6 +155,7 @@ struct RTPS_DllAPI CacheChange_t
         sequenceNumber = ch_ptr->sequenceNumber;
         sourceTimestamp = ch_ptr->sourceTimestamp;
         reader_info.receptionTimestamp = ch_ptr->reader_info.receptionTimestamp;
+        reader_info.writer_ownership_strength = ch_ptr->reader_info.writer_ownership_strength;
         write_params = ch_ptr->write_params;
         isRead = ch_ptr->isRead;
 
@@ -0,0 +1,134 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MemoryUsage.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_COMMON_MEMORYUSAGE_HPP_
+#define _FASTDDS_RTPS_COMMON_MEMORYUSAGE_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include <fastdds/rtps/common/Guid.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Bytes allocated by a component.
+ *
+ * Figures are computed from the sizes of the allocated elements, so they do not include the overhead of the
+ * heap allocator. Allocations which are not given back to a pool report the same figure in both fields.
+ * @ingroup COMMON_MODULE
+ */
+struct MemoryUsage
+{
+    //! Bytes allocated, whether they are being used or kept in a pool for later use
+    uint64_t reserved = 0;
+
+    //! Bytes of the allocations being used
+    uint64_t in_use = 0;
+
+    MemoryUsage& operator +=(
+            const MemoryUsage& other)
+    {
+        reserved += other.reserved;
+        in_use += other.in_use;
+        return *this;
+    }
+
+};
+
+/**
+ * Bytes allocated by an endpoint.
+ * @ingroup COMMON_MODULE
+ */
+struct EndpointMemoryUsage
+{
+    //! GUID of the endpoint
+    GUID_t guid;
+
+    //! Cache changes of the history, from its change pool
+    MemoryUsage history;
+
+    //! Serialized payloads referenced by the history. As payload pools are shared by the endpoints of the same
+    //! topic, their memory is also accounted at participant level (see ParticipantMemoryUsage::payload_pools).
+    MemoryUsage payloads;
+
+    //! Proxies of the matched endpoints, including their per-change state
+    MemoryUsage matched_proxies;
+
+    //! @return The sum of the memory of all the subsystems of the endpoint.
+    MemoryUsage total() const
+    {
+        MemoryUsage ret = history;
+        ret += payloads;
+        ret += matched_proxies;
+        return ret;
+    }
+
+};
+
+/**
+ * Bytes allocated by a participant, by subsystem, and by each of its endpoints.
+ * @ingroup COMMON_MODULE
+ */
+struct ParticipantMemoryUsage
+{
+    //! GUID of the participant
+    GUID_t guid;
+
+    //! Proxies of the discovered participants, readers and writers (PDP/EDP pools)
+    MemoryUsage discovery;
+
+    //! Buffers used to build the sent messages (SendBuffersManager pool)
+    MemoryUsage send_buffers;
+
+    //! Reception buffers of the opened channels and shared memory segments of the transports
+    MemoryUsage transports;
+
+    //! Payload pools of the endpoints, accounted once per pool
+    MemoryUsage payload_pools;
+
+    //! Sum of the memory of the builtin endpoints, not including their payload pools
+    MemoryUsage builtin_endpoints;
+
+    //! Sum of the memory of the user endpoints, not including their payload pools
+    MemoryUsage user_endpoints;
+
+    //! Memory of each user endpoint
+    std::vector<EndpointMemoryUsage> endpoints;
+
+    //! @return The sum of the memory of all the subsystems of the participant.
+    MemoryUsage total() const
+    {
+        MemoryUsage ret = discovery;
+        ret += send_buffers;
+        ret += transports;
+        ret += payload_pools;
+        ret += builtin_endpoints;
+        ret += user_endpoints;
+        return ret;
+    }
+
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_COMMON_MEMORYUSAGE_HPP_
@@ -0,0 +1,208 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RealtimeMonitor.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_COMMON_REALTIMEMONITOR_HPP_
+#define _FASTDDS_RTPS_COMMON_REALTIMEMONITOR_HPP_
+
+#include <fastrtps/fastrtps_dll.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Event that breaks the latency budget of a real-time path.
+ * The pointers are only valid during the call to the violation hook.
+ */
+struct RealtimeViolation
+{
+    enum Kind
+    {
+        //! Memory was allocated on a real-time path.
+        ALLOCATION,
+        //! Waiting for a lock on a real-time path took longer than the lock wait budget.
+        LOCK_WAIT
+    };
+
+    //! Kind of violation.
+    Kind kind;
+
+    //! Name of the real-time path where the violation happened (e.g. "DataWriter::write").
+    const char* path;
+
+    //! Bytes allocated, for ALLOCATION violations. 0 when the allocator does not provide it.
+    size_t size;
+
+    //! Nanoseconds waited for the lock, for LOCK_WAIT violations.
+    int64_t wait_ns;
+
+    //! Return addresses of the stack of the offending thread. Empty when the platform cannot provide them.
+    void* const* stack_trace;
+
+    //! Number of entries in stack_trace.
+    uint32_t stack_depth;
+};
+
+/**
+ * Reports the allocations and long lock waits that happen on the real-time paths of the participants with the
+ * real-time mode enabled (property fastdds.realtime_mode set to "true").
+ *
+ * Writing, reading or taking, and processing received messages are real-time paths. With PREALLOCATED_MEMORY_MODE
+ * histories, the library avoids allocating on them once the entities are enabled, except for:
+ * - Logging, which queues every entry it does not filter out.
+ * - The std::function callbacks of the application, and whatever they capture.
+ * - Buffers that grow with the traffic and are then reused, like the ones gathering the control messages to
+ *   aggregate. They allocate until they reach the size the traffic needs.
+ *
+ * So this is not a guarantee that nothing allocates: it is how the remaining allocations are found and budgeted.
+ * Lock waits are measured by the library itself. Allocations are not seen by the library, so the allocator in use
+ * (e.g. a replaced global operator new, or a malloc interposer) must call report_allocation, which only reports
+ * the allocations happening on a real-time path. Without it, allocations are not detected at all.
+ */
+class RealtimeMonitor
+{
+public:
+
+    //! Function called for every violation. It is called on the offending thread, and should not allocate.
+    using ViolationHook = void (*)(
+        const RealtimeViolation& violation);
+
+    //! Maximum number of stack frames provided on a violation.
+    static constexpr uint32_t max_stack_depth = 32;
+
+    /**
+     * Install the function called on every violation.
+     * @param hook Function to call, or nullptr to stop reporting violations.
+     * @param lock_wait_budget Lock waits longer than this are reported as LOCK_WAIT violations.
+     */
+    RTPS_DllAPI static void set_violation_hook(
+            ViolationHook hook,
+            std::chrono::nanoseconds lock_wait_budget = std::chrono::microseconds(100));
+
+    /**
+     * Report an allocation. It is notified to the violation hook only when the calling thread is on a real-time
+     * path.
+     * @param size Bytes allocated.
+     */
+    RTPS_DllAPI static void report_allocation(
+            size_t size);
+
+    /**
+     * Report the time the calling thread waited for a lock. It is notified to the violation hook only when the
+     * calling thread is on a real-time path and the wait exceeds the lock wait budget.
+     * @param wait Time waited.
+     */
+    RTPS_DllAPI static void report_lock_wait(
+            std::chrono::nanoseconds wait);
+
+    //! @return The real-time path the calling thread is on, nullptr when it is not on a real-time path.
+    RTPS_DllAPI static const char* current_path();
+
+    /**
+     * Print the stack trace of a violation, resolving the symbols when the platform allows it.
+     * @param violation Violation whose stack trace is printed.
+     * @param fd File descriptor where the stack trace is written.
+     */
+    RTPS_DllAPI static void print_stack_trace(
+            const RealtimeViolation& violation,
+            int fd);
+
+    /**
+     * Lock a lock object, reporting the wait when the calling thread is on a real-time path.
+     * @param lock Lock object, not owning its mutex yet.
+     */
+    template<typename Lock>
+    static void lock(
+            Lock& lock)
+    {
+        if (nullptr == current_path() || lock.try_lock())
+        {
+            if (!lock.owns_lock())
+            {
+                lock.lock();
+            }
+            return;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        lock.lock();
+        report_lock_wait(std::chrono::steady_clock::now() - start);
+    }
+
+    /**
+     * Try to lock a lock object until a time point, reporting the wait when the calling thread is on a real-time
+     * path.
+     * @param lock Lock object, not owning its mutex yet.
+     * @param max_blocking_time Time point when the wait is abandoned.
+     * @return Whether the lock object owns its mutex.
+     */
+    template<typename Lock>
+    static bool try_lock_until(
+            Lock& lock,
+            const std::chrono::steady_clock::time_point& max_blocking_time)
+    {
+        if (nullptr == current_path() || lock.try_lock())
+        {
+            return lock.owns_lock() || lock.try_lock_until(max_blocking_time);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        bool ret_val = lock.try_lock_until(max_blocking_time);
+        report_lock_wait(std::chrono::steady_clock::now() - start);
+        return ret_val;
+    }
+
+    /**
+     * Marks the calling thread as being on a real-time path during its lifetime.
+     * Nested scopes keep the path of the outermost one.
+     */
+    class Scope
+    {
+    public:
+
+        /**
+         * @param enabled Whether the real-time mode is enabled for the entity running the path.
+         * @param path Name of the path. It should be a string literal.
+         */
+        RTPS_DllAPI Scope(
+                bool enabled,
+                const char* path);
+
+        RTPS_DllAPI ~Scope();
+
+        Scope(
+                const Scope&) = delete;
+
+        Scope& operator =(
+                const Scope&) = delete;
+
+    private:
+
+        bool entered_;
+    };
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif /* _FASTDDS_RTPS_COMMON_REALTIMEMONITOR_HPP_ */
@@ -0,0 +1,213 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RoundTripTimeEstimator.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_COMMON_ROUNDTRIPTIMEESTIMATOR_HPP_
+#define _FASTDDS_RTPS_COMMON_ROUNDTRIPTIMEESTIMATOR_HPP_
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <algorithm>
+#include <chrono>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Configuration of the adaptive timing of a reliable endpoint.
+ * When enabled, the intervals of the reliability protocol are computed from the round trip time measured
+ * with each matched endpoint, and kept inside [min_interval, max_interval].
+ */
+struct AdaptiveTimingSettings
+{
+    //! Whether the adaptive timing is enabled
+    bool enabled = false;
+
+    //! Lower bound of the computed intervals
+    std::chrono::milliseconds min_interval {1};
+
+    //! Upper bound of the computed intervals
+    std::chrono::milliseconds max_interval {3000};
+
+    /**
+     * @param interval Computed interval.
+     * @return The interval, kept inside the bounds, in milliseconds.
+     */
+    double bounded_millisec(
+            std::chrono::duration<double, std::milli> interval) const
+    {
+        double ms = std::max(interval.count(), static_cast<double>(min_interval.count()));
+        return std::min(ms, static_cast<double>(max_interval.count()));
+    }
+
+};
+
+/**
+ * Round trip time estimation of the request / answer exchanges with a remote endpoint,
+ * using the smoothing algorithm of RFC 6298.
+ * It also estimates the ratio of requests which never got an answer.
+ * @ingroup COMMON_MODULE
+ */
+class RoundTripTimeEstimator
+{
+public:
+
+    using clock = std::chrono::steady_clock;
+
+    //! Forgets all the measurements.
+    void reset()
+    {
+        request_pending_ = false;
+        has_last_request_ = false;
+        has_estimation_ = false;
+        smoothed_rtt_ = clock::duration::zero();
+        rtt_variation_ = clock::duration::zero();
+        loss_ratio_ = 0.0f;
+    }
+
+    /**
+     * Records that a request expecting an answer has been sent.
+     * Answers do not tell which request they belong to, so a request is only measured when its answer cannot be
+     * taken for the answer to another one: no other request may have been sent during the last timeout(),
+     * unless it has already been answered.
+     * A request sent while another one is being measured makes that measurement ambiguous, so it is dropped,
+     * unless it has been waiting for more than timeout(), in which case it is accounted as lost.
+     * @param now Time the request was sent.
+     * @param measure Whether the request should be measured. When false, it is only taken into account
+     * to avoid ambiguous measurements.
+     */
+    void request_sent(
+            const clock::time_point& now,
+            bool measure = true)
+    {
+        bool quiet = !has_estimation_ || !has_last_request_ || now - last_request_time_ > timeout();
+        has_last_request_ = true;
+        last_request_time_ = now;
+
+        if (request_pending_)
+        {
+            request_pending_ = false;
+            if (has_estimation_ && now - request_time_ > timeout())
+            {
+                loss_ratio_ += (1.0f - loss_ratio_) * loss_gain;
+            }
+        }
+
+        if (measure && quiet)
+        {
+            request_pending_ = true;
+            request_time_ = now;
+        }
+    }
+
+    /**
+     * Records the answer to the pending request, if any.
+     * @param now Time the answer was received.
+     * @return true when a new sample has been taken.
+     */
+    bool answer_received(
+            const clock::time_point& now)
+    {
+        if (!request_pending_)
+        {
+            return false;
+        }
+
+        request_pending_ = false;
+        loss_ratio_ -= loss_ratio_ * loss_gain;
+
+        // No other answer is expected when the last request was the measured one
+        if (last_request_time_ == request_time_)
+        {
+            has_last_request_ = false;
+        }
+
+        clock::duration sample = now - request_time_;
+        if (!has_estimation_)
+        {
+            smoothed_rtt_ = sample;
+            rtt_variation_ = sample / 2;
+            has_estimation_ = true;
+        }
+        else
+        {
+            clock::duration error = (smoothed_rtt_ > sample) ? smoothed_rtt_ - sample : sample - smoothed_rtt_;
+            rtt_variation_ = (rtt_variation_ * 3 + error) / 4;
+            smoothed_rtt_ = (smoothed_rtt_ * 7 + sample) / 8;
+        }
+
+        return true;
+    }
+
+    //! @return Whether at least one sample has been taken.
+    bool has_estimation() const
+    {
+        return has_estimation_;
+    }
+
+    //! @return Smoothed round trip time.
+    clock::duration smoothed_rtt() const
+    {
+        return smoothed_rtt_;
+    }
+
+    //! @return Variation of the round trip time.
+    clock::duration rtt_variation() const
+    {
+        return rtt_variation_;
+    }
+
+    //! @return Time after which an answer is not expected anymore.
+    clock::duration timeout() const
+    {
+        return smoothed_rtt_ + rtt_variation_ * 4;
+    }
+
+    //! @return Estimated ratio, between 0 and 1, of requests without answer.
+    float loss_ratio() const
+    {
+        return loss_ratio_;
+    }
+
+private:
+
+    static constexpr float loss_gain = 0.125f;
+
+    bool request_pending_ = false;
+
+    clock::time_point request_time_;
+
+    bool has_last_request_ = false;
+
+    clock::time_point last_request_time_;
+
+    bool has_estimation_ = false;
+
+    clock::duration smoothed_rtt_ = clock::duration::zero();
+
+    clock::duration rtt_variation_ = clock::duration::zero();
+
+    float loss_ratio_ = 0.0f;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // _FASTDDS_RTPS_COMMON_ROUNDTRIPTIMEESTIMATOR_HPP_
@@ -50,6 +50,17 @@ struct FlowControllerDescriptor
     //! Period of time on which the flow controller is allowed to send max_bytes_per_period.
     //! Default value: 100ms.
     uint64_t period_ms = 100;
+
+    //! Maximum number of bytes to be sent to network back to back (depth of the token bucket).
+    //!
+    //! Only used when max_bytes_per_period is not 0. When not 0, the samples are paced with a token bucket instead
+    //! of sending max_bytes_per_period in a single burst at the beginning of each period: the bucket is refilled
+    //! continuously with nanosecond resolution at a rate of max_bytes_per_period every period_ms, and a sample (or
+    //! fragment) is sent as soon as there are tokens for it. Samples are fragmented to fit in the bucket.
+    //! Values lower than RTPSMESSAGE_COMMON_RTPS_PAYLOAD_SIZE cannot hold a RTPS message and are raised to it.
+    //! Range of bytes: [0, 2147483647];
+    //! Default value: 0 (no pacing).
+    int32_t max_burst_bytes = 0;
 };
 
 } // namespace rtps
@@ -19,6 +19,8 @@
 #ifndef _FASTDDS_RTPS_HISTORY_ICHANGEPOOL_H_
 #define _FASTDDS_RTPS_HISTORY_ICHANGEPOOL_H_
 
+#include <fastdds/rtps/common/MemoryUsage.hpp>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -63,6 +65,21 @@ public:
      */
     virtual bool release_cache(
             CacheChange_t* cache_change) = 0;
+
+    /**
+     * @brief Get the memory allocated by the pool for cache changes.
+     *
+     * @param [out] usage   Bytes of all the allocated cache changes, and bytes of the ones reserved from the pool.
+     *
+     * @returns false when the pool does not keep track of its memory, true otherwise
+     */
+    virtual bool get_memory_usage(
+            MemoryUsage& usage)
+    {
+        static_cast<void>(usage);
+        return false;
+    }
+
 };
 
 } /* namespace rtps */
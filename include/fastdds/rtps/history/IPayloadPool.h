@@ -19,6 +19,7 @@
 #ifndef _FASTDDS_RTPS_HISTORY_IPAYLOADPOOL_H_
 #define _FASTDDS_RTPS_HISTORY_IPAYLOADPOOL_H_
 
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/SerializedPayload.h>
 
 #include <cstdint>
@@ -122,6 +123,21 @@ public:
      */
     virtual bool release_payload(
             CacheChange_t& cache_change) = 0;
+
+    /**
+     * @brief Get the memory allocated by the pool for serialized payloads.
+     *
+     * @param [out] usage  Bytes reserved by the pool, and bytes of the payloads given to cache changes.
+     *
+     * @returns false when the pool does not keep track of its memory, true otherwise
+     */
+    virtual bool get_memory_usage(
+            MemoryUsage& usage)
+    {
+        static_cast<void>(usage);
+        return false;
+    }
+
 };
 
 } /* namespace rtps */
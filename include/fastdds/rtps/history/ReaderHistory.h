@@ -63,6 +63,25 @@ public:
             CacheChange_t* change,
             size_t);
 
+    /**
+     * Virtual method that is called when a new change is received, before a CacheChange_t is reserved for it.
+     * In this implementation this method always accepts the change. The user can overload it in case some
+     * changes can be discarded without storing them, avoiding the copy of their payload.
+     * No Thread Safe.
+     * @param change Pointer to the change, as received. Its instance handle may be updated.
+     * @return false if the change will never be added to the history.
+     */
+    RTPS_DllAPI virtual bool can_change_be_added_nts(
+            CacheChange_t* change);
+
+    /**
+     * Virtual method that is called when a writer is unmatched from the reader, after removing its changes.
+     * In this implementation this method does nothing.
+     * @param writer_guid GUID of the unmatched writer.
+     */
+    RTPS_DllAPI virtual void writer_unmatched(
+            const GUID_t& writer_guid);
+
     /**
      * Add a CacheChange_t to the ReaderHistory.
      * @param a_change Pointer to the CacheChange to add.
@@ -71,6 +71,9 @@ public:
     void removeEndpoint(
             Endpoint* to_remove);
 
+    //! @return GuidPrefix of the RTPSParticipant this receiver belongs to.
+    const GuidPrefix_t& participant_guid_prefix() const;
+
 private:
 
     std::mutex mtx_;
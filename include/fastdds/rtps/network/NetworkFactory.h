@@ -76,6 +76,18 @@ public:
             fastdds::rtps::SendResourceList&,
             const Locator_t& locator);
 
+    /**
+     * Walks over the list of transports, opening the channels that send through the given locator the messages of
+     * the writers with a transport priority.
+     * @param locator Locator through which to send.
+     * @param transport_priority Value of the TransportPriorityQosPolicy of the writers.
+     * @return true if any transport has a specific channel for the priority.
+     */
+    bool build_priority_send_resources(
+            fastdds::rtps::SendResourceList&,
+            const Locator_t& locator,
+            int32_t transport_priority);
+
     /**
      * Walks over the list of transports, opening every possible channel that we can listen to
      * from the given locator, and returns a vector of Receiver Resources for this goal.
@@ -58,6 +58,9 @@ public:
 
     /**
      * Register a MessageReceiver object to be called upon reception of data.
+     * Several message receivers are registered when the resource is shared by several participants.
+     * Then, messages whose submessages are all directed to specific participants are only given to
+     * their message receivers.
      * @param receiver The message receiver to register.
      */
     void RegisterReceiver(MessageReceiver* receiver);
@@ -97,8 +100,18 @@ private:
     bool mValid; // Post-construction validity check for the NetworkFactory
 
     std::mutex mtx;
-    MessageReceiver* receiver;
+    std::vector<MessageReceiver*> receivers_;
+    //! Whether each receiver is a destination of the message being received, when there are several receivers.
+    //! Sized when the receivers are registered, so receiving does not allocate.
+    std::vector<uint8_t> is_destination_;
     uint32_t max_message_size_;
+
+    void process_message(
+            MessageReceiver* rcv,
+            const octet* data,
+            const uint32_t size,
+            const Locator_t& localLocator,
+            const Locator_t& remoteLocator);
 };
 
 } // namespace rtps
@@ -23,6 +23,7 @@
 #include <memory>
 #include <fastrtps/fastrtps_dll.h>
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
 #include <fastrtps/qos/ReaderQos.h>
 #include <fastrtps/qos/WriterQos.h>
@@ -248,6 +249,13 @@ public:
      */
     void enable();
 
+    /**
+     * @brief Get the memory allocated by this participant.
+     * @param [out] usage Memory of the participant by subsystem, and of each of its user endpoints.
+     */
+    void get_memory_usage(
+            ParticipantMemoryUsage& usage) const;
+
 #if HAVE_SECURITY
 
     /**
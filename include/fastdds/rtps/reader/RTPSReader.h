@@ -24,6 +24,7 @@
 #include <fastdds/rtps/Endpoint.h>
 #include <fastdds/rtps/attributes/ReaderAttributes.h>
 #include <fastdds/rtps/builtin/data/WriterProxyData.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/SequenceNumber.h>
 #include <fastdds/rtps/common/Time_t.h>
 #include <fastdds/rtps/history/ReaderHistory.h>
@@ -115,6 +116,13 @@ public:
     RTPS_DllAPI virtual bool matched_writer_is_matched(
             const GUID_t& writer_guid) = 0;
 
+    /**
+     * Get the memory allocated by this reader.
+     * @param [out] usage Memory of the history, the payloads and the matched writers of the reader.
+     */
+    RTPS_DllAPI virtual void get_memory_usage(
+            EndpointMemoryUsage& usage) const;
+
     /**
      * Processes a new DATA message. Previously the message must have been accepted by function acceptMsgDirectedTo.
      *
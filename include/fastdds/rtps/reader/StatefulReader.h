@@ -22,6 +22,7 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
 #include <fastdds/rtps/reader/RTPSReader.h>
+#include <fastdds/rtps/common/RoundTripTimeEstimator.hpp>
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
 #include <fastdds/rtps/common/CDRMessage_t.h>
 #include <fastdds/rtps/messages/RTPSMessageGroup.h>
@@ -101,6 +102,9 @@ public:
     bool matched_writer_is_matched(
             const GUID_t& writer_guid) override;
 
+    void get_memory_usage(
+            EndpointMemoryUsage& usage) const override;
+
     /**
      * Look for a specific WriterProxy.
      * @param writerGUID GUID_t of the writer we are looking for.
@@ -256,7 +260,7 @@ public:
      * @param heartbeat_was_final Final flag of the last received heartbeat.
      */
     void send_acknack(
-            const WriterProxy* writer,
+            WriterProxy* writer,
             const RTPSMessageSenderInterface* sender,
             bool heartbeat_was_final);
 
@@ -340,6 +344,14 @@ private:
             const GUID_t& writerGUID,
             bool is_payload_pool_lost = false);
 
+    /**
+     * Reports the round trip time to a writer when a NACK sent to it has been answered.
+     * @param writer Proxy of the writer.
+     * @remarks Non thread-safe.
+     */
+    void report_round_trip_time_nts(
+            WriterProxy* writer);
+
     //! Acknack Count
     uint32_t acknack_count_;
     //! NACKFRAG Count
@@ -356,6 +368,8 @@ private:
     bool disable_positive_acks_;
     //! False when being destroyed
     bool is_alive_;
+    //! Adaptive timing configuration
+    AdaptiveTimingSettings adaptive_timing_;
 };
 
 } /* namespace rtps */
@@ -98,6 +98,9 @@ public:
     bool matched_writer_is_matched(
             const GUID_t& writer_guid) override;
 
+    void get_memory_usage(
+            EndpointMemoryUsage& usage) const override;
+
     /**
      * Method to indicate the reader that some change has been removed due to HistoryQos requirements.
      * @param change Pointer to the CacheChange_t.
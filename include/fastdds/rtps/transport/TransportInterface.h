@@ -131,6 +131,26 @@ public:
             SendResourceList& sender_resource_list,
             const Locator&) = 0;
 
+    /**
+     * Opens the channel used to send to the given locator the messages of the writers with a transport priority.
+     * Transports which do not distinguish priorities keep the default implementation, and those messages are sent
+     * through the channels opened with OpenOutputChannel.
+     * @param sender_resource_list List where the new sender resources are added.
+     * @param locator Locator the channel has to reach.
+     * @param transport_priority Value of the TransportPriorityQosPolicy of the writers.
+     * @return true if the transport has a specific channel for the priority.
+     */
+    virtual bool open_priority_output_channel(
+            SendResourceList& sender_resource_list,
+            const Locator& locator,
+            int32_t transport_priority)
+    {
+        (void)sender_resource_list;
+        (void)locator;
+        (void)transport_priority;
+        return false;
+    }
+
     /** Opens an input channel to receive incomming connections.
      *   If there is an existing channel it registers the receiver interface.
      */
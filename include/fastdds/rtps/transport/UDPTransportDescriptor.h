@@ -15,6 +15,9 @@
 #ifndef _FASTDDS_UDP_TRANSPORT_DESCRIPTOR_
 #define _FASTDDS_UDP_TRANSPORT_DESCRIPTOR_
 
+#include <cstdint>
+#include <map>
+
 #include <fastdds/rtps/transport/SocketTransportDescriptor.h>
 #include <fastrtps/fastrtps_dll.h>
 
@@ -31,6 +34,8 @@ namespace rtps {
  * immediately if the buffer is full, but no error will be returned to the upper layer. This means that the
  * application will behave as if the datagram is sent and lost.
  *
+ * - transport_priority_dscp: DSCP marking of the datagrams sent by writers with a TransportPriorityQosPolicy.
+ *
  * @ingroup TRANSPORT_MODULE
  */
 struct UDPTransportDescriptor : public SocketTransportDescriptor
@@ -68,6 +73,15 @@ struct UDPTransportDescriptor : public SocketTransportDescriptor
      * datagram. This may hinder performance on high-frequency writers.
      */
     bool non_blocking_send = false;
+
+    /**
+     * DSCP (0 to 63) of the datagrams sent by the writers with each value of TransportPriorityQosPolicy.
+     *
+     * Writers whose priority is found here send through their own sockets, marked with the DSCP (IP_TOS on UDPv4,
+     * IPV6_TCLASS on UDPv6) and, on Linux, with the class selector of the DSCP as SO_PRIORITY (at most 6, as
+     * higher values need CAP_NET_ADMIN). The rest of the writers send through the default sockets.
+     */
+    std::map<int32_t, uint8_t> transport_priority_dscp;
 };
 
 } // namespace rtps
@@ -29,16 +29,33 @@ class TransportInterface;
  *
  * - segment_size_: size of the shared memory segment (in octets).
  *
+ * - max_segment_size_: maximum size (in octets) the segment can grow to, adding extents of segment_size_ octets.
+ *   0 means the segment does not grow.
+ *
+ * - extent_idle_timeout_ms_: time (ms) an extent must go without allocations before it is released.
+ *
  * - port_queue_capacity_: size of the listening port (in messages).
  *
  * - healthy_check_timeout_ms_: timeout for the health check of ports (ms).
  *
  * - rtps_dump_file_: full path of the protocol dump file.
  *
+ * - huge_pages_: whether the segment should be backed by huge pages, when the system supports them.
+ *
+ * - prefault_segment_: whether all the pages of the segment are faulted in when it is created.
+ *
+ * - numa_node_: NUMA node where the pages of the segment are placed.
+ *
  * @ingroup TRANSPORT_MODULE
  */
 struct SharedMemTransportDescriptor : public TransportDescriptorInterface
 {
+    //! Value of numa_node() for not binding the segment to any NUMA node
+    static constexpr int32_t NUMA_NODE_NONE = -1;
+
+    //! Value of numa_node() for binding the segment to the NUMA node of the thread creating it
+    static constexpr int32_t NUMA_NODE_LOCAL = -2;
+
     //! Destructor
     virtual ~SharedMemTransportDescriptor() = default;
 
@@ -74,6 +91,34 @@ struct SharedMemTransportDescriptor : public TransportDescriptorInterface
         segment_size_ = segment_size;
     }
 
+    //! Return the maximum size the shared memory segment can grow to (0 means no growth)
+    RTPS_DllAPI uint32_t max_segment_size() const
+    {
+        return max_segment_size_;
+    }
+
+    //! Set the maximum size the shared memory segment can grow to.
+    //! The segment grows in steps of segment_size(), and shrinks back when the extra memory is idle.
+    RTPS_DllAPI void max_segment_size(
+            uint32_t max_segment_size)
+    {
+        max_segment_size_ = max_segment_size;
+    }
+
+    //! Return the time (in ms) an extent must go without allocations before it is released
+    RTPS_DllAPI uint32_t extent_idle_timeout_ms() const
+    {
+        return extent_idle_timeout_ms_;
+    }
+
+    //! Set the time (in ms) an extent must go without allocations before it is released.
+    //! Extents are only released once all their buffers are released.
+    RTPS_DllAPI void extent_idle_timeout_ms(
+            uint32_t extent_idle_timeout_ms)
+    {
+        extent_idle_timeout_ms_ = extent_idle_timeout_ms;
+    }
+
     //! Return the maximum size of a single message in the transport (in octets)
     virtual uint32_t max_message_size() const override
     {
@@ -126,6 +171,46 @@ struct SharedMemTransportDescriptor : public TransportDescriptorInterface
         rtps_dump_file_ = rtps_dump_file;
     }
 
+    //! Return whether the segment should be backed by huge pages
+    RTPS_DllAPI bool huge_pages() const
+    {
+        return huge_pages_;
+    }
+
+    //! Set whether the segment should be backed by huge pages.
+    //! Falls back to regular pages when the system does not support them.
+    RTPS_DllAPI void huge_pages(
+            bool huge_pages)
+    {
+        huge_pages_ = huge_pages;
+    }
+
+    //! Return whether the pages of the segment are faulted in on creation
+    RTPS_DllAPI bool prefault_segment() const
+    {
+        return prefault_segment_;
+    }
+
+    //! Set whether the pages of the segment are faulted in on creation
+    RTPS_DllAPI void prefault_segment(
+            bool prefault_segment)
+    {
+        prefault_segment_ = prefault_segment;
+    }
+
+    //! Return the NUMA node where the segment is placed
+    RTPS_DllAPI int32_t numa_node() const
+    {
+        return numa_node_;
+    }
+
+    //! Set the NUMA node where the segment is placed (NUMA_NODE_NONE, NUMA_NODE_LOCAL or a node index)
+    RTPS_DllAPI void numa_node(
+            int32_t numa_node)
+    {
+        numa_node_ = numa_node;
+    }
+
     //! Comparison operator
     RTPS_DllAPI bool operator ==(
             const SharedMemTransportDescriptor& t) const;
@@ -133,9 +218,14 @@ struct SharedMemTransportDescriptor : public TransportDescriptorInterface
 private:
 
     uint32_t segment_size_;
+    uint32_t max_segment_size_;
+    uint32_t extent_idle_timeout_ms_;
     uint32_t port_queue_capacity_;
     uint32_t healthy_check_timeout_ms_;
     std::string rtps_dump_file_;
+    bool huge_pages_;
+    bool prefault_segment_;
+    int32_t numa_node_;
 
 };
 
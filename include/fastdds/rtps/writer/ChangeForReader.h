@@ -60,6 +60,7 @@ public:
             const ChangeForReader_t& ch)
         : status_(ch.status_)
         , seq_num_(ch.seq_num_)
+        , is_relevant_(ch.is_relevant_)
         , change_(ch.change_)
         , unsent_fragments_(ch.unsent_fragments_)
     {
@@ -89,6 +90,7 @@ public:
     {
         status_ = ch.status_;
         seq_num_ = ch.seq_num_;
+        is_relevant_ = ch.is_relevant_;
         change_ = ch.change_;
         unsent_fragments_ = ch.unsent_fragments_;
         return *this;
@@ -114,6 +116,22 @@ public:
         return status_;
     }
 
+    /**
+     * Set whether the change is relevant for the reader, as decided by the writer's filters when the change was
+     * added for it.
+     * @param relevance true if the change is relevant.
+     */
+    void setRelevance(
+            const bool relevance)
+    {
+        is_relevant_ = relevance;
+    }
+
+    bool isRelevant() const
+    {
+        return is_relevant_;
+    }
+
     const SequenceNumber_t getSequenceNumber() const
     {
         return seq_num_;
@@ -199,6 +217,9 @@ private:
     //!Sequence number
     SequenceNumber_t seq_num_;
 
+    //!Relevance of the change for the reader
+    bool is_relevant_ = true;
+
     CacheChange_t* change_;
 
     FragmentNumberSet_t unsent_fragments_;
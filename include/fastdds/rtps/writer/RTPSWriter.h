@@ -28,6 +28,9 @@
 #include <fastdds/rtps/Endpoint.h>
 #include <fastdds/rtps/attributes/HistoryAttributes.h>
 #include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
+#include <fastdds/rtps/common/SequenceNumber.h>
+#include <fastdds/rtps/common/SerializedPayload.h>
 #include <fastdds/rtps/messages/RTPSMessageGroup.h>
 #include "DeliveryRetCode.hpp"
 #include "LocatorSelectorSender.hpp"
@@ -41,6 +44,7 @@ namespace  fastdds {
 namespace rtps {
 
 class FlowController;
+class FlowControllerSampleBatch;
 
 } // namespace rtps
 } // namespace fastdds
@@ -194,6 +198,13 @@ public:
     RTPS_DllAPI virtual void updateAttributes(
             const WriterAttributes& att) = 0;
 
+    /**
+     * Get the memory allocated by this writer.
+     * @param [out] usage Memory of the history, the payloads and the matched readers of the writer.
+     */
+    RTPS_DllAPI virtual void get_memory_usage(
+            EndpointMemoryUsage& usage) const;
+
     /**
      * Get Min Seq Num in History.
      * @return Minimum sequence number in history
@@ -323,6 +334,22 @@ public:
         return m_separateSendingEnabled;
     }
 
+    /**
+     * Set the transport priority of the writer, which selects the send resources its messages leave through.
+     * @param transport_priority Value of the TransportPriorityQosPolicy.
+     */
+    RTPS_DllAPI void set_transport_priority(
+            int32_t transport_priority);
+
+    /**
+     * Get the transport priority of the writer.
+     * @return Value of the TransportPriorityQosPolicy.
+     */
+    int32_t get_transport_priority() const
+    {
+        return transport_priority_;
+    }
+
     /**
      * Process an incoming ACKNACK submessage.
      * @param[in] writer_guid      GUID of the writer the submessage is directed to.
@@ -417,6 +444,45 @@ public:
             LocatorSelectorSender& locator_selector,
             const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) = 0;
 
+    /**
+     * Starts a batch of new changes.
+     * Until end_sample_batch() is called, the changes added to the history are kept in @c batch and then handed to
+     * the flow controller all together, instead of one by one.
+     * @param batch Keeps the changes of the batch. It is owned by the caller.
+     * @note The writer mutex has to be locked before calling this method and kept locked until end_sample_batch().
+     */
+    RTPS_DllAPI void begin_sample_batch(
+            fastdds::rtps::FlowControllerSampleBatch& batch);
+
+    /**
+     * Finishes the current batch of new changes, handing them to the flow controller.
+     * @param batch Keeps the changes of the batch, as passed to begin_sample_batch().
+     * @param max_blocking_time Future timepoint where blocking send should end.
+     * @return false if some change of the batch could not be handed to the flow controller, as happens when a
+     * synchronous flow controller fails to deliver it. true otherwise.
+     */
+    RTPS_DllAPI bool end_sample_batch(
+            fastdds::rtps::FlowControllerSampleBatch& batch,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
+    /**
+     * Whether samples compressed with an algorithm can be sent to the matched readers.
+     * Compression only pays off on the network, so at least one matched reader should be reached through a
+     * transport, and every matched reader should have announced it restores that algorithm.
+     * @param compression_kind Algorithm used to compress the samples.
+     * @return true if the samples of this writer can be compressed.
+     */
+    virtual bool can_send_compressed(
+            uint8_t compression_kind) const = 0;
+
+    /**
+     * Keeps the payload of the next change before it is compressed, so the readers of this process receive it
+     * as it was serialized. It is only kept while the writer has such readers, until the change is delivered to them.
+     * @param payload Payload of the next change, before compressing it.
+     */
+    virtual void keep_uncompressed_payload(
+            const SerializedPayload_t& payload) = 0;
+
     virtual LocatorSelectorSender& get_general_locator_selector() = 0;
 
     virtual LocatorSelectorSender& get_async_locator_selector() = 0;
@@ -450,6 +516,8 @@ protected:
     bool is_async_ = false;
     //!Separate sending activated
     bool m_separateSendingEnabled = false;
+    //! Transport priority, selecting the send resources
+    int32_t transport_priority_ = 0;
 
     //! The liveliness kind of this writer
     LivelinessQosPolicyKind liveliness_kind_;
@@ -458,6 +526,16 @@ protected:
     //! The liveliness announcement period
     Duration_t liveliness_announcement_period_;
 
+    //! Original payload of a compressed change, kept for the readers of this process
+    struct UncompressedPayload
+    {
+        SequenceNumber_t sequence_number;
+        SerializedPayload_t payload;
+    };
+
+    //! Payloads kept by keep_uncompressed_payload. Slots are reused, so their buffers are allocated only once.
+    std::vector<std::unique_ptr<UncompressedPayload>> uncompressed_payloads_;
+
     void add_guid(
             LocatorSelectorSender& locator_selector,
             const GUID_t& remote_guid);
@@ -485,6 +563,34 @@ protected:
     virtual bool change_removed_by_history(
             CacheChange_t* a_change) = 0;
 
+    /**
+     * Stores the payload of the next change before it is compressed.
+     * Payloads kept for changes which were not finally added to the history are dropped.
+     * @param payload Payload of the next change, before compressing it.
+     * @param keep Whether to store it. When false, only the payloads of changes not added are dropped.
+     */
+    void store_uncompressed_payload_nts(
+            const SerializedPayload_t& payload,
+            bool keep);
+
+    /**
+     * Prepares a change for a reader of this process, with its original payload when it was kept.
+     * @param [in]  change Change of the history.
+     * @param [out] uncompressed Receives the information of change and its original payload. The payload is
+     * borrowed, so its data has to be reset to nullptr once it is delivered.
+     * @return true if the original payload of change was kept and uncompressed was filled.
+     */
+    bool get_uncompressed_change_nts(
+            const CacheChange_t& change,
+            CacheChange_t& uncompressed) const;
+
+    /**
+     * Releases the original payload kept for a change, once it has been delivered to the readers of this process.
+     * @param sequence_number Sequence number of the change.
+     */
+    void release_uncompressed_payload_nts(
+            const SequenceNumber_t& sequence_number);
+
     bool is_datasharing_compatible_with(
             const ReaderProxyData& rdata) const;
 
@@ -26,6 +26,7 @@
 #include <fastdds/rtps/common/SequenceNumber.h>
 #include <fastdds/rtps/messages/RTPSMessageGroup.h>
 #include <fastdds/rtps/common/LocatorSelectorEntry.hpp>
+#include <fastdds/rtps/writer/ReaderTimeBasedFilter.hpp>
 
 namespace eprosima {
 namespace fastrtps {
@@ -213,6 +214,34 @@ public:
      */
     void datasharing_notify();
 
+    /**
+     * @return The writer side filter of the TIME_BASED_FILTER requested by the remote reader.
+     */
+    ReaderTimeBasedFilter& time_based_filter()
+    {
+        return time_based_filter_;
+    }
+
+    /**
+     * Set the payload compression algorithms announced by the remote reader.
+     * @param mask Mask with bit (1 << algorithm) set for each algorithm the reader restores.
+     */
+    void accepted_compression(
+            uint8_t mask)
+    {
+        accepted_compression_ = mask;
+    }
+
+    /**
+     * @param compression_kind Algorithm used to compress a payload.
+     * @return Whether the remote reader restores payloads compressed with that algorithm.
+     */
+    bool accepts_compression(
+            uint8_t compression_kind) const
+    {
+        return 0 != (accepted_compression_ & (1u << compression_kind));
+    }
+
     size_t locators_size() const
     {
         if (locator_info_.remote_guid != c_Guid_Unknown && !is_local_reader_)
@@ -242,6 +271,8 @@ private:
     std::vector<GuidPrefix_t> guid_prefix_as_vector_;
     std::vector<GUID_t> guid_as_vector_;
     IDataSharingNotifier* datasharing_notifier_;
+    ReaderTimeBasedFilter time_based_filter_;
+    uint8_t accepted_compression_ = 0;
 };
 
 } /* namespace rtps */
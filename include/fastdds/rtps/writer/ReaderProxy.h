@@ -30,6 +30,8 @@
 #include <fastdds/rtps/common/SequenceNumber.h>
 #include <fastdds/rtps/common/CacheChange.h>
 #include <fastdds/rtps/common/FragmentNumber.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
+#include <fastdds/rtps/common/RoundTripTimeEstimator.hpp>
 
 #include <fastdds/rtps/writer/ChangeForReader.h>
 #include <fastdds/rtps/writer/ReaderLocator.h>
@@ -40,6 +42,7 @@
 #include <mutex>
 #include <set>
 #include <atomic>
+#include <chrono>
 
 namespace eprosima {
 namespace fastrtps {
@@ -210,6 +213,36 @@ public:
     uint32_t perform_acknack_response(
             const std::function<void(ChangeForReader_t& change)>& func);
 
+    /**
+     * Turns a REQUESTED change into UNSENT, so it is served by the delivery in progress.
+     * Used to merge the requests of several readers into a single repair.
+     *
+     * @param seq_num Sequence number of the change.
+     * @return true if the change was REQUESTED, false otherwise.
+     */
+    bool requested_to_unsent(
+            const SequenceNumber_t& seq_num);
+
+    /**
+     * Turns an UNACKNOWLEDGED change into UNDERWAY, restarting the nack supression period.
+     * Used when the change has been resent to a multicast locator this reader listens to, so the NACKs already
+     * sent by the reader do not cause another repair.
+     *
+     * @param seq_num Sequence number of the change.
+     * @return true if the change was UNACKNOWLEDGED, false otherwise.
+     */
+    bool unacknowledged_to_underway(
+            const SequenceNumber_t& seq_num);
+
+    /**
+     * @return The time the oldest request not yet processed by perform_acknack_response was received,
+     * or a default constructed time_point if there are none.
+     */
+    std::chrono::steady_clock::time_point first_pending_request() const
+    {
+        return first_pending_request_;
+    }
+
     /**
      * Call this to inform a change was removed from history.
      * @param seq_num Sequence number of the removed change.
@@ -330,6 +363,16 @@ public:
     bool rtps_is_relevant(
             CacheChange_t* change) const;
 
+    /**
+     * Filter a CacheChange_t using the TIME_BASED_FILTER requested by the reader.
+     * The filter keeps the last relevant change of each instance, so each change should be evaluated only once,
+     * in sequence number order, when it is added to the proxy. The result is kept in its ChangeForReader_t.
+     * @param change
+     * @return true if the change passes the time based filter, false otherwise.
+     */
+    bool time_based_filter_is_relevant(
+            const CacheChange_t& change);
+
     /**
      * Get the highest fully acknowledged sequence number.
      * @return the highest fully acknowledged sequence number.
@@ -361,6 +404,12 @@ public:
         return locator_info_.is_datasharing_reader();
     }
 
+    bool accepts_compression(
+            uint8_t compression_kind) const
+    {
+        return locator_info_.accepts_compression(compression_kind);
+    }
+
     IDataSharingNotifier* datasharing_notifier()
     {
         return locator_info_.datasharing_notifier();
@@ -392,6 +441,25 @@ public:
         active_ = active;
     }
 
+    /**
+     * @return Round trip time estimation of the HEARTBEAT / ACKNACK exchanges with the remote reader.
+     */
+    RoundTripTimeEstimator& round_trip_time()
+    {
+        return round_trip_time_;
+    }
+
+    /**
+     * Add the memory of this proxy and its per-change state.
+     * @param [in,out] usage The memory of the proxy is added to it.
+     */
+    void get_memory_usage(
+            MemoryUsage& usage) const
+    {
+        usage.reserved += sizeof(ReaderProxy) + changes_for_reader_.capacity() * sizeof(ChangeForReader_t);
+        usage.in_use += sizeof(ReaderProxy) + changes_for_reader_.size() * sizeof(ChangeForReader_t);
+    }
+
 private:
 
     //!Is this proxy active? I.e. does it have a remote reader associated?
@@ -424,6 +492,12 @@ private:
 
     bool active_ = false;
 
+    //! Reception time of the oldest request not yet processed
+    std::chrono::steady_clock::time_point first_pending_request_;
+
+    //! Round trip time of the HEARTBEAT / ACKNACK exchanges
+    RoundTripTimeEstimator round_trip_time_;
+
     using ChangeIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::iterator;
     using ChangeConstIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::const_iterator;
 
@@ -0,0 +1,158 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReaderTimeBasedFilter.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_WRITER_READERTIMEBASEDFILTER_HPP_
+#define _FASTDDS_RTPS_WRITER_READERTIMEBASEDFILTER_HPP_
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/InstanceHandle.h>
+#include <fastdds/rtps/common/SequenceNumber.h>
+#include <fastdds/rtps/common/Time_t.h>
+
+#include <cstdint>
+#include <map>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Applies the TIME_BASED_FILTER of a matched reader on the writer side.
+ *
+ * Per instance, a change is only relevant for the reader when its source timestamp is at least
+ * minimum_separation after the one of the last relevant change. Changes that are not ALIVE are
+ * always relevant, so the reader is notified of every change in the state of the instances.
+ */
+class ReaderTimeBasedFilter
+{
+public:
+
+    /**
+     * Start filtering with the minimum separation requested by a matched reader.
+     * @param minimum_separation TimeBasedFilterQosPolicy::minimum_separation of the reader.
+     */
+    void start(
+            const Duration_t& minimum_separation)
+    {
+        stop();
+        update(minimum_separation);
+    }
+
+    /**
+     * Change the minimum separation requested by the reader. Timestamps of the last relevant changes are kept.
+     * @param minimum_separation TimeBasedFilterQosPolicy::minimum_separation of the reader.
+     */
+    void update(
+            const Duration_t& minimum_separation)
+    {
+        minimum_separation_ns_ = minimum_separation.to_ns();
+        if (0 >= minimum_separation_ns_)
+        {
+            minimum_separation_ns_ = 0;
+            last_timestamps_.clear();
+        }
+    }
+
+    //! Stop filtering, forgetting the timestamps of the last relevant changes.
+    void stop()
+    {
+        minimum_separation_ns_ = 0;
+        last_timestamps_.clear();
+        last_sequence_number_ = SequenceNumber_t::unknown();
+        last_result_ = true;
+    }
+
+    //! @return Whether the reader requested a minimum separation between samples.
+    bool is_active() const
+    {
+        return 0 < minimum_separation_ns_;
+    }
+
+    /**
+     * Check whether a change should be sent to the reader.
+     * Calling it again for the same change returns the same result, as the writer may need to evaluate
+     * a change more than once (i.e. when sending its fragments).
+     * @param change Change to be checked. Changes must be evaluated in sequence number order.
+     * @return true if the change is relevant for the reader.
+     */
+    bool is_relevant(
+            const CacheChange_t& change)
+    {
+        if (!is_active())
+        {
+            return true;
+        }
+
+        if (change.sequenceNumber == last_sequence_number_)
+        {
+            return last_result_;
+        }
+
+        last_sequence_number_ = change.sequenceNumber;
+        last_result_ = true;
+
+        if (ALIVE != change.kind)
+        {
+            // The reader will not receive more samples of the instance until it is written again
+            if (NOT_ALIVE_DISPOSED != change.kind)
+            {
+                last_timestamps_.erase(change.instanceHandle);
+            }
+            return true;
+        }
+
+        int64_t timestamp = change.sourceTimestamp.to_ns();
+        auto it = last_timestamps_.find(change.instanceHandle);
+        if (it == last_timestamps_.end())
+        {
+            last_timestamps_.emplace(change.instanceHandle, timestamp);
+        }
+        else if (timestamp < it->second || timestamp - it->second >= minimum_separation_ns_)
+        {
+            // A timestamp going backwards restarts the separation
+            it->second = timestamp;
+        }
+        else
+        {
+            last_result_ = false;
+        }
+
+        return last_result_;
+    }
+
+private:
+
+    //! Minimum separation in nanoseconds, 0 when the reader wants every sample.
+    int64_t minimum_separation_ns_ = 0;
+
+    //! Source timestamp of the last relevant change of each instance.
+    std::map<InstanceHandle_t, int64_t> last_timestamps_;
+
+    //! Last change evaluated, and its result.
+    SequenceNumber_t last_sequence_number_ = SequenceNumber_t::unknown();
+    bool last_result_ = true;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif /* _FASTDDS_RTPS_WRITER_READERTIMEBASEDFILTER_HPP_ */
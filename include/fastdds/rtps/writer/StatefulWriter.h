@@ -25,9 +25,12 @@
 #include <fastdds/rtps/writer/IReaderDataFilter.hpp>
 #include <fastdds/rtps/history/IChangePool.h>
 #include <fastdds/rtps/history/IPayloadPool.h>
+#include <fastdds/rtps/common/RoundTripTimeEstimator.hpp>
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -252,6 +255,9 @@ public:
     void updateAttributes(
             const WriterAttributes& att) override;
 
+    void get_memory_usage(
+            EndpointMemoryUsage& usage) const override;
+
     /**
      * Find a Reader Proxy in this writer.
      * @param[in] readerGuid The GUID_t of the reader.
@@ -291,6 +297,12 @@ public:
                + matched_datasharing_readers_.size();
     }
 
+    bool can_send_compressed(
+            uint8_t compression_kind) const override;
+
+    void keep_uncompressed_payload(
+            const SerializedPayload_t& payload) override;
+
     /**
      * @brief Returns true if disable positive ACKs QoS is enabled
      * @return True if positive acks are disabled, false otherwise
@@ -457,6 +469,22 @@ private:
     void prepare_datasharing_delivery(
             CacheChange_t* change);
 
+    /**
+     * Marks the change as UNDERWAY on the readers not included in the current delivery that listen to one of
+     * the multicast locators selected for it.
+     * @remarks This function is non thread-safe.
+     */
+    void mark_readers_covered_by_multicast_nts(
+            const SequenceNumber_t& seq_num);
+
+    /**
+     * Recomputes the intervals of the reliability protocol after a new round trip time measurement.
+     * @param reader Proxy of the reader whose estimation has changed.
+     * @remarks This function is non thread-safe.
+     */
+    void adapt_timing_to_reader_nts(
+            ReaderProxy* reader);
+
     //! True to disable piggyback heartbeats
     bool disable_heartbeat_piggyback_;
     //! True to disable positive ACKs
@@ -489,6 +517,18 @@ private:
     LocatorSelectorSender locator_selector_general_;
 
     LocatorSelectorSender locator_selector_async_;
+
+    //! True when the repairs requested by several readers are coalesced
+    bool coalesce_repairs_ = false;
+    //! Time the requests of readers only reachable through unicast are held back, so they can be merged
+    std::chrono::milliseconds repair_coalescing_window_ {0};
+    //! Timed event serving the requests held back
+    TimedEvent* repair_window_event_ = nullptr;
+    //! Multicast locators selected for the delivery in progress
+    std::vector<Locator_t> repair_multicast_locators_;
+
+    //! Adaptive timing configuration
+    AdaptiveTimingSettings adaptive_timing_;
 };
 
 } /* namespace rtps */
@@ -131,6 +131,9 @@ public:
         //FOR NOW THERE IS NOTHING TO UPDATE.
     }
 
+    void get_memory_usage(
+            EndpointMemoryUsage& usage) const override;
+
     bool set_fixed_locators(
             const LocatorList_t& locator_list);
 
@@ -174,6 +177,12 @@ public:
                + matched_datasharing_readers_.size();
     }
 
+    bool can_send_compressed(
+            uint8_t compression_kind) const override;
+
+    void keep_uncompressed_payload(
+            const SerializedPayload_t& payload) override;
+
     /*!
      * Tells writer the sample can be sent to the network.
      * This function should be used by a fastdds::rtps::FlowController.
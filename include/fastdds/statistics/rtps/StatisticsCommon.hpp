@@ -19,6 +19,7 @@
 #ifndef _FASTDDS_STATISTICS_RTPS_STATISTICSCOMMON_HPP_
 #define _FASTDDS_STATISTICS_RTPS_STATISTICSCOMMON_HPP_
 
+#include <chrono>
 #include <memory>
 #include <type_traits>
 
@@ -190,6 +191,15 @@ protected:
      */
     void on_resent_data(
             uint32_t to_send);
+
+    /**
+     * @brief Report a new round trip time estimation with a matched reader
+     * @param reader_guid GUID of the reader
+     * @param rtt smoothed round trip time of the HEARTBEAT / ACKNACK exchanges
+     */
+    void on_round_trip_time(
+            const fastrtps::rtps::GUID_t& reader_guid,
+            std::chrono::nanoseconds rtt);
 };
 
 // Members are private details
@@ -256,6 +266,15 @@ protected:
      */
     void on_subscribe_throughput(
             uint32_t payload);
+
+    /**
+     * @brief Report a new round trip time estimation with a matched writer
+     * @param writer_guid GUID of the writer
+     * @param rtt smoothed round trip time of the ACKNACK / repair exchanges
+     */
+    void on_round_trip_time(
+            const fastrtps::rtps::GUID_t& writer_guid,
+            std::chrono::nanoseconds rtt);
 };
 
 #else // when FASTDDS_STATISTICS is not defined a dummy implementation is used
@@ -323,6 +342,17 @@ protected:
     {
     }
 
+    /**
+     * @brief Report a new round trip time estimation with a matched reader
+     * Parameter: GUID of the reader
+     * Parameter: smoothed round trip time of the HEARTBEAT / ACKNACK exchanges
+     */
+    inline void on_round_trip_time(
+            const fastrtps::rtps::GUID_t&,
+            std::chrono::nanoseconds)
+    {
+    }
+
 };
 
 class StatisticsReaderImpl
@@ -371,6 +401,17 @@ protected:
     {
     }
 
+    /**
+     * @brief Report a new round trip time estimation with a matched writer
+     * Parameter: GUID of the writer
+     * Parameter: smoothed round trip time of the ACKNACK / repair exchanges
+     */
+    inline void on_round_trip_time(
+            const fastrtps::rtps::GUID_t&,
+            std::chrono::nanoseconds)
+    {
+    }
+
 };
 
 #endif // FASTDDS_STATISTICS
@@ -59,6 +59,11 @@ constexpr const char* DISCOVERY_TOPIC = "_fastdds_statistics_discovered_entity";
 constexpr const char* SAMPLE_DATAS_TOPIC = "_fastdds_statistics_sample_datas";
 //! Statistics topic that reports the host, user and process where the module is running
 constexpr const char* PHYSICAL_DATA_TOPIC = "_fastdds_statistics_physical_data";
+//! Statistics topic that reports the round trip time estimated by each reliable endpoint with its matched endpoints
+constexpr const char* ROUND_TRIP_TIME_TOPIC = "_fastdds_statistics_round_trip_time";
+//! Statistics topic that reports the memory allocated by each DDS participant and each of its DataWriters and
+//! DataReaders
+constexpr const char* MEMORY_USAGE_TOPIC = "_fastdds_statistics_memory_usage";
 
 } // statistics
 } // fastdds
@@ -21,6 +21,7 @@
 #define KEYEDCHANGES_H_
 
 #include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/Guid.h>
 #include <chrono>
 
 namespace eprosima{
@@ -36,6 +37,8 @@ struct KeyedChanges
     KeyedChanges()
         : cache_changes()
         , next_deadline_us()
+        , current_owner()
+        , current_owner_strength(0)
     {
     }
 
@@ -43,6 +46,8 @@ struct KeyedChanges
     KeyedChanges(const KeyedChanges& other)
         : cache_changes(other.cache_changes)
         , next_deadline_us(other.next_deadline_us)
+        , current_owner(other.current_owner)
+        , current_owner_strength(other.current_owner_strength)
     {
     }
 
@@ -55,6 +60,10 @@ struct KeyedChanges
     std::vector<rtps::CacheChange_t*> cache_changes;
     //! The time when the group will miss the deadline
     std::chrono::steady_clock::time_point next_deadline_us;
+    //! The writer owning the group with EXCLUSIVE ownership, unknown when there is no owner
+    rtps::GUID_t current_owner;
+    //! The ownership strength of the writer owning the group
+    uint32_t current_owner_strength;
 };
 
 } /* namespace  */
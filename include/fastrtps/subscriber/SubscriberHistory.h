@@ -85,6 +85,39 @@ public:
             rtps::CacheChange_t* change,
             size_t unknown_missing_changes_up_to) override;
 
+    /**
+     * Called when a change is received, before reserving a CacheChange_t for it.
+     * With EXCLUSIVE ownership, arbitrates the ownership of the instance of the change, so changes from writers
+     * not owning it are discarded without being stored. The ownership only changes once the change is added.
+     * No Thread Safe
+     * @param change The received change. Its instance handle is calculated when not received.
+     * @return false if the change comes from a writer not owning the instance.
+     */
+    bool can_change_be_added_nts(
+            rtps::CacheChange_t* change) override;
+
+    /**
+     * Called when a writer is unmatched. Releases the instances it owned.
+     * @param writer_guid GUID of the unmatched writer.
+     */
+    void writer_unmatched(
+            const rtps::GUID_t& writer_guid) override;
+
+    /**
+     * Called when a writer loses its liveliness. Releases the instances it owned.
+     * @param writer_guid GUID of the writer that lost its liveliness.
+     */
+    void writer_not_alive(
+            const rtps::GUID_t& writer_guid);
+
+    /**
+     * Called when an instance misses its deadline. Releases the ownership of the instance, so any writer can take
+     * it with its next sample.
+     * @param handle The handle to the instance
+     */
+    void instance_deadline_missed(
+            const rtps::InstanceHandle_t& handle);
+
     /** @name Read or take data methods.
      * Methods to read or take data from the History.
      * @param data Pointer to the object where you want to read or take the information.
@@ -177,6 +210,10 @@ private:
     t_m_Inst_Caches keyed_changes_;
     //!Time point when the next deadline will occur (only used for topics with no key)
     std::chrono::steady_clock::time_point next_deadline_us_;
+    //!Writer owning the samples with EXCLUSIVE ownership (only used for topics with no key)
+    rtps::GUID_t no_key_owner_;
+    //!Ownership strength of the writer owning the samples (only used for topics with no key)
+    uint32_t no_key_owner_strength_;
     //!HistoryQosPolicy values.
     HistoryQosPolicy history_qos_;
     //!ResourceLimitsQosPolicy values.
@@ -239,6 +276,21 @@ private:
             size_t unknown_missing_changes_up_to);
     ///@}
 
+    /**
+     * Releases the ownership of all the instances owned by a writer.
+     * @param writer_guid GUID of the writer.
+     */
+    void release_ownership(
+            const rtps::GUID_t& writer_guid);
+
+    /**
+     * Updates the owner of the instance of a change that has just been added to the history.
+     * No Thread Safe
+     * @param a_change The added change.
+     */
+    void update_ownership_nts(
+            const rtps::CacheChange_t* a_change);
+
     bool add_received_change(
             rtps::CacheChange_t* a_change);
 
@@ -246,6 +298,14 @@ private:
             rtps::CacheChange_t* a_change,
             std::vector<rtps::CacheChange_t*>& instance_changes);
 
+    /**
+     * Replaces the payload of a change sent compressed by its original content.
+     * @param[in] a_change The received change
+     * @return false if the payload could not be restored
+     */
+    bool decompress_change(
+            rtps::CacheChange_t* a_change);
+
     bool deserialize_change(
             rtps::CacheChange_t* change,
             uint32_t ownership_strength,
@@ -58,6 +58,11 @@ public:
             eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
             bool force_md5 = false) override;
 
+    RTPS_DllAPI bool serialize_key(
+            void* data,
+            eprosima::fastrtps::rtps::SerializedPayload_t* key,
+            size_t& max_key_length) override;
+
     RTPS_DllAPI std::function<uint32_t()> getSerializedSizeProvider(
             void* data) override;
 
@@ -74,6 +74,8 @@ extern const char* LISTENING_PORTS;
 extern const char* CALCULATE_CRC;
 extern const char* CHECK_CRC;
 extern const char* SEGMENT_SIZE;
+extern const char* MAX_SEGMENT_SIZE;
+extern const char* EXTENT_IDLE_TIMEOUT_MS;
 extern const char* PORT_QUEUE_CAPACITY;
 extern const char* PORT_OVERFLOW_POLICY;
 extern const char* SEGMENT_OVERFLOW_POLICY;
@@ -81,6 +83,9 @@ extern const char* HEALTHY_CHECK_TIMEOUT_MS;
 extern const char* DISCARD;
 extern const char* FAIL;
 extern const char* RTPS_DUMP_FILE;
+extern const char* HUGE_PAGES;
+extern const char* PREFAULT_SEGMENT;
+extern const char* NUMA_NODE;
 extern const char* ON;
 
 // IntraprocessDeliveryType
@@ -160,6 +160,30 @@ bool DynamicPubSubType::getKey(
     return true;
 }
 
+bool DynamicPubSubType::serialize_key(
+        void* data,
+        eprosima::fastrtps::rtps::SerializedPayload_t* key,
+        size_t& max_key_length)
+{
+    if (dynamic_type_ == nullptr || !m_isGetKeyDefined)
+    {
+        return false;
+    }
+    DynamicData* pDynamicData = (DynamicData*)data;
+    max_key_length = DynamicData::getKeyMaxCdrSerializedSize(dynamic_type_);
+
+    if (key->max_size < max_key_length)
+    {
+        key->reserve(static_cast<uint32_t>(max_key_length));
+    }
+
+    eprosima::fastcdr::FastBuffer fastbuffer((char*)key->data, key->max_size);
+    eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);     // Object that serializes the data.
+    pDynamicData->serializeKey(ser);
+    key->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+    return true;
+}
+
 std::function<uint32_t()> DynamicPubSubType::getSerializedSizeProvider(void* data)
 {
     return [data]() -> uint32_t
@@ -25,7 +25,11 @@
 #include <fastrtps/types/AnnotationDescriptor.h>
 #include <fastrtps/utils/md5.h>
 #include <fastdds/dds/log/Log.hpp>
+#include <algorithm>
+#include <limits>
+#include <set>
 #include <sstream>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -2195,7 +2199,6 @@ TypeIdentifierWithSizeSeq TypeObjectFactory::typelookup_get_type_dependencies(
     TypeIdentifierWithSizeSeq result;
     size_t continuation_point = to_size_t(in_continuation_point);
     size_t start_index = max_size * continuation_point;
-    size_t skip = 0;
 
     // TODO Manage the overflow with additional "start_indexes" to cover
     // the complete 256 bits possibilities of OctetSeq.
@@ -2209,65 +2212,85 @@ TypeIdentifierWithSizeSeq TypeObjectFactory::typelookup_get_type_dependencies(
         return result;
     }
 
-    // For each given identifier
+    // Dependencies are returned transitively, so the requester can ask for all the TypeObjects it lacks at once,
+    // instead of discovering the dependencies one level on each request.
+    // The closure is walked in the same order on every request, and only up to the requested page, plus one more
+    // dependency to know whether another page follows.
+    size_t needed_results = start_index + max_size + 1;
+    if (needed_results < start_index)
+    {
+        needed_results = std::numeric_limits<size_t>::max();
+    }
+
+    // Stored identifiers are unique, so they are compared by address
+    std::set<const TypeIdentifier*> known;
+    std::vector<const TypeIdentifier*> pending;
     for (const TypeIdentifier& identifier : identifiers)
     {
         const TypeIdentifier* local_id = get_stored_type_identifier(&identifier);
+        if (local_id != nullptr && known.insert(local_id).second)
+        {
+            pending.push_back(local_id);
+        }
+    }
 
-        // Check it is known
-        if (local_id != nullptr)
+    TypeIdentifierWithSizeSeq full_results;
+    while (!pending.empty() && full_results.size() < needed_results)
+    {
+        const TypeIdentifier* local_id = pending.back();
+        pending.pop_back();
+
+        // Create or retrieve its TypeInformation
+        if (get_type_information(local_id) == nullptr)
         {
-            // Create or retrieve its TypeInformation
-            if (get_type_information(local_id) == nullptr)
+            TypeInformation aux;
+            if (local_id->_d() > EK_MINIMAL)
             {
-                TypeInformation aux;
-                if (local_id->_d() > EK_MINIMAL)
-                {
-                    fill_complete_information(&aux, local_id);
-                }
-                else
-                {
-                    fill_minimal_information(&aux, local_id);
-                }
+                fill_complete_information(&aux, local_id);
             }
-            const TypeInformation* local_info = get_type_information(local_id);
-            if (local_info != nullptr)
+            else
             {
-                // With the TypeInformation, retrieve directly their dependencies
-                const TypeIdentifierWithSizeSeq& full_results =
-                        (local_id->_d() > EK_MINIMAL)
-                    ? local_info->complete().dependent_typeids()
-                    : local_info->minimal().dependent_typeids();
+                fill_minimal_information(&aux, local_id);
+            }
+        }
+        const TypeInformation* local_info = get_type_information(local_id);
+        if (local_info != nullptr)
+        {
+            // With the TypeInformation, retrieve directly their dependencies
+            const TypeIdentifierWithSizeSeq& dependencies =
+                    (local_id->_d() > EK_MINIMAL)
+                ? local_info->complete().dependent_typeids()
+                : local_info->minimal().dependent_typeids();
 
-                // Check the start_index
-                if (skip + full_results.size() < start_index)
+            for (const TypeIdentifierWithSize& dependency : dependencies)
+            {
+                // Unknown dependencies are returned, but cannot be followed
+                const TypeIdentifier* dependency_id = get_stored_type_identifier(&dependency.type_id());
+                if (dependency_id == nullptr)
                 {
-                    skip += full_results.size();
-                    continue;
+                    full_results.push_back(dependency);
                 }
-                else
+                else if (known.insert(dependency_id).second)
                 {
-                    size_t local_start = start_index - skip;
-                    size_t added = 0;
-                    // Add the next identifiers.
-                    for (size_t i = local_start; i < local_start + max_size && i < full_results.size(); ++i)
-                    {
-                        result.push_back(full_results[i]);
-                        ++added;
-                    }
-                    skip = 0;
-                    start_index = 0;
-                    if (added == max_size)
-                    {
-                        // If max_size reached, increment out_continuation_point
-                        ++out_continuation_point;
-                        break;
-                    }
+                    full_results.push_back(dependency);
+                    pending.push_back(dependency_id);
                 }
             }
         }
     }
 
+    // Return the requested page
+    for (size_t i = start_index; i < start_index + max_size && i < full_results.size(); ++i)
+    {
+        result.push_back(full_results[i]);
+    }
+    if (start_index + max_size < full_results.size())
+    {
+        // More dependencies remain, increment out_continuation_point
+        out_continuation_point = in_continuation_point;
+        ++out_continuation_point;
+    }
+
     return result;
 }
 
@@ -20,6 +20,7 @@
 #include <fastdds/dds/builtin/typelookup/TypeLookupManager.hpp>
 
 #include <fastdds/rtps/builtin/BuiltinProtocols.h>
+#include <fastdds/rtps/builtin/discovery/participant/PDP.h>
 #include <fastdds/rtps/builtin/data/ParticipantProxyData.h>
 #include <fastdds/rtps/builtin/data/WriterProxyData.h>
 #include <fastdds/rtps/builtin/data/ReaderProxyData.h>
@@ -133,7 +134,12 @@ bool TypeLookupManager::init_typelookup_service(
 {
     logInfo(TYPELOOKUP_SERVICE, "Initializing TypeLookup Service");
     participant_ = participant;
-    bool retVal = create_endpoints();
+    bool retVal = true;
+    // Lazily created builtin endpoints are created on first use, or when a remote client is discovered
+    if (!participant->lazy_builtin_endpoints())
+    {
+        retVal = create_endpoints();
+    }
     /*
      #if HAVE_SECURITY
         if (retVal)
@@ -148,6 +154,14 @@ bool TypeLookupManager::init_typelookup_service(
 bool TypeLookupManager::assign_remote_endpoints(
         const ParticipantProxyData& pdata)
 {
+    // A remote client needs our endpoints to get its requests replied
+    if (builtin_protocols_->m_att.typelookup_config.use_server &&
+            0 != (pdata.m_availableBuiltinEndpoints & BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REQUEST_DATA_WRITER) &&
+            !enable_endpoints())
+    {
+        logError(TYPELOOKUP_SERVICE, "Could not create the TypeLookup endpoints");
+    }
+
     const NetworkFactory& network = participant_->network_factory();
     uint32_t endp = pdata.m_availableBuiltinEndpoints;
     uint32_t partdet = endp;
@@ -465,6 +479,60 @@ bool TypeLookupManager::create_endpoints()
     return true;
 }
 
+bool TypeLookupManager::enable_endpoints()
+{
+    if (!participant_->lazy_builtin_endpoints())
+    {
+        // Created on initialization
+        return true;
+    }
+
+    std::vector<ParticipantProxyData> remote_participants;
+
+    {
+        std::lock_guard<std::recursive_mutex> guard(*builtin_protocols_->mp_PDP->getMutex());
+        if (nullptr != builtin_request_writer_ || nullptr != builtin_reply_writer_)
+        {
+            return true;
+        }
+
+        logInfo(TYPELOOKUP_SERVICE, "Creating TypeLookup endpoints on demand");
+        if (!create_endpoints())
+        {
+            return false;
+        }
+
+        // Pairing is done without the PDP mutex, as done on discovery
+        PDP* pdp = builtin_protocols_->mp_PDP;
+        for (auto it = pdp->ParticipantProxiesBegin(); it != pdp->ParticipantProxiesEnd(); ++it)
+        {
+            if ((*it)->m_guid != participant_->getGuid())
+            {
+                remote_participants.emplace_back(**it);
+            }
+        }
+    }
+
+    for (const ParticipantProxyData& pdata : remote_participants)
+    {
+        assign_remote_endpoints(pdata);
+    }
+
+    uint32_t endpoints = 0;
+    if (builtin_protocols_->m_att.typelookup_config.use_server)
+    {
+        endpoints |= BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REQUEST_DATA_READER;
+        endpoints |= BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REPLY_DATA_WRITER;
+    }
+    if (builtin_protocols_->m_att.typelookup_config.use_client)
+    {
+        endpoints |= BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REQUEST_DATA_WRITER;
+        endpoints |= BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REPLY_DATA_READER;
+    }
+    builtin_protocols_->mp_PDP->add_builtin_endpoints(endpoints);
+    return true;
+}
+
 /* TODO Implement if security is needed.
  #if HAVE_SECURITY
    bool TypeLookupManager::create_secure_endpoints()
@@ -474,10 +542,10 @@ bool TypeLookupManager::create_endpoints()
  */
 
 SampleIdentity TypeLookupManager::get_type_dependencies(
-        const fastrtps::types::TypeIdentifierSeq& id_seq) const
+        const fastrtps::types::TypeIdentifierSeq& id_seq)
 {
     SampleIdentity id = INVALID_SAMPLE_IDENTITY;
-    if (builtin_protocols_->m_att.typelookup_config.use_client)
+    if (builtin_protocols_->m_att.typelookup_config.use_client && enable_endpoints())
     {
         TypeLookup_getTypeDependencies_In in;
         in.type_ids = id_seq;
@@ -495,10 +563,10 @@ SampleIdentity TypeLookupManager::get_type_dependencies(
 }
 
 SampleIdentity TypeLookupManager::get_types(
-        const fastrtps::types::TypeIdentifierSeq& id_seq) const
+        const fastrtps::types::TypeIdentifierSeq& id_seq)
 {
     SampleIdentity id = INVALID_SAMPLE_IDENTITY;
-    if (builtin_protocols_->m_att.typelookup_config.use_client)
+    if (builtin_protocols_->m_att.typelookup_config.use_client && enable_endpoints())
     {
         TypeLookup_getTypes_In in;
         in.type_ids = id_seq;
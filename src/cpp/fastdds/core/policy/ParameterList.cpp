@@ -211,6 +211,56 @@ bool ParameterList::readInstanceHandleFromCDRMsg(
     return false;
 }
 
+bool ParameterList::read_topic_name_from_payload(
+        const fastrtps::rtps::SerializedPayload_t& payload,
+        fastrtps::string_255& topic_name)
+{
+    // Use a temporary wraping message
+    fastrtps::rtps::CDRMessage_t msg(payload);
+    msg.pos = 0;
+
+    // Read encapsulation
+    msg.pos += 1;
+    fastrtps::rtps::octet encapsulation = 0;
+    fastrtps::rtps::CDRMessage::readOctet(&msg, &encapsulation);
+    if (encapsulation == PL_CDR_BE)
+    {
+        msg.msg_endian = fastrtps::rtps::Endianness_t::BIGEND;
+    }
+    else if (encapsulation == PL_CDR_LE)
+    {
+        msg.msg_endian = fastrtps::rtps::Endianness_t::LITTLEEND;
+    }
+    else
+    {
+        return false;
+    }
+
+    // Skip encapsulation options
+    msg.pos += 2;
+
+    bool valid = false;
+    uint16_t pid;
+    uint16_t plength;
+    while (msg.pos < msg.length)
+    {
+        valid = true;
+        valid &= fastrtps::rtps::CDRMessage::readUInt16(&msg, &pid);
+        valid &= fastrtps::rtps::CDRMessage::readUInt16(&msg, &plength);
+        if ((pid == PID_SENTINEL) || !valid)
+        {
+            break;
+        }
+        if (pid == PID_TOPIC_NAME)
+        {
+            uint32_t end = msg.pos + plength;
+            return fastrtps::rtps::CDRMessage::readString(&msg, &topic_name) && msg.pos <= end;
+        }
+        msg.pos += (plength + 3) & ~3;
+    }
+    return false;
+}
+
 }  // namespace dds
 }  // namespace fastdds
 }  // namespace eprosima
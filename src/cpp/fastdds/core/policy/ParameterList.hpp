@@ -160,6 +160,16 @@ public:
     static bool readInstanceHandleFromCDRMsg(
             fastrtps::rtps::CacheChange_t* change,
             const uint16_t search_pid);
+
+    /**
+     * Read the topic name of a serialized endpoint discovery announcement, without parsing the rest of it.
+     * @param[in] payload Serialized announcement, including its encapsulation.
+     * @param[out] topic_name Reference where the topic name will be written.
+     * @return true if the topic name is returned, false otherwise.
+     */
+    static bool read_topic_name_from_payload(
+            const fastrtps::rtps::SerializedPayload_t& payload,
+            fastrtps::string_255& topic_name);
 };
 
 } // namespace dds
@@ -394,6 +394,12 @@ ReturnCode_t DomainParticipant::get_current_time(
     return impl_->get_current_time(current_time);
 }
 
+ReturnCode_t DomainParticipant::get_memory_usage(
+        fastrtps::rtps::ParticipantMemoryUsage& usage) const
+{
+    return impl_->get_memory_usage(usage);
+}
+
 ReturnCode_t DomainParticipant::register_type(
         TypeSupport type,
         const std::string& type_name)
@@ -29,6 +29,7 @@
 #include <fastdds/dds/subscriber/DataReader.hpp>
 #include <fastdds/dds/publisher/DataWriter.hpp>
 
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
 #include <fastdds/rtps/RTPSDomain.h>
 #include <fastdds/rtps/builtin/liveliness/WLP.h>
@@ -49,12 +50,15 @@
 #include <fastrtps/xmlparser/XMLProfileManager.h>
 
 #include <fastdds/publisher/PublisherImpl.hpp>
+#include <fastdds/recording/Recorder.hpp>
 #include <fastdds/subscriber/SubscriberImpl.hpp>
 #include <fastdds/topic/TopicImpl.hpp>
 
 #include <rtps/RTPSDomainImpl.hpp>
+#include <utils/shared_memory/ParticipantIdLock.hpp>
 
 #include <chrono>
+#include <cstdlib>
 
 namespace eprosima {
 namespace fastdds {
@@ -81,6 +85,9 @@ using fastrtps::rtps::EndpointKind_t;
 using fastrtps::rtps::ResourceEvent;
 using eprosima::fastdds::dds::Log;
 
+constexpr const char* TYPE_RESOLUTION_TIMEOUT_PROPERTY = "fastdds.type_lookup.resolution_timeout";
+constexpr int64_t TYPE_RESOLUTION_DEFAULT_TIMEOUT_MS = 10000;
+
 static void set_attributes_from_qos(
         fastrtps::rtps::RTPSParticipantAttributes& attr,
         const DomainParticipantQos& qos)
@@ -162,6 +169,13 @@ DomainParticipantImpl::DomainParticipantImpl(
 
     // Pre calculate participant id and generated guid
     participant_id_ = qos_.wire_protocol().participant_id;
+    fastrtps::rtps::RTPSParticipantAttributes rtps_attr;
+    set_attributes_from_qos(rtps_attr, qos_);
+    participant_id_lock_ = eprosima::fastrtps::rtps::RTPSDomainImpl::reserve_participant_id(domain_id_, rtps_attr);
+    if (participant_id_lock_)
+    {
+        participant_id_ = static_cast<int32_t>(participant_id_lock_->participant_id());
+    }
     eprosima::fastrtps::rtps::RTPSDomainImpl::create_participant_guid(participant_id_, guid_);
 }
 
@@ -231,6 +245,9 @@ DomainParticipantImpl::~DomainParticipantImpl()
         topics_by_handle_.clear();
     }
 
+    // The event runs on the thread of the RTPSParticipant
+    type_resolution_event_.reset();
+
     if (rtps_participant_ != nullptr)
     {
         RTPSDomain::removeRTPSParticipant(rtps_participant_);
@@ -287,6 +304,32 @@ ReturnCode_t DomainParticipantImpl::enable()
             return find_type(type_name).get() != nullptr;
         });
 
+    int64_t timeout_ms = TYPE_RESOLUTION_DEFAULT_TIMEOUT_MS;
+    const std::string* timeout_property = fastrtps::rtps::PropertyPolicyHelper::find_property(
+        qos_.properties(), TYPE_RESOLUTION_TIMEOUT_PROPERTY);
+    if (nullptr != timeout_property)
+    {
+        int64_t value = std::strtoll(timeout_property->c_str(), nullptr, 10);
+        if (0 < value)
+        {
+            timeout_ms = value;
+        }
+        else
+        {
+            logError(PARTICIPANT, "Wrong value '" << *timeout_property << "' for property " <<
+                    TYPE_RESOLUTION_TIMEOUT_PROPERTY << ". Using " << TYPE_RESOLUTION_DEFAULT_TIMEOUT_MS << " ms");
+        }
+    }
+    type_resolution_timeout_ = std::chrono::milliseconds(timeout_ms);
+    type_resolution_event_.reset(new fastrtps::rtps::TimedEvent(rtps_participant_->get_resource_event(),
+            [this]()
+            {
+                return expire_type_resolutions();
+            }, static_cast<double>(timeout_ms)));
+
+    // Recording of the received samples. It should exist before the DataReaders are enabled
+    recorder_ = recording::Recorder::create(qos_.properties());
+
     if (qos_.entity_factory().autoenable_created_entities)
     {
         // Enable topics first
@@ -857,6 +900,18 @@ ReturnCode_t DomainParticipantImpl::get_current_time(
     return ReturnCode_t::RETCODE_OK;
 }
 
+ReturnCode_t DomainParticipantImpl::get_memory_usage(
+        fastrtps::rtps::ParticipantMemoryUsage& usage) const
+{
+    if (nullptr == rtps_participant_)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    rtps_participant_->get_memory_usage(usage);
+    return ReturnCode_t::RETCODE_OK;
+}
+
 const DomainParticipant* DomainParticipantImpl::get_participant() const
 {
     return participant_;
@@ -1235,7 +1290,7 @@ void DomainParticipantImpl::MyRTPSParticipantListener::on_type_discovery(
             dyn_type);
     }
 
-    participant_->check_get_type_request(request_sample_id, identifier, object, dyn_type);
+    participant_->check_get_type_request(request_sample_id, identifier, object);
 }
 
 void DomainParticipantImpl::MyRTPSParticipantListener::on_type_dependencies_reply(
@@ -1356,53 +1411,67 @@ ReturnCode_t DomainParticipantImpl::register_remote_type(
     }
     else if (rtps_participant_->typelookup_manager() != nullptr)
     {
-        TypeIdentifierSeq dependencies;
-        TypeIdentifierSeq retrieve_objects;
-
-        fill_pending_dependencies(type_information.complete().dependent_typeids(), dependencies, retrieve_objects);
-
-        fastrtps::rtps::SampleIdentity request_dependencies;
-        fastrtps::rtps::SampleIdentity request_objects;
+        const TypeIdentifier& type_id = type_information.complete().typeid_with_size().type_id();
 
         // Lock now, we don't want to process the reply before we add the requests' ID to the maps.
         std::lock_guard<std::mutex> lock(mtx_request_cb_);
 
-        // If any pending dependency exists, retrieve it.
-        if (!dependencies.empty())
+        // Join the resolution of the type if it is already in flight.
+        // An expired one is forgotten instead, as its replies are not coming, and the type requested again.
+        const auto now = std::chrono::steady_clock::now();
+        for (auto pending = type_resolutions_.begin(); pending != type_resolutions_.end(); ++pending)
         {
-            request_dependencies = get_type_dependencies(dependencies);
-        }
+            if (pending->second.type_id == type_id)
+            {
+                if (now < pending->second.expiration)
+                {
+                    pending->second.callbacks.emplace_back(type_name, callback);
+                    return ReturnCode_t::RETCODE_OK;
+                }
 
-        // If any pending TypeObject exists, retrieve it
-        if (!retrieve_objects.empty())
-        {
-            request_objects = get_types(retrieve_objects);
+                logWarning(PARTICIPANT, "Resolution of remote type " << type_name << " timed out. Requesting it again");
+                remove_type_resolution(pending);
+                break;
+            }
         }
 
-        // If no more dependencies but failed to create, probably we only need the TypeObject
-        dependencies.clear(); // Reuse the same vector.
-        dependencies.push_back(type_information.complete().typeid_with_size().type_id());
-        fastrtps::rtps::SampleIdentity requestId = get_types(dependencies);
-
-        // Add everything to maps
-        register_callbacks_.emplace(std::make_pair(requestId, std::make_pair(type_name, callback)));
-        std::vector<fastrtps::rtps::SampleIdentity> vector;
-        vector.push_back(requestId); // Add itself
+        TypeIdentifierSeq dependencies;
+        TypeIdentifierSeq retrieve_objects;
+        fill_pending_dependencies(type_information.complete().dependent_typeids(), dependencies, retrieve_objects);
 
-        if (builtin::INVALID_SAMPLE_IDENTITY != request_dependencies)
+        // The TypeObject of the type goes on the same request than the ones of its dependencies, after them.
+        retrieve_objects.push_back(type_id);
+        fastrtps::rtps::SampleIdentity requestId = get_types(retrieve_objects);
+        if (builtin::INVALID_SAMPLE_IDENTITY == requestId)
         {
-            vector.push_back(request_dependencies);
-            child_requests_.emplace(std::make_pair(request_dependencies, requestId));
+            return ReturnCode_t::RETCODE_ERROR;
         }
 
-        if (builtin::INVALID_SAMPLE_IDENTITY != request_objects)
+        // The expiration event is only armed while resolutions are in flight
+        if (type_resolutions_.empty())
         {
-            vector.push_back(request_objects);
-            child_requests_.emplace(std::make_pair(request_objects, requestId));
+            type_resolution_event_->restart_timer();
         }
 
-        // Move the filled vector to the map
-        parent_requests_.emplace(std::make_pair(requestId, std::move(vector)));
+        RemoteTypeResolution& resolution = type_resolutions_[requestId];
+        resolution.type_id = type_id;
+        resolution.expiration = now + type_resolution_timeout_;
+        resolution.callbacks.emplace_back(type_name, callback);
+        resolution.requested_objects = retrieve_objects;
+        resolution.pending_objects = std::move(retrieve_objects);
+        type_requests_.emplace(requestId, requestId);
+
+        // If any pending dependency exists, retrieve it.
+        if (!dependencies.empty())
+        {
+            fastrtps::rtps::SampleIdentity request_dependencies = get_type_dependencies(dependencies);
+            if (builtin::INVALID_SAMPLE_IDENTITY != request_dependencies)
+            {
+                resolution.requested_dependencies = std::move(dependencies);
+                ++resolution.pending_dependency_requests;
+                type_requests_.emplace(request_dependencies, requestId);
+            }
+        }
 
         return ReturnCode_t::RETCODE_OK;
     }
@@ -1412,68 +1481,41 @@ ReturnCode_t DomainParticipantImpl::register_remote_type(
 bool DomainParticipantImpl::check_get_type_request(
         const fastrtps::rtps::SampleIdentity& requestId,
         const fastrtps::types::TypeIdentifier* identifier,
-        const fastrtps::types::TypeObject* object,
-        fastrtps::types::DynamicType_ptr dyn_type)
+        const fastrtps::types::TypeObject* object)
 {
     // Maybe we have a pending request?
-    if (builtin::INVALID_SAMPLE_IDENTITY != requestId)
+    if (builtin::INVALID_SAMPLE_IDENTITY != requestId && nullptr != identifier)
     {
-        // First level request?
         std::lock_guard<std::mutex> lock(mtx_request_cb_);
 
-        auto cb_it = register_callbacks_.find(requestId);
-
-        if (cb_it != register_callbacks_.end())
+        auto request_it = type_requests_.find(requestId);
+        if (request_it == type_requests_.end())
         {
-            const std::string& name = cb_it->second.first;
-            const auto& callback = cb_it->second.second;
-
-            if (nullptr != dyn_type)
-            {
-                dyn_type->set_name(name);
-                if (register_dynamic_type(dyn_type) == ReturnCode_t::RETCODE_OK)
-                {
-                    callback(name, dyn_type);
-                    remove_parent_request(requestId);
-                    return true;
-                }
-            }
-
-            // Exists the request, but the provided dyn_type isn't valid.
-            // Register the received TypeObject into factory and recreate the DynamicType.
-            fastrtps::types::TypeObjectFactory::get_instance()->add_type_object(name, identifier, object);
-
-            auto pending = parent_requests_.find(requestId);
-            if (pending != parent_requests_.end() && pending->second.size() < 2) // Exists and everything is solved.
-            {
-                fastrtps::types::DynamicType_ptr dynamic =
-                        fastrtps::types::TypeObjectFactory::get_instance()->build_dynamic_type(name, identifier,
-                                object);
-
-                if (nullptr != dynamic)
-                {
-                    if (register_dynamic_type(dynamic) == ReturnCode_t::RETCODE_OK)
-                    {
-                        callback(name, dynamic);
-                        remove_parent_request(requestId);
-                        return true;
-                    }
-                }
-            }
-            // Failed, cannot register the type yet, probably child request still pending.
             return false;
         }
 
-        // Child request?
-        auto child_it = child_requests_.find(requestId);
+        auto resolution_it = type_resolutions_.find(request_it->second);
+        if (resolution_it == type_resolutions_.end())
+        {
+            return false;
+        }
 
-        if (child_it != child_requests_.end())
+        RemoteTypeResolution& resolution = resolution_it->second;
+        auto pending_it = std::find(resolution.pending_objects.begin(), resolution.pending_objects.end(), *identifier);
+        if (pending_it == resolution.pending_objects.end())
         {
-            // Register received TypeObject into factory, remove the iterator from the map and check our parent.
-            fastrtps::types::TypeObjectFactory::get_instance()->add_type_object(
-                get_inner_type_name(requestId), identifier, object);
-            remove_child_request(requestId);
+            // Not requested, or already received
+            return false;
         }
+        resolution.pending_objects.erase(pending_it);
+
+        // Register received TypeObject into factory.
+        // Dependencies are registered with an inner name, the type itself with the name given by the user.
+        const std::string& name = (*identifier == resolution.type_id) ?
+                resolution.callbacks.front().first : get_inner_type_name(requestId);
+        fastrtps::types::TypeObjectFactory::get_instance()->add_type_object(name, identifier, object);
+
+        return try_complete_type_resolution(resolution_it);
     }
     return false;
 }
@@ -1509,204 +1551,198 @@ bool DomainParticipantImpl::check_get_dependencies_request(
         const fastrtps::rtps::SampleIdentity& requestId,
         const fastrtps::types::TypeIdentifierWithSizeSeq& dependencies)
 {
-    using namespace fastrtps::types;
-
     // Maybe we have a pending request?
     if (builtin::INVALID_SAMPLE_IDENTITY != requestId)
     {
-        TypeIdentifierSeq next_dependencies;
-        TypeIdentifierSeq retrieve_objects;
-
-        // First level request?
         std::lock_guard<std::mutex> lock(mtx_request_cb_);
 
-        auto cb_it = register_callbacks_.find(requestId);
-
-        if (cb_it != register_callbacks_.end())
+        auto request_it = type_requests_.find(requestId);
+        if (request_it == type_requests_.end())
         {
-            fill_pending_dependencies(dependencies, next_dependencies, retrieve_objects);
-
-            // If any pending dependency exists, retrieve it
-            if (!next_dependencies.empty())
-            {
-                fastrtps::rtps::SampleIdentity child_request = get_type_dependencies(next_dependencies);
-                std::vector<fastrtps::rtps::SampleIdentity> vector;
-                vector.push_back(child_request);
-                parent_requests_.emplace(std::make_pair(requestId, std::move(vector)));
-                child_requests_.emplace(std::make_pair(child_request, requestId));
-            }
-
-            // Add received dependencies to the factory
-            for (const TypeIdentifierWithSize& tiws : dependencies)
-            {
-                if (tiws.type_id()._d() >= EK_MINIMAL)
-                {
-                    // This dependency needs a TypeObject
-                    retrieve_objects.push_back(tiws.type_id());
-                }
-                else
-                {
-                    TypeObjectFactory::get_instance()->add_type_identifier(
-                        get_inner_type_name(requestId), &tiws.type_id());
-                }
-            }
+            return false;
+        }
 
-            // If any pending TypeObject exists, retrieve it
-            if (!retrieve_objects.empty())
-            {
-                fastrtps::rtps::SampleIdentity child_request = get_types(retrieve_objects);
-                std::vector<fastrtps::rtps::SampleIdentity> vector;
-                vector.push_back(child_request);
-                parent_requests_.emplace(std::make_pair(requestId, std::move(vector)));
-                child_requests_.emplace(std::make_pair(child_request, requestId));
-            }
-
-            if (next_dependencies.empty() && retrieve_objects.empty())
-            {
-                // Finished?
-                on_child_requests_finished(requestId);
-                return true;
-            }
+        fastrtps::rtps::SampleIdentity resolution_id = request_it->second;
+        type_requests_.erase(request_it);
 
+        auto resolution_it = type_resolutions_.find(resolution_id);
+        if (resolution_it == type_resolutions_.end())
+        {
             return false;
         }
 
-        // Child request?
-        auto child_it = child_requests_.find(requestId);
-
-        if (child_it != child_requests_.end())
+        RemoteTypeResolution& resolution = resolution_it->second;
+        if (resolution.pending_dependency_requests > 0)
         {
-            fill_pending_dependencies(dependencies, next_dependencies, retrieve_objects);
+            --resolution.pending_dependency_requests;
+        }
 
-            // If any pending dependency exists, retrieve it
-            if (!next_dependencies.empty())
-            {
-                fastrtps::rtps::SampleIdentity child_request = get_type_dependencies(next_dependencies);
-                std::vector<fastrtps::rtps::SampleIdentity> vector;
-                vector.push_back(child_request);
-                parent_requests_.emplace(std::make_pair(requestId, std::move(vector)));
-                child_requests_.emplace(std::make_pair(child_request, requestId));
-            }
+        request_type_dependencies(resolution_id, resolution, dependencies, get_inner_type_name(requestId));
 
-            // Add received dependencies to the factory
-            for (const TypeIdentifierWithSize& tiws : dependencies)
-            {
-                if (tiws.type_id()._d() >= EK_MINIMAL)
-                {
-                    // This dependency needs a TypeObject
-                    retrieve_objects.push_back(tiws.type_id());
-                }
-                else
-                {
-                    TypeObjectFactory::get_instance()->add_type_identifier(
-                        get_inner_type_name(requestId), &tiws.type_id());
-                }
-            }
+        return try_complete_type_resolution(resolution_it);
+    }
+    return false;
+}
+
+void DomainParticipantImpl::request_type_dependencies(
+        const fastrtps::rtps::SampleIdentity& resolution_id,
+        RemoteTypeResolution& resolution,
+        const fastrtps::types::TypeIdentifierWithSizeSeq& dependencies,
+        const std::string& inner_type_name)
+{
+    using namespace fastrtps::types;
 
-            // If any pending TypeObject exists, retrieve it
-            if (!retrieve_objects.empty())
+    TypeIdentifierSeq next_dependencies;
+    TypeIdentifierSeq retrieve_objects;
+    fill_pending_dependencies(dependencies, next_dependencies, retrieve_objects);
+
+    auto contains = [](const TypeIdentifierSeq& identifiers, const TypeIdentifier& identifier)
             {
-                fastrtps::rtps::SampleIdentity child_request = get_types(retrieve_objects);
-                std::vector<fastrtps::rtps::SampleIdentity> vector;
-                vector.push_back(child_request);
-                parent_requests_.emplace(std::make_pair(requestId, std::move(vector)));
-                child_requests_.emplace(std::make_pair(child_request, requestId));
-            }
+                return identifiers.end() != std::find(identifiers.begin(), identifiers.end(), identifier);
+            };
 
-            if (next_dependencies.empty() && retrieve_objects.empty())
+    // Servers reply with the transitive dependencies, so most of them will have been requested already
+    next_dependencies.erase(std::remove_if(next_dependencies.begin(), next_dependencies.end(),
+            [&](const TypeIdentifier& identifier)
             {
-                remove_child_request(requestId);
-                return true;
-            }
+                return contains(resolution.requested_dependencies, identifier);
+            }), next_dependencies.end());
+    retrieve_objects.erase(std::remove_if(retrieve_objects.begin(), retrieve_objects.end(),
+            [&](const TypeIdentifier& identifier)
+            {
+                return contains(resolution.requested_objects, identifier);
+            }), retrieve_objects.end());
 
-            return false;
+    // Add received dependencies that need no TypeObject to the factory
+    for (const TypeIdentifierWithSize& tiws : dependencies)
+    {
+        if (tiws.type_id()._d() < EK_MINIMAL)
+        {
+            TypeObjectFactory::get_instance()->add_type_identifier(inner_type_name, &tiws.type_id());
         }
     }
-    return false;
-}
 
-ReturnCode_t DomainParticipantImpl::register_dynamic_type(
-        fastrtps::types::DynamicType_ptr dyn_type)
-{
-    TypeSupport type(new fastrtps::types::DynamicPubSubType(dyn_type));
-    return participant_->register_type(type);
-}
-
-void DomainParticipantImpl::remove_parent_request(
-        const fastrtps::rtps::SampleIdentity& request)
-{
-    // If a parent request if going to be deleted, delete all its children too.
-    auto cb_it = register_callbacks_.find(request);
-    auto parent_it = parent_requests_.find(request);
-
-    if (parent_requests_.end() != parent_it)
+    // If any pending dependency exists, retrieve all of them at once
+    if (!next_dependencies.empty())
     {
-        for (const fastrtps::rtps::SampleIdentity& child_id : parent_it->second)
+        fastrtps::rtps::SampleIdentity child_request = get_type_dependencies(next_dependencies);
+        if (builtin::INVALID_SAMPLE_IDENTITY != child_request)
         {
-            auto child_it = child_requests_.find(child_id);
-            if (child_requests_.end() != child_it)
-            {
-                child_requests_.erase(child_it);
-            }
+            resolution.requested_dependencies.insert(resolution.requested_dependencies.end(),
+                    next_dependencies.begin(), next_dependencies.end());
+            ++resolution.pending_dependency_requests;
+            type_requests_.emplace(child_request, resolution_id);
         }
-        parent_requests_.erase(parent_it);
     }
 
-    if (register_callbacks_.end() != cb_it)
+    // If any pending TypeObject exists, retrieve all of them at once
+    if (!retrieve_objects.empty())
     {
-        register_callbacks_.erase(cb_it);
+        fastrtps::rtps::SampleIdentity child_request = get_types(retrieve_objects);
+        if (builtin::INVALID_SAMPLE_IDENTITY != child_request)
+        {
+            resolution.requested_objects.insert(resolution.requested_objects.end(),
+                    retrieve_objects.begin(), retrieve_objects.end());
+            resolution.pending_objects.insert(resolution.pending_objects.end(),
+                    retrieve_objects.begin(), retrieve_objects.end());
+            type_requests_.emplace(child_request, resolution_id);
+        }
     }
 }
 
-void DomainParticipantImpl::remove_child_request(
-        const fastrtps::rtps::SampleIdentity& request)
+bool DomainParticipantImpl::try_complete_type_resolution(
+        std::map<fastrtps::rtps::SampleIdentity, RemoteTypeResolution>::iterator resolution_it)
 {
-    auto child_it = child_requests_.find(request);
-    if (child_requests_.end() != child_it)
+    using namespace fastrtps::types;
+
+    RemoteTypeResolution& resolution = resolution_it->second;
+    if (resolution.pending_dependency_requests > 0 || !resolution.pending_objects.empty())
     {
-        fastrtps::rtps::SampleIdentity parent_request = child_it->second;
-        child_requests_.erase(child_it);
+        return false;
+    }
 
-        auto parent_it = parent_requests_.find(parent_request);
-        if (parent_requests_.end() != parent_it)
+    TypeObjectFactory* factory = TypeObjectFactory::get_instance();
+    TypeObject object;
+    factory->typelookup_get_type(resolution.type_id, object);
+
+    // Every call waiting for the type is notified, building it once for each different name
+    std::vector<std::pair<std::string, DynamicType_ptr>> built_types;
+    for (const auto& callback : resolution.callbacks)
+    {
+        auto built_it = std::find_if(built_types.begin(), built_types.end(),
+                        [&callback](const std::pair<std::string, DynamicType_ptr>& built)
+                        {
+                            return built.first == callback.first;
+                        });
+        if (built_it == built_types.end())
         {
-            std::vector<fastrtps::rtps::SampleIdentity>& pending = parent_it->second;
-            pending.erase(std::find(pending.begin(), pending.end(), request));
-            if (pending.empty())
+            DynamicType_ptr dynamic = factory->build_dynamic_type(callback.first, &resolution.type_id, &object);
+            if (nullptr != dynamic && register_dynamic_type(dynamic) != ReturnCode_t::RETCODE_OK)
             {
-                parent_requests_.erase(parent_it);
+                dynamic = DynamicType_ptr(nullptr);
             }
+            built_it = built_types.emplace(built_types.end(), callback.first, dynamic);
         }
 
-        on_child_requests_finished(parent_request);
+        if (nullptr != built_it->second)
+        {
+            callback.second(callback.first, built_it->second);
+        }
+        else
+        {
+            logWarning(PARTICIPANT, "Cannot register remote type " << callback.first);
+        }
     }
+
+    remove_type_resolution(resolution_it);
+
+    return true;
 }
 
-void DomainParticipantImpl::on_child_requests_finished(
-        const fastrtps::rtps::SampleIdentity& parent)
+void DomainParticipantImpl::remove_type_resolution(
+        std::map<fastrtps::rtps::SampleIdentity, RemoteTypeResolution>::iterator resolution_it)
 {
-    auto pending_requests_it = parent_requests_.find(parent);
-    // Do I have no more pending childs?
-    if (parent_requests_.end() == pending_requests_it || pending_requests_it->second.empty())
+    for (auto request_it = type_requests_.begin(); request_it != type_requests_.end();)
     {
-        // Am I a children?
-        auto child_it = child_requests_.find(parent);
-        if (child_requests_.end() != child_it)
+        if (request_it->second == resolution_it->first)
         {
-            remove_child_request(parent);
+            request_it = type_requests_.erase(request_it);
         }
         else
         {
-            // Or a top-level request?
-            auto cb_it = register_callbacks_.find(parent);
-            if (pending_requests_it->second.size() < 2)
+            ++request_it;
+        }
+    }
+    type_resolutions_.erase(resolution_it);
+}
+
+bool DomainParticipantImpl::expire_type_resolutions()
+{
+    std::lock_guard<std::mutex> lock(mtx_request_cb_);
+
+    const auto now = std::chrono::steady_clock::now();
+    for (auto resolution_it = type_resolutions_.begin(); resolution_it != type_resolutions_.end();)
+    {
+        auto current_it = resolution_it++;
+        if (current_it->second.expiration <= now)
+        {
+            // The calls waiting for the type are not notified. Discovering the type again requests it again.
+            for (const auto& callback : current_it->second.callbacks)
             {
-                parent_requests_.erase(pending_requests_it);
+                logWarning(PARTICIPANT, "Resolution of remote type " << callback.first << " timed out");
             }
-            cb_it->second.second(cb_it->second.first, fastrtps::types::DynamicType_ptr(nullptr)); // Everything should be already registered
-            register_callbacks_.erase(cb_it);
+            remove_type_resolution(current_it);
         }
     }
+
+    return !type_resolutions_.empty();
+}
+
+ReturnCode_t DomainParticipantImpl::register_dynamic_type(
+        fastrtps::types::DynamicType_ptr dyn_type)
+{
+    TypeSupport type(new fastrtps::types::DynamicPubSubType(dyn_type));
+    return participant_->register_type(type);
 }
 
 std::string DomainParticipantImpl::get_inner_type_name(
@@ -21,8 +21,10 @@
 #define _FASTDDS_PARTICIPANTIMPL_HPP_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/participant/RTPSParticipantListener.h>
 #include <fastdds/rtps/reader/StatefulReader.h>
+#include <fastdds/rtps/resources/TimedEvent.h>
 
 #include <fastdds/dds/publisher/qos/PublisherQos.hpp>
 #include <fastdds/dds/subscriber/qos/SubscriberQos.hpp>
@@ -53,6 +55,12 @@ class SubscriberAttributes;
 } // namespace fastrtps
 
 namespace fastdds {
+namespace rtps {
+
+class ParticipantIdLock;
+
+} // namespace rtps
+
 namespace dds {
 
 class DomainParticipant;
@@ -64,6 +72,12 @@ class Subscriber;
 class SubscriberImpl;
 class SubscriberListener;
 
+namespace recording {
+
+class Recorder;
+
+} // namespace recording
+
 /**
  * This is the implementation class of the DomainParticipant.
  * @ingroup FASTRTPS_MODULE
@@ -319,6 +333,9 @@ public:
     ReturnCode_t get_current_time(
             fastrtps::Time_t& current_time) const;
 
+    ReturnCode_t get_memory_usage(
+            fastrtps::rtps::ParticipantMemoryUsage& usage) const;
+
     const DomainParticipant* get_participant() const;
 
     DomainParticipant* get_participant();
@@ -390,6 +407,15 @@ public:
     DomainParticipantListener* get_listener_for(
             const StatusMask& status);
 
+    /**
+     * Returns the recorder of the samples received by the DataReaders of this participant,
+     * or nullptr if recording is not enabled.
+     */
+    recording::Recorder* recorder() const
+    {
+        return recorder_.get();
+    }
+
 protected:
 
     //!Domain id
@@ -398,6 +424,9 @@ protected:
     //!Participant id
     int32_t participant_id_ = -1;
 
+    //!Host-wide reservation of participant_id_, taken on construction so the pre-calculated guid is kept on enable
+    std::unique_ptr<fastdds::rtps::ParticipantIdLock> participant_id_lock_;
+
     //!Pre-calculated guid
     fastrtps::rtps::GUID_t guid_;
 
@@ -444,17 +473,52 @@ protected:
     // Mutex for requests and callbacks maps.
     std::mutex mtx_request_cb_;
 
-    // register_remote_type parent request, type_name, callback relationship.
-    std::map<fastrtps::rtps::SampleIdentity,
-            std::pair<std::string, std::function<void(
-                const std::string& name,
-                const fastrtps::types::DynamicType_ptr)>>> register_callbacks_;
+    /**
+     * Resolution of a remote type through the TypeLookup service.
+     * It is shared by all the register_remote_type calls for the same type while it is in flight, so the type and
+     * its dependencies are only requested once.
+     * A resolution not completed on time is forgotten, so the next call for the type requests it again.
+     */
+    struct RemoteTypeResolution
+    {
+        //! Complete identifier of the type being resolved.
+        fastrtps::types::TypeIdentifier type_id;
+
+        //! Time after which the resolution is given up.
+        std::chrono::steady_clock::time_point expiration;
+
+        //! Type name and callback of each register_remote_type call waiting for the type.
+        std::vector<std::pair<std::string, std::function<void(
+                    const std::string& name,
+                    const fastrtps::types::DynamicType_ptr)>>> callbacks;
+
+        //! Identifiers whose dependencies have already been requested.
+        fastrtps::types::TypeIdentifierSeq requested_dependencies;
+
+        //! Identifiers whose TypeObject has already been requested.
+        fastrtps::types::TypeIdentifierSeq requested_objects;
+
+        //! Identifiers whose TypeObject has been requested but not received yet.
+        fastrtps::types::TypeIdentifierSeq pending_objects;
 
-    // Relationship between child and parent request
-    std::map<fastrtps::rtps::SampleIdentity, fastrtps::rtps::SampleIdentity> child_requests_;
+        //! Number of get_type_dependencies requests not replied yet.
+        uint32_t pending_dependency_requests = 0;
+    };
 
-    // All parent's child requests
-    std::map<fastrtps::rtps::SampleIdentity, std::vector<fastrtps::rtps::SampleIdentity>> parent_requests_;
+    // Remote type resolutions in flight, by the request of the TypeObject of the type.
+    std::map<fastrtps::rtps::SampleIdentity, RemoteTypeResolution> type_resolutions_;
+
+    // Resolution of each request in flight.
+    std::map<fastrtps::rtps::SampleIdentity, fastrtps::rtps::SampleIdentity> type_requests_;
+
+    // Time given to a remote type resolution to complete, taken from property fastdds.type_lookup.resolution_timeout.
+    std::chrono::milliseconds type_resolution_timeout_;
+
+    // Forgets the remote type resolutions not completed on time. Only armed while resolutions are in flight.
+    std::unique_ptr<fastrtps::rtps::TimedEvent> type_resolution_event_;
+
+    //! Recorder of the received samples, created on enable when the fastdds.recorder properties are present
+    std::unique_ptr<recording::Recorder> recorder_;
 
     class MyRTPSParticipantListener : public fastrtps::rtps::RTPSParticipantListener
     {
@@ -524,8 +588,7 @@ protected:
     bool check_get_type_request(
             const fastrtps::rtps::SampleIdentity& requestId,
             const fastrtps::types::TypeIdentifier* identifier,
-            const fastrtps::types::TypeObject* object,
-            fastrtps::types::DynamicType_ptr dyn_type);
+            const fastrtps::types::TypeObject* object);
 
     bool check_get_dependencies_request(
             const fastrtps::rtps::SampleIdentity& requestId,
@@ -539,17 +602,28 @@ protected:
             const SubscriberQos& qos,
             SubscriberListener* listener);
 
-    // Always call it with the mutex already taken
-    void remove_parent_request(
-            const fastrtps::rtps::SampleIdentity& request);
+    // Always call it with the mutex already taken.
+    // Requests, in a single request of each kind, the dependencies and TypeObjects not requested yet by the
+    // resolution.
+    void request_type_dependencies(
+            const fastrtps::rtps::SampleIdentity& resolution_id,
+            RemoteTypeResolution& resolution,
+            const fastrtps::types::TypeIdentifierWithSizeSeq& dependencies,
+            const std::string& inner_type_name);
+
+    // Always call it with the mutex already taken.
+    // Registers the type and notifies the callbacks when nothing remains pending on the resolution.
+    bool try_complete_type_resolution(
+            std::map<fastrtps::rtps::SampleIdentity, RemoteTypeResolution>::iterator resolution_it);
 
-    // Always call it with the mutex already taken
-    void remove_child_request(
-            const fastrtps::rtps::SampleIdentity& request);
+    // Always call it with the mutex already taken.
+    // Forgets the resolution and its requests, including the ones whose reply was lost.
+    void remove_type_resolution(
+            std::map<fastrtps::rtps::SampleIdentity, RemoteTypeResolution>::iterator resolution_it);
 
-    // Always call it with the mutex already taken
-    void on_child_requests_finished(
-            const fastrtps::rtps::SampleIdentity& parent);
+    // Forgets the remote type resolutions not completed on time.
+    // Returns whether any resolution remains in flight.
+    bool expire_type_resolutions();
 
     void fill_pending_dependencies(
             const fastrtps::types::TypeIdentifierWithSizeSeq& dependencies,
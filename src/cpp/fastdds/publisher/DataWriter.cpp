@@ -98,6 +98,27 @@ ReturnCode_t DataWriter::write(
     return impl_->write(data, handle);
 }
 
+ReturnCode_t DataWriter::write_batch(
+        const std::vector<void*>& data)
+{
+    size_t written = 0;
+    return impl_->write_batch(data, written);
+}
+
+ReturnCode_t DataWriter::write_batch(
+        const std::vector<void*>& data,
+        size_t& written)
+{
+    return impl_->write_batch(data, written);
+}
+
+ReturnCode_t DataWriter::write_serialized(
+        const fastrtps::rtps::SerializedPayload_t& payload,
+        const InstanceHandle_t& handle)
+{
+    return impl_->write_serialized(payload, handle);
+}
+
 ReturnCode_t DataWriter::write_w_timestamp(
         void* data,
         const InstanceHandle_t& handle,
@@ -20,8 +20,14 @@
 
 #include <fastdds/publisher/DataWriterImpl.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <iostream>
+#include <limits>
 
 #include <fastdds/dds/domain/DomainParticipant.hpp>
 #include <fastdds/dds/log/Log.hpp>
@@ -32,6 +38,7 @@
 
 #include <fastdds/rtps/RTPSDomain.h>
 #include <fastdds/rtps/builtin/liveliness/WLP.h>
+#include <fastdds/rtps/common/RealtimeMonitor.hpp>
 #include <fastdds/rtps/participant/RTPSParticipant.h>
 #include <fastdds/rtps/resources/ResourceEvent.h>
 #include <fastdds/rtps/resources/TimedEvent.h>
@@ -65,6 +72,61 @@ static bool qos_has_pull_mode_request(
     return (nullptr != push_mode) && ("false" == *push_mode);
 }
 
+static bool qos_has_realtime_mode(
+        const DomainParticipantQos& qos)
+{
+    auto realtime_mode = PropertyPolicyHelper::find_property(qos.properties(), "fastdds.realtime_mode");
+    return (nullptr != realtime_mode) && ("true" == *realtime_mode);
+}
+
+static uint32_t qos_datasharing_payload_memory(
+        const DataWriterQos& qos)
+{
+    auto payload_memory = PropertyPolicyHelper::find_property(qos.properties(),
+                    "fastdds.datasharing.max_payload_memory");
+    if (nullptr == payload_memory)
+    {
+        return 0u;
+    }
+
+    // Only plain decimal numbers. strtoul alone would accept blanks, signs and trailing characters.
+    const char* str = payload_memory->c_str();
+    char* end = nullptr;
+    errno = 0;
+    unsigned long value = std::strtoul(str, &end, 10);
+    if (!std::isdigit(static_cast<unsigned char>(str[0])) || '\0' != *end || ERANGE == errno ||
+            value > std::numeric_limits<uint32_t>::max())
+    {
+        logWarning(DATA_WRITER, "Ignoring invalid fastdds.datasharing.max_payload_memory value '" <<
+                *payload_memory << "'");
+        return 0u;
+    }
+
+    return static_cast<uint32_t>(value);
+}
+
+static fastdds::rtps::SharedSegmentMemoryOptions qos_datasharing_memory_options(
+        const DataWriterQos& qos)
+{
+    fastdds::rtps::SharedSegmentMemoryOptions options;
+
+    auto huge_pages = PropertyPolicyHelper::find_property(qos.properties(), "fastdds.datasharing.huge_pages");
+    options.huge_pages = (nullptr != huge_pages) && ("true" == *huge_pages);
+
+    auto prefault = PropertyPolicyHelper::find_property(qos.properties(), "fastdds.datasharing.prefault");
+    options.prefault = (nullptr != prefault) && ("true" == *prefault);
+
+    auto numa_node = PropertyPolicyHelper::find_property(qos.properties(), "fastdds.datasharing.numa_node");
+    if (nullptr != numa_node)
+    {
+        options.numa_node = ("local" == *numa_node) ?
+                fastdds::rtps::SharedSegmentMemoryOptions::NUMA_NODE_LOCAL :
+                static_cast<int32_t>(std::strtol(numa_node->c_str(), nullptr, 10));
+    }
+
+    return options;
+}
+
 class DataWriterImpl::LoanCollection
 {
 public:
@@ -167,6 +229,7 @@ ReturnCode_t DataWriterImpl::enable()
     w_att.endpoint.remoteLocatorList = qos_.endpoint().remote_locator_list;
     w_att.mode = qos_.publish_mode().kind == SYNCHRONOUS_PUBLISH_MODE ? SYNCHRONOUS_WRITER : ASYNCHRONOUS_WRITER;
     w_att.flow_controller_name = qos_.publish_mode().flow_controller_name;
+    w_att.transport_priority = qos_.transport_priority().value;
     w_att.endpoint.properties = qos_.properties();
 
     if (qos_.endpoint().entity_id > 0)
@@ -280,6 +343,23 @@ ReturnCode_t DataWriterImpl::enable()
 
     writer_ = writer;
 
+    realtime_mode_ = qos_has_realtime_mode(publisher_->get_participant()->get_qos());
+    if (realtime_mode_ && PREALLOCATED_MEMORY_MODE != qos_.endpoint().history_memory_policy)
+    {
+        logWarning(DATA_WRITER, "Real-time mode needs PREALLOCATED_MEMORY_MODE to write without allocations");
+    }
+
+    // Data-sharing readers access the payloads of the writer directly, so they are never compressed.
+    if (!is_data_sharing_compatible_ &&
+            !fastdds::rtps::PayloadCompression::from_properties(qos_.properties(), compression_kind_,
+            compression_level_, compression_threshold_))
+    {
+        logWarning(DATA_WRITER, "Payload compression not available. Samples will be sent uncompressed");
+    }
+
+    // Batches up to the size of the history are written without growing the buffer of handles
+    batch_handles_.reserve(static_cast<size_t>(std::max(qos_.resource_limits().max_samples, qos_.history().depth)));
+
     // In case it has been loaded from the persistence DB, rebuild instances on history
     history_.rebuild_instances();
 
@@ -497,11 +577,7 @@ ReturnCode_t DataWriterImpl::write(
     InstanceHandle_t instance_handle;
     if (type_.get()->m_isGetKeyDefined)
     {
-        bool is_key_protected = false;
-#if HAVE_SECURITY
-        is_key_protected = writer_->getAttributes().security_attributes().is_key_protected;
-#endif // if HAVE_SECURITY
-        type_.get()->getKey(data, &instance_handle, is_key_protected);
+        get_key_hash(data, instance_handle);
     }
 
     //Check if the Handle is different from the special value HANDLE_NIL and
@@ -515,6 +591,178 @@ ReturnCode_t DataWriterImpl::write(
     return create_new_change_with_params(ALIVE, data, wparams, instance_handle);
 }
 
+ReturnCode_t DataWriterImpl::write_batch(
+        const std::vector<void*>& data,
+        size_t& written)
+{
+    written = 0;
+
+    if (writer_ == nullptr)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    if (data.empty())
+    {
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    // ALIVE changes only need valid samples. Check all of them before writing any.
+    if (data.end() != std::find(data.begin(), data.end(), nullptr))
+    {
+        logError(PUBLISHER, "Data pointer not valid");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    logInfo(DATA_WRITER, "Writing batch of " << data.size() << " samples");
+
+    RealtimeMonitor::Scope realtime_scope(realtime_mode_, "DataWriter::write");
+
+    auto max_blocking_time = steady_clock::now() +
+            microseconds(::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
+
+    std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex(), std::defer_lock);
+#if HAVE_STRICT_REALTIME
+    if (!RealtimeMonitor::try_lock_until(lock, max_blocking_time))
+    {
+        return ReturnCode_t::RETCODE_TIMEOUT;
+    }
+#else
+    RealtimeMonitor::lock(lock);
+#endif // if HAVE_STRICT_REALTIME
+
+    // The buffer of handles is shared by all the batches, so it is only used with the writer locked.
+    batch_handles_.assign(data.size(), c_InstanceHandle_Unknown);
+    if (type_->m_isGetKeyDefined)
+    {
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            get_key_hash(data[i], batch_handles_[i]);
+        }
+    }
+
+    // The whole batch is handed to the flow controller at once
+    writer_->begin_sample_batch(sample_batch_);
+
+    ReturnCode_t ret_code = ReturnCode_t::RETCODE_OK;
+    for (; written < data.size(); ++written)
+    {
+        WriteParams wparams;
+        ret_code = perform_create_new_change_nts(ALIVE, data[written], wparams, batch_handles_[written], lock,
+                        max_blocking_time);
+        if (!ret_code)
+        {
+            break;
+        }
+    }
+
+    if (!writer_->end_sample_batch(sample_batch_, max_blocking_time) &&
+            ReturnCode_t::RETCODE_OK == ret_code)
+    {
+        logError(DATA_WRITER, "Some samples of the batch could not be delivered");
+        ret_code = ReturnCode_t::RETCODE_ERROR;
+    }
+
+    if (0 < written)
+    {
+        restart_lifespan_timer();
+    }
+
+    return ret_code;
+}
+
+ReturnCode_t DataWriterImpl::write_serialized(
+        const SerializedPayload_t& payload,
+        const InstanceHandle_t& handle)
+{
+    if (writer_ == nullptr)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    if (nullptr == payload.data || 0 == payload.length)
+    {
+        logError(DATA_WRITER, "Serialized payload not valid");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    RealtimeMonitor::Scope realtime_scope(realtime_mode_, "DataWriter::write");
+
+    auto max_blocking_time = steady_clock::now() +
+            microseconds(::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
+
+    std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex(), std::defer_lock);
+#if HAVE_STRICT_REALTIME
+    if (!RealtimeMonitor::try_lock_until(lock, max_blocking_time))
+    {
+        return ReturnCode_t::RETCODE_TIMEOUT;
+    }
+#else
+    RealtimeMonitor::lock(lock);
+#endif // if HAVE_STRICT_REALTIME
+
+    uint32_t size = payload.length;
+    PayloadInfo_t payload_info;
+    if (!get_free_payload_from_pool([size]()
+            {
+                return size;
+            }, payload_info))
+    {
+        return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
+    }
+
+    if (payload_info.payload.max_size < size)
+    {
+        logError(DATA_WRITER, "Serialized payload bigger than the maximum size of the type");
+        return_payload_to_pool(payload_info);
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    memcpy(payload_info.payload.data, payload.data, size);
+    payload_info.payload.length = size;
+    payload_info.payload.encapsulation = payload.encapsulation;
+
+    InstanceHandle_t instance_handle;
+    if (type_->m_isGetKeyDefined)
+    {
+        // The key can only be obtained from the deserialized sample
+        void* sample = type_->createData();
+        bool is_deserialized = type_->deserialize(&payload_info.payload, sample);
+        if (is_deserialized)
+        {
+            get_key_hash(sample, instance_handle);
+        }
+        type_->deleteData(sample);
+
+        if (!is_deserialized)
+        {
+            logWarning(DATA_WRITER, "Cannot compute the key of a serialized payload");
+            return_payload_to_pool(payload_info);
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+        }
+    }
+
+    //Check if the Handle is different from the special value HANDLE_NIL and
+    //does not correspond with the instance referred by the payload
+    if (handle.isDefined() && handle != instance_handle)
+    {
+        return_payload_to_pool(payload_info);
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    compress_payload_nts(payload_info.payload);
+
+    WriteParams wparams;
+    ReturnCode_t ret_code = add_payload_change_nts(ALIVE, payload_info, nullptr, wparams, instance_handle, lock,
+                    max_blocking_time);
+    if (ReturnCode_t::RETCODE_OK == ret_code)
+    {
+        restart_lifespan_timer();
+    }
+
+    return ret_code;
+}
+
 InstanceHandle_t DataWriterImpl::register_instance(
         void* key)
 {
@@ -537,11 +785,7 @@ InstanceHandle_t DataWriterImpl::register_instance(
     }
 
     InstanceHandle_t instance_handle = c_InstanceHandle_Unknown;
-    bool is_key_protected = false;
-#if HAVE_SECURITY
-    is_key_protected = writer_->getAttributes().security_attributes().is_key_protected;
-#endif // if HAVE_SECURITY
-    type_->getKey(key, &instance_handle, is_key_protected);
+    get_key_hash(key, instance_handle);
 
     // Block lowlevel writer
     auto max_blocking_time = std::chrono::steady_clock::now() +
@@ -593,11 +837,7 @@ ReturnCode_t DataWriterImpl::unregister_instance(
     if (c_InstanceHandle_Unknown == ih)
 #endif // if !defined(NDEBUG)
     {
-        bool is_key_protected = false;
-#if HAVE_SECURITY
-        is_key_protected = writer_->getAttributes().security_attributes().is_key_protected;
-#endif // if HAVE_SECURITY
-        type_->getKey(instance, &ih, is_key_protected);
+        get_key_hash(instance, ih);
     }
 
 #if !defined(NDEBUG)
@@ -668,20 +908,40 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
         WriteParams& wparams,
         const InstanceHandle_t& handle)
 {
+    RealtimeMonitor::Scope realtime_scope(realtime_mode_, "DataWriter::write");
+
     // Block lowlevel writer
     auto max_blocking_time = steady_clock::now() +
             microseconds(::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
 
-#if HAVE_STRICT_REALTIME
     std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex(), std::defer_lock);
-    if (!lock.try_lock_until(max_blocking_time))
+#if HAVE_STRICT_REALTIME
+    if (!RealtimeMonitor::try_lock_until(lock, max_blocking_time))
     {
         return ReturnCode_t::RETCODE_TIMEOUT;
     }
 #else
-    std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex());
+    RealtimeMonitor::lock(lock);
 #endif // if HAVE_STRICT_REALTIME
 
+    ReturnCode_t ret_code = perform_create_new_change_nts(change_kind, data, wparams, handle, lock,
+                    max_blocking_time);
+    if (ReturnCode_t::RETCODE_OK == ret_code)
+    {
+        restart_lifespan_timer();
+    }
+
+    return ret_code;
+}
+
+ReturnCode_t DataWriterImpl::perform_create_new_change_nts(
+        ChangeKind_t change_kind,
+        void* data,
+        WriteParams& wparams,
+        const InstanceHandle_t& handle,
+        std::unique_lock<RecursiveTimedMutex>& lock,
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
     PayloadInfo_t payload;
     bool was_loaned = check_and_remove_loan(data, payload);
     if (!was_loaned)
@@ -697,8 +957,23 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
             return_payload_to_pool(payload);
             return ReturnCode_t::RETCODE_ERROR;
         }
+
+        compress_payload_nts(payload.payload);
     }
 
+    return add_payload_change_nts(change_kind, payload, was_loaned ? data : nullptr, wparams, handle, lock,
+                   max_blocking_time);
+}
+
+ReturnCode_t DataWriterImpl::add_payload_change_nts(
+        ChangeKind_t change_kind,
+        PayloadInfo_t& payload,
+        void* loaned_data,
+        WriteParams& wparams,
+        const InstanceHandle_t& handle,
+        std::unique_lock<RecursiveTimedMutex>& lock,
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
     CacheChange_t* ch = writer_->new_change(change_kind, handle);
     if (ch != nullptr)
     {
@@ -706,10 +981,10 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
 
         if (!this->history_.add_pub_change(ch, wparams, lock, max_blocking_time))
         {
-            if (was_loaned)
+            if (nullptr != loaned_data)
             {
                 payload.move_from_change(*ch);
-                add_loan(data, payload);
+                add_loan(loaned_data, payload);
             }
             writer_->release_change(ch);
             return ReturnCode_t::RETCODE_TIMEOUT;
@@ -736,20 +1011,57 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
             }
         }
 
-        if (qos_.lifespan().duration != c_TimeInfinite)
-        {
-            lifespan_duration_us_ = duration<double, std::ratio<1, 1000000>>(
-                qos_.lifespan().duration.to_ns() * 1e-3);
-            lifespan_timer_->update_interval_millisec(qos_.lifespan().duration.to_ns() * 1e-6);
-            lifespan_timer_->restart_timer();
-        }
-
         return ReturnCode_t::RETCODE_OK;
     }
 
     return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
 }
 
+void DataWriterImpl::compress_payload_nts(
+        SerializedPayload_t& payload)
+{
+    if ((fastdds::rtps::PayloadCompressionKind::NONE != compression_kind_) &&
+            (payload.length >= compression_threshold_) &&
+            writer_->can_send_compressed(static_cast<uint8_t>(compression_kind_)))
+    {
+        writer_->keep_uncompressed_payload(payload);
+        fastdds::rtps::PayloadCompression::compress(compression_kind_, compression_level_, payload,
+                compression_buffer_);
+    }
+}
+
+void DataWriterImpl::restart_lifespan_timer()
+{
+    if (qos_.lifespan().duration != c_TimeInfinite)
+    {
+        lifespan_duration_us_ = duration<double, std::ratio<1, 1000000>>(
+            qos_.lifespan().duration.to_ns() * 1e-3);
+        lifespan_timer_->update_interval_millisec(qos_.lifespan().duration.to_ns() * 1e-6);
+        lifespan_timer_->restart_timer();
+    }
+}
+
+void DataWriterImpl::get_key_hash(
+        void* data,
+        InstanceHandle_t& handle)
+{
+    bool is_key_protected = false;
+#if HAVE_SECURITY
+    is_key_protected = writer_->getAttributes().security_attributes().is_key_protected;
+#endif // if HAVE_SECURITY
+
+    std::lock_guard<std::mutex> guard(key_hash_mutex_);
+    size_t max_key_length = 0;
+    if (type_->serialize_key(data, &key_buffer_, max_key_length))
+    {
+        key_hash_cache_.get_key_hash(key_buffer_.data, key_buffer_.length, is_key_protected, max_key_length, handle);
+    }
+    else
+    {
+        type_->getKey(data, &handle, is_key_protected);
+    }
+}
+
 ReturnCode_t DataWriterImpl::create_new_change_with_params(
         ChangeKind_t changeKind,
         void* data,
@@ -764,11 +1076,7 @@ ReturnCode_t DataWriterImpl::create_new_change_with_params(
     InstanceHandle_t handle;
     if (type_->m_isGetKeyDefined)
     {
-        bool is_key_protected = false;
-#if HAVE_SECURITY
-        is_key_protected = writer_->getAttributes().security_attributes().is_key_protected;
-#endif // if HAVE_SECURITY
-        type_->getKey(data, &handle, is_key_protected);
+        get_key_hash(data, handle);
     }
 
     return perform_create_new_change(changeKind, data, wparams, handle);
@@ -869,6 +1177,9 @@ ReturnCode_t DataWriterImpl::set_qos(
         WriterQos wqos = qos_.get_writerqos(get_publisher()->get_qos(), topic_->get_qos());
         publisher_->rtps_participant()->updateWriter(writer_, topic_att, wqos);
 
+        // Transport priority
+        writer_->set_transport_priority(qos_.transport_priority().value);
+
         // Deadline
         if (qos_.deadline().period != c_TimeInfinite)
         {
@@ -1520,7 +1831,11 @@ std::shared_ptr<IPayloadPool> DataWriterImpl::get_payload_pool()
         // Get payload pool reference and allocate space for our history
         if (is_data_sharing_compatible_)
         {
-            payload_pool_ = DataSharingPayloadPool::get_writer_pool(config);
+            // Unbounded types need the payloads to be carved from a memory region of the configured size
+            uint32_t payload_memory = (type_->is_bounded() || type_->is_plain()) ?
+                    0u : qos_datasharing_payload_memory(qos_);
+            payload_pool_ = DataSharingPayloadPool::get_writer_pool(config, payload_memory,
+                            qos_datasharing_memory_options(qos_));
         }
         else
         {
@@ -1593,7 +1908,7 @@ ReturnCode_t DataWriterImpl::check_datasharing_compatible(
     bool has_bound_payload_size =
             (qos_.endpoint().history_memory_policy == eprosima::fastrtps::rtps::PREALLOCATED_MEMORY_MODE ||
             qos_.endpoint().history_memory_policy == eprosima::fastrtps::rtps::PREALLOCATED_WITH_REALLOC_MEMORY_MODE) &&
-            type_.is_bounded();
+            (type_.is_bounded() || 0u != qos_datasharing_payload_memory(qos_));
 
     bool has_key = type_->m_isGetKeyDefined;
 
@@ -1615,7 +1930,8 @@ ReturnCode_t DataWriterImpl::check_datasharing_compatible(
             if (!has_bound_payload_size)
             {
                 logError(DATA_WRITER, "Data sharing cannot be used with " <<
-                        (type_.is_bounded() ? "memory policies other than PREALLOCATED" : "unbounded data types"));
+                        (type_.is_bounded() ? "memory policies other than PREALLOCATED" :
+                        "unbounded data types unless fastdds.datasharing.max_payload_memory is set"));
                 return ReturnCode_t::RETCODE_BAD_PARAMETER;
             }
 
@@ -19,6 +19,8 @@
 #ifndef _FASTRTPS_DATAWRITERIMPL_HPP_
 #define _FASTRTPS_DATAWRITERIMPL_HPP_
 
+#include <mutex>
+
 #include <fastdds/dds/core/status/BaseStatus.hpp>
 #include <fastdds/dds/core/status/IncompatibleQosStatus.hpp>
 #include <fastdds/dds/publisher/DataWriter.hpp>
@@ -30,6 +32,7 @@
 #include <fastdds/rtps/attributes/WriterAttributes.h>
 #include <fastdds/rtps/common/LocatorList.hpp>
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/SerializedPayload.h>
 #include <fastdds/rtps/common/WriteParams.h>
 #include <fastdds/rtps/history/IPayloadPool.h>
 #include <fastdds/rtps/writer/WriterListener.h>
@@ -40,9 +43,12 @@
 
 #include <fastrtps/types/TypesBase.h>
 
+#include <rtps/common/PayloadCompression.hpp>
 #include <rtps/common/PayloadInfo_t.hpp>
+#include <rtps/flowcontrol/FlowControllerSampleBatch.hpp>
 #include <rtps/history/ITopicPayloadPool.h>
 #include <rtps/DataSharing/DataSharingPayloadPool.hpp>
+#include <utils/KeyHashCache.hpp>
 
 using eprosima::fastrtps::types::ReturnCode_t;
 
@@ -172,6 +178,27 @@ public:
             void* data,
             const InstanceHandle_t& handle);
 
+    /**
+     * Write a batch of samples, blocking the writer only once.
+     * @param data Pointers to the samples, written in order.
+     * @param[out] written Number of samples added to the history, from the beginning of the batch.
+     * @return RETCODE_OK if all the samples were written, or the error of the first one that could not be written.
+     * RETCODE_ERROR if the samples were written but some of them could not be delivered.
+     */
+    ReturnCode_t write_batch(
+            const std::vector<void*>& data,
+            size_t& written);
+
+    /**
+     * Write a sample which is already serialized.
+     * @param payload Serialized sample, including its encapsulation.
+     * @param handle Instance of the sample, which must correspond to the payload, or HANDLE_NIL.
+     * @return RETCODE_OK if the sample was written, or the error that prevented it.
+     */
+    ReturnCode_t write_serialized(
+            const fastrtps::rtps::SerializedPayload_t& payload,
+            const InstanceHandle_t& handle);
+
     /*!
      * @brief Implementation of the DDS `register_instance` operation.
      * It deduces the instance's key and tries to get resources in the PublisherHistory.
@@ -359,16 +386,46 @@ protected:
     //! The lifespan duration, in microseconds
     std::chrono::duration<double, std::ratio<1, 1000000>> lifespan_duration_us_;
 
+    //! Keeps the new changes of write_batch() until they are handed to the flow controller
+    fastdds::rtps::FlowControllerSampleBatch sample_batch_;
+
+    //! Instance handles of the samples of write_batch(). Reserved on enable and guarded by the writer mutex.
+    std::vector<InstanceHandle_t> batch_handles_;
+
     DataWriter* user_datawriter_ = nullptr;
 
     bool is_data_sharing_compatible_ = false;
 
+    //! Whether the participant has the real-time mode enabled, so writing is a real-time path
+    bool realtime_mode_ = false;
+
     uint32_t fixed_payload_size_ = 0u;
 
     std::shared_ptr<IPayloadPool> payload_pool_;
 
     std::unique_ptr<LoanCollection> loans_;
 
+    //! Algorithm compressing the samples sent over the network (property fastdds.compression)
+    fastdds::rtps::PayloadCompressionKind compression_kind_ = fastdds::rtps::PayloadCompressionKind::NONE;
+
+    //! Compression level (property fastdds.compression.level)
+    int32_t compression_level_ = 0;
+
+    //! Samples with a smaller serialized size are not compressed (property fastdds.compression.threshold)
+    uint32_t compression_threshold_ = 1024u;
+
+    //! Scratch buffer used while compressing
+    std::vector<fastrtps::rtps::octet> compression_buffer_;
+
+    //! Key hashes already computed, for types able to serialize their keys
+    fastrtps::KeyHashCache key_hash_cache_;
+
+    //! Buffer where the keys are serialized to look them up on the cache
+    fastrtps::rtps::SerializedPayload_t key_buffer_;
+
+    //! Protects the cache of key hashes and its buffer, as samples may be written from several threads
+    std::mutex key_hash_mutex_;
+
     virtual fastrtps::rtps::RTPSWriter* create_rtps_writer(
             fastrtps::rtps::RTPSParticipant* p,
             fastrtps::rtps::WriterAttributes& watt,
@@ -412,6 +469,16 @@ protected:
             fastrtps::rtps::WriteParams& wparams,
             const InstanceHandle_t& handle);
 
+    /**
+     * Get the instance handle of a sample, looking it up on the cache of key hashes when the type can serialize
+     * its key.
+     * @param data Sample whose key is hashed.
+     * @param [out] handle Instance handle of the sample.
+     */
+    void get_key_hash(
+            void* data,
+            InstanceHandle_t& handle);
+
     /**
      * Removes the cache change with the minimum sequence number
      * @return True if correct.
@@ -446,6 +513,44 @@ protected:
             fastrtps::rtps::WriteParams& wparams,
             const InstanceHandle_t& handle);
 
+    /**
+     * Creates a new change and adds it to the history.
+     * @note The writer mutex has to be locked by @c lock.
+     */
+    ReturnCode_t perform_create_new_change_nts(
+            fastrtps::rtps::ChangeKind_t change_kind,
+            void* data,
+            fastrtps::rtps::WriteParams& wparams,
+            const InstanceHandle_t& handle,
+            std::unique_lock<fastrtps::RecursiveTimedMutex>& lock,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
+    /**
+     * Creates a new change with an already filled payload and adds it to the history.
+     * @param change_kind Kind of the change.
+     * @param payload Payload of the change. It is given back to its loan when the change cannot be added.
+     * @param loaned_data Sample loaned with @ref loan_sample the payload belongs to, or nullptr.
+     * @note The writer mutex has to be locked by @c lock.
+     */
+    ReturnCode_t add_payload_change_nts(
+            fastrtps::rtps::ChangeKind_t change_kind,
+            PayloadInfo_t& payload,
+            void* loaned_data,
+            fastrtps::rtps::WriteParams& wparams,
+            const InstanceHandle_t& handle,
+            std::unique_lock<fastrtps::RecursiveTimedMutex>& lock,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
+    /**
+     * Compresses a serialized payload, when compression is enabled and the writer has remote readers.
+     * The original payload is kept by the writer for the readers of this process.
+     * @note The writer mutex has to be locked.
+     */
+    void compress_payload_nts(
+            fastrtps::rtps::SerializedPayload_t& payload);
+
+    void restart_lifespan_timer();
+
     static fastrtps::TopicAttributes get_topic_attributes(
             const DataWriterQos& qos,
             const Topic& topic,
@@ -0,0 +1,254 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Recorder.cpp
+ */
+
+#include <fastdds/recording/Recorder.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/recording/RecordingFile.hpp>
+#include <fastdds/rtps/common/Time_t.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+#include <sstream>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace recording {
+
+using namespace eprosima::fastrtps::rtps;
+
+//! Maximum time a captured sample waits for the background thread.
+static constexpr std::chrono::milliseconds FLUSH_PERIOD(100);
+
+std::unique_ptr<Recorder> Recorder::create(
+        const PropertyPolicy& properties)
+{
+    auto file = PropertyPolicyHelper::find_property(properties, "fastdds.recorder.file");
+    if (nullptr == file || file->empty())
+    {
+        return nullptr;
+    }
+
+    std::vector<std::string> topics;
+    auto topic_list = PropertyPolicyHelper::find_property(properties, "fastdds.recorder.topics");
+    if (nullptr != topic_list)
+    {
+        std::stringstream stream(*topic_list);
+        std::string topic;
+        while (std::getline(stream, topic, ';'))
+        {
+            if (!topic.empty())
+            {
+                topics.push_back(topic);
+            }
+        }
+    }
+
+    uint64_t segment_size = DEFAULT_SEGMENT_SIZE;
+    auto segment_size_property = PropertyPolicyHelper::find_property(properties, "fastdds.recorder.segment_size");
+    if (nullptr != segment_size_property)
+    {
+        segment_size = std::strtoull(segment_size_property->c_str(), nullptr, 10);
+    }
+
+    uint32_t buffer_size = DEFAULT_BUFFER_SIZE;
+    auto buffer_size_property = PropertyPolicyHelper::find_property(properties, "fastdds.recorder.buffer_size");
+    if (nullptr != buffer_size_property)
+    {
+        unsigned long value = std::strtoul(buffer_size_property->c_str(), nullptr, 10);
+        buffer_size = value > std::numeric_limits<uint32_t>::max() ?
+                std::numeric_limits<uint32_t>::max() : static_cast<uint32_t>(value);
+    }
+
+    std::unique_ptr<Recorder> recorder(new Recorder(*file, topics, segment_size, buffer_size));
+    if (!recorder->start())
+    {
+        return nullptr;
+    }
+    return recorder;
+}
+
+Recorder::Recorder(
+        const std::string& base_name,
+        const std::vector<std::string>& topics,
+        uint64_t segment_size,
+        uint32_t buffer_size)
+    : file_(new RecordingFileWriter(base_name, segment_size))
+    , topics_(topics)
+    , capture_buffer_(buffer_size)
+{
+}
+
+Recorder::~Recorder()
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        running_ = false;
+    }
+    cv_.notify_one();
+
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+
+    file_->close();
+
+    if (dropped_samples() > 0)
+    {
+        logWarning(RECORDING, dropped_samples() << " samples were dropped because the capture buffer was full");
+    }
+}
+
+bool Recorder::start()
+{
+    if (!file_->open())
+    {
+        return false;
+    }
+
+    running_ = true;
+    thread_ = std::thread(&Recorder::run, this);
+    return true;
+}
+
+bool Recorder::records(
+        const std::string& topic_name) const
+{
+    return topics_.empty() || std::find(topics_.begin(), topics_.end(), topic_name) != topics_.end();
+}
+
+uint16_t Recorder::register_topic(
+        const std::string& topic_name,
+        const std::string& type_name)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    auto topic_key = std::make_pair(topic_name, type_name);
+    auto it = std::find(registered_topics_.begin(), registered_topics_.end(), topic_key);
+    uint16_t topic_id = static_cast<uint16_t>(std::distance(registered_topics_.begin(), it));
+
+    if (it == registered_topics_.end())
+    {
+        registered_topics_.push_back(topic_key);
+
+        std::vector<octet> record(topic_record_size(topic_name, type_name));
+        fill_topic_record(record.data(), topic_id, topic_name, type_name);
+        pending_topics_.push_back(std::move(record));
+    }
+
+    return topic_id;
+}
+
+bool Recorder::record(
+        uint16_t topic_id,
+        const CacheChange_t& change)
+{
+    uint32_t size = sample_record_size(change.serializedPayload.length);
+    int64_t reception_timestamp = change.reader_info.receptionTimestamp.to_ns();
+    if (0 == reception_timestamp)
+    {
+        fastrtps::rtps::Time_t now;
+        fastrtps::rtps::Time_t::now(now);
+        reception_timestamp = now.to_ns();
+    }
+
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    if (capture_buffer_.size() - capture_used_ < size)
+    {
+        dropped_samples_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    last_timestamp_ = (std::max)(last_timestamp_, reception_timestamp);
+    fill_sample_record(&capture_buffer_[capture_used_], topic_id, last_timestamp_, change);
+
+    // Wake up the background thread when half of the buffer is in use
+    size_t half = capture_buffer_.size() / 2;
+    bool notify = capture_used_ < half && capture_used_ + size >= half;
+    capture_used_ += size;
+    if (notify)
+    {
+        cv_.notify_one();
+    }
+
+    return true;
+}
+
+void Recorder::run()
+{
+    std::vector<octet> records(capture_buffer_.size());
+    std::vector<std::vector<octet>> topics;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    bool running = true;
+    while (running)
+    {
+        cv_.wait_for(lock, FLUSH_PERIOD, [this]()
+                {
+                    return !running_ || capture_used_ >= capture_buffer_.size() / 2;
+                });
+
+        running = running_;
+        topics.swap(pending_topics_);
+        records.swap(capture_buffer_);
+        size_t used = capture_used_;
+        capture_used_ = 0;
+        lock.unlock();
+
+        // Topics are registered before their samples are captured
+        for (const std::vector<octet>& topic_record : topics)
+        {
+            file_->append(topic_record.data());
+        }
+        topics.clear();
+
+        write_buffer(records, used);
+
+        lock.lock();
+    }
+}
+
+void Recorder::write_buffer(
+        const std::vector<octet>& buffer,
+        size_t used)
+{
+    for (size_t offset = 0; offset < used;)
+    {
+        const RecordHeader* header = reinterpret_cast<const RecordHeader*>(buffer.data() + offset);
+        if (file_->append(buffer.data() + offset))
+        {
+            recorded_samples_.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            dropped_samples_.fetch_add(1, std::memory_order_relaxed);
+        }
+        offset += header->size;
+    }
+}
+
+} // namespace recording
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,170 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Recorder.hpp
+ */
+
+#ifndef _FASTDDS_RECORDING_RECORDER_HPP_
+#define _FASTDDS_RECORDING_RECORDER_HPP_
+
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
+#include <fastdds/rtps/common/CacheChange.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace recording {
+
+class RecordingFileWriter;
+
+/**
+ * Records the samples received by the DataReaders of a participant.
+ *
+ * It is enabled with the following properties of the participant:
+ *   - fastdds.recorder.file: path of the recording, without the segment suffix. Mandatory.
+ *   - fastdds.recorder.topics: names of the topics to record, separated by semicolons. All by default.
+ *   - fastdds.recorder.segment_size: size of the segment files in octets.
+ *   - fastdds.recorder.buffer_size: size of the capture buffers in octets.
+ *
+ * Samples are copied to a capture buffer on the reception thread, and a background thread moves them to the
+ * recording. When the capture buffer is full the samples are dropped instead of blocking the reception.
+ */
+class Recorder
+{
+public:
+
+    //! Default size of the capture buffers.
+    static constexpr uint32_t DEFAULT_BUFFER_SIZE = 4 * 1024 * 1024;
+
+    /**
+     * Creates a recorder from the properties of a participant.
+     * @param properties Properties of the participant.
+     * @return nullptr if recording is not enabled on the properties, or it cannot be started.
+     */
+    static std::unique_ptr<Recorder> create(
+            const fastrtps::rtps::PropertyPolicy& properties);
+
+    /**
+     * @param base_name Path of the recording, without the segment suffix.
+     * @param topics Names of the topics to record. All of them if empty.
+     * @param segment_size Size of the segment files.
+     * @param buffer_size Size of the capture buffers.
+     */
+    Recorder(
+            const std::string& base_name,
+            const std::vector<std::string>& topics,
+            uint64_t segment_size,
+            uint32_t buffer_size);
+
+    //! Moves the pending samples to the recording and closes it.
+    ~Recorder();
+
+    /**
+     * Creates the recording and launches the background thread.
+     * @return false if the recording cannot be created.
+     */
+    bool start();
+
+    /**
+     * @return Whether the samples of the given topic should be recorded.
+     */
+    bool records(
+            const std::string& topic_name) const;
+
+    /**
+     * Adds a topic to the recording.
+     * @return Identifier of the topic on the recording.
+     */
+    uint16_t register_topic(
+            const std::string& topic_name,
+            const std::string& type_name);
+
+    /**
+     * Copies a received sample to the capture buffer. It never blocks waiting for the recording.
+     * @param topic_id Identifier returned by register_topic.
+     * @param change Received change.
+     * @return false if the sample was dropped because the capture buffer is full.
+     */
+    bool record(
+            uint16_t topic_id,
+            const fastrtps::rtps::CacheChange_t& change);
+
+    //! @return Number of samples recorded.
+    uint64_t recorded_samples() const
+    {
+        return recorded_samples_.load(std::memory_order_relaxed);
+    }
+
+    //! @return Number of samples dropped because the capture buffer was full.
+    uint64_t dropped_samples() const
+    {
+        return dropped_samples_.load(std::memory_order_relaxed);
+    }
+
+private:
+
+    void run();
+
+    void write_buffer(
+            const std::vector<fastrtps::rtps::octet>& buffer,
+            size_t used);
+
+    std::unique_ptr<RecordingFileWriter> file_;
+
+    std::vector<std::string> topics_;
+
+    //! Protects the members below.
+    std::mutex mutex_;
+
+    std::condition_variable cv_;
+
+    //! Buffer where samples are captured.
+    std::vector<fastrtps::rtps::octet> capture_buffer_;
+
+    size_t capture_used_ = 0;
+
+    //! Topic records not yet written to the recording.
+    std::vector<std::vector<fastrtps::rtps::octet>> pending_topics_;
+
+    //! Names and types of the registered topics, by identifier.
+    std::vector<std::pair<std::string, std::string>> registered_topics_;
+
+    //! Last timestamp given to a sample, to keep the time index monotonic.
+    int64_t last_timestamp_ = 0;
+
+    bool running_ = false;
+
+    std::thread thread_;
+
+    std::atomic<uint64_t> recorded_samples_{0};
+
+    std::atomic<uint64_t> dropped_samples_{0};
+};
+
+} // namespace recording
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_RECORDING_RECORDER_HPP_
@@ -0,0 +1,504 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RecordingFile.cpp
+ */
+
+#include <fastdds/recording/RecordingFile.hpp>
+
+#include <boostconfig.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace recording {
+
+using namespace eprosima::fastrtps::rtps;
+namespace bi = boost::interprocess;
+
+static const char FILE_MAGIC[8] = "FDDSREC";
+
+//! Minimum size of the segment files.
+static constexpr uint64_t MIN_SEGMENT_SIZE = 64 * 1024;
+
+//! A time index entry is reserved for every 256 octets of the segment.
+static constexpr uint64_t OCTETS_PER_INDEX_ENTRY = 256;
+
+static uint32_t align_record_size(
+        uint64_t size)
+{
+    return static_cast<uint32_t>((size + 7u) & ~static_cast<uint64_t>(7u));
+}
+
+std::string segment_file_name(
+        const std::string& base_name,
+        uint32_t segment_index)
+{
+    char suffix[16];
+    snprintf(suffix, sizeof(suffix), "_%04u", segment_index);
+    return base_name + suffix + SEGMENT_EXTENSION;
+}
+
+uint32_t topic_record_size(
+        const std::string& topic_name,
+        const std::string& type_name)
+{
+    return align_record_size(sizeof(RecordHeader) + sizeof(TopicRecord) + topic_name.size() + type_name.size());
+}
+
+void fill_topic_record(
+        octet* buffer,
+        uint16_t topic_id,
+        const std::string& topic_name,
+        const std::string& type_name)
+{
+    uint32_t size = topic_record_size(topic_name, type_name);
+    memset(buffer, 0, size);
+
+    RecordHeader* header = reinterpret_cast<RecordHeader*>(buffer);
+    header->size = size;
+    header->kind = TOPIC_RECORD;
+    header->topic_id = topic_id;
+
+    TopicRecord* topic = reinterpret_cast<TopicRecord*>(buffer + sizeof(RecordHeader));
+    topic->name_length = static_cast<uint16_t>(topic_name.size());
+    topic->type_name_length = static_cast<uint16_t>(type_name.size());
+
+    octet* names = buffer + sizeof(RecordHeader) + sizeof(TopicRecord);
+    memcpy(names, topic_name.data(), topic_name.size());
+    memcpy(names + topic_name.size(), type_name.data(), type_name.size());
+}
+
+uint32_t sample_record_size(
+        uint32_t payload_length)
+{
+    return align_record_size(sizeof(RecordHeader) + sizeof(SampleRecord) + uint64_t(payload_length));
+}
+
+void fill_sample_record(
+        octet* buffer,
+        uint16_t topic_id,
+        int64_t timestamp,
+        const CacheChange_t& change)
+{
+    uint32_t payload_length = change.serializedPayload.length;
+    uint32_t size = sample_record_size(payload_length);
+
+    RecordHeader* header = reinterpret_cast<RecordHeader*>(buffer);
+    header->size = size;
+    header->kind = SAMPLE_RECORD;
+    header->topic_id = topic_id;
+
+    SampleRecord* sample = reinterpret_cast<SampleRecord*>(buffer + sizeof(RecordHeader));
+    sample->timestamp = timestamp;
+    sample->source_timestamp = change.sourceTimestamp.to_ns();
+    sample->reception_timestamp = change.reader_info.receptionTimestamp.to_ns();
+    memcpy(sample->writer_guid, change.writerGUID.guidPrefix.value, GuidPrefix_t::size);
+    memcpy(sample->writer_guid + GuidPrefix_t::size, change.writerGUID.entityId.value, EntityId_t::size);
+    sample->sequence_number_high = change.sequenceNumber.high;
+    sample->sequence_number_low = change.sequenceNumber.low;
+    memcpy(sample->instance_handle, change.instanceHandle.value, sizeof(sample->instance_handle));
+    sample->change_kind = static_cast<uint32_t>(change.kind);
+    sample->payload_length = payload_length;
+
+    octet* payload = buffer + sizeof(RecordHeader) + sizeof(SampleRecord);
+    if (payload_length > 0)
+    {
+        memcpy(payload, change.serializedPayload.data, payload_length);
+    }
+    memset(payload + payload_length, 0, size - (sizeof(RecordHeader) + sizeof(SampleRecord) + payload_length));
+}
+
+RecordingFileWriter::RecordingFileWriter(
+        const std::string& base_name,
+        uint64_t segment_size)
+    : base_name_(base_name)
+    , segment_size_((std::max)(segment_size, MIN_SEGMENT_SIZE))
+{
+}
+
+RecordingFileWriter::~RecordingFileWriter()
+{
+    close();
+}
+
+bool RecordingFileWriter::open()
+{
+    segment_index_ = 0;
+    return open_segment();
+}
+
+bool RecordingFileWriter::append(
+        const octet* record)
+{
+    const RecordHeader* header = reinterpret_cast<const RecordHeader*>(record);
+
+    if (!region_)
+    {
+        return false;
+    }
+
+    if (!fits(*header))
+    {
+        // Check the record would fit on a new segment before creating it
+        uint64_t topics_size = 0;
+        for (const std::vector<octet>& topic_record : topic_records_)
+        {
+            topics_size += topic_record.size();
+        }
+        if (header->size > segment_size_ - header_->data_offset - topics_size)
+        {
+            logWarning(RECORDING, "Record of " << header->size << " octets does not fit on a segment");
+            return false;
+        }
+
+        ++segment_index_;
+        if (!open_segment())
+        {
+            return false;
+        }
+    }
+
+    write_record(record);
+    if (TOPIC_RECORD == header->kind)
+    {
+        topic_records_.emplace_back(record, record + header->size);
+    }
+    return true;
+}
+
+void RecordingFileWriter::close()
+{
+    region_.reset();
+    header_ = nullptr;
+    index_ = nullptr;
+    data_ = nullptr;
+}
+
+bool RecordingFileWriter::open_segment()
+{
+    close();
+
+    std::string file_name = segment_file_name(base_name_, segment_index_);
+
+    // Create the file with its final size, so it can be mapped at once
+    {
+        std::filebuf file;
+        if (nullptr == file.open(file_name,
+                std::ios_base::in | std::ios_base::out | std::ios_base::trunc | std::ios_base::binary))
+        {
+            logError(RECORDING, "Cannot create recording file " << file_name);
+            return false;
+        }
+        file.pubseekoff(static_cast<std::streamoff>(segment_size_ - 1), std::ios_base::beg);
+        file.sputc(0);
+    }
+
+    try
+    {
+        bi::file_mapping mapping(file_name.c_str(), bi::read_write);
+        region_.reset(new bi::mapped_region(mapping, bi::read_write, 0, static_cast<size_t>(segment_size_)));
+    }
+    catch (const bi::interprocess_exception& e)
+    {
+        logError(RECORDING, "Cannot map recording file " << file_name << ": " << e.what());
+        region_.reset();
+        return false;
+    }
+
+    octet* base = static_cast<octet*>(region_->get_address());
+    uint32_t index_capacity = static_cast<uint32_t>(segment_size_ / OCTETS_PER_INDEX_ENTRY);
+
+    header_ = reinterpret_cast<SegmentHeader*>(base);
+    memset(header_, 0, sizeof(SegmentHeader));
+    memcpy(header_->magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    header_->version = FILE_VERSION;
+    header_->segment_index = segment_index_;
+    header_->segment_size = segment_size_;
+    header_->index_capacity = index_capacity;
+    header_->data_offset = sizeof(SegmentHeader) + uint64_t(index_capacity) * sizeof(IndexEntry);
+
+    index_ = reinterpret_cast<IndexEntry*>(base + sizeof(SegmentHeader));
+    data_ = base + header_->data_offset;
+
+    for (const std::vector<octet>& topic_record : topic_records_)
+    {
+        write_record(topic_record.data());
+    }
+
+    return true;
+}
+
+bool RecordingFileWriter::fits(
+        const RecordHeader& header) const
+{
+    if (SAMPLE_RECORD == header.kind && header_->index_count >= header_->index_capacity)
+    {
+        return false;
+    }
+    return header_->data_used + header.size <= segment_size_ - header_->data_offset;
+}
+
+void RecordingFileWriter::write_record(
+        const octet* record)
+{
+    const RecordHeader* header = reinterpret_cast<const RecordHeader*>(record);
+    uint64_t offset = header_->data_used;
+
+    memcpy(data_ + offset, record, header->size);
+
+    if (SAMPLE_RECORD == header->kind)
+    {
+        const SampleRecord* sample = reinterpret_cast<const SampleRecord*>(record + sizeof(RecordHeader));
+        IndexEntry& entry = index_[header_->index_count];
+        entry.timestamp = sample->timestamp;
+        entry.offset = offset;
+
+        if (0 == header_->index_count)
+        {
+            header_->first_timestamp = sample->timestamp;
+        }
+        header_->last_timestamp = sample->timestamp;
+
+        // Counters are only updated once the record and its index entry are in place
+        std::atomic_thread_fence(std::memory_order_release);
+        ++header_->index_count;
+    }
+    else
+    {
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    header_->data_used = offset + header->size;
+}
+
+RecordingFileReader::RecordingFileReader(
+        const std::string& base_name)
+    : base_name_(base_name)
+{
+}
+
+RecordingFileReader::~RecordingFileReader()
+{
+}
+
+bool RecordingFileReader::open()
+{
+    segments_.clear();
+    topics_.clear();
+
+    for (uint32_t segment_index = 0;; ++segment_index)
+    {
+        std::string file_name = segment_file_name(base_name_, segment_index);
+        if (!std::ifstream(file_name).good())
+        {
+            break;
+        }
+
+        Segment segment;
+        if (!open_segment(segment_index, segment))
+        {
+            break;
+        }
+        segments_.push_back(std::move(segment));
+    }
+
+    if (segments_.empty())
+    {
+        logError(RECORDING, "No recording found on " << base_name_);
+        return false;
+    }
+
+    // Every segment repeats the topics known when it was created, so the last one has all of them
+    const Segment& last = segments_.back();
+    for (uint64_t offset = 0; offset + sizeof(RecordHeader) <= last.data_used;)
+    {
+        const RecordHeader* header = reinterpret_cast<const RecordHeader*>(last.data + offset);
+        if (header->size < sizeof(RecordHeader) || offset + header->size > last.data_used)
+        {
+            break;
+        }
+
+        if (TOPIC_RECORD == header->kind)
+        {
+            const TopicRecord* topic =
+                    reinterpret_cast<const TopicRecord*>(last.data + offset + sizeof(RecordHeader));
+            const char* names =
+                    reinterpret_cast<const char*>(last.data + offset + sizeof(RecordHeader) + sizeof(TopicRecord));
+            RecordedTopic& recorded_topic = topics_[header->topic_id];
+            recorded_topic.name.assign(names, topic->name_length);
+            recorded_topic.type_name.assign(names + topic->name_length, topic->type_name_length);
+        }
+
+        offset += header->size;
+    }
+
+    current_segment_ = 0;
+    current_offset_ = 0;
+    return true;
+}
+
+bool RecordingFileReader::open_segment(
+        uint32_t segment_index,
+        Segment& segment)
+{
+    std::string file_name = segment_file_name(base_name_, segment_index);
+
+    try
+    {
+        segment.file.reset(new bi::file_mapping(file_name.c_str(), bi::read_only));
+        segment.region.reset(new bi::mapped_region(*segment.file, bi::read_only));
+    }
+    catch (const bi::interprocess_exception& e)
+    {
+        logError(RECORDING, "Cannot map recording file " << file_name << ": " << e.what());
+        return false;
+    }
+
+    const octet* base = static_cast<const octet*>(segment.region->get_address());
+    size_t size = segment.region->get_size();
+    segment.header = reinterpret_cast<const SegmentHeader*>(base);
+
+    if (size < sizeof(SegmentHeader) ||
+            0 != memcmp(segment.header->magic, FILE_MAGIC, sizeof(FILE_MAGIC)) ||
+            FILE_VERSION != segment.header->version ||
+            segment.header->segment_size > size ||
+            segment.header->data_offset > segment.header->segment_size)
+    {
+        logError(RECORDING, "Invalid recording file " << file_name);
+        return false;
+    }
+
+    // Take a snapshot of the counters, which may be increasing if the segment is being recorded
+    segment.index_count = segment.header->index_count;
+    segment.data_used = segment.header->data_used;
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    segment.index = reinterpret_cast<const IndexEntry*>(base + sizeof(SegmentHeader));
+    segment.data = base + segment.header->data_offset;
+    segment.data_used = (std::min)(segment.data_used, segment.header->segment_size - segment.header->data_offset);
+    segment.index_count = (std::min)(segment.index_count, segment.header->index_capacity);
+
+    return true;
+}
+
+int64_t RecordingFileReader::first_timestamp() const
+{
+    for (const Segment& segment : segments_)
+    {
+        if (segment.index_count > 0)
+        {
+            return segment.header->first_timestamp;
+        }
+    }
+    return 0;
+}
+
+int64_t RecordingFileReader::last_timestamp() const
+{
+    for (auto it = segments_.rbegin(); it != segments_.rend(); ++it)
+    {
+        if (it->index_count > 0)
+        {
+            return it->index[it->index_count - 1].timestamp;
+        }
+    }
+    return 0;
+}
+
+void RecordingFileReader::seek(
+        int64_t timestamp)
+{
+    for (current_segment_ = 0; current_segment_ < segments_.size(); ++current_segment_)
+    {
+        const Segment& segment = segments_[current_segment_];
+        if (segment.index_count > 0 && segment.index[segment.index_count - 1].timestamp >= timestamp)
+        {
+            const IndexEntry* entry = std::lower_bound(segment.index, segment.index + segment.index_count, timestamp,
+                            [](const IndexEntry& e, int64_t t)
+                            {
+                                return e.timestamp < t;
+                            });
+            current_offset_ = entry->offset;
+            return;
+        }
+    }
+
+    current_offset_ = 0;
+}
+
+bool RecordingFileReader::next(
+        RecordedSample& sample)
+{
+    while (current_segment_ < segments_.size())
+    {
+        const Segment& segment = segments_[current_segment_];
+        const RecordHeader* header = reinterpret_cast<const RecordHeader*>(segment.data + current_offset_);
+
+        if (current_offset_ + sizeof(RecordHeader) > segment.data_used ||
+                header->size < sizeof(RecordHeader) ||
+                current_offset_ + header->size > segment.data_used)
+        {
+            ++current_segment_;
+            current_offset_ = 0;
+            continue;
+        }
+
+        const octet* record = segment.data + current_offset_;
+        current_offset_ += header->size;
+
+        if (SAMPLE_RECORD != header->kind)
+        {
+            continue;
+        }
+
+        const SampleRecord* body = reinterpret_cast<const SampleRecord*>(record + sizeof(RecordHeader));
+        if (sizeof(RecordHeader) + sizeof(SampleRecord) + uint64_t(body->payload_length) > header->size)
+        {
+            logWarning(RECORDING, "Skipping malformed sample record on " << base_name_);
+            continue;
+        }
+
+        sample.topic_id = header->topic_id;
+        sample.timestamp = body->timestamp;
+        sample.source_timestamp.from_ns(body->source_timestamp);
+        sample.reception_timestamp.from_ns(body->reception_timestamp);
+        memcpy(sample.writer_guid.guidPrefix.value, body->writer_guid, GuidPrefix_t::size);
+        memcpy(sample.writer_guid.entityId.value, body->writer_guid + GuidPrefix_t::size, EntityId_t::size);
+        sample.sequence_number = SequenceNumber_t(body->sequence_number_high, body->sequence_number_low);
+        memcpy(sample.instance_handle.value, body->instance_handle, sizeof(body->instance_handle));
+        sample.kind = static_cast<ChangeKind_t>(body->change_kind);
+        sample.payload = record + sizeof(RecordHeader) + sizeof(SampleRecord);
+        sample.payload_length = body->payload_length;
+        return true;
+    }
+
+    return false;
+}
+
+} // namespace recording
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,360 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RecordingFile.hpp
+ */
+
+#ifndef _FASTDDS_RECORDING_RECORDINGFILE_HPP_
+#define _FASTDDS_RECORDING_RECORDINGFILE_HPP_
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/InstanceHandle.h>
+#include <fastdds/rtps/common/SequenceNumber.h>
+#include <fastdds/rtps/common/Types.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace interprocess {
+
+class file_mapping;
+class mapped_region;
+
+} // namespace interprocess
+} // namespace boost
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace recording {
+
+/*
+ * A recording is a sequence of segment files named <base>_NNNN.fddsrec. Each segment is a file of fixed size,
+ * mapped in memory, with three regions:
+ *   - A SegmentHeader.
+ *   - The time index: an IndexEntry for each sample record, in order of timestamp.
+ *   - The data: a sequence of records, each one starting with a RecordHeader and aligned to 8 octets.
+ * Records are appended and never modified. The header counters are updated after the record and its index entry
+ * are completely written, so a segment can be read while it is being recorded.
+ * The topic records of all the known topics are repeated at the beginning of every segment, hence the topics of a
+ * recording are those found in its last segment.
+ * All the fields are stored in the byte order of the host.
+ */
+
+//! Current version of the file format.
+constexpr uint32_t FILE_VERSION = 1;
+
+//! Default size of the segment files.
+constexpr uint64_t DEFAULT_SEGMENT_SIZE = 64 * 1024 * 1024;
+
+//! Extension of the segment files.
+constexpr const char* SEGMENT_EXTENSION = ".fddsrec";
+
+//! Header at the beginning of each segment.
+struct SegmentHeader
+{
+    //! "FDDSREC" followed by a null character.
+    char magic[8];
+    //! Version of the file format.
+    uint32_t version;
+    //! Position of the segment in the recording.
+    uint32_t segment_index;
+    //! Size of the segment file.
+    uint64_t segment_size;
+    //! Number of entries reserved for the time index.
+    uint32_t index_capacity;
+    //! Number of entries of the time index in use.
+    uint32_t index_count;
+    //! Offset of the data region from the beginning of the file.
+    uint64_t data_offset;
+    //! Octets of the data region in use.
+    uint64_t data_used;
+    //! Timestamp of the first sample record, in nanoseconds.
+    int64_t first_timestamp;
+    //! Timestamp of the last sample record, in nanoseconds.
+    int64_t last_timestamp;
+};
+
+//! Entry of the time index.
+struct IndexEntry
+{
+    //! Timestamp of the sample record, in nanoseconds.
+    int64_t timestamp;
+    //! Offset of the sample record from the beginning of the data region.
+    uint64_t offset;
+};
+
+//! Kinds of records.
+enum RecordKind : uint16_t
+{
+    TOPIC_RECORD = 1,
+    SAMPLE_RECORD = 2
+};
+
+//! Header of every record.
+struct RecordHeader
+{
+    //! Size of the whole record, including this header and the padding.
+    uint32_t size;
+    //! RecordKind.
+    uint16_t kind;
+    //! Identifier of the topic the record refers to.
+    uint16_t topic_id;
+};
+
+//! Body of a topic record. It is followed by the topic name and the type name, without null terminators.
+struct TopicRecord
+{
+    uint16_t name_length;
+    uint16_t type_name_length;
+    uint32_t reserved;
+};
+
+//! Body of a sample record. It is followed by the serialized payload.
+struct SampleRecord
+{
+    //! Timestamp used by the time index: the reception timestamp, forced to be monotonic.
+    int64_t timestamp;
+    int64_t source_timestamp;
+    int64_t reception_timestamp;
+    fastrtps::rtps::octet writer_guid[16];
+    int32_t sequence_number_high;
+    uint32_t sequence_number_low;
+    fastrtps::rtps::octet instance_handle[16];
+    uint32_t change_kind;
+    uint32_t payload_length;
+};
+
+static_assert(sizeof(SegmentHeader) == 64, "Unexpected padding on SegmentHeader");
+static_assert(sizeof(IndexEntry) == 16, "Unexpected padding on IndexEntry");
+static_assert(sizeof(RecordHeader) == 8, "Unexpected padding on RecordHeader");
+static_assert(sizeof(TopicRecord) == 8, "Unexpected padding on TopicRecord");
+static_assert(sizeof(SampleRecord) == 72, "Unexpected padding on SampleRecord");
+
+/**
+ * @return The name of the file of a segment.
+ */
+std::string segment_file_name(
+        const std::string& base_name,
+        uint32_t segment_index);
+
+/**
+ * @return The size of the topic record for the given names.
+ */
+uint32_t topic_record_size(
+        const std::string& topic_name,
+        const std::string& type_name);
+
+/**
+ * Fills a topic record.
+ * @param buffer Where the record is written. It should have room for topic_record_size() octets.
+ */
+void fill_topic_record(
+        fastrtps::rtps::octet* buffer,
+        uint16_t topic_id,
+        const std::string& topic_name,
+        const std::string& type_name);
+
+/**
+ * @return The size of the sample record for a payload of the given length.
+ */
+uint32_t sample_record_size(
+        uint32_t payload_length);
+
+/**
+ * Fills a sample record.
+ * @param buffer Where the record is written. It should have room for sample_record_size() octets.
+ * @param topic_id Identifier of the topic of the sample.
+ * @param timestamp Timestamp for the time index, in nanoseconds.
+ * @param change Change whose metadata and serialized payload are recorded.
+ */
+void fill_sample_record(
+        fastrtps::rtps::octet* buffer,
+        uint16_t topic_id,
+        int64_t timestamp,
+        const fastrtps::rtps::CacheChange_t& change);
+
+//! Topic found on a recording.
+struct RecordedTopic
+{
+    std::string name;
+    std::string type_name;
+};
+
+//! Sample read from a recording. The payload points to the mapped file.
+struct RecordedSample
+{
+    uint16_t topic_id = 0;
+    int64_t timestamp = 0;
+    fastrtps::rtps::Time_t source_timestamp;
+    fastrtps::rtps::Time_t reception_timestamp;
+    fastrtps::rtps::GUID_t writer_guid;
+    fastrtps::rtps::SequenceNumber_t sequence_number;
+    fastrtps::rtps::InstanceHandle_t instance_handle;
+    fastrtps::rtps::ChangeKind_t kind = fastrtps::rtps::ALIVE;
+    const fastrtps::rtps::octet* payload = nullptr;
+    uint32_t payload_length = 0;
+};
+
+/**
+ * Appends records to a recording, creating a new segment when the current one is full.
+ * It is not thread safe.
+ */
+class RecordingFileWriter
+{
+public:
+
+    /**
+     * @param base_name Path of the recording, without the segment suffix.
+     * @param segment_size Size of the segment files.
+     */
+    RecordingFileWriter(
+            const std::string& base_name,
+            uint64_t segment_size);
+
+    ~RecordingFileWriter();
+
+    /**
+     * Creates the first segment.
+     * @return false if the segment cannot be created.
+     */
+    bool open();
+
+    /**
+     * Appends a record. Topic records are kept to be repeated on the following segments.
+     * @param record Record, starting with its RecordHeader.
+     * @return false if the record does not fit on an empty segment or a new segment cannot be created.
+     */
+    bool append(
+            const fastrtps::rtps::octet* record);
+
+    //! Unmaps the current segment.
+    void close();
+
+private:
+
+    bool open_segment();
+
+    bool fits(
+            const RecordHeader& header) const;
+
+    void write_record(
+            const fastrtps::rtps::octet* record);
+
+    std::string base_name_;
+
+    uint64_t segment_size_;
+
+    uint32_t segment_index_ = 0;
+
+    std::unique_ptr<boost::interprocess::mapped_region> region_;
+
+    SegmentHeader* header_ = nullptr;
+
+    IndexEntry* index_ = nullptr;
+
+    fastrtps::rtps::octet* data_ = nullptr;
+
+    std::vector<std::vector<fastrtps::rtps::octet>> topic_records_;
+};
+
+/**
+ * Reads the records of a recording, in order.
+ * The segments being recorded are read up to the last record committed when they were opened.
+ */
+class RecordingFileReader
+{
+public:
+
+    /**
+     * @param base_name Path of the recording, without the segment suffix.
+     */
+    explicit RecordingFileReader(
+            const std::string& base_name);
+
+    ~RecordingFileReader();
+
+    /**
+     * Maps all the segments of the recording and collects its topics.
+     * @return false if there is no valid segment.
+     */
+    bool open();
+
+    //! @return The topics of the recording, by identifier.
+    const std::map<uint16_t, RecordedTopic>& topics() const
+    {
+        return topics_;
+    }
+
+    //! @return The timestamp of the first sample, in nanoseconds.
+    int64_t first_timestamp() const;
+
+    //! @return The timestamp of the last sample, in nanoseconds.
+    int64_t last_timestamp() const;
+
+    /**
+     * Positions the reader on the first sample with a timestamp equal or greater than the given one.
+     * @param timestamp Timestamp in nanoseconds.
+     */
+    void seek(
+            int64_t timestamp);
+
+    /**
+     * Reads the next sample.
+     * @param [out] sample Sample read. Its payload is valid while the reader is alive.
+     * @return false when there are no more samples.
+     */
+    bool next(
+            RecordedSample& sample);
+
+private:
+
+    struct Segment
+    {
+        std::unique_ptr<boost::interprocess::file_mapping> file;
+        std::unique_ptr<boost::interprocess::mapped_region> region;
+        const SegmentHeader* header = nullptr;
+        const IndexEntry* index = nullptr;
+        const fastrtps::rtps::octet* data = nullptr;
+        uint64_t data_used = 0;
+        uint32_t index_count = 0;
+    };
+
+    bool open_segment(
+            uint32_t segment_index,
+            Segment& segment);
+
+    std::string base_name_;
+
+    std::vector<Segment> segments_;
+
+    std::map<uint16_t, RecordedTopic> topics_;
+
+    size_t current_segment_ = 0;
+
+    uint64_t current_offset_ = 0;
+};
+
+} // namespace recording
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_RECORDING_RECORDINGFILE_HPP_
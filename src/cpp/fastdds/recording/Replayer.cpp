@@ -0,0 +1,289 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Replayer.cpp
+ */
+
+#include <fastdds/dds/recording/Replayer.hpp>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
+
+#include <fastdds/recording/RecordingFile.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::dds::recording;
+
+class ReplayerImpl
+{
+public:
+
+    ReplayerImpl(
+            DomainParticipant* participant,
+            const std::string& file_name,
+            const DataWriterQos& qos)
+        : participant_(participant)
+        , qos_(qos)
+        , use_default_qos_(&qos == &DATAWRITER_QOS_DEFAULT)
+        , file_(file_name)
+    {
+    }
+
+    ~ReplayerImpl()
+    {
+        if (nullptr != publisher_)
+        {
+            for (auto& writer : writers_)
+            {
+                publisher_->delete_datawriter(writer.second);
+            }
+            participant_->delete_publisher(publisher_);
+        }
+
+        for (Topic* topic : created_topics_)
+        {
+            participant_->delete_topic(topic);
+        }
+    }
+
+    ReturnCode_t enable()
+    {
+        if (enabled_)
+        {
+            return ReturnCode_t::RETCODE_OK;
+        }
+
+        if (nullptr == participant_ || !file_.open())
+        {
+            return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+        }
+
+        for (const auto& recorded_topic : file_.topics())
+        {
+            if (!participant_->find_type(recorded_topic.second.type_name))
+            {
+                logError(REPLAYER, "Type " << recorded_topic.second.type_name << " of topic "
+                                           << recorded_topic.second.name << " is not registered");
+                return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+            }
+        }
+
+        publisher_ = participant_->create_publisher(PUBLISHER_QOS_DEFAULT);
+        if (nullptr == publisher_)
+        {
+            return ReturnCode_t::RETCODE_ERROR;
+        }
+
+        for (const auto& recorded_topic : file_.topics())
+        {
+            Topic* topic = nullptr;
+            TopicDescription* description = participant_->lookup_topicdescription(recorded_topic.second.name);
+            if (nullptr != description)
+            {
+                topic = dynamic_cast<Topic*>(description);
+                if (nullptr == topic || topic->get_type_name() != recorded_topic.second.type_name)
+                {
+                    logError(REPLAYER, "Topic " << recorded_topic.second.name << " exists with another type");
+                    return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+                }
+            }
+            else
+            {
+                topic = participant_->create_topic(recorded_topic.second.name, recorded_topic.second.type_name,
+                                TOPIC_QOS_DEFAULT);
+                if (nullptr == topic)
+                {
+                    return ReturnCode_t::RETCODE_ERROR;
+                }
+                created_topics_.push_back(topic);
+            }
+
+            DataWriter* writer = publisher_->create_datawriter(topic,
+                            use_default_qos_ ? DATAWRITER_QOS_DEFAULT : qos_);
+            if (nullptr == writer)
+            {
+                return ReturnCode_t::RETCODE_ERROR;
+            }
+            writers_[recorded_topic.first] = writer;
+        }
+
+        enabled_ = true;
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    ReturnCode_t replay(
+            double speed,
+            const fastrtps::Duration_t& start_offset)
+    {
+        ReturnCode_t ret = enable();
+        if (!ret)
+        {
+            return ret;
+        }
+
+        stop_ = false;
+        replayed_samples_ = 0;
+        file_.seek(file_.first_timestamp() + start_offset.to_ns());
+
+        // The payload points to the mapped recording, so it should never release its buffer
+        SerializedPayload_t payload;
+        RecordedSample sample;
+        bool first_sample = true;
+        int64_t first_timestamp = 0;
+        std::chrono::steady_clock::time_point start_time;
+
+        while (!stop_ && file_.next(sample))
+        {
+            auto writer = writers_.find(sample.topic_id);
+            if (ALIVE != sample.kind || writers_.end() == writer || sample.payload_length < 4)
+            {
+                continue;
+            }
+
+            if (speed > 0)
+            {
+                if (first_sample)
+                {
+                    first_timestamp = sample.timestamp;
+                    start_time = std::chrono::steady_clock::now();
+                    first_sample = false;
+                }
+                else
+                {
+                    std::chrono::nanoseconds elapsed(
+                        static_cast<int64_t>(static_cast<double>(sample.timestamp - first_timestamp) / speed));
+                    std::this_thread::sleep_until(start_time + elapsed);
+                }
+            }
+
+            payload.data = const_cast<octet*>(sample.payload);
+            payload.length = sample.payload_length;
+            payload.max_size = sample.payload_length;
+            payload.encapsulation = static_cast<uint16_t>((sample.payload[0] << 8) | sample.payload[1]);
+
+            ret = writer->second->write_serialized(payload, sample.instance_handle);
+            if (!ret)
+            {
+                logWarning(REPLAYER, "Error " << ret() << " writing sample " << sample.sequence_number
+                                              << " of " << sample.writer_guid);
+                continue;
+            }
+            ++replayed_samples_;
+        }
+
+        payload.data = nullptr;
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    void stop()
+    {
+        stop_ = true;
+    }
+
+    uint64_t replayed_samples() const
+    {
+        return replayed_samples_;
+    }
+
+    fastrtps::Duration_t duration() const
+    {
+        fastrtps::rtps::Time_t time;
+        time.from_ns(file_.last_timestamp() - file_.first_timestamp());
+        return time.to_duration_t();
+    }
+
+private:
+
+    DomainParticipant* participant_;
+
+    DataWriterQos qos_;
+
+    //! The default DataWriterQos of the publisher is used when the default was given on construction
+    bool use_default_qos_;
+
+    RecordingFileReader file_;
+
+    bool enabled_ = false;
+
+    Publisher* publisher_ = nullptr;
+
+    std::vector<Topic*> created_topics_;
+
+    std::map<uint16_t, DataWriter*> writers_;
+
+    std::atomic<bool> stop_{false};
+
+    std::atomic<uint64_t> replayed_samples_{0};
+};
+
+Replayer::Replayer(
+        DomainParticipant* participant,
+        const std::string& file_name,
+        const DataWriterQos& qos)
+    : impl_(new ReplayerImpl(participant, file_name, qos))
+{
+}
+
+Replayer::~Replayer()
+{
+    delete impl_;
+}
+
+ReturnCode_t Replayer::enable()
+{
+    return impl_->enable();
+}
+
+ReturnCode_t Replayer::replay(
+        double speed,
+        const fastrtps::Duration_t& start_offset)
+{
+    return impl_->replay(speed, start_offset);
+}
+
+void Replayer::stop()
+{
+    impl_->stop();
+}
+
+uint64_t Replayer::replayed_samples() const
+{
+    return impl_->replayed_samples();
+}
+
+fastrtps::Duration_t Replayer::duration() const
+{
+    return impl_->duration();
+}
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
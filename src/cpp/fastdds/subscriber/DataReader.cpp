@@ -246,6 +246,26 @@ ReturnCode_t DataReader::take_next_sample(
     return impl_->take_next_sample(data, info);
 }
 
+ReturnCode_t DataReader::take_serialized(
+        fastrtps::rtps::SerializedPayload_t* payload,
+        SampleInfo* info)
+{
+    return impl_->take_serialized(payload, info);
+}
+
+ReturnCode_t DataReader::take_to_ring(
+        SampleRing& ring,
+        int32_t max_samples)
+{
+    return impl_->take_to_ring(ring, max_samples);
+}
+
+ReturnCode_t DataReader::set_sample_ring(
+        SampleRing* ring)
+{
+    return impl_->set_sample_ring(ring);
+}
+
 ReturnCode_t DataReader::get_first_untaken_info(
         SampleInfo* info)
 {
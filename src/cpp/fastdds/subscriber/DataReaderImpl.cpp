@@ -32,6 +32,7 @@
 #include <fastdds/dds/topic/Topic.hpp>
 
 #include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/common/RealtimeMonitor.hpp>
 #include <fastdds/rtps/participant/RTPSParticipant.h>
 #include <fastdds/rtps/reader/RTPSReader.h>
 #include <fastdds/rtps/resources/ResourceEvent.h>
@@ -39,14 +40,18 @@
 
 #include <fastdds/core/condition/StatusConditionImpl.hpp>
 #include <fastdds/core/policy/QosPolicyUtils.hpp>
+#include <fastdds/domain/DomainParticipantImpl.hpp>
+#include <fastdds/recording/Recorder.hpp>
 
 #include <fastdds/subscriber/SubscriberImpl.hpp>
 #include <fastdds/subscriber/DataReaderImpl/ReadTakeCommand.hpp>
+#include <fastdds/subscriber/DataReaderImpl/RingSegment.hpp>
 #include <fastdds/subscriber/DataReaderImpl/StateFilter.hpp>
 
 #include <fastrtps/utils/TimeConversion.h>
 #include <fastrtps/subscriber/SampleInfo.h>
 
+#include <rtps/common/PayloadCompression.hpp>
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
 
 using namespace eprosima::fastrtps;
@@ -106,6 +111,20 @@ static bool qos_has_unique_network_request(
     return nullptr != PropertyPolicyHelper::find_property(qos.properties(), "fastdds.unique_network_flows");
 }
 
+static bool qos_has_unbounded_datasharing_request(
+        const DataReaderQos& qos)
+{
+    auto unbounded = PropertyPolicyHelper::find_property(qos.properties(), "fastdds.datasharing.unbounded");
+    return (nullptr != unbounded) && ("true" == *unbounded);
+}
+
+static bool qos_has_realtime_mode(
+        const DomainParticipantQos& qos)
+{
+    auto realtime_mode = PropertyPolicyHelper::find_property(qos.properties(), "fastdds.realtime_mode");
+    return (nullptr != realtime_mode) && ("true" == *realtime_mode);
+}
+
 static bool qos_has_specific_locators(
         const DataReaderQos& qos)
 {
@@ -215,6 +234,9 @@ ReturnCode_t DataReaderImpl::enable()
         att.endpoint.set_data_sharing_configuration(datasharing);
     }
 
+    // The history restores compressed payloads, so writers are told which algorithms it accepts
+    fastdds::rtps::PayloadCompression::add_accepted_property(att.endpoint.properties);
+
     std::shared_ptr<IPayloadPool> pool = get_payload_pool();
     RTPSReader* reader = RTPSDomain::createRTPSReader(
         subscriber_->rtps_participant(),
@@ -231,6 +253,12 @@ ReturnCode_t DataReaderImpl::enable()
 
     reader_ = reader;
 
+    realtime_mode_ = qos_has_realtime_mode(subscriber_->get_participant()->get_qos());
+    if (realtime_mode_ && PREALLOCATED_MEMORY_MODE != qos_.endpoint().history_memory_policy)
+    {
+        logWarning(DATA_READER, "Real-time mode needs PREALLOCATED_MEMORY_MODE to receive without allocations");
+    }
+
     deadline_timer_ = new TimedEvent(subscriber_->get_participant()->get_resource_event(),
                     [&]() -> bool
                     {
@@ -245,6 +273,13 @@ ReturnCode_t DataReaderImpl::enable()
                     },
                     qos_.lifespan().duration.to_ns() * 1e-6);
 
+    recording::Recorder* recorder = subscriber_->participant_->recorder();
+    if (nullptr != recorder && recorder->records(topic_->get_name()))
+    {
+        recorder_topic_id_ = recorder->register_topic(topic_->get_name(), topic_->get_type_name());
+        recorder_ = recorder;
+    }
+
     // Register the reader
     ReaderQos rqos = qos_.get_readerqos(subscriber_->get_qos());
     if (!is_datasharing_compatible)
@@ -438,6 +473,8 @@ ReturnCode_t DataReaderImpl::read_or_take(
         return code;
     }
 
+    RealtimeMonitor::Scope realtime_scope(realtime_mode_, "DataReader::take");
+
     auto max_blocking_time = std::chrono::steady_clock::now() +
 #if HAVE_STRICT_REALTIME
             std::chrono::microseconds(::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
@@ -447,7 +484,7 @@ ReturnCode_t DataReaderImpl::read_or_take(
 
     std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex(), std::defer_lock);
 
-    if (!lock.try_lock_until(max_blocking_time))
+    if (!RealtimeMonitor::try_lock_until(lock, max_blocking_time))
     {
         return ReturnCode_t::RETCODE_TIMEOUT;
     }
@@ -606,7 +643,8 @@ ReturnCode_t DataReaderImpl::return_loan(
 ReturnCode_t DataReaderImpl::read_or_take_next_sample(
         void* data,
         SampleInfo* info,
-        bool should_take)
+        bool should_take,
+        bool serialized)
 {
     if (reader_ == nullptr)
     {
@@ -618,6 +656,8 @@ ReturnCode_t DataReaderImpl::read_or_take_next_sample(
         return ReturnCode_t::RETCODE_NO_DATA;
     }
 
+    RealtimeMonitor::Scope realtime_scope(realtime_mode_, "DataReader::take");
+
     auto max_blocking_time = std::chrono::steady_clock::now() +
 #if HAVE_STRICT_REALTIME
             std::chrono::microseconds(::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
@@ -627,7 +667,7 @@ ReturnCode_t DataReaderImpl::read_or_take_next_sample(
 
     std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex(), std::defer_lock);
 
-    if (!lock.try_lock_until(max_blocking_time))
+    if (!RealtimeMonitor::try_lock_until(lock, max_blocking_time))
     {
         return ReturnCode_t::RETCODE_TIMEOUT;
     }
@@ -645,7 +685,7 @@ ReturnCode_t DataReaderImpl::read_or_take_next_sample(
     StackAllocatedSequence<SampleInfo, 1> sample_infos;
 
     detail::StateFilter states{ NOT_READ_SAMPLE_STATE, ANY_VIEW_STATE, ANY_INSTANCE_STATE };
-    detail::ReadTakeCommand cmd(*this, data_values, sample_infos, 1, states, it.second, false);
+    detail::ReadTakeCommand cmd(*this, data_values, sample_infos, 1, states, it.second, false, serialized);
     while (!cmd.is_finished())
     {
         cmd.add_instance(should_take);
@@ -673,6 +713,135 @@ ReturnCode_t DataReaderImpl::take_next_sample(
     return read_or_take_next_sample(data, info, true);
 }
 
+ReturnCode_t DataReaderImpl::take_serialized(
+        SerializedPayload_t* payload,
+        SampleInfo* info)
+{
+    if (nullptr == payload)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    return read_or_take_next_sample(payload, info, true, true);
+}
+
+ReturnCode_t DataReaderImpl::take_to_ring(
+        SampleRing& ring,
+        int32_t max_samples)
+{
+    if (reader_ == nullptr)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    if (0 == ring.capacity())
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    RealtimeMonitor::Scope realtime_scope(realtime_mode_, "DataReader::take");
+
+    auto max_blocking_time = std::chrono::steady_clock::now() +
+#if HAVE_STRICT_REALTIME
+            std::chrono::microseconds(::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
+#else
+            std::chrono::hours(24);
+#endif // if HAVE_STRICT_REALTIME
+
+    std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex(), std::defer_lock);
+
+    if (!RealtimeMonitor::try_lock_until(lock, max_blocking_time))
+    {
+        return ReturnCode_t::RETCODE_TIMEOUT;
+    }
+
+    set_read_communication_status(false);
+
+    return take_to_ring_nts(ring, max_samples);
+}
+
+ReturnCode_t DataReaderImpl::take_to_ring_nts(
+        SampleRing& ring,
+        int32_t max_samples)
+{
+    ReturnCode_t code = ReturnCode_t::RETCODE_NO_DATA;
+
+    if (0 > max_samples)
+    {
+        max_samples = ring.capacity();
+    }
+
+    // The free slots may wrap around the end of the ring, so they are filled in up to two contiguous segments.
+    detail::StateFilter states{ ANY_SAMPLE_STATE, ANY_VIEW_STATE, ANY_INSTANCE_STATE };
+    while (max_samples > 0)
+    {
+        SampleRing::size_type first = 0;
+        SampleRing::size_type num_slots = std::min(ring.free_slots(first), max_samples);
+        if (0 == num_slots)
+        {
+            break;
+        }
+
+        auto it = history_.lookup_instance(HANDLE_NIL, false);
+        if (!it.first)
+        {
+            break;
+        }
+
+        detail::RingSegment<LoanableCollection> data_values(ring.samples_.data() + first, num_slots);
+        detail::RingSegment<LoanableTypedCollection<SampleInfo>> sample_infos(ring.info_slots_.data() + first,
+                num_slots);
+        {
+            detail::ReadTakeCommand cmd(*this, data_values, sample_infos, num_slots, states, it.second, false);
+            while (!cmd.is_finished())
+            {
+                cmd.add_instance(true);
+            }
+
+            if (ReturnCode_t::RETCODE_OK == cmd.return_value())
+            {
+                code = ReturnCode_t::RETCODE_OK;
+            }
+        }
+
+        SampleRing::size_type taken = data_values.length();
+        ring.push(taken);
+        max_samples -= taken;
+
+        if (taken < num_slots)
+        {
+            // The history has no more samples
+            break;
+        }
+    }
+
+    return code;
+}
+
+ReturnCode_t DataReaderImpl::set_sample_ring(
+        SampleRing* ring)
+{
+    if (reader_ == nullptr)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    if (nullptr != ring && 0 == ring->capacity())
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
+    sample_ring_ = ring;
+    if (nullptr != sample_ring_)
+    {
+        // Samples received before attaching the ring are moved to it too
+        take_to_ring_nts(*sample_ring_, LENGTH_UNLIMITED);
+    }
+
+    return ReturnCode_t::RETCODE_OK;
+}
+
 ReturnCode_t DataReaderImpl::get_first_untaken_info(
         SampleInfo* info)
 {
@@ -788,10 +957,21 @@ void DataReaderImpl::InnerDataReaderListener::onNewCacheChangeAdded(
         RTPSReader* /*reader*/,
         const CacheChange_t* const change_in)
 {
+    if (nullptr != data_reader_->recorder_)
+    {
+        data_reader_->recorder_->record(data_reader_->recorder_topic_id_, *change_in);
+    }
+
     if (data_reader_->on_new_cache_change_added(change_in))
     {
         auto user_reader = data_reader_->user_datareader_;
 
+        if (nullptr != data_reader_->sample_ring_)
+        {
+            // Deserialize on the reception thread. Samples not fitting in the ring are kept on the history.
+            data_reader_->take_to_ring_nts(*data_reader_->sample_ring_, LENGTH_UNLIMITED);
+        }
+
         //First check if we can handle with on_data_on_readers
         SubscriberListener* subscriber_listener =
                 data_reader_->subscriber_->get_listener_for(StatusMask::data_on_readers());
@@ -824,6 +1004,11 @@ void DataReaderImpl::InnerDataReaderListener::on_liveliness_changed(
         RTPSReader* /*reader*/,
         const fastrtps::LivelinessChangedStatus& status)
 {
+    if (0 < status.not_alive_count_change)
+    {
+        data_reader_->history_.writer_not_alive(iHandle2GUID(status.last_publication_handle));
+    }
+
     data_reader_->update_liveliness_status(status);
     StatusMask notify_status = StatusMask::liveliness_changed();
     DataReaderListener* listener = data_reader_->get_listener_for(notify_status);
@@ -1001,6 +1186,7 @@ bool DataReaderImpl::deadline_missed()
         deadline_missed_status_.total_count_change = 0;
     }
     user_datareader_->get_statuscondition().get_impl()->set_status(notify_status, true);
+    history_.instance_deadline_missed(timer_owner_);
 
     if (!history_.set_next_deadline(
                 timer_owner_,
@@ -1501,6 +1687,9 @@ ReturnCode_t DataReaderImpl::check_datasharing_compatible(
 
     bool has_key = type_->m_isGetKeyDefined;
 
+    // Unbounded types can only be shared with writers using variable-size pools, which must be explicitly requested
+    bool has_bound_payload_size = type_.is_bounded() || qos_has_unbounded_datasharing_request(qos_);
+
     is_datasharing_compatible = false;
     switch (qos_.data_sharing().kind())
     {
@@ -1515,9 +1704,10 @@ ReturnCode_t DataReaderImpl::check_datasharing_compatible(
                 return ReturnCode_t::RETCODE_NOT_ALLOWED_BY_SECURITY;
             }
 #endif // if HAVE_SECURITY
-            if (!type_.is_bounded())
+            if (!has_bound_payload_size)
             {
-                logInfo(DATA_READER, "Data sharing cannot be used with unbounded data types");
+                logInfo(DATA_READER, "Data sharing cannot be used with unbounded data types unless "
+                        "fastdds.datasharing.unbounded is set");
                 return ReturnCode_t::RETCODE_BAD_PARAMETER;
             }
 
@@ -1539,7 +1729,7 @@ ReturnCode_t DataReaderImpl::check_datasharing_compatible(
             }
 #endif // if HAVE_SECURITY
 
-            if (!type_.is_bounded())
+            if (!has_bound_payload_size)
             {
                 logInfo(DATA_READER, "Data sharing disabled because data type is not bounded");
                 return ReturnCode_t::RETCODE_OK;
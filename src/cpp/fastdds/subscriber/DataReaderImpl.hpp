@@ -27,6 +27,7 @@
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/dds/subscriber/DataReaderListener.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/SampleRing.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 
 #include <fastdds/rtps/attributes/ReaderAttributes.h>
@@ -65,6 +66,12 @@ class Subscriber;
 class SubscriberImpl;
 class TopicDescription;
 
+namespace recording {
+
+class Recorder;
+
+} // namespace recording
+
 using SampleInfoSeq = LoanableSequence<SampleInfo>;
 
 namespace detail {
@@ -179,8 +186,19 @@ public:
             void* data,
             SampleInfo* info);
 
+    ReturnCode_t take_serialized(
+            fastrtps::rtps::SerializedPayload_t* payload,
+            SampleInfo* info);
+
+    ReturnCode_t take_to_ring(
+            SampleRing& ring,
+            int32_t max_samples = LENGTH_UNLIMITED);
+
     ///@}
 
+    ReturnCode_t set_sample_ring(
+            SampleRing* ring);
+
     ReturnCode_t return_loan(
             LoanableCollection& data_values,
             SampleInfoSeq& sample_infos);
@@ -402,6 +420,18 @@ protected:
     detail::SampleInfoPool sample_info_pool_;
     detail::DataReaderLoanManager loan_manager_;
 
+    //! Ring filled on the reception of new samples. Protected by the reader mutex.
+    SampleRing* sample_ring_ = nullptr;
+
+    //! Recorder of the participant, when the samples of this topic are recorded.
+    recording::Recorder* recorder_ = nullptr;
+
+    //! Identifier of the topic on the recording.
+    uint16_t recorder_topic_id_ = 0;
+
+    //! Whether the participant has the real-time mode enabled, so reading and taking are real-time paths
+    bool realtime_mode_ = false;
+
     ReturnCode_t check_collection_preconditions_and_calc_max_samples(
             LoanableCollection& data_values,
             SampleInfoSeq& sample_infos,
@@ -424,10 +454,29 @@ protected:
             bool single_instance,
             bool should_take);
 
+    /**
+     * Reads or takes the next unread sample.
+     * @param data Sample to fill, or the SerializedPayload_t receiving its serialized data when @c serialized is true.
+     * @param info Information of the sample.
+     * @param should_take Whether the sample is removed from the history.
+     * @param serialized Whether the payload is copied instead of deserialized.
+     */
     ReturnCode_t read_or_take_next_sample(
             void* data,
             SampleInfo* info,
-            bool should_take);
+            bool should_take,
+            bool serialized = false);
+
+    /**
+     * Takes samples from the history into the free slots of a ring.
+     * @pre The reader mutex is locked.
+     * @param ring Ring to fill.
+     * @param max_samples Maximum number of samples to take. Negative values mean all the free slots.
+     * @return RETCODE_OK if some sample with valid data was taken, RETCODE_NO_DATA otherwise.
+     */
+    ReturnCode_t take_to_ring_nts(
+            SampleRing& ring,
+            int32_t max_samples);
 
     void set_read_communication_status(
             bool trigger_value);
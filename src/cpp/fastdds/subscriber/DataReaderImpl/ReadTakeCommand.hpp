@@ -42,6 +42,8 @@
 #include <rtps/reader/WriterProxy.h>
 #include <rtps/DataSharing/DataSharingPayloadPool.hpp>
 
+#include <utils/Prefetch.hpp>
+
 
 namespace eprosima {
 namespace fastdds {
@@ -53,6 +55,7 @@ struct ReadTakeCommand
     using ReturnCode_t = eprosima::fastrtps::types::ReturnCode_t;
     using history_type = eprosima::fastrtps::SubscriberHistory;
     using CacheChange_t = eprosima::fastrtps::rtps::CacheChange_t;
+    using SerializedPayload_t = eprosima::fastrtps::rtps::SerializedPayload_t;
     using RTPSReader = eprosima::fastrtps::rtps::RTPSReader;
     using WriterProxy = eprosima::fastrtps::rtps::WriterProxy;
     using SampleInfoSeq = LoanableTypedCollection<SampleInfo>;
@@ -65,7 +68,8 @@ struct ReadTakeCommand
             int32_t max_samples,
             const StateFilter& states,
             history_type::instance_info instance,
-            bool single_instance = false)
+            bool single_instance = false,
+            bool serialized_payloads = false)
         : type_(reader.type_)
         , loan_manager_(reader.loan_manager_)
         , history_(reader.history_)
@@ -79,6 +83,7 @@ struct ReadTakeCommand
         , instance_(instance)
         , handle_(instance.first)
         , single_instance_(single_instance)
+        , serialized_payloads_(serialized_payloads)
     {
         assert(0 <= remaining_samples_);
 
@@ -111,6 +116,8 @@ struct ReadTakeCommand
         auto it = instance_.second->begin();
         while (!finished_ && it != instance_.second->end())
         {
+            prefetch_ahead(it, instance_.second->end());
+
             CacheChange_t* change = *it;
             SampleStateKind check;
             check = change->isRead ? SampleStateKind::READ_SAMPLE_STATE : SampleStateKind::NOT_READ_SAMPLE_STATE;
@@ -223,6 +230,8 @@ private:
     history_type::instance_info instance_;
     InstanceHandle_t handle_;
     bool single_instance_;
+    //! The collection holds SerializedPayload_t objects, which receive the payloads without deserializing them
+    bool serialized_payloads_;
 
     bool finished_ = false;
     ReturnCode_t return_value_ = ReturnCode_t::RETCODE_NO_DATA;
@@ -314,7 +323,12 @@ private:
             CacheChange_t* change)
     {
         auto payload = &(change->serializedPayload);
-        if (data_values_.has_ownership())
+        if (serialized_payloads_)
+        {
+            auto target = static_cast<SerializedPayload_t*>(data_values_.buffer()[current_slot_]);
+            return target->copy(payload, false);
+        }
+        else if (data_values_.has_ownership())
         {
             // perform deserialization
             return type_->deserialize(payload, data_values_.buffer()[current_slot_]);
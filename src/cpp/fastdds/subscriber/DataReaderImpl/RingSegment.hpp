@@ -0,0 +1,85 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RingSegment.hpp
+ */
+
+#ifndef _FASTDDS_SUBSCRIBER_DATAREADERIMPL_RINGSEGMENT_HPP_
+#define _FASTDDS_SUBSCRIBER_DATAREADERIMPL_RINGSEGMENT_HPP_
+
+#include <stdexcept>
+
+#include <fastdds/dds/core/LoanableCollection.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+/**
+ * Owning collection over contiguous slots of a SampleRing, so they can be filled by a ReadTakeCommand.
+ * The slots are not released by the collection, and it cannot grow above them.
+ *
+ * @tparam CollectionType LoanableCollection or LoanableTypedCollection.
+ */
+template<typename CollectionType>
+struct RingSegment : public CollectionType
+{
+    using size_type = LoanableCollection::size_type;
+    using element_type = LoanableCollection::element_type;
+
+    RingSegment(
+            element_type* slots,
+            size_type num_slots)
+    {
+        has_ownership_ = true;
+        maximum_ = num_slots;
+        length_ = 0;
+        elements_ = slots;
+    }
+
+    ~RingSegment() = default;
+
+    // Non-copyable
+    RingSegment(
+            const RingSegment&) = delete;
+    RingSegment& operator = (
+            const RingSegment&) = delete;
+
+protected:
+
+    using LoanableCollection::maximum_;
+    using LoanableCollection::length_;
+    using LoanableCollection::elements_;
+    using LoanableCollection::has_ownership_;
+
+    void resize(
+            size_type new_length) override
+    {
+        // The slots are owned by the ring
+        if (new_length > maximum_)
+        {
+            throw std::bad_alloc();
+        }
+    }
+
+};
+
+} /* namespace detail */
+} /* namespace dds */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif  // _FASTDDS_SUBSCRIBER_DATAREADERIMPL_RINGSEGMENT_HPP_
@@ -36,6 +36,7 @@
 #include <fastrtps/subscriber/Subscriber.h>
 #include <fastrtps_deprecated/publisher/PublisherImpl.h>
 #include <fastrtps_deprecated/subscriber/SubscriberImpl.h>
+#include <rtps/common/PayloadCompression.hpp>
 
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
@@ -359,6 +360,9 @@ Subscriber* ParticipantImpl::createSubscriber(
         ratt.disable_positive_acks = true;
     }
 
+    // The history restores compressed payloads, so writers are told which algorithms it accepts
+    fastdds::rtps::PayloadCompression::add_accepted_property(ratt.endpoint.properties);
+
     RTPSReader* reader = RTPSDomain::createRTPSReader(this->mp_rtpsParticipant,
                     ratt, subimpl->payload_pool(),
                     (ReaderHistory*)&subimpl->m_history,
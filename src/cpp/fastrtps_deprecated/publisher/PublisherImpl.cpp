@@ -93,6 +93,12 @@ PublisherImpl::PublisherImpl(
                         return lifespan_expired();
                     },
                     m_att.qos.m_lifespan.duration.to_ns() * 1e-6);
+
+    if (!fastdds::rtps::PayloadCompression::from_properties(m_att.properties, compression_kind_,
+            compression_level_, compression_threshold_))
+    {
+        logWarning(PUBLISHER, "Payload compression not available. Samples will be sent uncompressed");
+    }
 }
 
 PublisherImpl::~PublisherImpl()
@@ -185,6 +191,15 @@ bool PublisherImpl::create_new_change_with_params(
                     mp_writer->release_change(ch);
                     return false;
                 }
+
+                if ((fastdds::rtps::PayloadCompressionKind::NONE != compression_kind_) &&
+                        (ch->serializedPayload.length >= compression_threshold_) &&
+                        mp_writer->can_send_compressed(static_cast<uint8_t>(compression_kind_)))
+                {
+                    mp_writer->keep_uncompressed_payload(ch->serializedPayload);
+                    fastdds::rtps::PayloadCompression::compress(compression_kind_, compression_level_,
+                            ch->serializedPayload, compression_buffer_);
+                }
             }
 
             InstanceHandle_t change_handle = ch->instanceHandle;
@@ -34,6 +34,7 @@
 
 #include <fastdds/dds/topic/TopicDataType.hpp>
 
+#include <rtps/common/PayloadCompression.hpp>
 #include <rtps/history/ITopicPayloadPool.h>
 
 namespace eprosima {
@@ -266,6 +267,15 @@ private:
 
     std::shared_ptr<rtps::ITopicPayloadPool> payload_pool_;
 
+    //! Algorithm compressing the samples sent over the network (property fastdds.compression)
+    fastdds::rtps::PayloadCompressionKind compression_kind_ = fastdds::rtps::PayloadCompressionKind::NONE;
+    //! Compression level (property fastdds.compression.level)
+    int32_t compression_level_ = 0;
+    //! Samples with a smaller serialized size are not compressed (property fastdds.compression.threshold)
+    uint32_t compression_threshold_ = 1024u;
+    //! Scratch buffer used while compressing
+    std::vector<rtps::octet> compression_buffer_;
+
     /**
      * @brief A method called when an instance misses the deadline
      */
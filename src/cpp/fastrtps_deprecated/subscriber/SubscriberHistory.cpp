@@ -28,6 +28,7 @@
 #include <fastdds/rtps/reader/RTPSReader.h>
 
 #include <fastrtps_deprecated/subscriber/SubscriberImpl.h>
+#include <rtps/common/PayloadCompression.hpp>
 #include <rtps/reader/WriterProxy.h>
 #include <utils/collections/sorted_vector_insert.hpp>
 
@@ -53,6 +54,58 @@ static void get_sample_info(
     info->related_sample_identity = change->write_params.sample_identity();
 }
 
+/**
+ * Arbitrates the ownership of an instance with EXCLUSIVE ownership.
+ * The instance is owned by the strongest writer, or by the one with the lowest GUID among writers with the same
+ * strength. A writer can take an instance without an owner.
+ * @param owner Writer owning the instance, unknown when it has no owner.
+ * @param owner_strength Ownership strength of the writer owning the instance.
+ * @param change Change received for the instance.
+ * @return true if the writer of the change owns the instance or can take it.
+ */
+static bool is_owner_candidate(
+        const GUID_t& owner,
+        uint32_t owner_strength,
+        const CacheChange_t* change)
+{
+    const GUID_t& writer = change->writerGUID;
+    uint32_t strength = change->reader_info.writer_ownership_strength;
+
+    return writer == owner ||
+           owner == c_Guid_Unknown ||
+           strength > owner_strength ||
+           (strength == owner_strength && writer < owner);
+}
+
+/**
+ * Gives the ownership of an instance with EXCLUSIVE ownership to the writer of a change already added to the
+ * history. The owner releases it when unregistering the instance.
+ * @param owner Writer owning the instance, unknown when it has no owner.
+ * @param owner_strength Ownership strength of the writer owning the instance.
+ * @param change Change added for the instance.
+ */
+static void update_owner(
+        GUID_t& owner,
+        uint32_t& owner_strength,
+        const CacheChange_t* change)
+{
+    if (!is_owner_candidate(owner, owner_strength, change))
+    {
+        return;
+    }
+
+    if (NOT_ALIVE_UNREGISTERED == change->kind || NOT_ALIVE_DISPOSED_UNREGISTERED == change->kind)
+    {
+        owner = c_Guid_Unknown;
+        owner_strength = 0;
+    }
+    else
+    {
+        owner = change->writerGUID;
+        owner_strength = change->reader_info.writer_ownership_strength;
+    }
+}
+
 static HistoryAttributes to_history_attributes(
         const TopicAttributes& topic_att,
         uint32_t payloadMaxSize,
@@ -82,6 +135,7 @@ SubscriberHistory::SubscriberHistory(
         uint32_t payloadMaxSize,
         MemoryManagementPolicy_t mempolicy)
     : ReaderHistory(to_history_attributes(topic_att, payloadMaxSize, mempolicy))
+    , no_key_owner_strength_(0)
     , history_qos_(topic_att.historyQos)
     , resource_limited_qos_(topic_att.resourceLimitsQos)
     , topic_att_(topic_att)
@@ -144,8 +198,206 @@ bool SubscriberHistory::received_change(
         return false;
     }
 
+    if (fastdds::rtps::PayloadCompression::is_compressed(a_change->serializedPayload) &&
+            !decompress_change(a_change))
+    {
+        return false;
+    }
+
     std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
-    return receive_fn_(a_change, unknown_missing_changes_up_to);
+    if (!receive_fn_(a_change, unknown_missing_changes_up_to))
+    {
+        return false;
+    }
+
+    update_ownership_nts(a_change);
+    return true;
+}
+
+bool SubscriberHistory::can_change_be_added_nts(
+        CacheChange_t* a_change)
+{
+    if (EXCLUSIVE_OWNERSHIP_QOS != qos_.m_ownership.kind)
+    {
+        return true;
+    }
+
+    if (NO_KEY == topic_att_.getTopicKind())
+    {
+        return is_owner_candidate(no_key_owner_, no_key_owner_strength_, a_change);
+    }
+
+    // The key cannot be calculated from a fragment or a compressed payload. Those changes are not arbitrated.
+    if (!a_change->instanceHandle.isDefined() &&
+            (0 != a_change->getFragmentSize() ||
+            fastdds::rtps::PayloadCompression::is_compressed(a_change->serializedPayload)))
+    {
+        logInfo(SUBSCRIBER, "Change " << a_change->sequenceNumber << " from " << a_change->writerGUID
+                                      << " cannot be arbitrated without its key");
+        return true;
+    }
+
+    t_m_Inst_Caches::iterator vit;
+    if (!find_key_for_change(a_change, vit))
+    {
+        // Let received_change discard it
+        return true;
+    }
+
+    return is_owner_candidate(vit->second.current_owner, vit->second.current_owner_strength, a_change);
+}
+
+void SubscriberHistory::update_ownership_nts(
+        const CacheChange_t* a_change)
+{
+    if (EXCLUSIVE_OWNERSHIP_QOS != qos_.m_ownership.kind)
+    {
+        return;
+    }
+
+    if (NO_KEY == topic_att_.getTopicKind())
+    {
+        update_owner(no_key_owner_, no_key_owner_strength_, a_change);
+        return;
+    }
+
+    // Changes added without their key were not arbitrated
+    if (!a_change->instanceHandle.isDefined())
+    {
+        return;
+    }
+
+    auto it = keyed_changes_.find(a_change->instanceHandle);
+    if (it != keyed_changes_.end())
+    {
+        update_owner(it->second.current_owner, it->second.current_owner_strength, a_change);
+    }
+}
+
+void SubscriberHistory::writer_unmatched(
+        const GUID_t& writer_guid)
+{
+    std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
+    release_ownership(writer_guid);
+}
+
+void SubscriberHistory::writer_not_alive(
+        const GUID_t& writer_guid)
+{
+    if (mp_reader == nullptr || mp_mutex == nullptr)
+    {
+        logError(SUBSCRIBER, "You need to create a Reader with this History before using it");
+        return;
+    }
+
+    std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
+    release_ownership(writer_guid);
+}
+
+void SubscriberHistory::instance_deadline_missed(
+        const InstanceHandle_t& handle)
+{
+    if (mp_reader == nullptr || mp_mutex == nullptr)
+    {
+        logError(SUBSCRIBER, "You need to create a Reader with this History before using it");
+        return;
+    }
+
+    std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
+    if (NO_KEY == topic_att_.getTopicKind())
+    {
+        no_key_owner_ = c_Guid_Unknown;
+        no_key_owner_strength_ = 0;
+        return;
+    }
+
+    auto it = keyed_changes_.find(handle);
+    if (it != keyed_changes_.end())
+    {
+        it->second.current_owner = c_Guid_Unknown;
+        it->second.current_owner_strength = 0;
+    }
+}
+
+void SubscriberHistory::release_ownership(
+        const GUID_t& writer_guid)
+{
+    if (no_key_owner_ == writer_guid)
+    {
+        no_key_owner_ = c_Guid_Unknown;
+        no_key_owner_strength_ = 0;
+    }
+
+    for (auto& instance : keyed_changes_)
+    {
+        if (instance.second.current_owner == writer_guid)
+        {
+            instance.second.current_owner = c_Guid_Unknown;
+            instance.second.current_owner_strength = 0;
+        }
+    }
+}
+
+bool SubscriberHistory::decompress_change(
+        CacheChange_t* a_change)
+{
+    using fastdds::rtps::PayloadCompression;
+
+    IPayloadPool* owner = a_change->payload_owner();
+    if (nullptr == owner)
+    {
+        logError(SUBSCRIBER, "Cannot decompress a change without payload pool");
+        return false;
+    }
+
+    // The payload may be shared with other readers, or with an intraprocess writer, so the original content is
+    // restored on a new one.
+    CacheChange_t decompressed;
+    decompressed.writerGUID = a_change->writerGUID;
+    decompressed.sequenceNumber = a_change->sequenceNumber;
+    uint32_t size = PayloadCompression::decompressed_size(a_change->serializedPayload);
+
+    // The size comes from the network, so it is checked before reserving memory for it
+    uint32_t max_size = PayloadCompression::max_decompressed_size(a_change->serializedPayload);
+    if (type_->is_bounded() && type_->m_typeSize < max_size)
+    {
+        max_size = type_->m_typeSize;
+    }
+    if (size > max_size)
+    {
+        logWarning(SUBSCRIBER, "Discarding compressed change " << a_change->sequenceNumber
+                                                               << " from " << a_change->writerGUID
+                                                               << ": invalid original size " << size);
+        return false;
+    }
+
+    if (!owner->get_payload(size, decompressed))
+    {
+        logWarning(SUBSCRIBER, "Not enough memory to decompress change " << a_change->sequenceNumber
+                                                                         << " from " << a_change->writerGUID);
+        return false;
+    }
+
+    bool ret = PayloadCompression::decompress(a_change->serializedPayload, decompressed.serializedPayload);
+    if (ret)
+    {
+        owner->release_payload(*a_change);
+        a_change->serializedPayload = decompressed.serializedPayload;
+        a_change->payload_owner(owner);
+        decompressed.payload_owner(nullptr);
+    }
+    else
+    {
+        logWarning(SUBSCRIBER, "Could not decompress change " << a_change->sequenceNumber
+                                                              << " from " << a_change->writerGUID);
+        owner->release_payload(decompressed);
+    }
+
+    // Avoid the payload to be freed, as it is now owned by a_change or has been returned to the pool
+    decompressed.serializedPayload.data = nullptr;
+    decompressed.serializedPayload.length = 0;
+    decompressed.serializedPayload.max_size = 0;
+    return ret;
 }
 
 bool SubscriberHistory::received_change_keep_all_no_key(
@@ -286,6 +286,11 @@ void SubscriberImpl::SubscriberReaderListener::on_liveliness_changed(
 {
     (void)reader;
 
+    if (0 < status.not_alive_count_change)
+    {
+        mp_subscriberImpl->m_history.writer_not_alive(iHandle2GUID(status.last_publication_handle));
+    }
+
     if (mp_subscriberImpl->mp_listener != nullptr)
     {
         mp_subscriberImpl->mp_listener->on_liveliness_changed(
@@ -404,6 +409,7 @@ bool SubscriberImpl::deadline_missed()
     deadline_missed_status_.last_instance_handle = timer_owner_;
     mp_listener->on_requested_deadline_missed(mp_userSubscriber, deadline_missed_status_);
     deadline_missed_status_.total_count_change = 0;
+    m_history.instance_deadline_missed(timer_owner_);
 
     if (!m_history.set_next_deadline(
                 timer_owner_,
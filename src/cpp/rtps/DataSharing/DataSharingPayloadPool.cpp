@@ -94,14 +94,18 @@ std::shared_ptr<DataSharingPayloadPool> DataSharingPayloadPool::get_reader_pool(
 }
 
 std::shared_ptr<DataSharingPayloadPool> DataSharingPayloadPool::get_writer_pool(
-        const PoolConfig& config)
+        const PoolConfig& config,
+        uint32_t payload_memory,
+        const fastdds::rtps::SharedSegmentMemoryOptions& memory_options)
 {
     assert (config.memory_policy == PREALLOCATED_MEMORY_MODE ||
             config.memory_policy == PREALLOCATED_WITH_REALLOC_MEMORY_MODE);
 
     return std::make_shared<WriterPool>(
         config.maximum_size,
-        config.payload_initial_size);
+        config.payload_initial_size,
+        payload_memory,
+        memory_options);
 }
 
 }  // namespace rtps
@@ -58,8 +58,19 @@ public:
     static std::shared_ptr<DataSharingPayloadPool> get_reader_pool(
             bool is_reader_volatile);
 
+    /**
+     * Creates the pool to be used by a data-sharing writer.
+     *
+     * @param config Configuration of the writer's history.
+     * @param payload_memory When not zero, the pool will be created for unbounded types,
+     *        and this will be the number of bytes reserved on the segment for variable-size payloads.
+     * @param memory_options Placement options for the pages of the segment.
+     */
     static std::shared_ptr<DataSharingPayloadPool> get_writer_pool(
-            const PoolConfig& config);
+            const PoolConfig& config,
+            uint32_t payload_memory = 0u,
+            const fastdds::rtps::SharedSegmentMemoryOptions& memory_options =
+            fastdds::rtps::SharedSegmentMemoryOptions());
 
     static std::string get_default_directory()
     {
@@ -153,6 +164,7 @@ protected:
                 : status(fastrtps::rtps::ChangeKind_t::ALIVE)
                 , has_been_removed(0)
                 , data_length(0)
+                , data_capacity(0)
                 , sequence_number(c_SequenceNumber_Unknown)
                 , writer_GUID(c_Guid_Unknown)
                 , instance_handle(c_InstanceHandle_Unknown)
@@ -173,6 +185,10 @@ protected:
             // Actual data size of the payload. Must be less than the configured maximum
             uint32_t data_length;
 
+            // Space reserved for the data of this node. Not reset, as it only changes when the writer pool splits
+            // or merges free nodes
+            uint32_t data_capacity;
+
             // Writer's timestamp
             Time_t source_timestamp;
 
@@ -243,6 +259,17 @@ protected:
             metadata_.data_length = length;
         }
 
+        uint32_t data_capacity() const
+        {
+            return metadata_.data_capacity;
+        }
+
+        void data_capacity(
+                uint32_t capacity)
+        {
+            metadata_.data_capacity = capacity;
+        }
+
         uint16_t encapsulation() const
         {
             return metadata_.encapsulation;
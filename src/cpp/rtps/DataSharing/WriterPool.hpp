@@ -26,6 +26,8 @@
 #include <rtps/DataSharing/DataSharingPayloadPool.hpp>
 #include <utils/collections/FixedSizeQueue.hpp>
 
+#include <algorithm>
+#include <array>
 #include <memory>
 
 namespace eprosima {
@@ -37,12 +39,25 @@ class WriterPool : public DataSharingPayloadPool
 
 public:
 
+    /**
+     * @param pool_size Number of payloads that can be in use at the same time.
+     * @param payload_size Size of each payload (bounded types).
+     * @param payload_memory When not zero, payloads will be variable-sized (unbounded types),
+     *        and this will be the total number of bytes reserved for them on the segment.
+     * @param memory_options Placement options for the pages of the segment.
+     */
     WriterPool(
             uint32_t pool_size,
-            uint32_t payload_size)
+            uint32_t payload_size,
+            uint32_t payload_memory = 0u,
+            const fastdds::rtps::SharedSegmentMemoryOptions& memory_options =
+            fastdds::rtps::SharedSegmentMemoryOptions())
         : max_data_size_(payload_size)
         , pool_size_(pool_size)
+        , payload_memory_(payload_memory)
         , free_history_size_(0)
+        , payloads_in_use_(0)
+        , memory_options_(memory_options)
         , writer_(nullptr)
     {
     }
@@ -60,21 +75,32 @@ public:
     }
 
     bool get_payload(
-            uint32_t /*size*/,
+            uint32_t size,
             CacheChange_t& cache_change) override
     {
-        if (free_payloads_.empty())
+        PayloadNode* payload = nullptr;
+        if (is_unbounded())
+        {
+            payload = get_variable_size_node(size);
+        }
+        else if (!free_payloads_.empty())
+        {
+            payload = free_payloads_.front();
+            free_payloads_.pop_front();
+        }
+
+        if (nullptr == payload)
         {
             return false;
         }
 
-        PayloadNode* payload = free_payloads_.front();
-        free_payloads_.pop_front();
+        ++payloads_in_use_;
+
         // Reset all the metadata to signal the reader that the payload is dirty
         payload->reset();
 
         cache_change.serializedPayload.data = payload->data();
-        cache_change.serializedPayload.max_size = max_data_size_;
+        cache_change.serializedPayload.max_size = payload->data_capacity();
         cache_change.payload_owner(this);
 
         return true;
@@ -132,7 +158,7 @@ public:
         }
         else
         {
-            free_payloads_.push_back(payload);
+            return_to_free_payloads(payload);
         }
         logInfo(DATASHARING_PAYLOADPOOL, "Change released with SN " << cache_change.sequenceNumber);
 
@@ -155,7 +181,10 @@ public:
             alignof(PayloadNode), DataSharingPayloadPool::domain_name());
         size_t payload_size = DataSharingPayloadPool::node_size(max_data_size_);
 
-        uint64_t estimated_size_for_payloads_pool = pool_size_ * payload_size;
+        // On unbounded mode the payloads are carved on demand from a memory region of the configured size
+        uint64_t estimated_size_for_payloads_pool = is_unbounded() ?
+                DataSharingPayloadPool::node_size(payload_memory_) :
+                static_cast<uint64_t>(pool_size_) * payload_size;
         overflow |= (estimated_size_for_payloads_pool != static_cast<uint32_t>(estimated_size_for_payloads_pool));
         uint32_t size_for_payloads_pool = static_cast<uint32_t>(estimated_size_for_payloads_pool);
 
@@ -188,7 +217,7 @@ public:
             local_segment = std::unique_ptr<T>(
                 new T(boost::interprocess::create_only,
                 segment_name_,
-                segment_size + T::EXTRA_SEGMENT_SIZE));
+                T::size_for_memory_options(segment_size + T::EXTRA_SEGMENT_SIZE, memory_options_)));
         }
         catch (const std::exception& e)
         {
@@ -197,6 +226,14 @@ public:
             return false;
         }
 
+        // Boost has already written the segment header, so only its first pages may keep the default placement.
+        // The pool itself is constructed below, after the options are applied.
+        if (!local_segment->apply_memory_options(memory_options_))
+        {
+            logWarning(DATASHARING_PAYLOADPOOL, "Segment " << segment_name_
+                                                           << ": memory placement options not fully applied");
+        }
+
         try
         {
             // Alloc the memory for the pool
@@ -204,17 +241,27 @@ public:
             // which is not considered in sizeof(PayloadNode).
             payloads_pool_ = static_cast<octet*>(local_segment->get().allocate(size_for_payloads_pool));
 
-            // Initialize each node in the pool
-            free_payloads_.init(pool_size_);
-            octet* payload = payloads_pool_;
-            for (uint32_t i = 0; i < pool_size_; ++i)
+            if (is_unbounded())
+            {
+                // Nodes will be created on demand
+                payloads_pool_end_ = payloads_pool_ + size_for_payloads_pool;
+                next_unused_payload_ = payloads_pool_;
+            }
+            else
             {
-                new (payload) PayloadNode();
+                // Initialize each node in the pool
+                free_payloads_.init(pool_size_);
+                octet* payload = payloads_pool_;
+                for (uint32_t i = 0; i < pool_size_; ++i)
+                {
+                    PayloadNode* node = new (payload) PayloadNode();
+                    node->data_capacity(max_data_size_);
 
-                // All payloads are free
-                free_payloads_.push_back(reinterpret_cast<PayloadNode*>(payload));
+                    // All payloads are free
+                    free_payloads_.push_back(node);
 
-                payload += (ptrdiff_t)payload_size;
+                    payload += (ptrdiff_t)payload_size;
+                }
             }
 
             //Alloc the memory for the history
@@ -287,6 +334,12 @@ public:
         node->sequence_number(cache_change->sequenceNumber);
 
         // Add it to the history
+        if (is_unbounded())
+        {
+            VariableSizeNode* node_info = node_of(node);
+            node_info->is_published = true;
+            node_info->history_position = history_count(descriptor_->notified_end);
+        }
         history_[static_cast<uint32_t>(descriptor_->notified_end)] = segment_->get_offset_from_address(node);
         logInfo(DATASHARING_PAYLOADPOOL, "Change added to shared history"
                 << " with SN " << cache_change->sequenceNumber);
@@ -329,7 +382,7 @@ public:
             }
 
             payload->has_been_removed(false);
-            free_payloads_.push_back(payload);
+            return_to_free_payloads(payload);
             advance(descriptor_->notified_begin);
             ++free_history_size_;
         }
@@ -345,16 +398,358 @@ public:
         return is_initialized_;
     }
 
+    bool is_unbounded() const
+    {
+        return 0u != payload_memory_;
+    }
+
 private:
 
+    /*
+     * Variable-size nodes are carved on demand, one after the other, from the payloads region.
+     * Each node starts with a VariableSizeNode header, only used by the writer, followed by the PayloadNode.
+     * So the information of the nodes lives on the region itself, and nothing is allocated while writing.
+     * Nodes are walked in address order by adding their sizes.
+     *
+     * Free nodes are linked on bins by size class, with four classes per power of two
+     * (i.e. 512, 640, 768, 896, 1024, 1280, ...), each node on the biggest class it can hold.
+     * A free node bigger than requested is split, the remainder becoming a new free node.
+     * When no node fits, consecutive free nodes are coalesced, and the free nodes at the end of the carved part
+     * are given back to the unused part of the region.
+     *
+     * Readers reach the nodes through the offsets on the shared history, and validate them with the sequence number
+     * on their metadata. So a node whose metadata is absorbed by another node must not be reachable anymore:
+     * it should not have been published, or its entry on the shared history should have been overwritten.
+     * The node that absorbs it keeps its metadata at the same place.
+     */
+    static constexpr size_t min_size_class_shift = 9;
+    static constexpr size_t size_classes_per_shift = 4;
+    static constexpr size_t num_size_classes = (32 - min_size_class_shift) * size_classes_per_shift + 1;
+
+    //< Writer side information of a variable-size node, placed on the region right before its PayloadNode
+    struct alignas (uint64_t) VariableSizeNode
+    {
+        //< Bytes taken by the node on the region, this header and metadata included
+        uint32_t size;
+
+        //< Bin of the node while it is free
+        uint32_t free_class;
+
+        //< Whether the node is on the free bins
+        bool is_free;
+
+        //< Whether the node has ever been added to the shared history
+        bool is_published;
+
+        //< Number of entries added to the shared history before the last addition of the node
+        uint64_t history_position;
+
+        //< Neighbours on the bin of the node while it is free
+        VariableSizeNode* prev_free;
+        VariableSizeNode* next_free;
+    };
+
+    static_assert(sizeof(VariableSizeNode) + PayloadNode::data_offset < (size_t(1) << min_size_class_shift),
+            "The smallest size class must hold the header and the metadata of a node");
+
+    static VariableSizeNode* node_of(
+            PayloadNode* payload)
+    {
+        return reinterpret_cast<VariableSizeNode*>(reinterpret_cast<octet*>(payload) - sizeof(VariableSizeNode));
+    }
+
+    static PayloadNode* payload_of(
+            VariableSizeNode* node)
+    {
+        return reinterpret_cast<PayloadNode*>(reinterpret_cast<octet*>(node) + sizeof(VariableSizeNode));
+    }
+
+    static uint32_t data_capacity_of(
+            size_t node_bytes)
+    {
+        return static_cast<uint32_t>(node_bytes - sizeof(VariableSizeNode) - PayloadNode::data_offset);
+    }
+
+    //< Smallest size class able to hold a node of the given size
+    static size_t size_class(
+            size_t node_size)
+    {
+        if (node_size <= (size_t(1) << min_size_class_shift))
+        {
+            return 0;
+        }
+
+        size_t shift = min_size_class_shift;
+        while ((size_t(2) << shift) < node_size)
+        {
+            ++shift;
+        }
+
+        size_t base = size_t(1) << shift;
+        size_t step = base / size_classes_per_shift;
+        size_t sub_class = (node_size - base + step - 1) / step;
+        return (shift - min_size_class_shift) * size_classes_per_shift + sub_class;
+    }
+
+    //< Biggest size class whose nodes fit on the given size
+    static size_t free_size_class(
+            size_t node_size)
+    {
+        size_t node_class = size_class(node_size);
+        if (node_class > 0 && size_class_bytes(node_class) > node_size)
+        {
+            --node_class;
+        }
+        return std::min(node_class, num_size_classes - 1);
+    }
+
+    static size_t size_class_bytes(
+            size_t size_class)
+    {
+        size_t base = size_t(1) << (min_size_class_shift + size_class / size_classes_per_shift);
+        return base + (base / size_classes_per_shift) * (size_class % size_classes_per_shift);
+    }
+
+    PayloadNode* get_variable_size_node(
+            uint32_t data_size)
+    {
+        if (payloads_in_use_ >= pool_size_)
+        {
+            return nullptr;
+        }
+
+        size_t node_class = size_class(DataSharingPayloadPool::node_size(data_size) + sizeof(VariableSizeNode));
+        if (node_class >= num_size_classes)
+        {
+            return nullptr;
+        }
+
+        size_t class_bytes = size_class_bytes(node_class);
+        PayloadNode* payload = take_free_node(node_class, node_class, class_bytes);
+        if (nullptr == payload)
+        {
+            payload = carve_node(class_bytes);
+        }
+        if (nullptr == payload)
+        {
+            payload = take_free_node(node_class + 1, num_size_classes - 1, class_bytes);
+        }
+        if (nullptr == payload && coalesce_free_nodes())
+        {
+            payload = take_free_node(node_class, num_size_classes - 1, class_bytes);
+            if (nullptr == payload)
+            {
+                payload = carve_node(class_bytes);
+            }
+        }
+
+        if (nullptr == payload)
+        {
+            logWarning(DATASHARING_PAYLOADPOOL, "No space left on the segment for a payload of " << data_size
+                                                                                                  << " bytes");
+        }
+        return payload;
+    }
+
+    //< Takes a free node from the bins of the given classes, keeping only the given bytes of it
+    PayloadNode* take_free_node(
+            size_t first_class,
+            size_t last_class,
+            size_t node_bytes)
+    {
+        for (size_t i = first_class; i <= last_class && i < num_size_classes; ++i)
+        {
+            VariableSizeNode* node = free_bins_[i];
+            if (nullptr != node)
+            {
+                remove_from_free_bins(node);
+                split_node(node, node_bytes);
+                return payload_of(node);
+            }
+        }
+
+        return nullptr;
+    }
+
+    //< Carves a new node from the unused part of the region
+    PayloadNode* carve_node(
+            size_t node_bytes)
+    {
+        if (static_cast<size_t>(payloads_pool_end_ - next_unused_payload_) < node_bytes)
+        {
+            return nullptr;
+        }
+
+        VariableSizeNode* node = new (next_unused_payload_) VariableSizeNode{
+            static_cast<uint32_t>(node_bytes), 0u, false, false, 0u, nullptr, nullptr};
+        PayloadNode* payload = new (payload_of(node)) PayloadNode();
+        payload->data_capacity(data_capacity_of(node_bytes));
+        next_unused_payload_ += node_bytes;
+        return payload;
+    }
+
+    //< Leaves the node with the given bytes, turning the rest into a free node when big enough
+    void split_node(
+            VariableSizeNode* node,
+            size_t node_bytes)
+    {
+        size_t rest_bytes = node->size - node_bytes;
+        if (rest_bytes < size_class_bytes(0))
+        {
+            return;
+        }
+
+        // Invalidate the sample on the node before its data gets overwritten by the new metadata
+        PayloadNode* payload = payload_of(node);
+        payload->reset();
+
+        VariableSizeNode* rest = new (reinterpret_cast<octet*>(node) + node_bytes) VariableSizeNode{
+            static_cast<uint32_t>(rest_bytes), 0u, false, false, 0u, nullptr, nullptr};
+        PayloadNode* rest_payload = new (payload_of(rest)) PayloadNode();
+        rest_payload->data_capacity(data_capacity_of(rest_bytes));
+        add_to_free_bins(rest);
+
+        node->size = static_cast<uint32_t>(node_bytes);
+        payload->data_capacity(data_capacity_of(node_bytes));
+    }
+
+    //< Number of entries added to the shared history before the given index
+    uint64_t history_count(
+            uint64_t index) const
+    {
+        // lower part is the index, upper part is the loop counter
+        return (index >> 32) * descriptor_->history_size + static_cast<uint32_t>(index);
+    }
+
+    //< Whether no reader can reach the metadata of the node anymore
+    bool is_unreachable(
+            const VariableSizeNode* node) const
+    {
+        return !node->is_published ||
+               (history_count(descriptor_->notified_end) - node->history_position > descriptor_->history_size);
+    }
+
+    void add_to_free_bins(
+            VariableSizeNode* node)
+    {
+        node->is_free = true;
+        node->free_class = static_cast<uint32_t>(free_size_class(node->size));
+        node->prev_free = nullptr;
+        node->next_free = free_bins_[node->free_class];
+        if (nullptr != node->next_free)
+        {
+            node->next_free->prev_free = node;
+        }
+        free_bins_[node->free_class] = node;
+    }
+
+    void remove_from_free_bins(
+            VariableSizeNode* node)
+    {
+        assert(node->is_free);
+        if (nullptr != node->prev_free)
+        {
+            node->prev_free->next_free = node->next_free;
+        }
+        else
+        {
+            assert(free_bins_[node->free_class] == node);
+            free_bins_[node->free_class] = node->next_free;
+        }
+        if (nullptr != node->next_free)
+        {
+            node->next_free->prev_free = node->prev_free;
+        }
+        node->is_free = false;
+    }
+
+    /**
+     * Merges each free node with the unreachable free nodes following it,
+     * and gives back the unreachable free nodes at the end of the carved part to the unused part of the region.
+     * @return Whether any node has been merged or given back.
+     */
+    bool coalesce_free_nodes()
+    {
+        bool changed = false;
+        octet* address = payloads_pool_;
+        while (address < next_unused_payload_)
+        {
+            VariableSizeNode* node = reinterpret_cast<VariableSizeNode*>(address);
+            if (!node->is_free)
+            {
+                address += node->size;
+                continue;
+            }
+
+            remove_from_free_bins(node);
+            uint32_t original_size = node->size;
+            octet* next_address = address + node->size;
+            while (next_address < next_unused_payload_)
+            {
+                VariableSizeNode* next = reinterpret_cast<VariableSizeNode*>(next_address);
+                if (!next->is_free || !is_unreachable(next))
+                {
+                    break;
+                }
+
+                remove_from_free_bins(next);
+                node->size += next->size;
+                next_address += next->size;
+            }
+
+            if (next_address == next_unused_payload_ && is_unreachable(node))
+            {
+                next_unused_payload_ = address;
+                return true;
+            }
+
+            if (node->size != original_size)
+            {
+                payload_of(node)->data_capacity(data_capacity_of(node->size));
+                changed = true;
+            }
+            add_to_free_bins(node);
+
+            address = next_address;
+        }
+
+        return changed;
+    }
+
+    void return_to_free_payloads(
+            PayloadNode* payload)
+    {
+        assert(payloads_in_use_ > 0);
+        --payloads_in_use_;
+
+        if (is_unbounded())
+        {
+            add_to_free_bins(node_of(payload));
+        }
+        else
+        {
+            free_payloads_.push_back(payload);
+        }
+    }
+
     octet* payloads_pool_;          //< Shared pool of payloads
 
     uint32_t max_data_size_;        //< Maximum size of the serialized payload data
     uint32_t pool_size_;            //< Number of payloads in the pool
+    uint32_t payload_memory_;       //< Bytes reserved for variable-size payloads (0 for bounded types)
     uint32_t free_history_size_;    //< Number of elements currently unused in the shared history
+    uint32_t payloads_in_use_;      //< Number of payloads currently taken from the pool
+
+    fastdds::rtps::SharedSegmentMemoryOptions memory_options_;  //< Placement options for the segment pages
 
     FixedSizeQueue<PayloadNode*> free_payloads_;    //< Pointers to the free payloads in the pool
 
+    octet* payloads_pool_end_ = nullptr;    //< End of the region for variable-size payloads
+    octet* next_unused_payload_ = nullptr;  //< Start of the part of the region not yet carved into nodes
+
+    //< First free variable-size node of each size class
+    std::array<VariableSizeNode*, num_size_classes> free_bins_ {};
+
     const RTPSWriter* writer_;      //< Writer that is owner of the pool
 
     bool is_initialized_ = false;   //< Whether the pool has been initialized on shared memory
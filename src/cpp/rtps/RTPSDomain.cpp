@@ -24,6 +24,7 @@
 #include <regex>
 
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/history/WriterHistory.h>
 #include <fastdds/rtps/participant/RTPSParticipant.h>
 #include <fastdds/rtps/reader/RTPSReader.h>
@@ -43,6 +44,7 @@
 
 #include <rtps/common/GuidUtils.hpp>
 #include <utils/Host.hpp>
+#include <utils/shared_memory/ParticipantIdLock.hpp>
 
 
 namespace eprosima {
@@ -108,15 +110,30 @@ RTPSParticipant* RTPSDomain::createParticipant(
     }
 
     uint32_t ID;
+    std::unique_ptr<fastdds::rtps::ParticipantIdLock> id_lock;
+    bool host_wide_id = RTPSDomainImpl::use_host_wide_participant_id(PParam);
     {
         std::lock_guard<std::mutex> guard(m_mutex);
 
         if (PParam.participantID < 0)
         {
-            ID = getNewId();
-            while (m_RTPSParticipantIDs.insert(ID).second == false)
+            if (host_wide_id)
+            {
+                id_lock = RTPSDomainImpl::reserve_host_wide_participant_id(domain_id, PParam.port);
+            }
+
+            if (id_lock)
+            {
+                ID = id_lock->participant_id();
+                m_RTPSParticipantIDs.insert(ID);
+            }
+            else
             {
                 ID = getNewId();
+                while (m_RTPSParticipantIDs.insert(ID).second == false)
+                {
+                    ID = getNewId();
+                }
             }
         }
         else
@@ -127,6 +144,13 @@ RTPSParticipant* RTPSDomain::createParticipant(
                 logError(RTPS_PARTICIPANT, "RTPSParticipant with the same ID already exists");
                 return nullptr;
             }
+
+            if (host_wide_id)
+            {
+                // Keep the participants with automatic identifier away from this one. If another process already
+                // holds it, the ports will be mutated as usual.
+                id_lock = fastdds::rtps::ParticipantIdLock::try_lock(domain_id, ID);
+            }
         }
     }
 
@@ -160,6 +184,7 @@ RTPSParticipant* RTPSDomain::createParticipant(
     {
         pimpl = new RTPSParticipantImpl(domain_id, PParam, guidP, p, listen);
     }
+    pimpl->participant_id_lock(std::move(id_lock));
 
     // Above constructors create the sender resources. If a given listening port cannot be allocated an iterative
     // mechanism will allocate another by default. Change the default listening port is unacceptable for server
@@ -423,6 +448,45 @@ RTPSParticipant* RTPSDomain::clientServerEnvironmentCreationOverride(
     return nullptr;
 }
 
+bool RTPSDomainImpl::use_host_wide_participant_id(
+        const RTPSParticipantAttributes& attrs)
+{
+    const std::string* enabled = PropertyPolicyHelper::find_property(attrs.properties, "fastdds.host_participant_id");
+    return (nullptr != enabled) && ("true" == *enabled);
+}
+
+std::unique_ptr<fastdds::rtps::ParticipantIdLock> RTPSDomainImpl::reserve_host_wide_participant_id(
+        uint32_t domain_id,
+        const PortParameters& port)
+{
+    // Identifiers whose ports do not overlap with the ones of the next domain
+    uint32_t max_ids = (0 == port.participantIDGain) ? 1 : port.domainIDGain / port.participantIDGain;
+
+    std::unique_ptr<fastdds::rtps::ParticipantIdLock> id_lock =
+            fastdds::rtps::ParticipantIdLock::lock_lowest_free(domain_id, max_ids, RTPSDomain::m_RTPSParticipantIDs);
+    if (id_lock)
+    {
+        return id_lock;
+    }
+
+    logWarning(RTPS_PARTICIPANT, "No participant identifier free on the host for domain " << domain_id
+                                                                                          << ", using a local one");
+    return nullptr;
+}
+
+std::unique_ptr<fastdds::rtps::ParticipantIdLock> RTPSDomainImpl::reserve_participant_id(
+        uint32_t domain_id,
+        const RTPSParticipantAttributes& attrs)
+{
+    if (0 <= attrs.participantID || !use_host_wide_participant_id(attrs))
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> guard(RTPSDomain::m_mutex);
+    return reserve_host_wide_participant_id(domain_id, attrs.port);
+}
+
 void RTPSDomainImpl::create_participant_guid(
         int32_t& participant_id,
         GUID_t& guid)
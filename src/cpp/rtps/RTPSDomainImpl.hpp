@@ -18,9 +18,18 @@
 #include <fastrtps/rtps/writer/RTPSWriter.h>
 
 #include <chrono>
+#include <memory>
 #include <thread>
 
 namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+class ParticipantIdLock;
+
+} // namespace rtps
+} // namespace fastdds
+
 namespace fastrtps {
 namespace rtps {
 
@@ -32,6 +41,38 @@ class RTPSDomainImpl
 {
 public:
 
+    /**
+     * Check whether the identifiers of a participant are reserved for the whole host.
+     * @param attrs Attributes of the participant.
+     * @return True when enabled with property fastdds.host_participant_id.
+     */
+    static bool use_host_wide_participant_id(
+            const RTPSParticipantAttributes& attrs);
+
+    /**
+     * Reserve the lowest participant identifier which is not used by any participant of the host.
+     * Should be called with RTPSDomain::m_mutex locked.
+     * @param domain_id Domain of the participant.
+     * @param port Port parameters of the participant, which bound the valid identifiers.
+     * @return The reservation, or nullptr if there are no free identifiers.
+     */
+    static std::unique_ptr<fastdds::rtps::ParticipantIdLock> reserve_host_wide_participant_id(
+            uint32_t domain_id,
+            const PortParameters& port);
+
+    /**
+     * Reserve the lowest participant identifier which is not used by any participant of the host, when the
+     * attributes of the participant enable it and do not set an identifier.
+     * It is used to calculate the guid of a participant before creating it. The reservation should be kept until
+     * the participant is destroyed, and its identifier set on the attributes used to create it.
+     * @param domain_id Domain of the participant.
+     * @param attrs Attributes of the participant.
+     * @return The reservation, or nullptr if not enabled or there are no free identifiers.
+     */
+    static std::unique_ptr<fastdds::rtps::ParticipantIdLock> reserve_participant_id(
+            uint32_t domain_id,
+            const RTPSParticipantAttributes& attrs);
+
     /**
      * Creates the guid of a participant given its identifier.
      * @param [in, out] participant_id   Participant identifier for which to generate the GUID.
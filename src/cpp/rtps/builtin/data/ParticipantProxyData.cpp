@@ -99,6 +99,7 @@ ParticipantProxyData::ParticipantProxyData(
     // so there is no need to copy m_readers and m_writers
     , m_readers(nullptr)
     , m_writers(nullptr)
+    , announcement_digest(pdata.announcement_digest)
     , lease_duration_(pdata.lease_duration_)
 {
 }
@@ -698,6 +699,7 @@ void ParticipantProxyData::clear()
     m_properties.length = 0;
     m_userData.clear();
     m_userData.length = 0;
+    announcement_digest.clear();
 }
 
 void ParticipantProxyData::copy(
@@ -717,6 +719,7 @@ void ParticipantProxyData::copy(
     isAlive = pdata.isAlive;
     m_userData = pdata.m_userData;
     m_properties = pdata.m_properties;
+    announcement_digest = pdata.announcement_digest;
 
     // This method is only called when a new participant is discovered.The destination of the copy
     // will always be a new ParticipantProxyData or one from the pool, so there is no need for
@@ -735,10 +738,12 @@ bool ParticipantProxyData::updateData(
 {
     metatraffic_locators = pdata.metatraffic_locators;
     default_locators = pdata.default_locators;
+    m_availableBuiltinEndpoints = pdata.m_availableBuiltinEndpoints;
     m_leaseDuration = pdata.m_leaseDuration;
     isAlive = true;
     m_userData = pdata.m_userData;
     m_properties = pdata.m_properties;
+    announcement_digest = pdata.announcement_digest;
 #if HAVE_SECURITY
     identity_token_ = pdata.identity_token_;
     permissions_token_ = pdata.permissions_token_;
@@ -97,6 +97,7 @@ ReaderProxyData::ReaderProxyData(
     , m_type(nullptr)
     , m_type_information(nullptr)
     , m_properties(readerInfo.m_properties)
+    , announcement_digest_(readerInfo.announcement_digest_)
 {
     if (readerInfo.m_type_id)
     {
@@ -136,6 +137,7 @@ ReaderProxyData& ReaderProxyData::operator =(
     m_topicKind = readerInfo.m_topicKind;
     m_qos.setQos(readerInfo.m_qos, true);
     m_properties = readerInfo.m_properties;
+    announcement_digest_ = readerInfo.announcement_digest_;
 
     if (readerInfo.m_type_id)
     {
@@ -1034,6 +1036,7 @@ void ReaderProxyData::clear()
     m_qos.clear();
     m_properties.clear();
     m_properties.length = 0;
+    announcement_digest_.clear();
 
     if (m_type_id)
     {
@@ -1090,6 +1093,7 @@ void ReaderProxyData::copy(
     m_isAlive = rdata->m_isAlive;
     m_topicKind = rdata->m_topicKind;
     m_properties = rdata->m_properties;
+    announcement_digest_ = rdata->announcement_digest_;
 
     if (rdata->m_type_id)
     {
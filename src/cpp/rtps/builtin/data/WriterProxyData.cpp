@@ -86,6 +86,7 @@ WriterProxyData::WriterProxyData(
     , m_type(nullptr)
     , m_type_information(nullptr)
     , m_properties(writerInfo.m_properties)
+    , announcement_digest_(writerInfo.announcement_digest_)
 {
     if (writerInfo.m_type_id)
     {
@@ -133,6 +134,7 @@ WriterProxyData& WriterProxyData::operator =(
     persistence_guid_ = writerInfo.persistence_guid_;
     m_qos.setQos(writerInfo.m_qos, true);
     m_properties = writerInfo.m_properties;
+    announcement_digest_ = writerInfo.announcement_digest_;
 
     if (writerInfo.m_type_id)
     {
@@ -1040,6 +1042,7 @@ void WriterProxyData::clear()
     persistence_guid_ = c_Guid_Unknown;
     m_properties.clear();
     m_properties.length = 0;
+    announcement_digest_.clear();
 
     if (m_type_id)
     {
@@ -1070,6 +1073,7 @@ void WriterProxyData::copy(
     m_topicKind = wdata->m_topicKind;
     persistence_guid_ = wdata->persistence_guid_;
     m_properties = wdata->m_properties;
+    announcement_digest_ = wdata->announcement_digest_;
 
     if (wdata->m_type_id)
     {
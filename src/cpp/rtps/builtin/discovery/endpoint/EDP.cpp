@@ -146,6 +146,13 @@ bool EDP::newLocalReaderProxyData(
                 }
                 rpd->m_qos.setQos(rqos, true);
                 rpd->userDefinedId(reader->getAttributes().getUserDefinedID());
+                // Announce the compressed payloads restored by the history of the reader
+                const std::string* accepted_compression = PropertyPolicyHelper::find_property(
+                    reader->getAttributes().properties, "fastdds.compression.accepted");
+                if (nullptr != accepted_compression)
+                {
+                    rpd->accepted_compression(*accepted_compression);
+                }
 #if HAVE_SECURITY
                 if (mp_RTPSParticipant->is_secure())
                 {
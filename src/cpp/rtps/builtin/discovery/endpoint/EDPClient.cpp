@@ -44,6 +44,8 @@ bool EDPClient::processLocalReaderProxyData(
     logInfo(RTPS_EDP, rdata->guid().entityId);
     (void)local_reader;
 
+    add_local_reader_interest(rdata->topicName());
+
     auto* writer = &subscriptions_writer_;
 
 #if HAVE_SECURITY
@@ -77,6 +79,8 @@ bool EDPClient::processLocalWriterProxyData(
     logInfo(RTPS_EDP, wdata->guid().entityId);
     (void)local_writer;
 
+    add_local_writer_interest(wdata->topicName());
+
     auto* writer = &publications_writer_;
 
 #if HAVE_SECURITY
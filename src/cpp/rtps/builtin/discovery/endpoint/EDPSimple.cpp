@@ -17,6 +17,7 @@
  *
  */
 
+#include <fastdds/core/policy/ParameterList.hpp>
 #include <fastdds/core/policy/ParameterSerializer.hpp>
 #include <fastdds/rtps/builtin/discovery/endpoint/EDPSimple.h>
 #include <rtps/builtin/discovery/endpoint/EDPSimpleListeners.h>
@@ -450,6 +451,7 @@ bool EDPSimple::createSEDPEndpoints()
 
     publications_listener_ = new EDPSimplePUBListener(this);
     subscriptions_listener_ = new EDPSimpleSUBListener(this);
+    interest_filter_ = mp_RTPSParticipant->edp_interest_filter();
 
     if (m_discovery.discovery_config.m_simpleEDP.use_PublicationWriterANDSubscriptionReader)
     {
@@ -589,6 +591,8 @@ bool EDPSimple::processLocalReaderProxyData(
     logInfo(RTPS_EDP, rdata->guid().entityId);
     (void)local_reader;
 
+    add_local_reader_interest(rdata->topicName());
+
     auto* writer = &subscriptions_writer_;
 
 #if HAVE_SECURITY
@@ -613,6 +617,8 @@ bool EDPSimple::processLocalWriterProxyData(
     logInfo(RTPS_EDP, wdata->guid().entityId);
     (void)local_writer;
 
+    add_local_writer_interest(wdata->topicName());
+
     auto* writer = &publications_writer_;
 
 #if HAVE_SECURITY
@@ -980,6 +986,21 @@ void EDPSimple::removeRemoteEndpoints(
         subscriptions_writer_.first->matched_reader_remove(tmp_guid);
     }
 
+    if (interest_filter_)
+    {
+        // Forget the announcements kept aside for the endpoints of the participant
+        GUID_t first_guid(pdata->m_guid.guidPrefix, c_EntityId_Unknown);
+        std::lock_guard<std::mutex> guard(interest_mutex_);
+        for (SkippedAnnouncementMap* skipped : {&skipped_writers_, &skipped_readers_})
+        {
+            auto it = skipped->lower_bound(first_guid);
+            while (it != skipped->end() && it->first.guidPrefix == first_guid.guidPrefix)
+            {
+                it = skipped->erase(it);
+            }
+        }
+    }
+
 #if HAVE_SECURITY
     auxendp = endp;
     auxendp &= DISC_BUILTIN_ENDPOINT_PUBLICATION_SECURE_ANNOUNCER;
@@ -1040,6 +1061,149 @@ void EDPSimple::removeRemoteEndpoints(
 #endif // if HAVE_SECURITY
 }
 
+bool EDPSimple::skip_remote_writer_announcement(
+        const CacheChange_t& change)
+{
+    return skip_remote_announcement(change, local_reader_topics_, skipped_writers_);
+}
+
+bool EDPSimple::skip_remote_reader_announcement(
+        const CacheChange_t& change)
+{
+    return skip_remote_announcement(change, local_writer_topics_, skipped_readers_);
+}
+
+void EDPSimple::forget_skipped_writer(
+        const GUID_t& writer_guid)
+{
+    if (interest_filter_)
+    {
+        std::lock_guard<std::mutex> guard(interest_mutex_);
+        skipped_writers_.erase(writer_guid);
+    }
+}
+
+void EDPSimple::forget_skipped_reader(
+        const GUID_t& reader_guid)
+{
+    if (interest_filter_)
+    {
+        std::lock_guard<std::mutex> guard(interest_mutex_);
+        skipped_readers_.erase(reader_guid);
+    }
+}
+
+bool EDPSimple::skip_remote_announcement(
+        const CacheChange_t& change,
+        const std::set<std::string>& local_topics,
+        SkippedAnnouncementMap& skipped)
+{
+    if (!interest_filter_)
+    {
+        return false;
+    }
+
+    // Announcements whose topic cannot be read are left to the complete parser
+    string_255 topic_name;
+    if (!ParameterList::read_topic_name_from_payload(change.serializedPayload, topic_name))
+    {
+        return false;
+    }
+
+    GUID_t guid = iHandle2GUID(change.instanceHandle);
+    if (!change.instanceHandle.isDefined() || guid.guidPrefix == mp_RTPSParticipant->getGuid().guidPrefix)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard(interest_mutex_);
+    if (local_topics.find(topic_name.c_str()) != local_topics.end())
+    {
+        return false;
+    }
+
+    // Only the latest announcement of each endpoint is kept
+    SkippedAnnouncement& announcement = skipped[guid];
+    announcement.topic_name = topic_name.c_str();
+    announcement.payload.assign(change.serializedPayload.data,
+            change.serializedPayload.data + change.serializedPayload.length);
+    logInfo(RTPS_EDP, "Keeping aside announcement of " << guid << " in topic " << topic_name);
+    return true;
+}
+
+void EDPSimple::take_skipped_announcements(
+        const std::string& topic_name,
+        SkippedAnnouncementMap& skipped,
+        std::vector<std::vector<octet>>& announcements)
+{
+    for (auto it = skipped.begin(); it != skipped.end();)
+    {
+        if (it->second.topic_name == topic_name)
+        {
+            announcements.push_back(std::move(it->second.payload));
+            it = skipped.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void EDPSimple::add_local_reader_interest(
+        const string_255& topic_name)
+{
+    if (!interest_filter_)
+    {
+        return;
+    }
+
+    // Listeners check the interest with the PDP mutex taken, so no announcement is processed in between
+    std::lock_guard<std::recursive_mutex> pdp_guard(*mp_PDP->getMutex());
+    std::vector<std::vector<octet>> announcements;
+    {
+        std::lock_guard<std::mutex> guard(interest_mutex_);
+        if (!local_reader_topics_.insert(topic_name.c_str()).second)
+        {
+            return;
+        }
+        take_skipped_announcements(topic_name.c_str(), skipped_writers_, announcements);
+    }
+
+    if (!announcements.empty() && nullptr != publications_reader_.first)
+    {
+        static_cast<EDPSimplePUBListener*>(publications_listener_)->add_skipped_writers(
+            publications_reader_.first, announcements);
+    }
+}
+
+void EDPSimple::add_local_writer_interest(
+        const string_255& topic_name)
+{
+    if (!interest_filter_)
+    {
+        return;
+    }
+
+    // Listeners check the interest with the PDP mutex taken, so no announcement is processed in between
+    std::lock_guard<std::recursive_mutex> pdp_guard(*mp_PDP->getMutex());
+    std::vector<std::vector<octet>> announcements;
+    {
+        std::lock_guard<std::mutex> guard(interest_mutex_);
+        if (!local_writer_topics_.insert(topic_name.c_str()).second)
+        {
+            return;
+        }
+        take_skipped_announcements(topic_name.c_str(), skipped_readers_, announcements);
+    }
+
+    if (!announcements.empty() && nullptr != subscriptions_reader_.first)
+    {
+        static_cast<EDPSimpleSUBListener*>(subscriptions_listener_)->add_skipped_readers(
+            subscriptions_reader_.first, announcements);
+    }
+}
+
 bool EDPSimple::areRemoteEndpointsMatched(
         const ParticipantProxyData* pdata)
 {
@@ -67,7 +67,8 @@ void EDPBasePUBListener::add_writer_from_change(
         ReaderHistory* reader_history,
         CacheChange_t* change,
         EDP* edp,
-        bool release_change /*=true*/)
+        bool release_change /*=true*/,
+        const AnnouncementDigest& digest /*=AnnouncementDigest()*/)
 {
     //LOAD INFORMATION IN DESTINATION WRITER PROXY DATA
     const NetworkFactory& network = edp->mp_RTPSParticipant->network_factory();
@@ -82,7 +83,7 @@ void EDPBasePUBListener::add_writer_from_change(
         }
 
         //LOAD INFORMATION IN DESTINATION WRITER PROXY DATA
-        auto copy_data_fun = [this, &network](
+        auto copy_data_fun = [this, &network, &digest](
             WriterProxyData* data,
             bool updating,
             const ParticipantProxyData& participant_data)
@@ -98,6 +99,7 @@ void EDPBasePUBListener::add_writer_from_change(
                                 "Received incompatible update for WriterQos. writer_guid = " << data->guid());
                     }
                     *data = temp_writer_data_;
+                    data->announcement_digest(digest);
                     return true;
                 };
 
@@ -106,7 +108,10 @@ void EDPBasePUBListener::add_writer_from_change(
                 edp->mp_PDP->addWriterProxyData(temp_writer_data_.guid(), participant_guid, copy_data_fun);
 
         //Removing change from history
-        reader_history->remove_change(reader_history->find_change(change), release_change);
+        if (nullptr != reader_history)
+        {
+            reader_history->remove_change(reader_history->find_change(change), release_change);
+        }
 
         // At this point we can release reader lock, cause change is not used
         reader->getMutex().unlock();
@@ -146,8 +151,24 @@ void EDPSimplePUBListener::onNewCacheChangeAdded(
     {
         PREVENT_PDP_DEADLOCK(reader, change, sedp_->mp_PDP);
 
+        // Announcements on topics without local endpoints that could match them are kept aside
+        if (sedp_->skip_remote_writer_announcement(*change))
+        {
+            reader_history->remove_change(change);
+            return;
+        }
+
+        // Repeated announcements of a known writer need no parsing
+        AnnouncementDigest digest;
+        if (sedp_->mp_PDP->has_writer_announcement(iHandle2GUID(change->instanceHandle), *change, digest))
+        {
+            logInfo(RTPS_EDP, "Unchanged announcement, removing");
+            reader_history->remove_change(change);
+            return;
+        }
+
         // Note: change is removed from history inside this method.
-        add_writer_from_change(reader, reader_history, change, sedp_);
+        add_writer_from_change(reader, reader_history, change, sedp_, true, digest);
     }
     else
     {
@@ -156,12 +177,34 @@ void EDPSimplePUBListener::onNewCacheChangeAdded(
         GUID_t writer_guid = iHandle2GUID(change->instanceHandle);
         //Removing change from history
         reader_history->remove_change(change);
+        sedp_->forget_skipped_writer(writer_guid);
         reader->getMutex().unlock();
         this->sedp_->mp_PDP->removeWriterProxyData(writer_guid);
         reader->getMutex().lock();
     }
 }
 
+void EDPSimplePUBListener::add_skipped_writers(
+        RTPSReader* reader,
+        std::vector<std::vector<octet>>& announcements)
+{
+    std::lock_guard<RecursiveTimedMutex> guard(reader->getMutex());
+    for (std::vector<octet>& announcement : announcements)
+    {
+        // Wrap the announcement on a change, as if it was just received
+        CacheChange_t change;
+        change.serializedPayload.data = announcement.data();
+        change.serializedPayload.length = static_cast<uint32_t>(announcement.size());
+        change.serializedPayload.max_size = change.serializedPayload.length;
+        if (computeKey(&change))
+        {
+            AnnouncementDigest digest(change.serializedPayload);
+            add_writer_from_change(reader, nullptr, &change, sedp_, true, digest);
+        }
+        change.serializedPayload.data = nullptr;
+    }
+}
+
 bool EDPListener::computeKey(
         CacheChange_t* change)
 {
@@ -173,7 +216,8 @@ void EDPBaseSUBListener::add_reader_from_change(
         ReaderHistory* reader_history,
         CacheChange_t* change,
         EDP* edp,
-        bool release_change /*=true*/)
+        bool release_change /*=true*/,
+        const AnnouncementDigest& digest /*=AnnouncementDigest()*/)
 {
     //LOAD INFORMATION IN TEMPORAL WRITER PROXY DATA
     const NetworkFactory& network = edp->mp_RTPSParticipant->network_factory();
@@ -187,7 +231,7 @@ void EDPBaseSUBListener::add_reader_from_change(
             return;
         }
 
-        auto copy_data_fun = [this, &network](
+        auto copy_data_fun = [this, &network, &digest](
             ReaderProxyData* data,
             bool updating,
             const ParticipantProxyData& participant_data)
@@ -203,6 +247,7 @@ void EDPBaseSUBListener::add_reader_from_change(
                                 "Received incompatible update for ReaderQos. reader_guid = " << data->guid());
                     }
                     *data = temp_reader_data_;
+                    data->announcement_digest(digest);
                     return true;
                 };
 
@@ -212,7 +257,10 @@ void EDPBaseSUBListener::add_reader_from_change(
                 edp->mp_PDP->addReaderProxyData(temp_reader_data_.guid(), participant_guid, copy_data_fun);
 
         // Remove change from history.
-        reader_history->remove_change(reader_history->find_change(change), release_change);
+        if (nullptr != reader_history)
+        {
+            reader_history->remove_change(reader_history->find_change(change), release_change);
+        }
 
         // At this point we can release reader lock, cause change is not used
         reader->getMutex().unlock();
@@ -255,8 +303,24 @@ void EDPSimpleSUBListener::onNewCacheChangeAdded(
     {
         PREVENT_PDP_DEADLOCK(reader, change, sedp_->mp_PDP);
 
+        // Announcements on topics without local endpoints that could match them are kept aside
+        if (sedp_->skip_remote_reader_announcement(*change))
+        {
+            reader_history->remove_change(change);
+            return;
+        }
+
+        // Repeated announcements of a known reader need no parsing
+        AnnouncementDigest digest;
+        if (sedp_->mp_PDP->has_reader_announcement(iHandle2GUID(change->instanceHandle), *change, digest))
+        {
+            logInfo(RTPS_EDP, "Unchanged announcement, removing");
+            reader_history->remove_change(change);
+            return;
+        }
+
         // Note: change is removed from history inside this method.
-        add_reader_from_change(reader, reader_history, change, sedp_);
+        add_reader_from_change(reader, reader_history, change, sedp_, true, digest);
     }
     else
     {
@@ -266,12 +330,34 @@ void EDPSimpleSUBListener::onNewCacheChangeAdded(
         GUID_t reader_guid = iHandle2GUID(change->instanceHandle);
         //Removing change from history
         reader_history->remove_change(change);
+        sedp_->forget_skipped_reader(reader_guid);
         reader->getMutex().unlock();
         this->sedp_->mp_PDP->removeReaderProxyData(reader_guid);
         reader->getMutex().lock();
     }
 }
 
+void EDPSimpleSUBListener::add_skipped_readers(
+        RTPSReader* reader,
+        std::vector<std::vector<octet>>& announcements)
+{
+    std::lock_guard<RecursiveTimedMutex> guard(reader->getMutex());
+    for (std::vector<octet>& announcement : announcements)
+    {
+        // Wrap the announcement on a change, as if it was just received
+        CacheChange_t change;
+        change.serializedPayload.data = announcement.data();
+        change.serializedPayload.length = static_cast<uint32_t>(announcement.size());
+        change.serializedPayload.max_size = change.serializedPayload.length;
+        if (computeKey(&change))
+        {
+            AnnouncementDigest digest(change.serializedPayload);
+            add_reader_from_change(reader, nullptr, &change, sedp_, true, digest);
+        }
+        change.serializedPayload.data = nullptr;
+    }
+}
+
 void EDPSimplePUBListener::onWriterChangeReceivedByAll(
         RTPSWriter* writer,
         CacheChange_t* change)
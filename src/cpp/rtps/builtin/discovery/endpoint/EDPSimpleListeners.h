@@ -86,7 +86,8 @@ protected:
             ReaderHistory* reader_history,
             CacheChange_t* change,
             EDP* edp,
-            bool release_change = true);
+            bool release_change = true,
+            const AnnouncementDigest& digest = AnnouncementDigest());
 
     //!Temporary structure to avoid allocations
     WriterProxyData temp_writer_data_;
@@ -119,7 +120,8 @@ protected:
             ReaderHistory* reader_history,
             CacheChange_t* change,
             EDP* edp,
-            bool release_change = true);
+            bool release_change = true,
+            const AnnouncementDigest& digest = AnnouncementDigest());
 
     //!Temporary structure to avoid allocations
     ReaderProxyData temp_reader_data_;
@@ -167,6 +169,16 @@ public:
             RTPSWriter* writer,
             CacheChange_t* change) override;
 
+    /**
+     * Process the announcements of remote writers that were kept aside, as there were no local readers on their topic.
+     * Should be called with the PDP mutex taken.
+     * @param reader Pointer to the publications reader.
+     * @param announcements Serialized announcements.
+     */
+    void add_skipped_writers(
+            RTPSReader* reader,
+            std::vector<std::vector<octet>>& announcements);
+
 protected:
 
     //!Pointer to the EDPSimple
@@ -213,6 +225,16 @@ public:
             RTPSWriter* writer,
             CacheChange_t* change) override;
 
+    /**
+     * Process the announcements of remote readers that were kept aside, as there were no local writers on their topic.
+     * Should be called with the PDP mutex taken.
+     * @param reader Pointer to the subscriptions reader.
+     * @param announcements Serialized announcements.
+     */
+    void add_skipped_readers(
+            RTPSReader* reader,
+            std::vector<std::vector<octet>>& announcements);
+
 private:
 
     //!Pointer to the EDPSimple
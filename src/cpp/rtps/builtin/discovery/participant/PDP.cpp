@@ -241,7 +241,10 @@ void PDP::initializeParticipantProxyData(
     participant_data->m_availableBuiltinEndpoints |= DISC_BUILTIN_ENDPOINT_PARTICIPANT_SECURE_DETECTOR;
 #endif // if HAVE_SECURITY
 
-    if (mp_RTPSParticipant->getAttributes().builtin.use_WriterLivelinessProtocol)
+    // Lazily created builtin endpoints are added to the mask when they are created
+    bool lazy_builtin_endpoints = mp_RTPSParticipant->lazy_builtin_endpoints();
+
+    if (mp_RTPSParticipant->getAttributes().builtin.use_WriterLivelinessProtocol && !lazy_builtin_endpoints)
     {
         participant_data->m_availableBuiltinEndpoints |= BUILTIN_ENDPOINT_PARTICIPANT_MESSAGE_DATA_WRITER;
         participant_data->m_availableBuiltinEndpoints |= BUILTIN_ENDPOINT_PARTICIPANT_MESSAGE_DATA_READER;
@@ -252,13 +255,13 @@ void PDP::initializeParticipantProxyData(
 #endif // if HAVE_SECURITY
     }
 
-    if (mp_RTPSParticipant->getAttributes().builtin.typelookup_config.use_server)
+    if (mp_RTPSParticipant->getAttributes().builtin.typelookup_config.use_server && !lazy_builtin_endpoints)
     {
         participant_data->m_availableBuiltinEndpoints |= BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REQUEST_DATA_READER;
         participant_data->m_availableBuiltinEndpoints |= BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REPLY_DATA_WRITER;
     }
 
-    if (mp_RTPSParticipant->getAttributes().builtin.typelookup_config.use_client)
+    if (mp_RTPSParticipant->getAttributes().builtin.typelookup_config.use_client && !lazy_builtin_endpoints)
     {
         participant_data->m_availableBuiltinEndpoints |= BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REQUEST_DATA_WRITER;
         participant_data->m_availableBuiltinEndpoints |= BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REPLY_DATA_READER;
@@ -504,11 +507,55 @@ void PDP::announceParticipantState(
 
 }
 
+void PDP::add_builtin_endpoints(
+        uint32_t endpoints)
+{
+    {
+        std::lock_guard<std::recursive_mutex> guard(*getMutex());
+        ParticipantProxyData* local_participant_data = getLocalParticipantProxyData();
+        if (endpoints == (local_participant_data->m_availableBuiltinEndpoints & endpoints))
+        {
+            return;
+        }
+        local_participant_data->m_availableBuiltinEndpoints |= endpoints;
+    }
+
+    // Send DATA(P)
+    announceParticipantState(true);
+}
+
+void PDP::builtin_endpoints_changed(
+        const ParticipantProxyData& pdata)
+{
+    if (mp_builtin->mp_WLP != nullptr)
+    {
+        mp_builtin->mp_WLP->assignRemoteEndpoints(pdata);
+    }
+    if (mp_builtin->tlm_ != nullptr)
+    {
+        mp_builtin->tlm_->assign_remote_endpoints(pdata);
+    }
+}
+
 void PDP::stopParticipantAnnouncement()
 {
     resend_participant_info_event_->cancel_timer();
 }
 
+void PDP::get_memory_usage(
+        MemoryUsage& usage)
+{
+    std::lock_guard<std::recursive_mutex> guardPDP(*mp_mutex);
+
+    usage.reserved = participant_proxies_number_ * sizeof(ParticipantProxyData) +
+            reader_proxies_number_ * sizeof(ReaderProxyData) +
+            writer_proxies_number_ * sizeof(WriterProxyData);
+    usage.in_use = usage.reserved -
+            participant_proxies_pool_.size() * sizeof(ParticipantProxyData) -
+            reader_proxies_pool_.size() * sizeof(ReaderProxyData) -
+            writer_proxies_pool_.size() * sizeof(WriterProxyData);
+}
+
 void PDP::resetParticipantAnnouncement()
 {
     resend_participant_info_event_->restart_timer();
@@ -549,6 +596,36 @@ bool PDP::lookupReaderProxyData(
     return false;
 }
 
+bool PDP::has_reader_announcement(
+        const GUID_t& reader,
+        const CacheChange_t& change,
+        AnnouncementDigest& digest)
+{
+    std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
+    for (ParticipantProxyData* pit : participant_proxies_)
+    {
+        if (pit->m_guid.guidPrefix == reader.guidPrefix)
+        {
+            auto rit = pit->m_readers->find(reader.entityId);
+            if (rit != pit->m_readers->end())
+            {
+                const AnnouncementDigest& known = rit->second->announcement_digest();
+                if (known.is_same_change(change))
+                {
+                    return true;
+                }
+
+                digest = AnnouncementDigest(change);
+                return digest == known;
+            }
+            break;
+        }
+    }
+
+    digest = AnnouncementDigest(change);
+    return false;
+}
+
 bool PDP::has_writer_proxy_data(
         const GUID_t& writer)
 {
@@ -584,6 +661,36 @@ bool PDP::lookupWriterProxyData(
     return false;
 }
 
+bool PDP::has_writer_announcement(
+        const GUID_t& writer,
+        const CacheChange_t& change,
+        AnnouncementDigest& digest)
+{
+    std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
+    for (ParticipantProxyData* pit : participant_proxies_)
+    {
+        if (pit->m_guid.guidPrefix == writer.guidPrefix)
+        {
+            auto wit = pit->m_writers->find(writer.entityId);
+            if (wit != pit->m_writers->end())
+            {
+                const AnnouncementDigest& known = wit->second->announcement_digest();
+                if (known.is_same_change(change))
+                {
+                    return true;
+                }
+
+                digest = AnnouncementDigest(change);
+                return digest == known;
+            }
+            break;
+        }
+    }
+
+    digest = AnnouncementDigest(change);
+    return false;
+}
+
 bool PDP::removeReaderProxyData(
         const GUID_t& reader_guid)
 {
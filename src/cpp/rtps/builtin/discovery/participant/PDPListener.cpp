@@ -95,6 +95,39 @@ void PDPListener::onNewCacheChangeAdded(
             return;
         }
 
+        // Periodic announcements of a known participant usually repeat the information already received.
+        // Its liveliness was asserted when the message arrived, so there is no need to parse them again.
+        // Resending the same change is recognized by its sequence number, and other changes by their digest.
+        AnnouncementDigest digest;
+        bool is_hashed = false;
+        bool is_unchanged = false;
+        for (ParticipantProxyData* it : parent_pdp_->participant_proxies_)
+        {
+            if (guid == it->m_guid)
+            {
+                is_unchanged = it->announcement_digest.is_same_change(*change);
+                if (!is_unchanged)
+                {
+                    digest = AnnouncementDigest(*change);
+                    is_hashed = true;
+                    is_unchanged = digest == it->announcement_digest;
+                }
+                break;
+            }
+        }
+
+        if (is_unchanged)
+        {
+            logInfo(RTPS_PDP, "Unchanged announcement from " << guid << ", removing");
+            parent_pdp_->mp_PDPReaderHistory->remove_change(change);
+            return;
+        }
+
+        if (!is_hashed)
+        {
+            digest = AnnouncementDigest(*change);
+        }
+
         // Access to temp_participant_data_ is protected by reader lock
 
         // Load information on temp_participant_data_
@@ -105,6 +138,7 @@ void PDPListener::onNewCacheChangeAdded(
         {
             // After correctly reading it
             change->instanceHandle = temp_participant_data_.m_key;
+            temp_participant_data_.announcement_digest = digest;
             guid = temp_participant_data_.m_guid;
 
             // Check if participant already exists (updated info)
@@ -151,6 +185,7 @@ void PDPListener::onNewCacheChangeAdded(
             }
             else
             {
+                uint32_t previous_builtin_endpoints = pdata->m_availableBuiltinEndpoints;
                 pdata->updateData(temp_participant_data_);
                 pdata->isAlive = true;
                 reader->getMutex().unlock();
@@ -166,6 +201,12 @@ void PDPListener::onNewCacheChangeAdded(
                 }
 
                 lock.unlock();
+
+                // Builtin endpoints created lazily by the remote participant
+                if (previous_builtin_endpoints != pdata->m_availableBuiltinEndpoints)
+                {
+                    parent_pdp_->builtin_endpoints_changed(*pdata);
+                }
             }
 
             if (pdata != nullptr)
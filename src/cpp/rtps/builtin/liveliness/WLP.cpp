@@ -78,6 +78,17 @@ static void set_builtin_writer_history_attributes(
     hatt.maximumReservedCaches = 2;
 }
 
+/**
+ * Check whether the liveliness of an entity is asserted through the builtin endpoints.
+ * Entities with infinite lease duration do not need them, and MANUAL_BY_TOPIC liveliness
+ * is asserted through the heartbeats of the writer.
+ */
+static bool uses_builtin_endpoints(
+        const LivelinessQosPolicy& liveliness)
+{
+    return MANUAL_BY_TOPIC_LIVELINESS_QOS != liveliness.kind && c_TimeInfinite != liveliness.lease_duration;
+}
+
 WLP::WLP(
         BuiltinProtocols* p)
     : min_automatic_ms_(std::numeric_limits<double>::max())
@@ -156,8 +167,14 @@ WLP::~WLP()
     }
 #endif // if HAVE_SECURITY
 
-    mp_participant->deleteUserEndpoint(mp_builtinReader);
-    mp_participant->deleteUserEndpoint(mp_builtinWriter);
+    if (mp_builtinReader != nullptr)
+    {
+        mp_participant->deleteUserEndpoint(mp_builtinReader);
+    }
+    if (mp_builtinWriter != nullptr)
+    {
+        mp_participant->deleteUserEndpoint(mp_builtinWriter);
+    }
 
     if (mp_builtinReaderHistory)
     {
@@ -219,7 +236,12 @@ bool WLP::initWL(
         },
         mp_participant->getEventResource());
 
-    bool retVal = createEndpoints();
+    bool retVal = true;
+    // Lazily created builtin endpoints are created with the first writer or reader needing them
+    if (!p->lazy_builtin_endpoints())
+    {
+        retVal = createEndpoints();
+    }
 #if HAVE_SECURITY
     if (retVal && p->is_secure())
     {
@@ -324,6 +346,44 @@ bool WLP::createEndpoints()
     return true;
 }
 
+bool WLP::enable_endpoints()
+{
+    std::vector<ParticipantProxyData> remote_participants;
+
+    {
+        std::lock_guard<std::recursive_mutex> guard(*mp_builtinProtocols->mp_PDP->getMutex());
+        if (mp_builtinWriter != nullptr)
+        {
+            return true;
+        }
+
+        logInfo(RTPS_LIVELINESS, "Creating Liveliness Protocol endpoints on demand");
+        if (!createEndpoints())
+        {
+            return false;
+        }
+
+        // Pairing is done without the PDP mutex, as the listener of the builtin reader takes it
+        PDP* pdp = mp_builtinProtocols->mp_PDP;
+        for (auto it = pdp->ParticipantProxiesBegin(); it != pdp->ParticipantProxiesEnd(); ++it)
+        {
+            if ((*it)->m_guid != mp_participant->getGuid())
+            {
+                remote_participants.emplace_back(**it);
+            }
+        }
+    }
+
+    for (const ParticipantProxyData& pdata : remote_participants)
+    {
+        assignRemoteEndpoints(pdata);
+    }
+
+    mp_builtinProtocols->mp_PDP->add_builtin_endpoints(
+        BUILTIN_ENDPOINT_PARTICIPANT_MESSAGE_DATA_WRITER | BUILTIN_ENDPOINT_PARTICIPANT_MESSAGE_DATA_READER);
+    return true;
+}
+
 #if HAVE_SECURITY
 
 bool WLP::createSecureEndpoints()
@@ -610,6 +670,11 @@ bool WLP::add_local_writer(
         RTPSWriter* W,
         const WriterQos& wqos)
 {
+    if (uses_builtin_endpoints(wqos.m_liveliness) && !enable_endpoints())
+    {
+        logError(RTPS_LIVELINESS, "Could not create the endpoints of the Liveliness Protocol");
+    }
+
     std::lock_guard<std::recursive_mutex> guard(*mp_builtinProtocols->mp_PDP->getMutex());
     logInfo(RTPS_LIVELINESS, W->getGuid().entityId << " to Liveliness Protocol");
 
@@ -810,6 +875,11 @@ bool WLP::add_local_reader(
         RTPSReader* reader,
         const ReaderQos& rqos)
 {
+    if (uses_builtin_endpoints(rqos.m_liveliness) && !enable_endpoints())
+    {
+        logError(RTPS_LIVELINESS, "Could not create the endpoints of the Liveliness Protocol");
+    }
+
     std::lock_guard<std::recursive_mutex> guard(*mp_builtinProtocols->mp_PDP->getMutex());
 
     if (rqos.m_liveliness.kind == AUTOMATIC_LIVELINESS_QOS)
@@ -872,6 +942,12 @@ bool WLP::send_liveliness_message(
     StatefulWriter* writer = builtin_writer();
     WriterHistory* history = builtin_writer_history();
 
+    if (writer == nullptr)
+    {
+        // Endpoints not created, as no writer needs them
+        return false;
+    }
+
     std::lock_guard<RecursiveTimedMutex> wguard(writer->getMutex());
 
     CacheChange_t* change = writer->new_change(
@@ -0,0 +1,90 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AdaptiveTiming.hpp
+ */
+
+#ifndef RTPS_COMMON_ADAPTIVETIMING_HPP_
+#define RTPS_COMMON_ADAPTIVETIMING_HPP_
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
+#include <fastdds/rtps/common/RoundTripTimeEstimator.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Reads the adaptive timing configuration from the properties of an endpoint:
+ * - fastdds.adaptive_timing: "true" enables it.
+ * - fastdds.adaptive_timing.min_interval: lower bound of the computed intervals, in milliseconds.
+ * - fastdds.adaptive_timing.max_interval: upper bound of the computed intervals, in milliseconds.
+ * @param properties Properties of the endpoint.
+ * @param settings Settings to fill. Members without property keep their value.
+ */
+inline void get_adaptive_timing_settings(
+        const PropertyPolicy& properties,
+        AdaptiveTimingSettings& settings)
+{
+    const std::string* enabled = PropertyPolicyHelper::find_property(properties, "fastdds.adaptive_timing");
+    if (nullptr == enabled)
+    {
+        return;
+    }
+
+    settings.enabled = ("true" == *enabled);
+    if (!settings.enabled)
+    {
+        return;
+    }
+
+    auto read_bound = [&properties](const char* name, std::chrono::milliseconds& bound)
+            {
+                const std::string* value = PropertyPolicyHelper::find_property(properties, name);
+                if (nullptr != value)
+                {
+                    uint32_t ms = 0;
+                    std::stringstream ss(*value);
+                    if (ss >> ms)
+                    {
+                        bound = std::chrono::milliseconds(ms);
+                    }
+                    else
+                    {
+                        logError(RTPS_ENDPOINT, "Wrong value '" << *value << "' for property " << name);
+                    }
+                }
+            };
+
+    read_bound("fastdds.adaptive_timing.min_interval", settings.min_interval);
+    read_bound("fastdds.adaptive_timing.max_interval", settings.max_interval);
+
+    if (settings.max_interval < settings.min_interval)
+    {
+        logError(RTPS_ENDPOINT, "fastdds.adaptive_timing.max_interval is smaller than the minimum one");
+        settings.max_interval = settings.min_interval;
+    }
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // RTPS_COMMON_ADAPTIVETIMING_HPP_
@@ -0,0 +1,357 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PayloadCompression.cpp
+ */
+
+#include <rtps/common/PayloadCompression.hpp>
+
+#include <fastrtps/config.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#if HAVE_LZ4
+#include <lz4.h>
+#include <lz4hc.h>
+#endif // if HAVE_LZ4
+
+#if HAVE_ZSTD
+#include <zstd.h>
+#endif // if HAVE_ZSTD
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+using fastrtps::rtps::octet;
+using fastrtps::rtps::PropertyPolicy;
+using fastrtps::rtps::PropertyPolicyHelper;
+using fastrtps::rtps::SerializedPayload_t;
+
+namespace {
+
+constexpr octet compressed_mark = 0x80;
+
+// Each LZ4 sequence needs at least one byte for each 255 bytes it restores.
+constexpr uint64_t lz4_max_ratio = 255u;
+
+// A zstd block restores at most 128 KB, and needs at least 4 bytes (3 for its header and 1 for an RLE byte).
+constexpr uint64_t zstd_min_block_size = 4u;
+constexpr uint64_t zstd_max_block_content = 128u * 1024u;
+
+void write_header(
+        octet* header,
+        PayloadCompressionKind kind,
+        uint32_t length)
+{
+    header[0] = compressed_mark;
+    header[1] = static_cast<octet>(kind);
+    header[2] = 0;
+    header[3] = 0;
+    header[4] = static_cast<octet>(length);
+    header[5] = static_cast<octet>(length >> 8);
+    header[6] = static_cast<octet>(length >> 16);
+    header[7] = static_cast<octet>(length >> 24);
+}
+
+} // namespace
+
+const char* const PayloadCompression::accepted_property = "fastdds.compression.accepted";
+
+bool PayloadCompression::from_string(
+        const std::string& name,
+        PayloadCompressionKind& kind)
+{
+    if (name.empty() || name == "none")
+    {
+        kind = PayloadCompressionKind::NONE;
+    }
+    else if (name == "lz4")
+    {
+        kind = PayloadCompressionKind::LZ4;
+    }
+    else if (name == "zstd")
+    {
+        kind = PayloadCompressionKind::ZSTD;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool PayloadCompression::from_properties(
+        const PropertyPolicy& properties,
+        PayloadCompressionKind& kind,
+        int32_t& level,
+        uint32_t& threshold)
+{
+    kind = PayloadCompressionKind::NONE;
+
+    auto compression = PropertyPolicyHelper::find_property(properties, "fastdds.compression");
+    if (nullptr == compression)
+    {
+        return true;
+    }
+
+    if (!from_string(*compression, kind) || !is_supported(kind))
+    {
+        kind = PayloadCompressionKind::NONE;
+        return false;
+    }
+
+    auto compression_level = PropertyPolicyHelper::find_property(properties, "fastdds.compression.level");
+    if (nullptr != compression_level)
+    {
+        level = static_cast<int32_t>(std::strtol(compression_level->c_str(), nullptr, 10));
+    }
+
+    auto compression_threshold = PropertyPolicyHelper::find_property(properties, "fastdds.compression.threshold");
+    if (nullptr != compression_threshold)
+    {
+        unsigned long value = std::strtoul(compression_threshold->c_str(), nullptr, 10);
+        threshold = value > std::numeric_limits<uint32_t>::max() ?
+                std::numeric_limits<uint32_t>::max() : static_cast<uint32_t>(value);
+    }
+
+    return true;
+}
+
+bool PayloadCompression::is_supported(
+        PayloadCompressionKind kind)
+{
+    switch (kind)
+    {
+        case PayloadCompressionKind::NONE:
+            return true;
+        case PayloadCompressionKind::LZ4:
+            return HAVE_LZ4 != 0;
+        case PayloadCompressionKind::ZSTD:
+            return HAVE_ZSTD != 0;
+    }
+
+    return false;
+}
+
+std::string PayloadCompression::supported_algorithms()
+{
+    std::string algorithms;
+    if (is_supported(PayloadCompressionKind::LZ4))
+    {
+        algorithms = "lz4";
+    }
+    if (is_supported(PayloadCompressionKind::ZSTD))
+    {
+        algorithms += algorithms.empty() ? "zstd" : ",zstd";
+    }
+    return algorithms;
+}
+
+void PayloadCompression::add_accepted_property(
+        PropertyPolicy& properties)
+{
+    std::string algorithms = supported_algorithms();
+    if (!algorithms.empty() && nullptr == PropertyPolicyHelper::find_property(properties, accepted_property))
+    {
+        fastrtps::rtps::Property property;
+        property.name(accepted_property);
+        property.value(std::move(algorithms));
+        properties.properties().push_back(std::move(property));
+    }
+}
+
+uint8_t PayloadCompression::accepted_mask(
+        const std::string& algorithms)
+{
+    uint8_t mask = 0;
+    std::string::size_type begin = 0;
+    while (begin < algorithms.size())
+    {
+        std::string::size_type end = algorithms.find(',', begin);
+        if (std::string::npos == end)
+        {
+            end = algorithms.size();
+        }
+
+        PayloadCompressionKind kind;
+        if (from_string(algorithms.substr(begin, end - begin), kind) && PayloadCompressionKind::NONE != kind)
+        {
+            mask |= static_cast<uint8_t>(1u << static_cast<uint8_t>(kind));
+        }
+        begin = end + 1;
+    }
+    return mask;
+}
+
+bool PayloadCompression::compress(
+        PayloadCompressionKind kind,
+        int32_t level,
+        SerializedPayload_t& payload,
+        std::vector<octet>& buffer)
+{
+    (void)level;
+
+    if (payload.data == nullptr || payload.length <= header_size ||
+            payload.length > static_cast<uint32_t>(std::numeric_limits<int>::max()))
+    {
+        return false;
+    }
+
+    // Only worth it if the result is shorter than the original payload.
+    const uint32_t max_length = payload.length - 1;
+    buffer.resize(max_length);
+    size_t compressed_length = 0;
+
+    switch (kind)
+    {
+#if HAVE_LZ4
+        case PayloadCompressionKind::LZ4:
+        {
+            const char* src = reinterpret_cast<const char*>(payload.data);
+            char* dst = reinterpret_cast<char*>(buffer.data() + header_size);
+            int src_size = static_cast<int>(payload.length);
+            int dst_capacity = static_cast<int>(max_length - header_size);
+            int ret = 0 < level ?
+                    LZ4_compress_HC(src, dst, src_size, dst_capacity, level) :
+                    LZ4_compress_default(src, dst, src_size, dst_capacity);
+            compressed_length = ret > 0 ? static_cast<size_t>(ret) : 0;
+            break;
+        }
+#endif // if HAVE_LZ4
+#if HAVE_ZSTD
+        case PayloadCompressionKind::ZSTD:
+        {
+            size_t ret = ZSTD_compress(buffer.data() + header_size, max_length - header_size,
+                            payload.data, payload.length, level);
+            compressed_length = ZSTD_isError(ret) ? 0 : ret;
+            break;
+        }
+#endif // if HAVE_ZSTD
+        default:
+            break;
+    }
+
+    if (0 == compressed_length)
+    {
+        return false;
+    }
+
+    write_header(buffer.data(), kind, payload.length);
+    payload.length = static_cast<uint32_t>(header_size + compressed_length);
+    memcpy(payload.data, buffer.data(), payload.length);
+    payload.pos = 0;
+    return true;
+}
+
+bool PayloadCompression::is_compressed(
+        const SerializedPayload_t& payload)
+{
+    return payload.data != nullptr && payload.length > header_size &&
+           compressed_mark == payload.data[0] && 0 != payload.data[1];
+}
+
+uint32_t PayloadCompression::decompressed_size(
+        const SerializedPayload_t& payload)
+{
+    const octet* header = payload.data;
+    return static_cast<uint32_t>(header[4]) |
+           (static_cast<uint32_t>(header[5]) << 8) |
+           (static_cast<uint32_t>(header[6]) << 16) |
+           (static_cast<uint32_t>(header[7]) << 24);
+}
+
+uint32_t PayloadCompression::max_decompressed_size(
+        const SerializedPayload_t& payload)
+{
+    const PayloadCompressionKind kind = static_cast<PayloadCompressionKind>(payload.data[1]);
+    if (!is_supported(kind))
+    {
+        return 0;
+    }
+
+    const uint64_t compressed_length = payload.length - header_size;
+    uint64_t max_length = 0;
+    switch (kind)
+    {
+        case PayloadCompressionKind::LZ4:
+            max_length = compressed_length * lz4_max_ratio;
+            break;
+        case PayloadCompressionKind::ZSTD:
+            max_length = (compressed_length / zstd_min_block_size) * zstd_max_block_content;
+            break;
+        default:
+            break;
+    }
+
+    return max_length > std::numeric_limits<uint32_t>::max() ?
+           std::numeric_limits<uint32_t>::max() : static_cast<uint32_t>(max_length);
+}
+
+bool PayloadCompression::decompress(
+        const SerializedPayload_t& input,
+        SerializedPayload_t& output)
+{
+    const uint32_t length = decompressed_size(input);
+    if (output.data == nullptr || output.max_size < length || length > max_decompressed_size(input))
+    {
+        return false;
+    }
+
+    const octet* src = input.data + header_size;
+    const uint32_t src_size = input.length - header_size;
+    bool ret = false;
+
+    switch (static_cast<PayloadCompressionKind>(input.data[1]))
+    {
+#if HAVE_LZ4
+        case PayloadCompressionKind::LZ4:
+        {
+            int result = LZ4_decompress_safe(reinterpret_cast<const char*>(src),
+                            reinterpret_cast<char*>(output.data), static_cast<int>(src_size),
+                            static_cast<int>(length));
+            ret = result >= 0 && static_cast<uint32_t>(result) == length;
+            break;
+        }
+#endif // if HAVE_LZ4
+#if HAVE_ZSTD
+        case PayloadCompressionKind::ZSTD:
+        {
+            size_t result = ZSTD_decompress(output.data, length, src, src_size);
+            ret = !ZSTD_isError(result) && result == length;
+            break;
+        }
+#endif // if HAVE_ZSTD
+        default:
+            (void)src;
+            (void)src_size;
+            break;
+    }
+
+    if (ret)
+    {
+        output.length = length;
+        output.pos = 0;
+    }
+
+    return ret;
+}
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
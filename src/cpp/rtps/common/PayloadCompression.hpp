@@ -0,0 +1,167 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PayloadCompression.hpp
+ */
+
+#ifndef RTPS_COMMON_PAYLOADCOMPRESSION_HPP_
+#define RTPS_COMMON_PAYLOADCOMPRESSION_HPP_
+
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastdds/rtps/common/Types.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+//! Algorithms available to compress serialized payloads.
+enum class PayloadCompressionKind : uint8_t
+{
+    NONE = 0,
+    LZ4 = 1,
+    ZSTD = 2
+};
+
+/**
+ * Compression of serialized payloads.
+ *
+ * A compressed payload starts with a header that takes the place of the encapsulation:
+ *   - Octet 0 is 0x80 and octet 1 the PayloadCompressionKind, so it is never taken for a CDR encapsulation.
+ *   - Octets 2 and 3 are reserved and set to 0.
+ *   - Octets 4 to 7 hold the length of the original payload, in little endian.
+ * The rest is the compressed original payload, including its encapsulation.
+ */
+class PayloadCompression
+{
+public:
+
+    //! Size of the header prepended to the compressed data.
+    static constexpr uint32_t header_size = 8;
+
+    /**
+     * Name of the reader property listing the algorithms whose payloads the reader restores.
+     * It is added by the DDS layer to the readers whose history decompresses payloads, and announced in their
+     * discovery data, so writers only compress when every matched reader accepts it.
+     */
+    static const char* const accepted_property;
+
+    /**
+     * Parses the name of a compression algorithm ("none", "lz4" or "zstd").
+     * @param [in]  name Name of the algorithm.
+     * @param [out] kind Algorithm parsed.
+     * @return false if the name is not known.
+     */
+    static bool from_string(
+            const std::string& name,
+            PayloadCompressionKind& kind);
+
+    /**
+     * Reads the compression settings of a writer from its properties:
+     *   - fastdds.compression: name of the algorithm.
+     *   - fastdds.compression.level: compression level.
+     *   - fastdds.compression.threshold: samples with a smaller serialized size are sent uncompressed.
+     * Settings not present in the properties are left unchanged.
+     * @param [in]  properties Properties of the writer.
+     * @param [out] kind       Algorithm to use.
+     * @param [out] level      Compression level.
+     * @param [out] threshold  Minimum serialized size to compress.
+     * @return false if the algorithm is not known or not supported. In that case kind is NONE.
+     */
+    static bool from_properties(
+            const fastrtps::rtps::PropertyPolicy& properties,
+            PayloadCompressionKind& kind,
+            int32_t& level,
+            uint32_t& threshold);
+
+    //! Whether the library implementing the algorithm was available when building.
+    static bool is_supported(
+            PayloadCompressionKind kind);
+
+    /**
+     * Names of the algorithms available in this build, as a value for accepted_property.
+     * @return Comma separated names of the algorithms. Empty if none is available.
+     */
+    static std::string supported_algorithms();
+
+    /**
+     * Adds accepted_property to the properties of a reader, when any algorithm is available.
+     * @param [in,out] properties Properties of the reader.
+     */
+    static void add_accepted_property(
+            fastrtps::rtps::PropertyPolicy& properties);
+
+    /**
+     * Parses the value of accepted_property announced by a reader.
+     * @param algorithms Comma separated names of the algorithms.
+     * @return Mask with bit (1 << PayloadCompressionKind) set for each algorithm accepted.
+     */
+    static uint8_t accepted_mask(
+            const std::string& algorithms);
+
+    /**
+     * Compresses a serialized payload in place.
+     * The payload is left untouched when compressing it would not reduce its length.
+     * @param kind     Algorithm to use.
+     * @param level    Compression level. 0 selects the default one of the algorithm.
+     * @param payload  Payload to compress.
+     * @param buffer   Scratch buffer, kept by the caller to avoid allocations on each call.
+     * @return true if the payload has been compressed.
+     */
+    static bool compress(
+            PayloadCompressionKind kind,
+            int32_t level,
+            fastrtps::rtps::SerializedPayload_t& payload,
+            std::vector<fastrtps::rtps::octet>& buffer);
+
+    //! Whether the payload starts with a compression header.
+    static bool is_compressed(
+            const fastrtps::rtps::SerializedPayload_t& payload);
+
+    //! Length of the original payload, as recorded in the compression header.
+    static uint32_t decompressed_size(
+            const fastrtps::rtps::SerializedPayload_t& payload);
+
+    /**
+     * Largest length the algorithm of a compressed payload can restore from its compressed data.
+     * The length recorded in the header comes from the network, so it should be checked against this one before
+     * reserving memory for it.
+     * @param payload Compressed payload.
+     * @return Maximum length of the original payload. 0 if the algorithm is not supported.
+     */
+    static uint32_t max_decompressed_size(
+            const fastrtps::rtps::SerializedPayload_t& payload);
+
+    /**
+     * Restores a compressed payload.
+     * @param [in]  input  Compressed payload.
+     * @param [out] output Payload receiving the original data. Its max_size should be at least
+     * decompressed_size(input).
+     * @return false if the algorithm is not supported or the data is corrupted.
+     */
+    static bool decompress(
+            const fastrtps::rtps::SerializedPayload_t& input,
+            fastrtps::rtps::SerializedPayload_t& output);
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // RTPS_COMMON_PAYLOADCOMPRESSION_HPP_
@@ -0,0 +1,143 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RealtimeMonitor.cpp
+ */
+
+#include <fastdds/rtps/common/RealtimeMonitor.hpp>
+
+#include <atomic>
+
+#if defined(__GLIBC__)
+#include <execinfo.h>
+#endif // if defined(__GLIBC__)
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+static std::atomic<RealtimeMonitor::ViolationHook> violation_hook(nullptr);
+static std::atomic<int64_t> lock_wait_budget_ns(0);
+
+//! Real-time path the thread is on
+static thread_local const char* thread_path = nullptr;
+
+//! Set while the hook is being called, so the allocations of the hook itself are not reported
+static thread_local bool thread_reporting = false;
+
+static uint32_t capture_stack_trace(
+        void** frames)
+{
+#if defined(__GLIBC__)
+    int depth = backtrace(frames, static_cast<int>(RealtimeMonitor::max_stack_depth));
+    return depth > 0 ? static_cast<uint32_t>(depth) : 0u;
+#else
+    static_cast<void>(frames);
+    return 0u;
+#endif // if defined(__GLIBC__)
+}
+
+static void report(
+        RealtimeViolation& violation)
+{
+    RealtimeMonitor::ViolationHook hook = violation_hook.load(std::memory_order_acquire);
+    if (nullptr == hook || thread_reporting)
+    {
+        return;
+    }
+
+    thread_reporting = true;
+    void* frames[RealtimeMonitor::max_stack_depth];
+    violation.path = thread_path;
+    violation.stack_trace = frames;
+    violation.stack_depth = capture_stack_trace(frames);
+    hook(violation);
+    thread_reporting = false;
+}
+
+void RealtimeMonitor::set_violation_hook(
+        ViolationHook hook,
+        std::chrono::nanoseconds lock_wait_budget)
+{
+    if (nullptr != hook)
+    {
+        // The first backtrace loads the unwinder, which allocates. Do it now, outside of any real-time path.
+        void* frames[max_stack_depth];
+        capture_stack_trace(frames);
+    }
+
+    lock_wait_budget_ns.store(lock_wait_budget.count(), std::memory_order_relaxed);
+    violation_hook.store(hook, std::memory_order_release);
+}
+
+void RealtimeMonitor::report_allocation(
+        size_t size)
+{
+    if (nullptr != thread_path)
+    {
+        RealtimeViolation violation{RealtimeViolation::ALLOCATION, nullptr, size, 0, nullptr, 0u};
+        report(violation);
+    }
+}
+
+void RealtimeMonitor::report_lock_wait(
+        std::chrono::nanoseconds wait)
+{
+    if (nullptr != thread_path && wait.count() > lock_wait_budget_ns.load(std::memory_order_relaxed))
+    {
+        RealtimeViolation violation{RealtimeViolation::LOCK_WAIT, nullptr, 0u, wait.count(), nullptr, 0u};
+        report(violation);
+    }
+}
+
+const char* RealtimeMonitor::current_path()
+{
+    return thread_path;
+}
+
+void RealtimeMonitor::print_stack_trace(
+        const RealtimeViolation& violation,
+        int fd)
+{
+#if defined(__GLIBC__)
+    backtrace_symbols_fd(violation.stack_trace, static_cast<int>(violation.stack_depth), fd);
+#else
+    static_cast<void>(violation);
+    static_cast<void>(fd);
+#endif // if defined(__GLIBC__)
+}
+
+RealtimeMonitor::Scope::Scope(
+        bool enabled,
+        const char* path)
+    : entered_(enabled && nullptr == thread_path)
+{
+    if (entered_)
+    {
+        thread_path = path;
+    }
+}
+
+RealtimeMonitor::Scope::~Scope()
+{
+    if (entered_)
+    {
+        thread_path = nullptr;
+    }
+}
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
@@ -2,6 +2,7 @@
 #define _RTPS_FLOWCONTROL_FLOWCONTROLLER_HPP_
 
 #include <chrono>
+#include <cstddef>
 
 namespace eprosima {
 
@@ -64,6 +65,49 @@ public:
             fastrtps::rtps::CacheChange_t* change,
             const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) = 0;
 
+    /*!
+     * Adds a batch of new CacheChange_t to be managed by this object, in order.
+     * Same requirements than add_new_sample() apply to each of the changes.
+     * This method should be called when a batch of new changes is flushed.
+     *
+     * @param Pointer to the writer that owns the added changes. Cannot be nullptr.
+     * @param changes Pointer to the first element of an array of new changes. Cannot be nullptr.
+     * @param count Number of changes in the array.
+     * @param max_blocking_time Maximum time this method has to complete the task.
+     * @return true if all the samples could be added. false otherwise.
+     */
+    virtual bool add_new_samples(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* const* changes,
+            size_t count,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+    {
+        bool ret = true;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            ret &= add_new_sample(writer, changes[i], max_blocking_time);
+        }
+
+        return ret;
+    }
+
+    /*!
+     * Hands the pending new changes of a writer to the flow controller managing them.
+     * Only flow controllers keeping new changes, as the one installed during a batch, have something to do.
+     * This method should be called before waiting for the acknowledgement of new changes.
+     *
+     * @param Pointer to the writer that owns the pending changes. Cannot be nullptr.
+     * @param max_blocking_time Maximum time this method has to complete the task.
+     * @return true if all the pending changes could be handed. false otherwise.
+     */
+    virtual bool flush_new_samples(
+            fastrtps::rtps::RTPSWriter*,
+            const std::chrono::time_point<std::chrono::steady_clock>&)
+    {
+        return true;
+    }
+
     /*!
      * Adds a CacheChange_t to be managed by this object.
      * The CacheChange_t has to be an old one, that is, it was already in the writer's history and for some reason has to
@@ -44,7 +44,42 @@ void FlowControllerFactory::register_flow_controller (
         return;
     }
 
-    if (0 < flow_controller_descr.max_bytes_per_period)
+    if (0 < flow_controller_descr.max_bytes_per_period && 0 < flow_controller_descr.max_burst_bytes)
+    {
+        switch (flow_controller_descr.scheduler)
+        {
+            case FlowControllerSchedulerPolicy::FIFO:
+                flow_controllers_.insert({flow_controller_descr.name,
+                                          std::unique_ptr<FlowController>(
+                                              new FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                                              FlowControllerFifoSchedule>(participant_, &flow_controller_descr))});
+                break;
+            case FlowControllerSchedulerPolicy::ROUND_ROBIN:
+                flow_controllers_.insert({flow_controller_descr.name,
+                                          std::unique_ptr<FlowController>(
+                                              new FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                                              FlowControllerRoundRobinSchedule>(participant_,
+                                              &flow_controller_descr))});
+                break;
+            case FlowControllerSchedulerPolicy::HIGH_PRIORITY:
+                flow_controllers_.insert({flow_controller_descr.name,
+                                          std::unique_ptr<FlowController>(
+                                              new FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                                              FlowControllerHighPrioritySchedule>(participant_,
+                                              &flow_controller_descr))});
+                break;
+            case FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION:
+                flow_controllers_.insert({flow_controller_descr.name,
+                                          std::unique_ptr<FlowController>(
+                                              new FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                                              FlowControllerPriorityWithReservationSchedule>(participant_,
+                                              &flow_controller_descr))});
+                break;
+            default:
+                assert(false);
+        }
+    }
+    else if (0 < flow_controller_descr.max_bytes_per_period)
     {
         switch (flow_controller_descr.scheduler)
         {
@@ -5,6 +5,8 @@
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
 
+#include <algorithm>
+#include <cmath>
 #include <map>
 #include <unordered_map>
 #include <thread>
@@ -362,6 +364,148 @@ private:
     std::chrono::steady_clock::time_point last_period_ = std::chrono::steady_clock::now();
 };
 
+//! Sends all samples asynchronously, pacing them with a token bucket.
+struct FlowControllerTokenBucketPublishMode : public FlowControllerAsyncPublishMode
+{
+    FlowControllerTokenBucketPublishMode(
+            fastrtps::rtps::RTPSParticipantImpl* participant,
+            const FlowControllerDescriptor* descriptor)
+        : FlowControllerAsyncPublishMode(participant, descriptor)
+    {
+        assert(nullptr != descriptor);
+        assert(0 < descriptor->max_bytes_per_period);
+        assert(0 < descriptor->max_burst_bytes);
+
+        bucket_depth = descriptor->max_burst_bytes;
+        // A bucket unable to hold the RTPS header plus the submessages of a fragment would never send anything.
+        if (RTPSMESSAGE_COMMON_RTPS_PAYLOAD_SIZE > bucket_depth)
+        {
+            logWarning(RTPS_PARTICIPANT,
+                    "FlowController " << descriptor->name << ": max_burst_bytes " << bucket_depth <<
+                    " cannot hold a RTPS message. Using " << RTPSMESSAGE_COMMON_RTPS_PAYLOAD_SIZE << " instead");
+            bucket_depth = RTPSMESSAGE_COMMON_RTPS_PAYLOAD_SIZE;
+        }
+
+        uint64_t period_ns = std::max<uint64_t>(1, descriptor->period_ms) * 1000000;
+        bytes_per_ns_ = static_cast<double>(descriptor->max_bytes_per_period) / static_cast<double>(period_ns);
+        tokens_ = bucket_depth;
+        group.set_sent_bytes_limitation(static_cast<uint32_t>(bucket_depth));
+    }
+
+    bool fast_check_is_there_slot_for_change(
+            fastrtps::rtps::CacheChange_t* change)
+    {
+        // Not fragmented sample, the whole serialized payload has to fit.
+        uint32_t size_to_check = change->serializedPayload.length;
+
+        if (0 != change->getFragmentCount())
+        {
+            // For fragmented sample, one fragment has to fit.
+            size_to_check = std::min<uint32_t>(change->getFragmentSize(), size_to_check);
+        }
+
+        needed_tokens_ = std::min<double>(size_to_check, bucket_depth);
+        refill();
+
+        bool ret = tokens_ >= needed_tokens_;
+
+        if (!ret)
+        {
+            force_wait_ = true;
+        }
+
+        return ret;
+    }
+
+    /*!
+     * Wait until there is a new change added (notified by other thread) or, when the bucket has not tokens enough for
+     * the next change, until it has been refilled with them.
+     *
+     * @return false if the condition_variable was awaken because a new change was added. true if the bucket was
+     * refilled.
+     */
+    bool wait(
+            std::unique_lock<std::mutex>& lock)
+    {
+        if (!force_wait_)
+        {
+            cv.wait(lock);
+            return false;
+        }
+
+        refill();
+        double missing_tokens = needed_tokens_ - tokens_;
+
+        if (0 < missing_tokens)
+        {
+            std::chrono::nanoseconds lapse(static_cast<int64_t>(std::ceil(missing_tokens / bytes_per_ns_)));
+            if (std::cv_status::no_timeout == cv.wait_for(lock, lapse))
+            {
+                return false;
+            }
+            refill();
+        }
+
+        force_wait_ = false;
+        return true;
+    }
+
+    bool force_wait() const
+    {
+        return force_wait_;
+    }
+
+    void process_deliver_retcode(
+            const fastrtps::rtps::DeliveryRetCode& ret_value)
+    {
+        if (fastrtps::rtps::DeliveryRetCode::EXCEEDED_LIMIT == ret_value)
+        {
+            // The headers of the message did not fit. A full bucket always has room for a whole fragment.
+            force_wait_ = true;
+            needed_tokens_ = bucket_depth;
+        }
+    }
+
+    int32_t bucket_depth = 0;
+
+private:
+
+    /*!
+     * Adds the tokens generated since the last refill and takes out the bytes sent since then.
+     * The limitation of the message group is updated with the resulting tokens.
+     */
+    void refill()
+    {
+        auto now = std::chrono::steady_clock::now();
+        double elapsed_ns = std::chrono::duration<double, std::nano>(now - last_refill_).count();
+        double sent_bytes = static_cast<double>(group.get_current_bytes_processed()) - pending_bytes_;
+        tokens_ = std::min<double>(bucket_depth, tokens_ - sent_bytes + elapsed_ns * bytes_per_ns_);
+        last_refill_ = now;
+
+        // Bytes of a message not flushed yet remain accounted by the group after the reset.
+        group.reset_current_bytes_processed();
+        pending_bytes_ = group.get_current_bytes_processed();
+
+        // Limitation 0 means no limitation.
+        uint32_t available = 1 <= tokens_ ? static_cast<uint32_t>(tokens_) : 1;
+        group.set_sent_bytes_limitation(pending_bytes_ + available);
+    }
+
+    bool force_wait_ = false;
+
+    //! Tokens (bytes) available at last_refill_. Negative when more bytes than available were sent.
+    double tokens_ = 0;
+
+    //! Tokens needed to send the next change.
+    double needed_tokens_ = 0;
+
+    double bytes_per_ns_ = 0;
+
+    uint32_t pending_bytes_ = 0;
+
+    std::chrono::steady_clock::time_point last_refill_ = std::chrono::steady_clock::now();
+};
+
 
 /** Classes used to specify FlowController's sample scheduling **/
 
@@ -993,6 +1137,25 @@ public:
         return add_new_sample_impl(writer, change, max_blocking_time);
     }
 
+    /*
+     * Adds a batch of new CacheChange_t to be managed by this object.
+     * Synchronous publish modes send the whole batch using the same RTPSMessageGroup, so several samples share a
+     * datagram. Asynchronous publish modes enqueue the whole batch waking up the async thread only once.
+     *
+     * @param Pointer to the writer which the added changes are responsable. Cannot be nullptr.
+     * @param changes Pointer to an array of new CacheChange_t to be managed by this object. Cannot be nullptr.
+     * @param count Number of changes in the array.
+     * @return true if all the samples could be added. false in other case.
+     */
+    bool add_new_samples(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* const* changes,
+            size_t count,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) override
+    {
+        return add_new_samples_impl(writer, changes, count, max_blocking_time);
+    }
+
     /*!
      * Adds the CacheChante_t to be managed by this object.
      * The CacheChange_t has to be an old one, that is, it is already in the writer's history and for some reason has to
@@ -1125,6 +1288,87 @@ private:
         return false;
     }
 
+    /*!
+     * This function stores internally a batch of samples and wakes up the async thread once.
+     *
+     * @note Before calling this function, the changes' writer mutex have to be locked.
+     */
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, bool>::type
+    enqueue_new_samples_impl(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* const* changes,
+            size_t count)
+    {
+        std::unique_lock<std::mutex> lock(async_mode.changes_interested_mutex);
+        for (size_t i = 0; i < count; ++i)
+        {
+            assert(nullptr == changes[i]->writer_info.previous &&
+                    nullptr == changes[i]->writer_info.next);
+            sched.add_new_sample(writer, changes[i]);
+        }
+        async_mode.cv.notify_one();
+
+        return true;
+    }
+
+    /*! This function is used when PublishMode = FlowControllerPureSyncPublishMode.
+     *  In this case there is no async mechanism.
+     */
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, bool>::type
+    constexpr enqueue_new_samples_impl(
+            fastrtps::rtps::RTPSWriter*,
+            fastrtps::rtps::CacheChange_t* const*,
+            size_t) const
+    {
+        // Do nothing. Return false.
+        return false;
+    }
+
+    /*!
+     * This function tries to send a batch of samples synchronously, sharing the same RTPSMessageGroup.
+     * The samples that could not be delivered, from the first failing one on, are stored internally to try
+     * sending them again asynchronously.
+     */
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_base_of<FlowControllerPureSyncPublishMode, PubMode>::value, bool>::type
+    add_new_samples_impl(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* const* changes,
+            size_t count,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+    {
+        // This call should be made with writer's mutex locked.
+        fastrtps::rtps::LocatorSelectorSender& locator_selector = writer->get_general_locator_selector();
+        fastrtps::rtps::RTPSMessageGroup group(participant_, writer, &locator_selector);
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (fastrtps::rtps::DeliveryRetCode::DELIVERED !=
+                    writer->deliver_sample_nts(changes[i], group, locator_selector, max_blocking_time))
+            {
+                // Keep the order of the batch
+                return enqueue_new_samples_impl(writer, changes + i, count - i);
+            }
+        }
+
+        return true;
+    }
+
+    /*!
+     * This function stores internally a batch of samples to send them asynchronously.
+     */
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_base_of<FlowControllerPureSyncPublishMode, PubMode>::value, bool>::type
+    add_new_samples_impl(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* const* changes,
+            size_t count,
+            const std::chrono::time_point<std::chrono::steady_clock>&)
+    {
+        return enqueue_new_samples_impl(writer, changes, count);
+    }
+
     /*!
      * This function tries to send the sample synchronously.
      * That is, it uses the user's thread, which is the one calling this function, to send the sample.
@@ -1385,7 +1629,15 @@ private:
     }
 
     template<typename PubMode = PublishMode>
-    typename std::enable_if<!std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value, uint32_t>::type
+    typename std::enable_if<std::is_base_of<FlowControllerTokenBucketPublishMode, PubMode>::value, uint32_t>::type
+    get_max_payload_impl()
+    {
+        return static_cast<uint32_t>(async_mode.bucket_depth);
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value &&
+            !std::is_base_of<FlowControllerTokenBucketPublishMode, PubMode>::value, uint32_t>::type
     constexpr get_max_payload_impl() const
     {
         return std::numeric_limits<uint32_t>::max();
@@ -0,0 +1,126 @@
+#ifndef _RTPS_FLOWCONTROL_FLOWCONTROLLERSAMPLEBATCH_HPP_
+#define _RTPS_FLOWCONTROL_FLOWCONTROLLERSAMPLEBATCH_HPP_
+
+#include "FlowController.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/*!
+ * Flow controller installed on a writer while it adds a batch of new changes.
+ * New changes are kept until the batch is flushed, and then handed all together to the flow controller of the
+ * writer. Any other call is forwarded to that flow controller.
+ */
+class FlowControllerSampleBatch : public FlowController
+{
+public:
+
+    /*!
+     * Starts a batch.
+     *
+     * @param controller Flow controller of the writer, receiving the changes of the batch.
+     */
+    void begin(
+            FlowController* controller)
+    {
+        assert(nullptr == controller_);
+        assert(changes_.empty());
+        controller_ = controller;
+    }
+
+    /*!
+     * Finishes the batch. The changes of the batch should have been flushed before.
+     *
+     * @return The flow controller of the writer, which was passed to begin().
+     */
+    FlowController* end()
+    {
+        assert(changes_.empty());
+        FlowController* controller = controller_;
+        controller_ = nullptr;
+        return controller;
+    }
+
+    void init() override
+    {
+    }
+
+    void register_writer(
+            fastrtps::rtps::RTPSWriter* writer) override
+    {
+        controller_->register_writer(writer);
+    }
+
+    void unregister_writer(
+            fastrtps::rtps::RTPSWriter* writer) override
+    {
+        controller_->unregister_writer(writer);
+    }
+
+    bool add_new_sample(
+            fastrtps::rtps::RTPSWriter*,
+            fastrtps::rtps::CacheChange_t* change,
+            const std::chrono::time_point<std::chrono::steady_clock>&) override
+    {
+        changes_.push_back(change);
+        return true;
+    }
+
+    bool add_old_sample(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* change) override
+    {
+        return controller_->add_old_sample(writer, change);
+    }
+
+    bool flush_new_samples(
+            fastrtps::rtps::RTPSWriter* writer,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) override
+    {
+        bool ret = true;
+
+        if (!changes_.empty())
+        {
+            ret = controller_->add_new_samples(writer, changes_.data(), changes_.size(), max_blocking_time);
+            changes_.clear();
+        }
+
+        return ret;
+    }
+
+    void remove_change(
+            fastrtps::rtps::CacheChange_t* change) override
+    {
+        auto it = std::find(changes_.begin(), changes_.end(), change);
+        if (it != changes_.end())
+        {
+            changes_.erase(it);
+        }
+
+        controller_->remove_change(change);
+    }
+
+    uint32_t get_max_payload() override
+    {
+        return controller_->get_max_payload();
+    }
+
+private:
+
+    //! Flow controller of the writer while the batch is in progress.
+    FlowController* controller_ = nullptr;
+
+    //! New changes added to the history during the batch.
+    std::vector<fastrtps::rtps::CacheChange_t*> changes_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _RTPS_FLOWCONTROL_FLOWCONTROLLERSAMPLEBATCH_HPP_
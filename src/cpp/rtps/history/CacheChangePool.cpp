@@ -211,6 +211,14 @@ bool CacheChangePool::reserve_cache(
     return true;
 }
 
+bool CacheChangePool::get_memory_usage(
+        MemoryUsage& usage)
+{
+    usage.reserved = all_caches_.size() * sizeof(CacheChange_t);
+    usage.in_use = (all_caches_.size() - free_caches_.size()) * sizeof(CacheChange_t);
+    return true;
+}
+
 bool CacheChangePool::release_cache(
         CacheChange_t* cache_change)
 {
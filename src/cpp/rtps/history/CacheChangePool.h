@@ -72,6 +72,9 @@ public:
     bool release_cache(
             CacheChange_t* cache_change) override;
 
+    bool get_memory_usage(
+            MemoryUsage& usage) override;
+
     //!Get the size of the cache vector; all of them (reserved and not reserved).
     size_t get_allCachesSize()
     {
@@ -25,6 +25,7 @@
 
 #include <rtps/history/BasicPayloadPool.hpp>
 #include <rtps/history/CacheChangePool.h>
+#include <utils/Prefetch.hpp>
 
 #include <mutex>
 
@@ -54,11 +55,20 @@ History::const_iterator History::find_change_nts(
         return const_iterator();
     }
 
-    return std::find_if(changesBegin(), changesEnd(), [this, ch](const CacheChange_t* chi)
-                   {
-                       // use the derived classes comparisson criteria for searching
-                       return this->matches_change(chi, ch);
-                   });
+    const_iterator end = changesEnd();
+    const_iterator it = changesBegin();
+    for (; it != end; ++it)
+    {
+        prefetch_ahead(it, end);
+
+        // use the derived classes comparisson criteria for searching
+        if (matches_change(*it, ch))
+        {
+            break;
+        }
+    }
+
+    return it;
 }
 
 bool History::matches_change(
@@ -184,8 +194,11 @@ History::const_iterator History::get_change_nts(
     const_iterator returned_value = hint;
     *change = nullptr;
 
-    for (; returned_value != m_changes.end(); ++returned_value)
+    const_iterator end = m_changes.end();
+    for (; returned_value != end; ++returned_value)
     {
+        prefetch_ahead(returned_value, end);
+
         if ((*returned_value)->writerGUID == guid)
         {
             if ((*returned_value)->sequenceNumber == seq)
@@ -50,6 +50,17 @@ bool ReaderHistory::received_change(
     return add_change(change);
 }
 
+bool ReaderHistory::can_change_be_added_nts(
+        CacheChange_t* /*change*/)
+{
+    return true;
+}
+
+void ReaderHistory::writer_unmatched(
+        const GUID_t& /*writer_guid*/)
+{
+}
+
 bool ReaderHistory::add_change(
         CacheChange_t* a_change)
 {
@@ -131,33 +142,24 @@ History::iterator ReaderHistory::remove_change_nts(
 bool ReaderHistory::remove_changes_with_guid(
         const GUID_t& a_guid)
 {
-    std::vector<CacheChange_t*> changes_to_remove;
-
     if (mp_reader == nullptr || mp_mutex == nullptr)
     {
         logError(RTPS_READER_HISTORY, "You need to create a Reader with History before removing any changes");
         return false;
     }
 
+    // Changes are removed in place, so no temporary collection is allocated
+    std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
+    const_iterator chit = m_changes.begin();
+    while (chit != m_changes.end())
     {
-        //Lock scope
-        std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
-        for (std::vector<CacheChange_t*>::iterator chit = m_changes.begin(); chit != m_changes.end(); ++chit)
+        if ((*chit)->writerGUID == a_guid)
         {
-            if ((*chit)->writerGUID == a_guid)
-            {
-                changes_to_remove.push_back((*chit));
-            }
+            chit = remove_change_nts(chit);
         }
-    }//End lock scope
-
-    for (std::vector<CacheChange_t*>::iterator chit = changes_to_remove.begin(); chit != changes_to_remove.end();
-            ++chit)
-    {
-        if (!remove_change(*chit))
+        else
         {
-            logError(RTPS_READER_HISTORY, "One of the cachechanged in the GUID removal bulk could not be removed");
-            return false;
+            ++chit;
         }
     }
     return true;
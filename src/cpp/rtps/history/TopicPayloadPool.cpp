@@ -151,6 +151,26 @@ bool TopicPayloadPool::release_payload(
     return true;
 }
 
+bool TopicPayloadPool::get_memory_usage(
+        MemoryUsage& usage)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    uint64_t free_bytes = 0;
+    for (PayloadNode* payload : free_payloads_)
+    {
+        free_bytes += payload->data_size();
+    }
+
+    usage.reserved = 0;
+    for (PayloadNode* payload : all_payloads_)
+    {
+        usage.reserved += payload->data_size();
+    }
+    usage.in_use = usage.reserved - free_bytes;
+    return true;
+}
+
 bool TopicPayloadPool::reserve_history(
         const PoolConfig& config,
         bool /*is_reader*/)
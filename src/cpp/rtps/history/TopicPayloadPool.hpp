@@ -65,6 +65,9 @@ public:
     bool release_payload(
             CacheChange_t& cache_change) override;
 
+    bool get_memory_usage(
+            MemoryUsage& usage) override;
+
     /**
      * @brief Ensures the pool has capacity to fullfill the requirements of a new history.
      *
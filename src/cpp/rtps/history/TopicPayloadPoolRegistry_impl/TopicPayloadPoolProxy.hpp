@@ -76,6 +76,12 @@ public:
         return inner_pool_->release_payload(cache_change);
     }
 
+    bool get_memory_usage(
+            MemoryUsage& usage) override
+    {
+        return inner_pool_->get_memory_usage(usage);
+    }
+
     bool reserve_history(
             const PoolConfig& config,
             bool is_reader) override
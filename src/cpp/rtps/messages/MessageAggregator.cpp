@@ -0,0 +1,313 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MessageAggregator.cpp
+ */
+
+#include "MessageAggregator.hpp"
+
+#include <fastdds/rtps/common/LocatorList.hpp>
+#include <fastdds/rtps/messages/CDRMessage.h>
+#include <fastdds/rtps/messages/RTPSMessageCreator.h>
+#include <fastdds/rtps/messages/RTPS_messages.h>
+
+#include <rtps/participant/RTPSParticipantImpl.h>
+#include <statistics/rtps/messages/RTPSStatisticsMessages.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+static thread_local bool collecting_messages = false;
+
+MessageAggregator::CollectScope::CollectScope(
+        bool enable)
+    : previous_(collecting_messages)
+{
+    collecting_messages = previous_ || enable;
+}
+
+MessageAggregator::CollectScope::~CollectScope()
+{
+    collecting_messages = previous_;
+}
+
+MessageAggregator::MessageAggregator(
+        RTPSParticipantImpl* participant,
+        uint32_t period_ms,
+        uint32_t max_message_size)
+    : participant_(participant)
+    , send_msg_(max_message_size)
+{
+    flush_event_ = new TimedEvent(participant_->getEventResource(), [&]() -> bool
+                    {
+                        return flush();
+                    },
+                    period_ms);
+}
+
+MessageAggregator::~MessageAggregator()
+{
+    delete flush_event_;
+}
+
+bool MessageAggregator::is_collecting()
+{
+    return collecting_messages;
+}
+
+void MessageAggregator::add_block_nts(
+        Destination& destination,
+        const CDRMessage_t* msg)
+{
+    assert(msg->length > RTPSMESSAGE_HEADER_SIZE);
+
+    // The statistics submessage is always the last one, and only one per message is allowed.
+    // It will be added again to the aggregated message.
+    uint32_t end = msg->length;
+#ifdef FASTDDS_STATISTICS
+    end -= fastdds::statistics::rtps::statistics_submessage_length;
+#endif // FASTDDS_STATISTICS
+
+    // Every message starts addressed to all the participants reached through the locators
+    GuidPrefix_t destination_prefix = c_GuidPrefix_Unknown;
+
+    uint32_t pos = RTPSMESSAGE_HEADER_SIZE;
+    while (pos + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE <= end)
+    {
+        const octet* submessage = &msg->buffer[pos];
+        bool little_endian = 0 != (submessage[1] & BIT(0));
+        uint32_t octets_to_next_header = little_endian ?
+                static_cast<uint32_t>(submessage[2] | (submessage[3] << 8)) :
+                static_cast<uint32_t>((submessage[2] << 8) | submessage[3]);
+        uint32_t size = RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + octets_to_next_header;
+
+        // Except for PAD and INFO_TS, a zero length means the submessage extends up to the end of the message
+        if ((0 == octets_to_next_header && PAD != submessage[0] && INFO_TS != submessage[0]) ||
+                pos + size > end)
+        {
+            size = end - pos;
+        }
+
+        if (INFO_DST == submessage[0])
+        {
+            // Kept aside, and added again when the destination changes on the aggregated message
+            if (size >= RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + GuidPrefix_t::size)
+            {
+                memcpy(destination_prefix.value, &submessage[RTPSMESSAGE_SUBMESSAGEHEADER_SIZE],
+                        GuidPrefix_t::size);
+            }
+        }
+        else
+        {
+            add_submessage_nts(destination, destination_prefix, submessage, size);
+        }
+
+        pos += size;
+    }
+}
+
+void MessageAggregator::add_submessage_nts(
+        Destination& destination,
+        const GuidPrefix_t& destination_prefix,
+        const octet* submessage,
+        uint32_t size)
+{
+    octet kind = submessage[0];
+    if ((HEARTBEAT == kind || ACKNACK == kind || GAP == kind) && size >= RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + 8)
+    {
+        // All of them start with the reader id followed by the writer id
+        EntityId_t reader_id;
+        EntityId_t writer_id;
+        memcpy(reader_id.value, &submessage[RTPSMESSAGE_SUBMESSAGEHEADER_SIZE], EntityId_t::size);
+        memcpy(writer_id.value, &submessage[RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + 4], EntityId_t::size);
+
+        // The local endpoint is the writer of a HEARTBEAT or GAP, and the reader of an ACKNACK
+        const GuidPrefix_t& local_prefix = participant_->getGuid().guidPrefix;
+        bool from_writer = ACKNACK != kind;
+        SubmessageKey key;
+        key.kind = kind;
+        key.reader = GUID_t(from_writer ? destination_prefix : local_prefix, reader_id);
+        key.writer = GUID_t(from_writer ? local_prefix : destination_prefix, writer_id);
+
+        auto latest = std::lower_bound(destination.latest.begin(), destination.latest.end(), key,
+                        [](const std::pair<SubmessageKey, size_t>& entry, const SubmessageKey& value)
+                        {
+                            return entry.first < value;
+                        });
+        if (latest != destination.latest.end() && !(key < latest->first))
+        {
+            Submessage& previous = destination.submessages[latest->second];
+            if (GAP == kind)
+            {
+                // A different GAP announces other sequence numbers, so both are kept
+                if (previous.size == size && 0 == memcmp(&destination.data[previous.offset], submessage, size))
+                {
+                    return;
+                }
+
+                latest->second = destination.submessages.size();
+            }
+            else if (previous.size == size)
+            {
+                // HEARTBEATs always have the same size, so they are replaced in place
+                memcpy(&destination.data[previous.offset], submessage, size);
+                return;
+            }
+            else
+            {
+                previous.size = 0;
+                latest->second = destination.submessages.size();
+            }
+        }
+        else
+        {
+            destination.latest.emplace(latest, key, destination.submessages.size());
+        }
+    }
+
+    Submessage stored;
+    stored.destination = destination_prefix;
+    stored.offset = static_cast<uint32_t>(destination.data.size());
+    stored.size = size;
+    destination.data.insert(destination.data.end(), submessage, submessage + size);
+    destination.submessages.push_back(stored);
+}
+
+bool MessageAggregator::flush()
+{
+    // Sent outside the mutex, so the endpoints are not blocked by the transports.
+    // The destinations are kept with their buffers, so gathering stops allocating once they have grown.
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        pending_.swap(destinations_);
+    }
+
+    for (Destination& destination : pending_)
+    {
+        if (destination.submessages.empty())
+        {
+            ++destination.idle_ticks;
+            continue;
+        }
+
+        send(destination);
+        destination.clear();
+        destination.idle_ticks = 0;
+    }
+
+    // The locators of the remote participants which are gone are not kept forever
+    pending_.erase(std::remove_if(pending_.begin(), pending_.end(), [](const Destination& destination)
+            {
+                return destination.idle_ticks > max_idle_ticks;
+            }), pending_.end());
+
+    return false;
+}
+
+void MessageAggregator::send(
+        const Destination& destination)
+{
+    // Room for the INFO_DST that sets the destination of the next submessages
+    constexpr uint32_t info_dst_size = RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + 12;
+    uint32_t reserved = 0;
+#ifdef FASTDDS_STATISTICS
+    reserved = fastdds::statistics::rtps::statistics_submessage_length;
+#endif // FASTDDS_STATISTICS
+
+    const GuidPrefix_t& prefix = participant_->getGuid().guidPrefix;
+    fastdds::rtps::Locators locators_begin(destination.locators.begin());
+    fastdds::rtps::Locators locators_end(destination.locators.end());
+
+    // Destination in effect at the end of send_msg_
+    GuidPrefix_t current_destination = c_GuidPrefix_Unknown;
+
+    // The senders of the gathered messages are not waiting anymore, so the limit starts counting now
+    std::chrono::steady_clock::time_point max_blocking_time =
+            std::chrono::steady_clock::now() + destination.max_blocking_time;
+
+    auto send_msg = [&]()
+            {
+                if (send_msg_.length > RTPSMESSAGE_HEADER_SIZE)
+                {
+                    fastdds::statistics::rtps::add_statistics_submessage(&send_msg_);
+                    participant_->send_aggregated(&send_msg_, locators_begin, locators_end, max_blocking_time);
+                }
+
+                CDRMessage::initCDRMsg(&send_msg_);
+                RTPSMessageCreator::addHeader(&send_msg_, prefix);
+                current_destination = c_GuidPrefix_Unknown;
+            };
+
+    CDRMessage::initCDRMsg(&send_msg_);
+    RTPSMessageCreator::addHeader(&send_msg_, prefix);
+
+    for (const Submessage& submessage : destination.submessages)
+    {
+        if (0 == submessage.size)
+        {
+            // Replaced by a newer one
+            continue;
+        }
+
+        const octet* data = &destination.data[submessage.offset];
+        bool needs_info_dst = current_destination != submessage.destination;
+        uint32_t needed = submessage.size + (needs_info_dst ? info_dst_size : 0) + reserved;
+
+        if (send_msg_.length + needed > send_msg_.max_size && send_msg_.length > RTPSMESSAGE_HEADER_SIZE)
+        {
+            send_msg();
+            needs_info_dst = current_destination != submessage.destination;
+            needed = submessage.size + (needs_info_dst ? info_dst_size : 0) + reserved;
+        }
+
+        if (send_msg_.length + needed > send_msg_.max_size)
+        {
+            // Submessages bigger than the aggregation buffer are sent on their own.
+            CDRMessage_t big_msg(RTPSMESSAGE_HEADER_SIZE + needed);
+            RTPSMessageCreator::addHeader(&big_msg, prefix);
+            if (needs_info_dst)
+            {
+                RTPSMessageCreator::addSubmessageInfoDST(&big_msg, submessage.destination);
+            }
+            memcpy(&big_msg.buffer[big_msg.pos], data, submessage.size);
+            big_msg.pos += submessage.size;
+            big_msg.length += submessage.size;
+            fastdds::statistics::rtps::add_statistics_submessage(&big_msg);
+            participant_->send_aggregated(&big_msg, locators_begin, locators_end, max_blocking_time);
+        }
+        else
+        {
+            if (needs_info_dst)
+            {
+                RTPSMessageCreator::addSubmessageInfoDST(&send_msg_, submessage.destination);
+                current_destination = submessage.destination;
+            }
+
+            memcpy(&send_msg_.buffer[send_msg_.pos], data, submessage.size);
+            send_msg_.pos += submessage.size;
+            send_msg_.length += submessage.size;
+        }
+    }
+
+    send_msg();
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
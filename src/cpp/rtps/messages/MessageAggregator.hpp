@@ -0,0 +1,262 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MessageAggregator.hpp
+ */
+
+#ifndef RTPS_MESSAGES_MESSAGEAGGREGATOR_HPP
+#define RTPS_MESSAGES_MESSAGEAGGREGATOR_HPP
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/rtps/common/CDRMessage_t.h>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/resources/TimedEvent.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class RTPSParticipantImpl;
+
+/**
+ * Gathers the periodic control messages (HEARTBEAT, ACKNACK) of all the endpoints of a participant
+ * and sends them on a shared tick, packing the ones going to the same locators into as few RTPS
+ * messages as possible. Each gathered message is thus delayed up to the period of the tick.
+ * A HEARTBEAT or ACKNACK replaces the one of the same kind, writer and reader still waiting for the tick,
+ * as the newer one carries all the information of the older.
+ * A GAP only covers its own sequence numbers, so it is never replaced, but it is dropped when the same GAP
+ * is already waiting for the tick.
+ * Only the messages sent inside a CollectScope are gathered.
+ * @ingroup MANAGEMENT_MODULE
+ */
+class MessageAggregator
+{
+public:
+
+    /**
+     * Marks the messages sent by the current thread, while the object is alive, as candidates for aggregation.
+     */
+    class CollectScope
+    {
+    public:
+
+        /**
+         * @param enable Whether the scope is active. Lets the callers decide at runtime.
+         */
+        explicit CollectScope(
+                bool enable = true);
+
+        ~CollectScope();
+
+    private:
+
+        bool previous_;
+    };
+
+    /**
+     * @param participant Participant owning the aggregator. Its send resources are used on each tick.
+     * @param period_ms Period of the shared tick, in milliseconds.
+     * @param max_message_size Maximum size of the aggregated messages.
+     */
+    MessageAggregator(
+            RTPSParticipantImpl* participant,
+            uint32_t period_ms,
+            uint32_t max_message_size);
+
+    ~MessageAggregator();
+
+    /**
+     * @return Whether the current thread is inside a CollectScope.
+     */
+    static bool is_collecting();
+
+    /**
+     * Stores the submessages of a message until the next tick.
+     * @param msg Complete RTPS message, header included.
+     * @param destination_locators_begin Iterator at the first destination locator.
+     * @param destination_locators_end Iterator at the end destination locator.
+     * @param max_blocking_time_point Time limit the sender gave to the message. The time left is kept,
+     * and given again to the aggregated message when the tick comes.
+     * @return true when the message has been stored.
+     */
+    template<class LocatorIteratorT>
+    bool add_message(
+            const CDRMessage_t* msg,
+            const LocatorIteratorT& destination_locators_begin,
+            const LocatorIteratorT& destination_locators_end,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point)
+    {
+        std::chrono::steady_clock::duration max_blocking_time =
+                max_blocking_time_point - std::chrono::steady_clock::now();
+
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+
+            Destination* destination = nullptr;
+            for (Destination& d : destinations_)
+            {
+                if (same_locators(d.locators, destination_locators_begin, destination_locators_end))
+                {
+                    destination = &d;
+                    break;
+                }
+            }
+
+            if (nullptr == destination)
+            {
+                destinations_.emplace_back();
+                destination = &destinations_.back();
+                for (LocatorIteratorT it = destination_locators_begin; it != destination_locators_end; ++it)
+                {
+                    destination->locators.push_back(*it);
+                }
+            }
+
+            destination->max_blocking_time = (std::max)(destination->max_blocking_time, max_blocking_time);
+            add_block_nts(*destination, msg);
+        }
+
+        flush_event_->restart_timer();
+        return true;
+    }
+
+private:
+
+    //! Identifies the HEARTBEATs, ACKNACKs or GAPs of the same kind, writer and reader
+    struct SubmessageKey
+    {
+        octet kind;
+        GUID_t reader;
+        GUID_t writer;
+
+        bool operator <(
+                const SubmessageKey& other) const
+        {
+            return std::tie(kind, reader, writer) < std::tie(other.kind, other.reader, other.writer);
+        }
+
+    };
+
+    //! A submessage stored in Destination::data
+    struct Submessage
+    {
+        //! Destination prefix in effect for the submessage, set with INFO_DST before it when needed
+        GuidPrefix_t destination;
+
+        uint32_t offset;
+
+        //! 0 when the submessage has been replaced by a newer one stored at the end of data
+        uint32_t size;
+    };
+
+    //! Submessages pending to be sent to the same set of locators
+    struct Destination
+    {
+        std::vector<Locator_t> locators;
+
+        //! Submessages of the gathered messages, one after the other
+        std::vector<octet> data;
+
+        //! Submessages inside data, in the order they were gathered
+        std::vector<Submessage> submessages;
+
+        //! Position in submessages of the latest HEARTBEAT, ACKNACK or GAP of each writer and reader, sorted by key
+        std::vector<std::pair<SubmessageKey, size_t>> latest;
+
+        //! Longest time the senders of the gathered messages accepted to block
+        std::chrono::steady_clock::duration max_blocking_time = std::chrono::steady_clock::duration::zero();
+
+        //! Number of consecutive ticks without submessages
+        uint32_t idle_ticks = 0;
+
+        //! Empties the destination after sending it, keeping the capacity of its buffers
+        void clear()
+        {
+            data.clear();
+            submessages.clear();
+            latest.clear();
+            max_blocking_time = std::chrono::steady_clock::duration::zero();
+        }
+
+    };
+
+    //! Destinations unused for this many ticks are dropped
+    static constexpr uint32_t max_idle_ticks = 1000;
+
+    template<class LocatorIteratorT>
+    static bool same_locators(
+            const std::vector<Locator_t>& locators,
+            LocatorIteratorT it,
+            const LocatorIteratorT& end)
+    {
+        auto stored = locators.begin();
+        for (; it != end && stored != locators.end(); ++it, ++stored)
+        {
+            if (!(*stored == *it))
+            {
+                return false;
+            }
+        }
+
+        return !(it != end) && stored == locators.end();
+    }
+
+    void add_block_nts(
+            Destination& destination,
+            const CDRMessage_t* msg);
+
+    void add_submessage_nts(
+            Destination& destination,
+            const GuidPrefix_t& destination_prefix,
+            const octet* submessage,
+            uint32_t size);
+
+    //! Callback of the shared tick
+    bool flush();
+
+    //! Only called from flush, outside the mutex, so send_msg_ needs no protection
+    void send(
+            const Destination& destination);
+
+    RTPSParticipantImpl* participant_;
+
+    std::mutex mutex_;
+
+    //! Destinations gathering the submessages until the next tick
+    std::vector<Destination> destinations_;
+
+    //! Destinations being sent on the tick. Swapped with destinations_, so the buffers of both are reused.
+    std::vector<Destination> pending_;
+
+    CDRMessage_t send_msg_;
+
+    TimedEvent* flush_event_ = nullptr;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // RTPS_MESSAGES_MESSAGEAGGREGATOR_HPP
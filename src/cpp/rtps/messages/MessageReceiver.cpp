@@ -25,6 +25,7 @@
 
 #include <fastdds/core/policy/ParameterList.hpp>
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/common/RealtimeMonitor.hpp>
 
 #include <fastdds/rtps/reader/RTPSReader.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
@@ -302,6 +303,11 @@ void MessageReceiver::removeEndpoint(
     }
 }
 
+const GuidPrefix_t& MessageReceiver::participant_guid_prefix() const
+{
+    return participant_->getGuid().guidPrefix;
+}
+
 void MessageReceiver::reset()
 {
     source_version_ = c_ProtocolVersion;
@@ -323,6 +329,9 @@ void MessageReceiver::processCDRMsg(
         return;
     }
 
+    RealtimeMonitor::Scope realtime_scope(nullptr != participant_ && participant_->realtime_mode(),
+            "MessageReceiver::processCDRMsg");
+
     reset();
 
 #ifdef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
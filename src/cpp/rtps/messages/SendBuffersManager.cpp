@@ -55,6 +55,7 @@ void SendBuffersManager::init(
         advance *= 2;
 #endif
         size_t data_size = advance * (pool_.capacity() - n_created_);
+        buffer_size_ = advance + sizeof(RTPSMessageGroup_t);
         common_buffer_.assign(data_size, 0);
 
         octet* raw_buffer = common_buffer_.data();
@@ -107,6 +108,14 @@ void SendBuffersManager::return_buffer(
     available_cv_.notify_one();
 }
 
+void SendBuffersManager::get_memory_usage(
+        MemoryUsage& usage)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    usage.reserved = n_created_ * buffer_size_;
+    usage.in_use = (n_created_ - pool_.size()) * buffer_size_;
+}
+
 void SendBuffersManager::add_one_buffer(
         const RTPSParticipantImpl* participant)
 {
@@ -116,6 +125,15 @@ void SendBuffersManager::add_one_buffer(
 #endif
         participant->getMaxMessageSize(), participant->getGuid().guidPrefix);
     pool_.emplace_back(new_item);
+    if (0 == buffer_size_)
+    {
+#if HAVE_SECURITY
+        size_t num_messages = participant->is_secure() ? 3 : 2;
+#else
+        size_t num_messages = 2;
+#endif
+        buffer_size_ = num_messages * participant->getMaxMessageSize() + sizeof(RTPSMessageGroup_t);
+    }
     ++n_created_;
 }
 
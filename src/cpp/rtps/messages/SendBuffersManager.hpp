@@ -22,6 +22,7 @@
 
 #include "RTPSMessageGroup_t.hpp"
 #include <fastdds/rtps/common/GuidPrefix_t.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 
 #include <vector>              // std::vector
 #include <memory>              // std::unique_ptr
@@ -80,6 +81,13 @@ public:
     void return_buffer(
             std::unique_ptr <RTPSMessageGroup_t>&& buffer);
 
+    /**
+     * Get the memory of the buffers.
+     * @param [out] usage Bytes of all the created buffers, and bytes of the ones taken from the pool.
+     */
+    void get_memory_usage(
+            MemoryUsage& usage);
+
 private:
 
     void add_one_buffer(
@@ -93,6 +101,8 @@ private:
     std::vector<octet> common_buffer_;
     //!Creation counter
     std::size_t n_created_ = 0;
+    //!Bytes of each created buffer
+    std::size_t buffer_size_ = 0;
     //!Whether we allow n_created_ to grow beyond the pool_ capacity.
     bool allow_growing_ = true;
     //!To wait for a buffer to be returned to the pool.
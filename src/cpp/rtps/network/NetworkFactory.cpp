@@ -50,6 +50,21 @@ bool NetworkFactory::build_send_resources(
     return returned_value;
 }
 
+bool NetworkFactory::build_priority_send_resources(
+        SendResourceList& sender_resource_list,
+        const Locator_t& locator,
+        int32_t transport_priority)
+{
+    bool returned_value = false;
+
+    for (auto& transport : mRegisteredTransports)
+    {
+        returned_value |= transport->open_priority_output_channel(sender_resource_list, locator, transport_priority);
+    }
+
+    return returned_value;
+}
+
 bool NetworkFactory::BuildReceiverResources(
         Locator_t& local,
         std::vector<std::shared_ptr<ReceiverResource>>& returned_resources_list,
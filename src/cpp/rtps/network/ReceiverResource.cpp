@@ -14,7 +14,10 @@
 
 #include <fastdds/rtps/network/ReceiverResource.h>
 #include <fastdds/rtps/messages/MessageReceiver.h>
+#include <fastdds/rtps/messages/RTPS_messages.h>
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <fastdds/dds/log/Log.hpp>
 
 #define IDSTRING "(ID:" << std::this_thread::get_id() << ") " <<
@@ -26,6 +29,75 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+/**
+ * Gets the receivers a message is directed to, reading its INFO_DST submessages.
+ * @param data Received message.
+ * @param size Size of the received message.
+ * @param receivers Receivers registered on the resource.
+ * @param [out] is_destination Whether each receiver is a destination of the message.
+ * @return false when some submessage may be directed to any participant.
+ */
+static bool get_message_destinations(
+        const octet* data,
+        uint32_t size,
+        const std::vector<MessageReceiver*>& receivers,
+        std::vector<uint8_t>& is_destination)
+{
+    std::fill(is_destination.begin(), is_destination.end(), uint8_t(0));
+    bool has_destinations = false;
+    if (size < RTPSMESSAGE_HEADER_SIZE)
+    {
+        return false;
+    }
+
+    uint32_t pos = RTPSMESSAGE_HEADER_SIZE;
+    while (pos + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE <= size)
+    {
+        octet id = data[pos];
+        bool little_endian = (data[pos + 1] & BIT(0)) != 0;
+        uint32_t length = little_endian ?
+                (static_cast<uint32_t>(data[pos + 3]) << 8) | data[pos + 2] :
+                (static_cast<uint32_t>(data[pos + 2]) << 8) | data[pos + 3];
+        pos += RTPSMESSAGE_SUBMESSAGEHEADER_SIZE;
+
+        if (INFO_DST == id)
+        {
+            if (length < GuidPrefix_t::size || pos + GuidPrefix_t::size > size)
+            {
+                return false;
+            }
+            GuidPrefix_t prefix;
+            memcpy(prefix.value, &data[pos], GuidPrefix_t::size);
+            if (c_GuidPrefix_Unknown == prefix)
+            {
+                return false;
+            }
+            has_destinations = true;
+            for (size_t i = 0; i < receivers.size(); ++i)
+            {
+                if (receivers[i]->participant_guid_prefix() == prefix)
+                {
+                    is_destination[i] = 1;
+                }
+            }
+        }
+        else if (!has_destinations && PAD != id && INFO_TS != id)
+        {
+            // Submessage without destination
+            return false;
+        }
+
+        if (0 == length && PAD != id && INFO_TS != id)
+        {
+            // Last submessage
+            break;
+        }
+        pos += (length + 3u) & ~3u;
+    }
+
+    return has_destinations;
+}
+
 ReceiverResource::ReceiverResource(
         TransportInterface& transport,
         const Locator_t& locator,
@@ -34,7 +106,6 @@ ReceiverResource::ReceiverResource(
     , LocatorMapsToManagedChannel(nullptr)
     , mValid(false)
     , mtx()
-    , receiver(nullptr)
     , max_message_size_(max_recv_buffer_size)
 {
     // Internal channel is opened and assigned to this resource.
@@ -60,8 +131,8 @@ ReceiverResource::ReceiverResource(
 {
     Cleanup.swap(rValueResource.Cleanup);
     LocatorMapsToManagedChannel.swap(rValueResource.LocatorMapsToManagedChannel);
-    receiver = rValueResource.receiver;
-    rValueResource.receiver = nullptr;
+    receivers_.swap(rValueResource.receivers_);
+    is_destination_.swap(rValueResource.is_destination_);
     mValid = rValueResource.mValid;
     rValueResource.mValid = false;
     max_message_size_ = rValueResource.max_message_size_;
@@ -81,9 +152,10 @@ void ReceiverResource::RegisterReceiver(
         MessageReceiver* rcv)
 {
     std::unique_lock<std::mutex> lock(mtx);
-    if (receiver == nullptr)
+    if (std::find(receivers_.begin(), receivers_.end(), rcv) == receivers_.end())
     {
-        receiver = rcv;
+        receivers_.push_back(rcv);
+        is_destination_.resize(receivers_.size());
     }
 }
 
@@ -91,9 +163,11 @@ void ReceiverResource::UnregisterReceiver(
         MessageReceiver* rcv)
 {
     std::unique_lock<std::mutex> lock(mtx);
-    if (receiver == rcv)
+    auto it = std::find(receivers_.begin(), receivers_.end(), rcv);
+    if (it != receivers_.end())
     {
-        receiver = nullptr;
+        receivers_.erase(it);
+        is_destination_.resize(receivers_.size());
     }
 }
 
@@ -103,24 +177,42 @@ void ReceiverResource::OnDataReceived(
         const Locator_t& localLocator,
         const Locator_t& remoteLocator)
 {
-    (void)localLocator;
-
     std::unique_lock<std::mutex> lock(mtx);
-    MessageReceiver* rcv = receiver;
 
-    if (rcv != nullptr)
+    if (receivers_.size() == 1)
+    {
+        process_message(receivers_.front(), data, size, localLocator, remoteLocator);
+    }
+    else if (!receivers_.empty())
     {
-        CDRMessage_t msg(0);
-        msg.wraps = true;
-        msg.buffer = const_cast<octet*>(data);
-        msg.length = size;
-        msg.max_size = size;
-        msg.reserved_size = size;
-
-        // TODO: Should we unlock in case UnregisterReceiver is called from callback ?
-        rcv->processCDRMsg(remoteLocator, localLocator, &msg);
+        // Shared resource: only the participants the message is directed to need to process it
+        bool only_destinations = get_message_destinations(data, size, receivers_, is_destination_);
+        for (size_t i = 0; i < receivers_.size(); ++i)
+        {
+            if (!only_destinations || 0 != is_destination_[i])
+            {
+                process_message(receivers_[i], data, size, localLocator, remoteLocator);
+            }
+        }
     }
+}
 
+void ReceiverResource::process_message(
+        MessageReceiver* rcv,
+        const octet* data,
+        const uint32_t size,
+        const Locator_t& localLocator,
+        const Locator_t& remoteLocator)
+{
+    CDRMessage_t msg(0);
+    msg.wraps = true;
+    msg.buffer = const_cast<octet*>(data);
+    msg.length = size;
+    msg.max_size = size;
+    msg.reserved_size = size;
+
+    // TODO: Should we unlock in case UnregisterReceiver is called from callback ?
+    rcv->processCDRMsg(remoteLocator, localLocator, &msg);
 }
 
 void ReceiverResource::disable()
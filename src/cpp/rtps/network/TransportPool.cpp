@@ -0,0 +1,177 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TransportPool.cpp
+ */
+
+#include <rtps/network/TransportPool.hpp>
+
+#include <algorithm>
+#include <map>
+
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+#include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+using UDPv4TransportDescriptor = fastdds::rtps::UDPv4TransportDescriptor;
+using SharedMemTransportDescriptor = fastdds::rtps::SharedMemTransportDescriptor;
+
+std::shared_ptr<TransportPool> TransportPool::get(
+        uint32_t domain_id)
+{
+    static std::mutex pools_mutex;
+    static std::map<uint32_t, std::weak_ptr<TransportPool>> pools;
+
+    std::lock_guard<std::mutex> lock(pools_mutex);
+    std::shared_ptr<TransportPool> pool = pools[domain_id].lock();
+    if (!pool)
+    {
+        pool.reset(new TransportPool());
+        pools[domain_id] = pool;
+    }
+    return pool;
+}
+
+TransportPool::~TransportPool()
+{
+    if (network_factory_)
+    {
+        network_factory_->Shutdown();
+    }
+}
+
+bool TransportPool::accepts_receivers(
+        const RTPSParticipantAttributes& att)
+{
+    if (!att.useBuiltinTransports || !att.userTransports.empty())
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!network_factory_)
+    {
+        send_buffer_size_ = att.sendSocketBufferSize;
+        listen_buffer_size_ = att.listenSocketBufferSize;
+        network_factory_.reset(new NetworkFactory());
+
+        // Same builtin transports as RTPSParticipantImpl
+        UDPv4TransportDescriptor descriptor;
+        descriptor.sendBufferSize = send_buffer_size_;
+        descriptor.receiveBufferSize = listen_buffer_size_;
+        network_factory_->RegisterTransport(&descriptor);
+
+#ifdef SHM_TRANSPORT_BUILTIN
+        // The transport is only used to receive, so its own segment is kept as small as possible
+        SharedMemTransportDescriptor shm_transport;
+        shm_transport.max_message_size(descriptor.max_message_size());
+        shm_transport.segment_size(descriptor.max_message_size());
+        network_factory_->RegisterTransport(&shm_transport);
+#endif // ifdef SHM_TRANSPORT_BUILTIN
+    }
+
+    return send_buffer_size_ == att.sendSocketBufferSize && listen_buffer_size_ == att.listenSocketBufferSize;
+}
+
+bool TransportPool::build_receiver_resources(
+        Locator_t& local,
+        std::vector<std::shared_ptr<ReceiverResource>>& returned_resources_list,
+        uint32_t receiver_max_message_size)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Forget the channels already closed
+    receiver_resources_.erase(
+        std::remove_if(receiver_resources_.begin(), receiver_resources_.end(),
+        [](const std::weak_ptr<ReceiverResource>& resource)
+        {
+            return resource.expired();
+        }),
+        receiver_resources_.end());
+
+    bool found = false;
+    for (auto& resource : receiver_resources_)
+    {
+        std::shared_ptr<ReceiverResource> shared = resource.lock();
+        if (shared && shared->SupportsLocator(local))
+        {
+            returned_resources_list.push_back(shared);
+            found = true;
+        }
+    }
+    if (found || !network_factory_)
+    {
+        return found;
+    }
+
+    std::vector<std::shared_ptr<ReceiverResource>> new_resources;
+    bool ret = network_factory_->BuildReceiverResources(local, new_resources, receiver_max_message_size);
+    for (auto& resource : new_resources)
+    {
+        // The channel is closed when no participant is using it
+        std::shared_ptr<ReceiverResource> shared(resource.get(), [this, resource](ReceiverResource* r)
+                {
+                    std::lock_guard<std::mutex> close_lock(mutex_);
+                    r->disable();
+                });
+        receiver_resources_.push_back(shared);
+        returned_resources_list.push_back(shared);
+    }
+    return ret;
+}
+
+bool TransportPool::get_unicast_locators(
+        LocatorList_t& metatraffic_unicast,
+        LocatorList_t& default_unicast)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (has_unicast_locators_)
+    {
+        metatraffic_unicast = metatraffic_unicast_locators_;
+        default_unicast = default_unicast_locators_;
+    }
+    return has_unicast_locators_;
+}
+
+void TransportPool::set_unicast_locators(
+        const LocatorList_t& metatraffic_unicast,
+        const LocatorList_t& default_unicast)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!has_unicast_locators_)
+    {
+        metatraffic_unicast_locators_ = metatraffic_unicast;
+        default_unicast_locators_ = default_unicast;
+        has_unicast_locators_ = true;
+    }
+}
+
+ResourceEvent& TransportPool::event_resource()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!event_thread_started_)
+    {
+        event_.init_thread();
+        event_thread_started_ = true;
+    }
+    return event_;
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,145 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TransportPool.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_NETWORK_TRANSPORTPOOL_HPP_
+#define _FASTDDS_RTPS_NETWORK_TRANSPORTPOOL_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/common/LocatorList.hpp>
+#include <fastdds/rtps/network/NetworkFactory.h>
+#include <fastdds/rtps/network/ReceiverResource.h>
+#include <fastdds/rtps/resources/ResourceEvent.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Resources shared by the participants of the same domain in a process.
+ *
+ * Participants enabling property fastdds.shared_transports receive through the channels of the pool instead of
+ * opening their own ones, so each channel has a single reception thread. When they use the default unicast
+ * locators, they also listen on the same unicast locators, and messages are given only to the participants they
+ * are directed to (see ReceiverResource).
+ * Participants enabling property fastdds.shared_event_thread run their timed events on the event thread of the
+ * pool.
+ *
+ * The pool lives while any participant uses it.
+ * @ingroup NETWORK_MODULE
+ */
+class TransportPool
+{
+public:
+
+    /**
+     * Get the pool of a domain, creating it when no participant of the process is using it.
+     * @param domain_id Domain of the participant.
+     * @return The pool of the domain.
+     */
+    static std::shared_ptr<TransportPool> get(
+            uint32_t domain_id);
+
+    /**
+     * Check whether a participant can receive through the channels of the pool.
+     * Only participants using just the builtin transports can, and the first one decides their socket buffer sizes.
+     * @param att Attributes of the participant.
+     * @return True when the channels of the pool can be used by the participant.
+     */
+    bool accepts_receivers(
+            const RTPSParticipantAttributes& att);
+
+    /**
+     * Get the receiver resources of a locator, opening the channel when no participant is using it.
+     * The channel is closed when the last returned resource is released.
+     * Should only be called for participants accepted by accepts_receivers().
+     * @param local Locator to listen on.
+     * @param returned_resources_list Resources are added to this list.
+     * @param receiver_max_message_size Maximum size of the received messages.
+     * @return True if the locator is listened on.
+     */
+    bool build_receiver_resources(
+            Locator_t& local,
+            std::vector<std::shared_ptr<ReceiverResource>>& returned_resources_list,
+            uint32_t receiver_max_message_size);
+
+    /**
+     * Get the unicast locators shared by the participants using the default ones.
+     * @param [out] metatraffic_unicast Metatraffic unicast locators.
+     * @param [out] default_unicast Default unicast locators.
+     * @return False when no participant has set them yet.
+     */
+    bool get_unicast_locators(
+            LocatorList_t& metatraffic_unicast,
+            LocatorList_t& default_unicast);
+
+    /**
+     * Set the unicast locators shared by the participants using the default ones, if not already set.
+     * @param metatraffic_unicast Metatraffic unicast locators.
+     * @param default_unicast Default unicast locators.
+     */
+    void set_unicast_locators(
+            const LocatorList_t& metatraffic_unicast,
+            const LocatorList_t& default_unicast);
+
+    //! @return The event resource shared by the participants, whose thread is started on the first call.
+    ResourceEvent& event_resource();
+
+    ~TransportPool();
+
+private:
+
+    TransportPool() = default;
+
+    TransportPool(
+            const TransportPool&) = delete;
+
+    TransportPool& operator =(
+            const TransportPool&) = delete;
+
+    std::mutex mutex_;
+
+    //! Transports opening the shared channels. Only created for the first participant sharing them.
+    std::unique_ptr<NetworkFactory> network_factory_;
+
+    uint32_t send_buffer_size_ = 0;
+
+    uint32_t listen_buffer_size_ = 0;
+
+    std::vector<std::weak_ptr<ReceiverResource>> receiver_resources_;
+
+    bool has_unicast_locators_ = false;
+
+    LocatorList_t metatraffic_unicast_locators_;
+
+    LocatorList_t default_unicast_locators_;
+
+    bool event_thread_started_ = false;
+
+    ResourceEvent event_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_NETWORK_TRANSPORTPOOL_HPP_
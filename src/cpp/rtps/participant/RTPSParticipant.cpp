@@ -176,6 +176,12 @@ void RTPSParticipant::enable()
     mp_impl->enable();
 }
 
+void RTPSParticipant::get_memory_usage(
+        ParticipantMemoryUsage& usage) const
+{
+    mp_impl->get_memory_usage(usage);
+}
+
 #if HAVE_SECURITY
 
 bool RTPSParticipant::is_security_enabled_for_writer(
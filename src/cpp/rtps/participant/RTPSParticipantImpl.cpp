@@ -27,6 +27,7 @@
 
 #include <rtps/persistence/PersistenceService.h>
 #include <rtps/history/BasicPayloadPool.hpp>
+#include <rtps/network/TransportPool.hpp>
 
 #include <fastrtps/utils/IPFinder.h>
 #include <fastrtps/utils/Semaphore.h>
@@ -67,6 +68,7 @@
 #include <rtps/builtin/discovery/participant/PDPClient.h>
 
 #include <statistics/rtps/GuidUtils.hpp>
+#include <utils/shared_memory/ParticipantIdLock.hpp>
 
 namespace eprosima {
 namespace fastrtps {
@@ -116,6 +118,14 @@ static bool get_unique_flows_parameters(
     return true;
 }
 
+static uint64_t shm_segment_size(
+        const SharedMemTransportDescriptor& descriptor)
+{
+    // Same default as SharedMemTransport
+    constexpr uint64_t shm_default_segment_size = 512 * 1024;
+    return (0 == descriptor.segment_size()) ? shm_default_segment_size : descriptor.segment_size();
+}
+
 Locator_t& RTPSParticipantImpl::applyLocatorAdaptRule(
         Locator_t& loc)
 {
@@ -147,6 +157,12 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     , mp_mutex(new std::recursive_mutex())
     , is_intraprocess_only_(should_be_intraprocess_only(PParam))
     , has_shm_transport_(false)
+    , shared_receivers_(false)
+    , event_resource_(&mp_event_thr)
+    , lazy_builtin_endpoints_(false)
+    , edp_interest_filter_(false)
+    , realtime_mode_(false)
+    , shm_segments_size_(0)
 {
     if (c_GuidPrefix_Unknown != persistence_guid)
     {
@@ -169,7 +185,11 @@ RTPSParticipantImpl::RTPSParticipantImpl(
         shm_transport.segment_size(segment_size_udp_equivalent);
         // Use same default max_message_size on both UDP and SHM
         shm_transport.max_message_size(descriptor.max_message_size());
-        has_shm_transport_ |= m_network_Factory.RegisterTransport(&shm_transport);
+        if (m_network_Factory.RegisterTransport(&shm_transport))
+        {
+            has_shm_transport_ = true;
+            shm_segments_size_ += shm_segment_size(shm_transport);
+        }
 #endif // ifdef SHM_TRANSPORT_BUILTIN
     }
 
@@ -212,8 +232,13 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     {
         if (m_network_Factory.RegisterTransport(transportDescriptor.get()))
         {
-            has_shm_transport_ |=
-                    (dynamic_cast<fastdds::rtps::SharedMemTransportDescriptor*>(transportDescriptor.get()) != nullptr);
+            auto shm_descriptor =
+                    dynamic_cast<fastdds::rtps::SharedMemTransportDescriptor*>(transportDescriptor.get());
+            if (nullptr != shm_descriptor)
+            {
+                has_shm_transport_ = true;
+                shm_segments_size_ += shm_segment_size(*shm_descriptor);
+            }
         }
         else
         {
@@ -234,7 +259,45 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     }
 
     mp_userParticipant->mp_impl = this;
-    mp_event_thr.init_thread();
+
+    // Resources shared with the other participants of the domain in this process
+    const std::string* shared_transports = PropertyPolicyHelper::find_property(m_att.properties,
+                    "fastdds.shared_transports");
+    const std::string* shared_event_thread = PropertyPolicyHelper::find_property(m_att.properties,
+                    "fastdds.shared_event_thread");
+    bool share_receivers = (nullptr != shared_transports && "true" == *shared_transports);
+    bool share_event_thread = (nullptr != shared_event_thread && "true" == *shared_event_thread);
+    if (share_receivers || share_event_thread)
+    {
+        transport_pool_ = TransportPool::get(domain_id_);
+        shared_receivers_ = share_receivers && transport_pool_->accepts_receivers(m_att);
+        if (share_receivers && !shared_receivers_)
+        {
+            logWarning(RTPS_PARTICIPANT, "Participant " << m_att.getName() << " cannot share the transports of"
+                    " other participants, as it uses its own transports or socket buffer sizes");
+        }
+        if (share_event_thread)
+        {
+            event_resource_ = &transport_pool_->event_resource();
+        }
+    }
+
+    const std::string* lazy_builtin_endpoints = PropertyPolicyHelper::find_property(m_att.properties,
+                    "fastdds.lazy_builtin_endpoints");
+    lazy_builtin_endpoints_ = (nullptr != lazy_builtin_endpoints && "true" == *lazy_builtin_endpoints);
+
+    const std::string* edp_interest_filter = PropertyPolicyHelper::find_property(m_att.properties,
+                    "fastdds.edp_interest_filter");
+    edp_interest_filter_ = (nullptr != edp_interest_filter && "true" == *edp_interest_filter);
+
+    const std::string* realtime_mode = PropertyPolicyHelper::find_property(m_att.properties,
+                    "fastdds.realtime_mode");
+    realtime_mode_ = (nullptr != realtime_mode && "true" == *realtime_mode);
+
+    if (event_resource_ == &mp_event_thr)
+    {
+        mp_event_thr.init_thread();
+    }
 
     if (!networkFactoryHasRegisteredTransports())
     {
@@ -251,8 +314,11 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     uint32_t meta_multicast_port_for_check = metatraffic_multicast_port;
 
     /* INSERT DEFAULT MANDATORY MULTICAST LOCATORS HERE */
+    bool has_default_metatraffic_locators = false;
     if (m_att.builtin.metatrafficMulticastLocatorList.empty() && m_att.builtin.metatrafficUnicastLocatorList.empty())
     {
+        has_default_metatraffic_locators = true;
+
         m_network_Factory.getDefaultMetatrafficMulticastLocators(m_att.builtin.metatrafficMulticastLocatorList,
                 metatraffic_multicast_port);
         m_network_Factory.NormalizeLocators(m_att.builtin.metatrafficMulticastLocatorList);
@@ -343,6 +409,14 @@ RTPSParticipantImpl::RTPSParticipantImpl(
                                                   << m_att.defaultUnicastLocatorList);
     }
 
+    // Participants sharing the transports listen on the same unicast locators, when using the default ones
+    bool share_unicast_locators = shared_receivers_ && has_default_metatraffic_locators && !hasLocatorsDefined;
+    if (share_unicast_locators)
+    {
+        transport_pool_->get_unicast_locators(m_att.builtin.metatrafficUnicastLocatorList,
+                m_att.defaultUnicastLocatorList);
+    }
+
 #if HAVE_SECURITY
     // Start security
     // TODO(Ricardo) Get returned value in future.
@@ -367,6 +441,12 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     createReceiverResources(m_att.defaultUnicastLocatorList, true, false);
     createReceiverResources(m_att.defaultMulticastLocatorList, true, false);
 
+    if (share_unicast_locators && !is_intraprocess_only())
+    {
+        transport_pool_->set_unicast_locators(m_att.builtin.metatrafficUnicastLocatorList,
+                m_att.defaultUnicastLocatorList);
+    }
+
     // Check metatraffic multicast port
     if (0 < m_att.builtin.metatrafficMulticastLocatorList.size() &&
             m_att.builtin.metatrafficMulticastLocatorList.begin()->port != meta_multicast_port_for_check)
@@ -424,6 +504,33 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     }
 #endif // if HAVE_SECURITY
 
+    // Aggregation of periodic HEARTBEATs and ACKNACKs. Not compatible with RTPS protection, as the messages
+    // reach the send resources already encoded.
+    const std::string* aggregation_period = PropertyPolicyHelper::find_property(m_att.properties,
+                    "fastdds.message_aggregation_period");
+#if HAVE_SECURITY
+    if (is_secure())
+    {
+        aggregation_period = nullptr;
+    }
+#endif // if HAVE_SECURITY
+    if (nullptr != aggregation_period)
+    {
+        uint32_t period_ms = 0;
+        std::stringstream ss(*aggregation_period);
+        if ((ss >> period_ms) && 0 < period_ms)
+        {
+            // Aggregated messages are always kept below the UDP datagram size
+            uint32_t max_message_size = (std::min)(getMaxMessageSize(), 65500u);
+            message_aggregator_.reset(new MessageAggregator(this, period_ms, max_message_size));
+        }
+        else
+        {
+            logError(RTPS_PARTICIPANT, "Wrong value '" << *aggregation_period
+                                                       << "' for property fastdds.message_aggregation_period");
+        }
+    }
+
     mp_builtinProtocols = new BuiltinProtocols();
 
     logInfo(RTPS_PARTICIPANT, "RTPSParticipant \"" << m_att.getName() << "\" with guidPrefix: " << m_guid.guidPrefix);
@@ -469,7 +576,11 @@ void RTPSParticipantImpl::disable()
     for (auto& block : m_receiverResourcelist)
     {
         block.Receiver->UnregisterReceiver(block.mp_receiver);
-        block.disable();
+        // Shared channels are closed when the last participant using them releases them
+        if (!shared_receivers_)
+        {
+            block.disable();
+        }
     }
 
     while (m_userReaderList.size() > 0)
@@ -500,6 +611,8 @@ RTPSParticipantImpl::~RTPSParticipantImpl()
 {
     disable();
 
+    message_aggregator_.reset();
+
 #if HAVE_SECURITY
     m_security_manager.destroy();
 #endif // if HAVE_SECURITY
@@ -514,11 +627,21 @@ RTPSParticipantImpl::~RTPSParticipantImpl()
     delete mp_ResourceSemaphore;
     delete mp_userParticipant;
     mp_userParticipant = nullptr;
+    priority_send_resource_lists_.clear();
     send_resource_list_.clear();
 
+    // Ports are closed, so the identifier can be given to another participant
+    participant_id_lock_.reset();
+
     delete mp_mutex;
 }
 
+void RTPSParticipantImpl::participant_id_lock(
+        std::unique_ptr<fastdds::rtps::ParticipantIdLock>&& id_lock)
+{
+    participant_id_lock_ = std::move(id_lock);
+}
+
 template <EndpointKind_t kind, octet no_key, octet with_key>
 bool RTPSParticipantImpl::preprocess_endpoint_attributes(
         const EntityId_t& entity_id,
@@ -1458,7 +1581,7 @@ bool RTPSParticipantImpl::createReceiverResources(
 
     for (auto it_loc = Locator_list.begin(); it_loc != Locator_list.end(); ++it_loc)
     {
-        bool ret = m_network_Factory.BuildReceiverResources(*it_loc, newItemsBuffer, max_receiver_buffer_size);
+        bool ret = build_receiver_resources(*it_loc, newItemsBuffer, max_receiver_buffer_size);
         if (!ret && ApplyMutation)
         {
             uint32_t tries = 0;
@@ -1466,7 +1589,7 @@ bool RTPSParticipantImpl::createReceiverResources(
             {
                 tries++;
                 *it_loc = applyLocatorAdaptRule(*it_loc);
-                ret = m_network_Factory.BuildReceiverResources(*it_loc, newItemsBuffer, max_receiver_buffer_size);
+                ret = build_receiver_resources(*it_loc, newItemsBuffer, max_receiver_buffer_size);
             }
         }
 
@@ -1492,6 +1615,33 @@ bool RTPSParticipantImpl::createReceiverResources(
     return ret_val;
 }
 
+bool RTPSParticipantImpl::build_receiver_resources(
+        Locator_t& locator,
+        std::vector<std::shared_ptr<ReceiverResource>>& resources,
+        uint32_t max_receiver_buffer_size)
+{
+    if (!shared_receivers_)
+    {
+        return m_network_Factory.BuildReceiverResources(locator, resources, max_receiver_buffer_size);
+    }
+
+    size_t first_new = resources.size();
+    bool ret = transport_pool_->build_receiver_resources(locator, resources, max_receiver_buffer_size);
+
+    // Shared resources this participant already listens on are not added again
+    std::lock_guard<std::mutex> lock(m_receiverResourcelistMutex);
+    resources.erase(std::remove_if(resources.begin() + first_new, resources.end(),
+            [this](const std::shared_ptr<ReceiverResource>& resource)
+            {
+                return std::any_of(m_receiverResourcelist.begin(), m_receiverResourcelist.end(),
+                [&resource](const ReceiverControlBlock& block)
+                {
+                    return block.Receiver == resource;
+                });
+            }), resources.end());
+    return ret;
+}
+
 void RTPSParticipantImpl::createSenderResources(
         const LocatorList_t& locator_list)
 {
@@ -1511,6 +1661,31 @@ void RTPSParticipantImpl::createSenderResources(
     m_network_Factory.build_send_resources(send_resource_list_, locator);
 }
 
+void RTPSParticipantImpl::register_transport_priority(
+        int32_t transport_priority)
+{
+    if (0 == transport_priority)
+    {
+        return;
+    }
+
+    std::lock_guard<std::timed_mutex> guard(m_send_resources_mutex_);
+    if (priority_send_resource_lists_.find(transport_priority) != priority_send_resource_lists_.end())
+    {
+        return;
+    }
+
+    // Transports open their output channels regardless of the destination address, so the default output
+    // locators are enough to build the resources for any destination
+    LocatorList_t locators;
+    m_network_Factory.GetDefaultOutputLocators(locators);
+    fastdds::rtps::SendResourceList& resources = priority_send_resource_lists_[transport_priority];
+    for (const Locator_t& locator : locators)
+    {
+        m_network_Factory.build_priority_send_resources(resources, locator, transport_priority);
+    }
+}
+
 bool RTPSParticipantImpl::deleteUserEndpoint(
         Endpoint* p_endpoint)
 {
@@ -1874,6 +2049,104 @@ fastdds::dds::builtin::TypeLookupManager* RTPSParticipantImpl::typelookup_manage
     return mp_builtinProtocols->tlm_;
 }
 
+bool RTPSParticipantImpl::lazy_builtin_endpoints() const
+{
+#if HAVE_SECURITY
+    // Secure builtin endpoints are matched through the security handshake, so they are always created
+    if (is_secure())
+    {
+        return false;
+    }
+#endif // if HAVE_SECURITY
+    return lazy_builtin_endpoints_;
+}
+
+bool RTPSParticipantImpl::edp_interest_filter() const
+{
+#if HAVE_SECURITY
+    // Announcements on the secure builtin endpoints are not filtered
+    if (is_secure())
+    {
+        return false;
+    }
+#endif // if HAVE_SECURITY
+    return edp_interest_filter_;
+}
+
+void RTPSParticipantImpl::get_memory_usage(
+        ParticipantMemoryUsage& usage)
+{
+    usage = ParticipantMemoryUsage();
+    usage.guid = m_guid;
+
+    if (nullptr != mp_builtinProtocols && nullptr != mp_builtinProtocols->mp_PDP)
+    {
+        mp_builtinProtocols->mp_PDP->get_memory_usage(usage.discovery);
+    }
+
+    if (send_buffers_)
+    {
+        send_buffers_->get_memory_usage(usage.send_buffers);
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(m_receiverResourcelistMutex);
+        for (const ReceiverControlBlock& block : m_receiverResourcelist)
+        {
+            usage.transports.reserved += block.Receiver->max_message_size();
+        }
+    }
+    usage.transports.reserved += shm_segments_size_;
+    usage.transports.in_use = usage.transports.reserved;
+
+    // Payload pools are shared by the endpoints of the same topic, so each one is only accounted once
+    std::vector<IPayloadPool*> payload_pools;
+    auto add_payload_pool = [&usage, &payload_pools](IPayloadPool* pool)
+            {
+                if (nullptr != pool &&
+                        payload_pools.end() == std::find(payload_pools.begin(), payload_pools.end(), pool))
+                {
+                    payload_pools.push_back(pool);
+                    MemoryUsage pool_usage;
+                    if (pool->get_memory_usage(pool_usage))
+                    {
+                        usage.payload_pools += pool_usage;
+                    }
+                }
+            };
+    auto add_endpoint = [&usage](const EndpointMemoryUsage& endpoint_usage, bool is_builtin)
+            {
+                if (is_builtin)
+                {
+                    usage.builtin_endpoints += endpoint_usage.total();
+                }
+                else
+                {
+                    usage.user_endpoints += endpoint_usage.total();
+                    usage.endpoints.push_back(endpoint_usage);
+                }
+            };
+
+    std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
+    usage.endpoints.reserve(m_userWriterList.size() + m_userReaderList.size());
+    for (RTPSWriter* writer : m_allWriterList)
+    {
+        EndpointMemoryUsage endpoint_usage;
+        writer->get_memory_usage(endpoint_usage);
+        add_endpoint(endpoint_usage,
+                m_userWriterList.end() == std::find(m_userWriterList.begin(), m_userWriterList.end(), writer));
+        add_payload_pool(writer->payload_pool_.get());
+    }
+    for (RTPSReader* reader : m_allReaderList)
+    {
+        EndpointMemoryUsage endpoint_usage;
+        reader->get_memory_usage(endpoint_usage);
+        add_endpoint(endpoint_usage,
+                m_userReaderList.end() == std::find(m_userReaderList.begin(), m_userReaderList.end(), reader));
+        add_payload_pool(reader->payload_pool_.get());
+    }
+}
+
 IPersistenceService* RTPSParticipantImpl::get_persistence_service(
         const EndpointAttributes& param)
 {
@@ -19,9 +19,11 @@
 #ifndef _RTPS_PARTICIPANT_RTPSPARTICIPANTIMPL_H_
 #define _RTPS_PARTICIPANT_RTPSPARTICIPANTIMPL_H_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <list>
+#include <map>
 #include <sys/types.h>
 #include <mutex>
 #include <atomic>
@@ -34,10 +36,12 @@
 #include <unistd.h>
 #endif // if defined(_WIN32)
 
+#include <rtps/messages/MessageAggregator.hpp>
 #include <rtps/messages/RTPSMessageGroup_t.hpp>
 #include <rtps/messages/SendBuffersManager.hpp>
 
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
 
@@ -72,6 +76,12 @@ class TypeLookupManager;
 
 } // namespace builtin
 } // namespace dds
+
+namespace rtps {
+
+class ParticipantIdLock;
+
+} // namespace rtps
 } // namespace fastdds
 
 namespace fastrtps {
@@ -97,6 +107,7 @@ class ReaderListener;
 class StatefulReader;
 class PDPSimple;
 class IPersistenceService;
+class TransportPool;
 class WLP;
 
 /**
@@ -249,7 +260,7 @@ public:
     //!Get Pointer to the Event Resource.
     ResourceEvent& getEventResource()
     {
-        return mp_event_thr;
+        return *event_resource_;
     }
 
     /**
@@ -259,6 +270,7 @@ public:
      * @param destination_locators_begin Iterator at the first destination locator.
      * @param destination_locators_end Iterator at the end destination locator.
      * @param max_blocking_time_point execution time limit timepoint.
+     * @param transport_priority TransportPriorityQosPolicy of the sender, selecting the send resources.
      * @return true if at least one locator has been sent.
      */
     template<class LocatorIteratorT>
@@ -267,32 +279,36 @@ public:
             const GUID_t& sender_guid,
             const LocatorIteratorT& destination_locators_begin,
             const LocatorIteratorT& destination_locators_end,
-            std::chrono::steady_clock::time_point& max_blocking_time_point)
+            std::chrono::steady_clock::time_point& max_blocking_time_point,
+            int32_t transport_priority = 0)
     {
         bool ret_code = false;
-        std::unique_lock<std::timed_mutex> lock(m_send_resources_mutex_, std::defer_lock);
 
-        if (lock.try_lock_until(max_blocking_time_point))
+        // Aggregated messages leave through the default send resources, so prioritized ones are not aggregated
+        if (message_aggregator_ && 0 == transport_priority && MessageAggregator::is_collecting())
         {
-            ret_code = true;
+            // Reported to the statistics module by send_aggregated, once actually sent
+            ret_code = message_aggregator_->add_message(msg, destination_locators_begin, destination_locators_end,
+                            max_blocking_time_point);
+        }
+        else
+        {
+            ret_code = send_through_resources(msg, destination_locators_begin, destination_locators_end,
+                            max_blocking_time_point, transport_priority);
 
-            for (auto& send_resource : send_resource_list_)
+            if (ret_code)
             {
-                LocatorIteratorT locators_begin = destination_locators_begin;
-                LocatorIteratorT locators_end = destination_locators_end;
-                send_resource->send(msg->buffer, msg->length, &locators_begin, &locators_end,
-                        max_blocking_time_point);
+                // notify statistics module
+                on_rtps_send(
+                    sender_guid,
+                    destination_locators_begin,
+                    destination_locators_end,
+                    msg->length);
             }
+        }
 
-            lock.unlock();
-
-            // notify statistics module
-            on_rtps_send(
-                sender_guid,
-                destination_locators_begin,
-                destination_locators_end,
-                msg->length);
-
+        if (ret_code)
+        {
             // checkout if sender is a discovery endpoint
             on_discovery_packet(
                 sender_guid,
@@ -303,6 +319,104 @@ public:
         return ret_code;
     }
 
+    /**
+     * Send a message built by the aggregator of control messages, reporting it to the statistics module.
+     * @param msg Pointer to the message.
+     * @param destination_locators_begin Iterator at the first destination locator.
+     * @param destination_locators_end Iterator at the end destination locator.
+     * @param max_blocking_time_point execution time limit timepoint.
+     * @return true if at least one locator has been sent.
+     */
+    template<class LocatorIteratorT>
+    bool send_aggregated(
+            CDRMessage_t* msg,
+            const LocatorIteratorT& destination_locators_begin,
+            const LocatorIteratorT& destination_locators_end,
+            std::chrono::steady_clock::time_point& max_blocking_time_point)
+    {
+        bool ret_code = send_through_resources(msg, destination_locators_begin, destination_locators_end,
+                        max_blocking_time_point);
+
+        if (ret_code)
+        {
+            // notify statistics module. The message gathers several endpoints, so it is reported as the participant's
+            on_rtps_send(
+                m_guid,
+                destination_locators_begin,
+                destination_locators_end,
+                msg->length);
+        }
+
+        return ret_code;
+    }
+
+    /**
+     * Send a message through the send resources of the participant, skipping the aggregation of control messages.
+     * @param msg Pointer to the message.
+     * @param destination_locators_begin Iterator at the first destination locator.
+     * @param destination_locators_end Iterator at the end destination locator.
+     * @param max_blocking_time_point execution time limit timepoint.
+     * @param transport_priority TransportPriorityQosPolicy of the sender, selecting the send resources.
+     * @return true if at least one locator has been sent.
+     */
+    template<class LocatorIteratorT>
+    bool send_through_resources(
+            CDRMessage_t* msg,
+            const LocatorIteratorT& destination_locators_begin,
+            const LocatorIteratorT& destination_locators_end,
+            std::chrono::steady_clock::time_point& max_blocking_time_point,
+            int32_t transport_priority = 0)
+    {
+        std::unique_lock<std::timed_mutex> lock(m_send_resources_mutex_, std::defer_lock);
+
+        if (!lock.try_lock_until(max_blocking_time_point))
+        {
+            return false;
+        }
+
+        const fastdds::rtps::SendResourceList* priority_resources = nullptr;
+        if (0 != transport_priority)
+        {
+            auto it = priority_send_resource_lists_.find(transport_priority);
+            if (it != priority_send_resource_lists_.end() && !it->second.empty())
+            {
+                priority_resources = &it->second;
+            }
+        }
+
+        if (nullptr != priority_resources)
+        {
+            for (auto& send_resource : *priority_resources)
+            {
+                LocatorIteratorT locators_begin = destination_locators_begin;
+                LocatorIteratorT locators_end = destination_locators_end;
+                send_resource->send(msg->buffer, msg->length, &locators_begin, &locators_end,
+                        max_blocking_time_point);
+            }
+        }
+
+        for (auto& send_resource : send_resource_list_)
+        {
+            // Transports with resources for the priority do not send through the default ones
+            if (nullptr != priority_resources &&
+                    std::any_of(priority_resources->begin(), priority_resources->end(),
+                    [&send_resource](const std::unique_ptr<SenderResource>& priority_resource)
+                    {
+                        return priority_resource->kind() == send_resource->kind();
+                    }))
+            {
+                continue;
+            }
+
+            LocatorIteratorT locators_begin = destination_locators_begin;
+            LocatorIteratorT locators_end = destination_locators_end;
+            send_resource->send(msg->buffer, msg->length, &locators_begin, &locators_end,
+                    max_blocking_time_point);
+        }
+
+        return true;
+    }
+
     //!Get the participant Mutex
     std::recursive_mutex* getParticipantMutex() const
     {
@@ -407,6 +521,40 @@ public:
 
     fastdds::dds::builtin::TypeLookupManager* typelookup_manager() const;
 
+    /**
+     * Whether the optional builtin endpoints (WLP and TypeLookup) are only created when they are first needed.
+     * Enabled with property fastdds.lazy_builtin_endpoints, unless the participant is secure.
+     * @return True when the optional builtin endpoints are created lazily.
+     */
+    bool lazy_builtin_endpoints() const;
+
+    /**
+     * Whether the announcements of remote endpoints on topics without local endpoints that could match them are
+     * kept aside by SIMPLE (and CLIENT) discovery, instead of being parsed and stored as proxies.
+     * Enabled with property fastdds.edp_interest_filter, unless the participant is secure.
+     * @return True when endpoint discovery only processes the announcements of interest.
+     */
+    bool edp_interest_filter() const;
+
+    /**
+     * Whether writing, reading and processing received messages are real-time paths, whose allocations and long
+     * lock waits are reported through RealtimeMonitor.
+     * Enabled with property fastdds.realtime_mode.
+     * @return True when the real-time mode is enabled.
+     */
+    bool realtime_mode() const
+    {
+        return realtime_mode_;
+    }
+
+    /**
+     * Get the memory allocated by this participant.
+     * Receive channels shared with other participants (see TransportPool) are accounted by each of them.
+     * @param [out] usage Memory of the participant by subsystem, and of each of its user endpoints.
+     */
+    void get_memory_usage(
+            ParticipantMemoryUsage& usage);
+
     bool is_intraprocess_only() const
     {
         return is_intraprocess_only_;
@@ -475,6 +623,13 @@ public:
 
     uint32_t get_domain_id() const;
 
+    /**
+     * Keep the host wide reservation of the participant identifier while this participant exists.
+     * @param id_lock Reservation of the identifier.
+     */
+    void participant_id_lock(
+            std::unique_ptr<fastdds::rtps::ParticipantIdLock>&& id_lock);
+
     //!Compare metatraffic locators list searching for mutations
     bool did_mutation_took_place_on_meta(
             const LocatorList_t& MulticastLocatorList,
@@ -494,6 +649,8 @@ private:
     GUID_t m_persistence_guid;
     //! Sending resources. - DEPRECATED -Stays commented for reference purposes
     // ResourceSend* mp_send_thr;
+    //! Resources shared with the participants of the same domain in this process
+    std::shared_ptr<TransportPool> transport_pool_;
     //! Event Resource
     ResourceEvent mp_event_thr;
     //! BuiltinProtocols of this RTPSParticipant
@@ -517,6 +674,10 @@ private:
     std::function<bool(const std::string&)> type_check_fn_;
     //!Pool of send buffers
     std::unique_ptr<SendBuffersManager> send_buffers_;
+    //! Aggregator of periodic control messages. Only created when enabled by property.
+    std::unique_ptr<MessageAggregator> message_aggregator_;
+    //! Host wide reservation of the participant identifier. Only held when enabled by property.
+    std::unique_ptr<fastdds::rtps::ParticipantIdLock> participant_id_lock_;
 
 #if HAVE_SECURITY
     // Security manager
@@ -535,6 +696,8 @@ private:
     //!SenderResource List
     std::timed_mutex m_send_resources_mutex_;
     fastdds::rtps::SendResourceList send_resource_list_;
+    //! Send resources of the writers with each transport priority, guarded by m_send_resources_mutex_
+    std::map<int32_t, fastdds::rtps::SendResourceList> priority_send_resource_lists_;
 
     //!Participant Listener
     RTPSParticipantListener* mp_participantListener;
@@ -626,6 +789,24 @@ private:
     //! Indicates whether the participant has shared-memory transport
     bool has_shm_transport_;
 
+    //! Indicates whether the receiver resources are shared through transport_pool_
+    bool shared_receivers_;
+
+    //! Event resource used: mp_event_thr, or the one of transport_pool_
+    ResourceEvent* event_resource_;
+
+    //! Indicates whether property fastdds.lazy_builtin_endpoints is enabled
+    bool lazy_builtin_endpoints_;
+
+    //! Indicates whether property fastdds.edp_interest_filter is enabled
+    bool edp_interest_filter_;
+
+    //! Indicates whether property fastdds.realtime_mode is enabled
+    bool realtime_mode_;
+
+    //! Bytes of the shared memory segments created by the registered transports
+    uint64_t shm_segments_size_;
+
     /**
      * Get persistence service from factory, using endpoint attributes (or participant
      * attributes if endpoint does not define a persistence service config)
@@ -891,12 +1072,32 @@ public:
             bool ApplyMutation,
             bool RegisterReceiver);
 
+    /**
+     * Builds the ReceiverResources of a locator, from the network factory or from the transport pool.
+     * @param locator Locator to listen on.
+     * @param resources New resources are added to this list.
+     * @param max_receiver_buffer_size Maximum size of the received messages.
+     * @return True if the locator is listened on.
+     */
+    bool build_receiver_resources(
+            Locator_t& locator,
+            std::vector<std::shared_ptr<ReceiverResource>>& resources,
+            uint32_t max_receiver_buffer_size);
+
     void createSenderResources(
             const LocatorList_t& locator_list);
 
     void createSenderResources(
             const Locator_t& locator);
 
+    /**
+     * Creates the send resources used by the writers with the given transport priority, if any transport
+     * distinguishes it. Writers with priorities without their own resources send through the default ones.
+     * @param transport_priority Value of the TransportPriorityQosPolicy of the writers.
+     */
+    void register_transport_priority(
+            int32_t transport_priority);
+
     bool networkFactoryHasRegisteredTransports() const;
 
 #if HAVE_SECURITY
@@ -346,6 +346,21 @@ uint64_t RTPSReader::get_unread_count() const
     return total_unread_;
 }
 
+void RTPSReader::get_memory_usage(
+        EndpointMemoryUsage& usage) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+
+    usage = EndpointMemoryUsage();
+    usage.guid = m_guid;
+    change_pool_->get_memory_usage(usage.history);
+    for (auto it = mp_history->changesBegin(); it != mp_history->changesEnd(); ++it)
+    {
+        usage.payloads.reserved += (*it)->serializedPayload.max_size;
+        usage.payloads.in_use += (*it)->serializedPayload.length;
+    }
+}
+
 bool RTPSReader::is_datasharing_compatible_with(
         const WriterProxyData& wdata)
 {
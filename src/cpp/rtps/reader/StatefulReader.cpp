@@ -22,10 +22,14 @@
 #include <fastdds/rtps/history/ReaderHistory.h>
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/messages/RTPSMessageCreator.h>
+#include <fastdds/rtps/common/RealtimeMonitor.hpp>
+#include <rtps/common/AdaptiveTiming.hpp>
+#include <rtps/messages/MessageAggregator.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <rtps/reader/WriterProxy.h>
 #include <fastrtps/utils/TimeConversion.h>
 #include <rtps/history/HistoryAttributesExtension.hpp>
+#include <utils/Prefetch.hpp>
 #include <rtps/DataSharing/DataSharingListener.hpp>
 #include <rtps/DataSharing/ReaderPool.hpp>
 #include <fastdds/rtps/builtin/BuiltinProtocols.h>
@@ -141,6 +145,8 @@ void StatefulReader::init(
     {
         matched_writers_pool_.push_back(new WriterProxy(this, part_att.allocation.locators, proxy_changes_config_));
     }
+
+    get_adaptive_timing_settings(att.endpoint.properties, adaptive_timing_);
 }
 
 bool StatefulReader::matched_writer_add(
@@ -286,6 +292,7 @@ bool StatefulReader::matched_writer_remove(
     {
         //Remove cachechanges belonging to the unmatched writer
         mp_history->remove_changes_with_guid(writer_guid);
+        mp_history->writer_unmatched(writer_guid);
 
         if (liveliness_lease_duration_ < c_TimeInfinite)
         {
@@ -360,6 +367,26 @@ bool StatefulReader::matched_writer_is_matched(
     return false;
 }
 
+void StatefulReader::get_memory_usage(
+        EndpointMemoryUsage& usage) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+
+    RTPSReader::get_memory_usage(usage);
+    for (const WriterProxy* writer : matched_writers_)
+    {
+        writer->get_memory_usage(usage.matched_proxies);
+    }
+
+    // Proxies kept for future matches are only reserved
+    for (const WriterProxy* writer : matched_writers_pool_)
+    {
+        MemoryUsage pooled;
+        writer->get_memory_usage(pooled);
+        usage.matched_proxies.reserved += pooled.reserved;
+    }
+}
+
 bool StatefulReader::matched_writer_lookup(
         const GUID_t& writerGUID,
         WriterProxy** WP)
@@ -432,7 +459,8 @@ bool StatefulReader::processDataMsg(
 
     assert(change);
 
-    std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
+    std::unique_lock<RecursiveTimedMutex> lock(mp_mutex, std::defer_lock);
+    RealtimeMonitor::lock(lock);
     if (!is_alive_)
     {
         return false;
@@ -446,6 +474,19 @@ bool StatefulReader::processDataMsg(
             logInfo(RTPS_MSG_IN,
                     IDSTRING "Trying to add change " << change->sequenceNumber << " TO reader: " << getGuid().entityId);
 
+            change->reader_info.writer_ownership_strength = pWP ? pWP->ownership_strength() : 0;
+            if (pWP && !mp_history->can_change_be_added_nts(change))
+            {
+                // The history would never keep it, so it is not stored
+                logInfo(RTPS_MSG_IN, IDSTRING "Change " << change->sequenceNumber << " discarded by reader " << m_guid);
+                pWP->irrelevant_change_set(change->sequenceNumber);
+                NotifyChanges(pWP);
+
+                lock.unlock(); // Avoid deadlock with LivelinessManager.
+                assert_writer_liveliness(change->writerGUID);
+                return true;
+            }
+
             // Ask the pool for a cache change
             CacheChange_t* change_to_add = nullptr;
             if (!change_pool_->reserve_cache(change_to_add))
@@ -520,7 +561,8 @@ bool StatefulReader::processDataFragMsg(
 
     assert(incomingChange);
 
-    std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
+    std::unique_lock<RecursiveTimedMutex> lock(mp_mutex, std::defer_lock);
+    RealtimeMonitor::lock(lock);
     if (!is_alive_)
     {
         return false;
@@ -542,8 +584,17 @@ bool StatefulReader::processDataFragMsg(
             CacheChange_t* work_change = nullptr;
             if (!mp_history->get_change(change_to_add->sequenceNumber, change_to_add->writerGUID, &work_change))
             {
+                change_to_add->reader_info.writer_ownership_strength = pWP->ownership_strength();
+                if (!mp_history->can_change_be_added_nts(change_to_add))
+                {
+                    // The history would never keep it, so the rest of fragments will be ignored
+                    logInfo(RTPS_MSG_IN, IDSTRING "Change " << change_to_add->sequenceNumber << " discarded by reader "
+                                                            << m_guid);
+                    pWP->irrelevant_change_set(change_to_add->sequenceNumber);
+                    NotifyChanges(pWP);
+                }
                 // A new change should be reserved
-                if (reserveCache(&work_change, sampleSize))
+                else if (reserveCache(&work_change, sampleSize))
                 {
                     if (work_change->serializedPayload.max_size < sampleSize)
                     {
@@ -584,6 +635,7 @@ bool StatefulReader::processDataFragMsg(
             if (work_change != nullptr && work_change->is_fully_assembled())
             {
                 pWP->received_change_set(work_change->sequenceNumber);
+                report_round_trip_time_nts(pWP);
                 NotifyChanges(pWP);
             }
         }
@@ -606,7 +658,8 @@ bool StatefulReader::processHeartbeatMsg(
 {
     WriterProxy* writer = nullptr;
 
-    std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
+    std::unique_lock<RecursiveTimedMutex> lock(mp_mutex, std::defer_lock);
+    RealtimeMonitor::lock(lock);
     if (!is_alive_)
     {
         return false;
@@ -662,7 +715,8 @@ bool StatefulReader::processGapMsg(
 {
     WriterProxy* pWP = nullptr;
 
-    std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
+    std::unique_lock<RecursiveTimedMutex> lock(mp_mutex, std::defer_lock);
+    RealtimeMonitor::lock(lock);
     if (!is_alive_)
     {
         return false;
@@ -712,6 +766,8 @@ bool StatefulReader::processGapMsg(
                 }
             });
 
+        report_round_trip_time_nts(pWP);
+
         // Maybe now we have to notify user from new CacheChanges.
         NotifyChanges(pWP);
 
@@ -862,6 +918,7 @@ bool StatefulReader::change_received(
         if (a_change->is_fully_assembled())
         {
             ret = prox->received_change_set(a_change->sequenceNumber);
+            report_round_trip_time_nts(prox);
         }
 
         // WARNING! This method could destroy a_change
@@ -1011,6 +1068,8 @@ bool StatefulReader::nextUnreadCache(
     std::vector<CacheChange_t*>::iterator it = mp_history->changesBegin();
     while (it != mp_history->changesEnd())
     {
+        prefetch_ahead(it, mp_history->changesEnd());
+
         if ((*it)->isRead)
         {
             ++it;
@@ -1152,6 +1211,8 @@ void StatefulReader::change_read_by_user(
         for (std::vector<CacheChange_t*>::iterator it = mp_history->changesBegin();
                 it != mp_history->changesEnd(); ++it)
         {
+            prefetch_ahead(it, mp_history->changesEnd());
+
             if (!(*it)->isRead)
             {
                 if ((*it)->writerGUID == writer->guid())
@@ -1198,12 +1259,14 @@ void StatefulReader::send_acknack(
 
     logInfo(RTPS_READER, "Sending ACKNACK: " << sns);
 
+    // May wait for the next tick of the participant's message aggregator
+    MessageAggregator::CollectScope aggregate;
     RTPSMessageGroup group(getRTPSParticipant(), this, sender);
     group.add_acknack(sns, acknack_count_, is_final);
 }
 
 void StatefulReader::send_acknack(
-        const WriterProxy* writer,
+        WriterProxy* writer,
         const RTPSMessageSenderInterface* sender,
         bool heartbeat_was_final)
 {
@@ -1226,6 +1289,10 @@ void StatefulReader::send_acknack(
 
     try
     {
+        // Pure acknowledgements may wait for the next tick of the participant's message aggregator.
+        // Negative ones are sent right away, so repairs are not delayed.
+        // With adaptive timing they are not delayed either, so the writer measures a steady response time.
+        MessageAggregator::CollectScope aggregate(missing_changes.empty() && !adaptive_timing_.enabled);
         RTPSMessageGroup group(getRTPSParticipant(), this, sender);
         if (!missing_changes.empty() || !heartbeat_was_final)
         {
@@ -1270,6 +1337,11 @@ void StatefulReader::send_acknack(
 
             bool final = sns.empty();
             group.add_acknack(sns, acknack_count_, final);
+
+            if (adaptive_timing_.enabled && !final)
+            {
+                writer->nack_sent(sns.base());
+            }
         }
     }
     catch (const RTPSMessageGroup::timeout&)
@@ -1278,6 +1350,17 @@ void StatefulReader::send_acknack(
     }
 }
 
+void StatefulReader::report_round_trip_time_nts(
+        WriterProxy* writer)
+{
+    if (adaptive_timing_.enabled && writer->nack_answered())
+    {
+        // The heartbeat response delay is not adapted. It is part of the round trip measured by the writer,
+        // so it would feed back into the estimations of both sides.
+        on_round_trip_time(writer->guid(), writer->round_trip_time().smoothed_rtt());
+    }
+}
+
 bool StatefulReader::send_sync_nts(
         CDRMessage_t* message,
         const Locators& locators_begin,
@@ -22,6 +22,7 @@
 #include <fastdds/rtps/reader/ReaderListener.h>
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/RealtimeMonitor.hpp>
 #include <fastdds/rtps/builtin/BuiltinProtocols.h>
 #include <fastdds/rtps/builtin/liveliness/WLP.h>
 #include <fastdds/rtps/writer/LivelinessManager.h>
@@ -179,6 +180,7 @@ bool StatelessReader::matched_writer_remove(
 
     //Remove cachechanges belonging to the unmatched writer
     mp_history->remove_changes_with_guid(writer_guid);
+    mp_history->writer_unmatched(writer_guid);
 
     if (liveliness_lease_duration_ < c_TimeInfinite)
     {
@@ -235,6 +237,16 @@ bool StatelessReader::matched_writer_is_matched(
     return false;
 }
 
+void StatelessReader::get_memory_usage(
+        EndpointMemoryUsage& usage) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+
+    RTPSReader::get_memory_usage(usage);
+    usage.matched_proxies.reserved += matched_writers_.capacity() * sizeof(RemoteWriterInfo_t);
+    usage.matched_proxies.in_use += matched_writers_.size() * sizeof(RemoteWriterInfo_t);
+}
+
 bool StatelessReader::change_received(
         CacheChange_t* change)
 {
@@ -392,7 +404,8 @@ bool StatelessReader::processDataMsg(
 {
     assert(change);
 
-    std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
+    std::unique_lock<RecursiveTimedMutex> lock(mp_mutex, std::defer_lock);
+    RealtimeMonitor::lock(lock);
 
     if (acceptMsgFrom(change->writerGUID, change->kind))
     {
@@ -476,7 +489,8 @@ bool StatelessReader::processDataFragMsg(
 
     GUID_t writer_guid = incomingChange->writerGUID;
 
-    std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
+    std::unique_lock<RecursiveTimedMutex> lock(mp_mutex, std::defer_lock);
+    RealtimeMonitor::lock(lock);
     for (RemoteWriterInfo_t& writer : matched_writers_)
     {
         if (writer.guid == writer_guid)
@@ -176,6 +176,8 @@ void WriterProxy::clear()
     guid_prefix_as_vector_.clear();
     changes_received_.clear();
     is_on_same_process_ = false;
+    round_trip_time_.reset();
+    nack_probe_ = SequenceNumber_t::unknown();
     loaded_from_storage(SequenceNumber_t());
 }
 
@@ -472,6 +474,14 @@ size_t WriterProxy::number_of_changes_from_writer() const
     return 0;
 }
 
+void WriterProxy::get_memory_usage(
+        MemoryUsage& usage) const
+{
+    uint64_t changes_size = changes_received_.size() * set_helper::node_size;
+    usage.reserved += sizeof(WriterProxy) + changes_size + changes_pool_.capacity_left();
+    usage.in_use += sizeof(WriterProxy) + changes_size;
+}
+
 SequenceNumber_t WriterProxy::next_cache_change_to_be_notified()
 {
 #ifdef SHOULD_DEBUG_LINUX
@@ -506,7 +516,7 @@ void WriterProxy::perform_initial_ack_nack() const
     }
 }
 
-void WriterProxy::perform_heartbeat_response() const
+void WriterProxy::perform_heartbeat_response()
 {
     reader_->send_acknack(this, this, heartbeat_final_flag_.load());
 }
@@ -577,6 +587,32 @@ void WriterProxy::update_heartbeat_response_interval(
     heartbeat_response_->update_interval(interval);
 }
 
+void WriterProxy::nack_sent(
+        const SequenceNumber_t& first_requested)
+{
+#ifdef SHOULD_DEBUG_LINUX
+    assert(get_mutex_owner() == get_thread_id());
+#endif // SHOULD_DEBUG_LINUX
+
+    nack_probe_ = first_requested;
+    round_trip_time_.request_sent(std::chrono::steady_clock::now());
+}
+
+bool WriterProxy::nack_answered()
+{
+#ifdef SHOULD_DEBUG_LINUX
+    assert(get_mutex_owner() == get_thread_id());
+#endif // SHOULD_DEBUG_LINUX
+
+    if (SequenceNumber_t::unknown() == nack_probe_ || !change_was_received(nack_probe_))
+    {
+        return false;
+    }
+
+    nack_probe_ = SequenceNumber_t::unknown();
+    return round_trip_time_.answer_received(std::chrono::steady_clock::now());
+}
+
 bool WriterProxy::send(
         CDRMessage_t* message,
         std::chrono::steady_clock::time_point max_blocking_time_point) const
@@ -29,6 +29,8 @@
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
 #include <fastdds/rtps/builtin/data/WriterProxyData.h>
 #include <fastdds/rtps/common/LocatorSelectorEntry.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
+#include <fastdds/rtps/common/RoundTripTimeEstimator.hpp>
 
 #include <foonathan/memory/container.hpp>
 #include <foonathan/memory/memory_pool.hpp>
@@ -223,6 +225,13 @@ public:
      */
     size_t number_of_changes_from_writer() const;
 
+    /**
+     * Add the memory of this proxy and its received sequence numbers.
+     * @param [in,out] usage The memory of the proxy is added to it.
+     */
+    void get_memory_usage(
+            MemoryUsage& usage) const;
+
     /*!
      * @brief Returns next SequenceNumber_t to be notified.
      * @return Next SequenceNumber_t to be nofified or invalid SequenceNumber_t
@@ -246,7 +255,7 @@ public:
     /**
      * Sends the necessary acknac and nackfrag messages to answer the last received heartbeat message.
      */
-    void perform_heartbeat_response() const;
+    void perform_heartbeat_response();
 
     /**
      * Process an incoming heartbeat from the writer represented by this proxy.
@@ -275,6 +284,28 @@ public:
     void update_heartbeat_response_interval(
             const Duration_t& interval);
 
+    /**
+     * Records that a NACK has been sent to the writer, starting a round trip time measurement.
+     * The measurement ends when the first requested change is received.
+     * @param first_requested First sequence number requested on the NACK.
+     */
+    void nack_sent(
+            const SequenceNumber_t& first_requested);
+
+    /**
+     * Checks whether the change requested on the last NACK has been received, ending the measurement.
+     * @return true when the round trip time estimation has been updated.
+     */
+    bool nack_answered();
+
+    /**
+     * @return Round trip time estimation of the NACK / repair exchanges with the writer.
+     */
+    const RoundTripTimeEstimator& round_trip_time() const
+    {
+        return round_trip_time_;
+    }
+
     /**
      * Check if the destinations managed by this sender interface have changed.
      *
@@ -396,6 +427,10 @@ private:
     LocatorSelectorEntry locators_entry_;
     //! Is the writer datasharing
     bool is_datasharing_writer_;
+    //! Round trip time of the NACK / repair exchanges
+    RoundTripTimeEstimator round_trip_time_;
+    //! First sequence number requested on the NACK being measured
+    SequenceNumber_t nack_probe_;
 
     using ChangeIterator = decltype(changes_received_)::iterator;
 
@@ -53,6 +53,7 @@ bool UDPTransportDescriptor::operator ==(
 {
     return (this->m_output_udp_socket == t.m_output_udp_socket &&
            this->non_blocking_send == t.non_blocking_send &&
+           this->transport_priority_dscp == t.transport_priority_dscp &&
            SocketTransportDescriptor::operator ==(t));
 }
 
@@ -234,7 +235,8 @@ UDPChannelResource* UDPTransportInterface::CreateInputChannelResource(
 
 eProsimaUDPSocket UDPTransportInterface::OpenAndBindUnicastOutputSocket(
         const ip::udp::endpoint& endpoint,
-        uint16_t& port)
+        uint16_t& port,
+        const uint8_t* dscp)
 {
     eProsimaUDPSocket socket = createUDPSocket(io_service_);
     getSocketPtr(socket)->open(generate_protocol());
@@ -243,6 +245,15 @@ eProsimaUDPSocket UDPTransportInterface::OpenAndBindUnicastOutputSocket(
         getSocketPtr(socket)->set_option(socket_base::send_buffer_size(static_cast<int32_t>(mSendBufferSize)));
     }
     getSocketPtr(socket)->set_option(ip::multicast::hops(configuration()->TTL));
+    if (nullptr != dscp)
+    {
+        set_socket_dscp(socket, *dscp);
+#ifdef __linux__
+        // Setting the TOS also changes the priority of the socket, so it has to be set afterwards
+        int priority = std::min(*dscp >> 3, 6);
+        getSocketPtr(socket)->set_option(asio::detail::socket_option::integer<SOL_SOCKET, SO_PRIORITY>(priority));
+#endif // ifdef __linux__
+    }
     getSocketPtr(socket)->bind(endpoint);
     getSocketPtr(socket)->non_blocking(configuration()->non_blocking_send);
 
@@ -277,16 +288,65 @@ bool UDPTransportInterface::OpenOutputChannel(
         }
     }
 
+    if (!open_output_sockets(sender_resource_list, configuration()->m_output_udp_socket, nullptr))
+    {
+        return false;
+    }
+
+    statistics_info_.add_entry(locator);
+    return true;
+}
+
+bool UDPTransportInterface::open_priority_output_channel(
+        SendResourceList& sender_resource_list,
+        const Locator& locator,
+        int32_t transport_priority)
+{
+    if (!IsLocatorSupported(locator))
+    {
+        return false;
+    }
+
+    auto dscp = configuration()->transport_priority_dscp.find(transport_priority);
+    if (dscp == configuration()->transport_priority_dscp.end())
+    {
+        return false;
+    }
+
+    bool already_open = false;
+    for (auto& sender_resource : sender_resource_list)
+    {
+        if (UDPSenderResource::cast(*this, sender_resource.get()))
+        {
+            already_open = true;
+            break;
+        }
+    }
+
+    // The source port of the default sockets may be fixed, so these ones take any free port
+    if (!already_open && !open_output_sockets(sender_resource_list, 0, &dscp->second))
+    {
+        return false;
+    }
+
+    statistics_info_.add_entry(locator);
+    return true;
+}
+
+bool UDPTransportInterface::open_output_sockets(
+        SendResourceList& sender_resource_list,
+        uint16_t port,
+        const uint8_t* dscp)
+{
     try
     {
-        uint16_t port = configuration()->m_output_udp_socket;
         std::vector<IPFinder::info_IP> locNames;
         get_ips(locNames);
         // If there is no whitelist, we can simply open a generic output socket
         // and gain efficiency.
         if (is_interface_whitelist_empty())
         {
-            eProsimaUDPSocket unicastSocket = OpenAndBindUnicastOutputSocket(GenerateAnyAddressEndpoint(port), port);
+            eProsimaUDPSocket unicastSocket = OpenAndBindUnicastOutputSocket(GenerateAnyAddressEndpoint(port), port, dscp);
             getSocketPtr(unicastSocket)->set_option(ip::multicast::enable_loopback(true));
 
             // Outbounding first interface with already created socket.
@@ -313,7 +373,8 @@ bool UDPTransportInterface::OpenOutputChannel(
                     try
                     {
                         eProsimaUDPSocket multicastSocket =
-                                OpenAndBindUnicastOutputSocket(generate_endpoint((*locIt).name, new_port), new_port);
+                                OpenAndBindUnicastOutputSocket(generate_endpoint((*locIt).name, new_port), new_port,
+                                dscp);
                         SetSocketOutboundInterface(multicastSocket, (*locIt).name);
 
                         sender_resource_list.emplace_back(
@@ -343,7 +404,7 @@ bool UDPTransportInterface::OpenOutputChannel(
                 try
                 {
                     eProsimaUDPSocket multicastSocket =
-                            OpenAndBindUnicastOutputSocket(generate_endpoint(localhost, new_port), new_port);
+                            OpenAndBindUnicastOutputSocket(generate_endpoint(localhost, new_port), new_port, dscp);
                     SetSocketOutboundInterface(multicastSocket, localhost);
 
                     sender_resource_list.emplace_back(
@@ -368,7 +429,7 @@ bool UDPTransportInterface::OpenOutputChannel(
                 if (is_interface_allowed(infoIP.name))
                 {
                     eProsimaUDPSocket unicastSocket =
-                            OpenAndBindUnicastOutputSocket(generate_endpoint(infoIP.name, port), port);
+                            OpenAndBindUnicastOutputSocket(generate_endpoint(infoIP.name, port), port, dscp);
                     SetSocketOutboundInterface(unicastSocket, infoIP.name);
                     if (!firstInterface)
                     {
@@ -396,7 +457,6 @@ bool UDPTransportInterface::OpenOutputChannel(
         return false;
     }
 
-    statistics_info_.add_entry(locator);
     return true;
 }
 
@@ -74,6 +74,12 @@ public:
             SendResourceList& sender_resource_list,
             const Locator&) override;
 
+    //! Opens sockets marked with the DSCP configured for the priority (see transport_priority_dscp).
+    virtual bool open_priority_output_channel(
+            SendResourceList& sender_resource_list,
+            const Locator& locator,
+            int32_t transport_priority) override;
+
     /**
      * Converts a given remote locator (that is, a locator referring to a remote
      * destination) to the main local locator whose channel can write to that
@@ -239,7 +245,24 @@ protected:
             bool is_multicast) = 0;
     eProsimaUDPSocket OpenAndBindUnicastOutputSocket(
             const asio::ip::udp::endpoint& endpoint,
-            uint16_t& port);
+            uint16_t& port,
+            const uint8_t* dscp = nullptr);
+
+    /**
+     * Opens the output sockets of the channel and adds their sender resources to the list.
+     * @param sender_resource_list List where the new sender resources are added.
+     * @param port Source port of the unicast sockets, or 0 for any free one.
+     * @param dscp DSCP to mark the sockets with, or nullptr to leave them unmarked.
+     */
+    bool open_output_sockets(
+            SendResourceList& sender_resource_list,
+            uint16_t port,
+            const uint8_t* dscp);
+
+    //! Sets the DSCP on the IP header of the datagrams sent through the socket.
+    virtual void set_socket_dscp(
+            eProsimaUDPSocket& socket,
+            uint8_t dscp) = 0;
 
     virtual void set_receive_buffer_size(
             uint32_t size) = 0;
@@ -553,6 +553,20 @@ void UDPv4Transport::SetSocketOutboundInterface(
     getSocketPtr(socket)->set_option(ip::multicast::outbound_interface(asio::ip::address_v4::from_string(sIp)));
 }
 
+void UDPv4Transport::set_socket_dscp(
+        eProsimaUDPSocket& socket,
+        uint8_t dscp)
+{
+#ifndef _WIN32
+    // The two lower bits of the TOS are used by ECN
+    getSocketPtr(socket)->set_option(asio::detail::socket_option::integer<IPPROTO_IP, IP_TOS>(dscp << 2));
+#else
+    (void)socket;
+    (void)dscp;
+    logWarning(RTPS_MSG_OUT, "DSCP marking is not supported on this platform");
+#endif // ifndef _WIN32
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
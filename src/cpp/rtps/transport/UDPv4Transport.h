@@ -156,6 +156,9 @@ protected:
     virtual void SetSocketOutboundInterface(
             eProsimaUDPSocket&,
             const std::string&) override;
+    virtual void set_socket_dscp(
+            eProsimaUDPSocket& socket,
+            uint8_t dscp) override;
 };
 
 } // namespace rtps
@@ -585,6 +585,20 @@ bool UDPv6Transport::compare_ips(
     return false;
 }
 
+void UDPv6Transport::set_socket_dscp(
+        eProsimaUDPSocket& socket,
+        uint8_t dscp)
+{
+#ifndef _WIN32
+    // The two lower bits of the traffic class are used by ECN
+    getSocketPtr(socket)->set_option(asio::detail::socket_option::integer<IPPROTO_IPV6, IPV6_TCLASS>(dscp << 2));
+#else
+    (void)socket;
+    (void)dscp;
+    logWarning(RTPS_MSG_OUT, "DSCP marking is not supported on this platform");
+#endif // ifndef _WIN32
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
@@ -152,6 +152,9 @@ protected:
     virtual void SetSocketOutboundInterface(
             eProsimaUDPSocket&,
             const std::string&) override;
+    virtual void set_socket_dscp(
+            eProsimaUDPSocket& socket,
+            uint8_t dscp) override;
 
     //! Checks if the IP address is the same without taking into account the scope of the IPv6 address
     bool compare_ips(
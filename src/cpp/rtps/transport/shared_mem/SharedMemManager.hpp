@@ -16,8 +16,15 @@
 #define _FASTDDS_SHAREDMEM_MANAGER_H_
 
 #include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
 #include <list>
+#include <memory>
+#include <mutex>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include <rtps/transport/shared_mem/SharedMemGlobal.hpp>
 
@@ -341,6 +348,129 @@ public:
         uint32_t original_validity_id_;
     };
 
+    /**
+     * Recycles the memory of the SharedMemBuffer objects, which are allocated together with the control block of
+     * their shared_ptr, so buffers are allocated and received without heap allocations.
+     * Requests not fitting in a slot, or exceeding the number of slots, are served by the heap.
+     */
+    class BufferPool
+    {
+    public:
+
+        explicit BufferPool(
+                uint32_t max_slots)
+            : slots_(new Slot[max_slots])
+            , max_slots_(max_slots)
+        {
+            free_slots_.reserve(max_slots);
+            for (uint32_t i = 0; i < max_slots; ++i)
+            {
+                free_slots_.push_back(&slots_[i]);
+            }
+        }
+
+        void* allocate(
+                size_t size)
+        {
+            if (size <= sizeof(Slot))
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!free_slots_.empty())
+                {
+                    Slot* slot = free_slots_.back();
+                    free_slots_.pop_back();
+                    return slot;
+                }
+            }
+
+            return ::operator new(size);
+        }
+
+        void deallocate(
+                void* ptr)
+        {
+            Slot* slot = static_cast<Slot*>(ptr);
+            std::less<const Slot*> less;
+            if (!less(slot, slots_.get()) && less(slot, slots_.get() + max_slots_))
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                free_slots_.push_back(slot);
+                return;
+            }
+
+            ::operator delete(ptr);
+        }
+
+    private:
+
+        //! Room for a SharedMemBuffer and the control block of its shared_ptr
+        using Slot = std::aligned_storage<sizeof(SharedMemBuffer) + 64, alignof(std::max_align_t)>::type;
+
+        std::unique_ptr<Slot[]> slots_;
+        uint32_t max_slots_;
+        std::mutex mutex_;
+        std::vector<Slot*> free_slots_;
+    };
+
+    /**
+     * Allocator for std::allocate_shared taking the memory from a BufferPool.
+     * The control block keeps a copy of the allocator, so the pool outlives the buffers allocated from it.
+     */
+    template<typename T>
+    class BufferPoolAllocator
+    {
+    public:
+
+        using value_type = T;
+
+        explicit BufferPoolAllocator(
+                const std::shared_ptr<BufferPool>& pool)
+            : pool_(pool)
+        {
+        }
+
+        template<typename U>
+        BufferPoolAllocator(
+                const BufferPoolAllocator<U>& other)
+            : pool_(other.pool_)
+        {
+        }
+
+        T* allocate(
+                size_t n)
+        {
+            return static_cast<T*>(pool_->allocate(n * sizeof(T)));
+        }
+
+        void deallocate(
+                T* ptr,
+                size_t)
+        {
+            pool_->deallocate(ptr);
+        }
+
+        template<typename U>
+        bool operator ==(
+                const BufferPoolAllocator<U>& other) const
+        {
+            return pool_ == other.pool_;
+        }
+
+        template<typename U>
+        bool operator !=(
+                const BufferPoolAllocator<U>& other) const
+        {
+            return pool_ != other.pool_;
+        }
+
+    private:
+
+        template<typename U>
+        friend class BufferPoolAllocator;
+
+        std::shared_ptr<BufferPool> pool_;
+    };
+
     /**
      * Handle a shared-memory segment
      * Allows buffer allocation / deallocation
@@ -353,9 +483,20 @@ public:
                 uint32_t size,
                 uint32_t payload_size,
                 uint32_t max_allocations,
-                const std::string& domain_name)
+                const std::string& domain_name,
+                const SharedSegmentMemoryOptions& memory_options = SharedSegmentMemoryOptions(),
+                uint32_t max_extents = 0,
+                std::chrono::milliseconds extent_idle_timeout = std::chrono::milliseconds(5000))
             : segment_id_()
             , overflows_count_(0)
+            , size_(size)
+            , payload_size_(payload_size)
+            , max_allocations_(max_allocations)
+            , domain_name_(domain_name)
+            , memory_options_(memory_options)
+            , max_extents_(max_extents)
+            , extent_idle_timeout_(extent_idle_timeout)
+            , last_alloc_time_(std::chrono::steady_clock::now())
         {
             generate_segment_id_and_name(domain_name);
 
@@ -364,7 +505,8 @@ public:
             try
             {
                 segment_ = std::unique_ptr<SharedMemSegment>(
-                    new SharedMemSegment(boost::interprocess::create_only, segment_name_.c_str(), size));
+                    new SharedMemSegment(boost::interprocess::create_only, segment_name_.c_str(),
+                    SharedMemSegment::size_for_memory_options(size, memory_options)));
             }
             catch (const std::exception& e)
             {
@@ -374,6 +516,14 @@ public:
                 throw;
             }
 
+            // Boost has already written the segment header, so only its first pages may keep the default placement.
+            // The buffer nodes are constructed below, after the options are applied.
+            if (!segment_->apply_memory_options(memory_options))
+            {
+                logWarning(RTPS_TRANSPORT_SHM, "Segment " << segment_name_
+                                                          << ": memory placement options not fully applied");
+            }
+
             free_bytes_ = payload_size;
 
             // Alloc the buffer nodes
@@ -388,10 +538,14 @@ public:
                 buffers_nodes[i].data_offset = 0;
                 free_buffers_.push_back(&buffers_nodes[i]);
             }
+
+            buffer_pool_ = std::make_shared<BufferPool>(max_allocations);
         }
 
         ~Segment()
         {
+            extents_.clear();
+
             segment_.reset();
 
             // After remove(), remote processes with the segment open will still have the memory block mapped,
@@ -422,18 +576,87 @@ public:
 
             std::lock_guard<std::mutex> lock(alloc_mutex_);
 
-            if (!recover_buffers(size))
+            Segment* target = this;
+
+            if (max_extents_ > 0)
+            {
+                target = select_extent_nts(size);
+            }
+
+            if (!target->recover_buffers(size))
             {
                 throw std::runtime_error("allocation overflow");
             }
 
+            return target->alloc_buffer_nts(size);
+        }
+
+        /**
+         * @return The memory mapped by the segment, including its current extents.
+         */
+        uint64_t mem_size()
+        {
+            std::lock_guard<std::mutex> lock(alloc_mutex_);
+
+            uint64_t size = segment_->mem_size();
+            for (auto& extent : extents_)
+            {
+                size += extent->mem_size();
+            }
+
+            return size;
+        }
+
+        /**
+         * @return The number of extents currently added to the segment.
+         */
+        size_t extents_count()
+        {
+            std::lock_guard<std::mutex> lock(alloc_mutex_);
+            return extents_.size();
+        }
+
+    private:
+
+        std::string segment_name_;
+
+        std::unique_ptr<RobustExclusiveLock> segment_name_lock_;
+
+        // Every buffer node is allocated on construction. Nodes are moved between the lists with splice,
+        // so the lists do not allocate afterwards.
+        std::list<BufferNode*> free_buffers_;
+        std::list<BufferNode*> allocated_buffers_;
+
+        std::shared_ptr<BufferPool> buffer_pool_;
+
+        std::mutex alloc_mutex_;
+        std::shared_ptr<SharedMemSegment> segment_;
+        SharedMemSegment::Id segment_id_;
+        uint64_t overflows_count_;
+
+        uint32_t free_bytes_;
+
+        // Growth configuration. Every extent is a segment of the same size than the original one
+        uint32_t size_;
+        uint32_t payload_size_;
+        uint32_t max_allocations_;
+        std::string domain_name_;
+        SharedSegmentMemoryOptions memory_options_;
+        uint32_t max_extents_;
+        std::chrono::milliseconds extent_idle_timeout_;
+        std::vector<std::unique_ptr<Segment>> extents_;
+        std::chrono::steady_clock::time_point last_alloc_time_;
+
+        std::shared_ptr<Buffer> alloc_buffer_nts(
+                uint32_t size)
+        {
             void* data = nullptr;
             BufferNode* buffer_node = nullptr;
             std::shared_ptr<SharedMemBuffer> new_buffer;
 
             try
             {
-                buffer_node = pop_free_node();
+                buffer_node = take_free_node();
 
                 data = segment_->get().allocate(size);
                 free_bytes_ -= size;
@@ -443,9 +666,9 @@ public:
 
                 auto validity_id = buffer_node->status.load(std::memory_order_relaxed).validity_id;
 
-                // TODO(Adolfo) : Dynamic allocation. Use foonathan to convert it to static allocation
-                new_buffer = std::make_shared<SharedMemBuffer>(segment_, segment_id_, buffer_node,
-                                static_cast<uint32_t>(validity_id));
+                new_buffer = std::allocate_shared<SharedMemBuffer>(
+                    BufferPoolAllocator<SharedMemBuffer>(buffer_pool_), segment_, segment_id_, buffer_node,
+                    static_cast<uint32_t>(validity_id));
 
                 if (new_buffer)
                 {
@@ -456,8 +679,7 @@ public:
                     throw std::runtime_error("alloc_buffer: out of memory");
                 }
 
-                // TODO(Adolfo) : Dynamic allocation. Use foonathan to convert it to static allocation
-                allocated_buffers_.push_back(buffer_node);
+                last_alloc_time_ = std::chrono::steady_clock::now();
             }
             catch (const std::exception&)
             {
@@ -468,7 +690,7 @@ public:
                         release_buffer(buffer_node);
                     }
 
-                    free_buffers_.push_back(buffer_node);
+                    free_buffers_.splice(free_buffers_.end(), allocated_buffers_, std::prev(allocated_buffers_.end()));
                 }
 
                 overflows_count_++;
@@ -479,27 +701,84 @@ public:
             return new_buffer;
         }
 
-        uint64_t mem_size()
+        /**
+         * Chooses the segment (this one or one of its extents) where a buffer of the given size is allocated.
+         * Buffers are only invalidated, in order to free space, when the segment cannot grow any more.
+         * @return The chosen segment.
+         */
+        Segment* select_extent_nts(
+                uint32_t size)
         {
-            return segment_->mem_size();
-        }
+            release_idle_extents_nts();
 
-    private:
+            if (recover_buffers(size, false))
+            {
+                return this;
+            }
 
-        std::string segment_name_;
+            for (auto& extent : extents_)
+            {
+                if (extent->recover_buffers(size, false))
+                {
+                    return extent.get();
+                }
+            }
 
-        std::unique_ptr<RobustExclusiveLock> segment_name_lock_;
+            if (extents_.size() < max_extents_ && size <= payload_size_)
+            {
+                try
+                {
+                    extents_.emplace_back(new Segment(size_, payload_size_, max_allocations_, domain_name_,
+                            memory_options_));
 
-        // TODO(Adolfo) : Dynamic allocations. Use foonathan to convert it to static allocation
-        std::list<BufferNode*> free_buffers_;
-        std::list<BufferNode*> allocated_buffers_;
+                    logInfo(RTPS_TRANSPORT_SHM, "Segment " << segment_id_.to_string() << " grown with extent "
+                                                           << extents_.back()->id().to_string());
 
-        std::mutex alloc_mutex_;
-        std::shared_ptr<SharedMemSegment> segment_;
-        SharedMemSegment::Id segment_id_;
-        uint64_t overflows_count_;
+                    return extents_.back().get();
+                }
+                catch (const std::exception& e)
+                {
+                    logWarning(RTPS_TRANSPORT_SHM, "Segment " << segment_id_.to_string()
+                                                              << " could not grow: " << e.what());
+                }
+            }
 
-        uint32_t free_bytes_;
+            // No room for growing, so fallback to recover the oldest buffers of the original segment
+            return this;
+        }
+
+        /**
+         * Destroys the extents that have not allocated buffers for a while and have all their buffers released.
+         */
+        void release_idle_extents_nts()
+        {
+            if (extents_.empty())
+            {
+                return;
+            }
+
+            // Extents with no buffers allocated for extent_idle_timeout_ are candidates to be destroyed
+            auto now = std::chrono::steady_clock::now();
+            auto it = extents_.begin();
+            while (it != extents_.end())
+            {
+                if (now - (*it)->last_alloc_time_ >= extent_idle_timeout_)
+                {
+                    (*it)->recover_buffers(0, false);
+
+                    if ((*it)->allocated_buffers_.empty())
+                    {
+                        logInfo(RTPS_TRANSPORT_SHM, "Segment " << segment_id_.to_string() << " shrunk, extent "
+                                                               << (*it)->id().to_string() << " released");
+
+                        it = extents_.erase(it);
+                        continue;
+                    }
+                }
+
+                ++it;
+            }
+        }
 
         void generate_segment_id_and_name(
                 const std::string& domain_name)
@@ -531,16 +810,31 @@ public:
             }
         }
 
-        inline BufferNode* pop_free_node()
+        /**
+         * Moves the last free buffer node to the end of the allocated ones.
+         * @return The buffer node moved.
+         */
+        inline BufferNode* take_free_node()
         {
             if (free_buffers_.empty())
             {
                 throw std::runtime_error("BufferNodes overflow");
             }
 
-            auto node = free_buffers_.back();
-            free_buffers_.pop_back();
-            return node;
+            allocated_buffers_.splice(allocated_buffers_.end(), free_buffers_, std::prev(free_buffers_.end()));
+            return allocated_buffers_.back();
+        }
+
+        /**
+         * Moves an allocated buffer node to the end of the free ones.
+         * @return Iterator to the allocated buffer node following the one moved.
+         */
+        inline std::list<BufferNode*>::iterator free_node(
+                std::list<BufferNode*>::iterator it)
+        {
+            auto next = std::next(it);
+            free_buffers_.splice(free_buffers_.end(), allocated_buffers_, it);
+            return next;
         }
 
         void release_buffer(
@@ -555,16 +849,20 @@ public:
         /**
          * Recover unreferenced buffers and, in case of overflow, also recovers the oldest buffers not being
          * processed by any listener (until enough free bytes is gathered to solve the overflow).
+         * @param required_data_size Free bytes needed.
+         * @param allow_invalidation When false, only unreferenced buffers are recovered.
          * @return true if at least required_data_size bytes are free after the recovery, false otherwise.
+         * When allow_invalidation is false, a free buffer node is also required.
          */
         bool recover_buffers(
-                uint32_t required_data_size)
+                uint32_t required_data_size,
+                bool allow_invalidation = true)
         {
             auto it = allocated_buffers_.begin();
             while (it != allocated_buffers_.end())
             {
                 // There is enough space to allocate the buffer
-                if (free_bytes_ >= required_data_size)
+                if (free_bytes_ >= required_data_size || !allow_invalidation)
                 {
                     if ((*it)->is_not_referenced())
                     {
@@ -572,8 +870,7 @@ public:
 
                         release_buffer(*it);
 
-                        free_buffers_.push_back(*it);
-                        it = allocated_buffers_.erase(it);
+                        it = free_node(it);
                     }
                     else
                     {
@@ -587,8 +884,7 @@ public:
                     {
                         release_buffer(*it);
 
-                        free_buffers_.push_back(*it);
-                        it = allocated_buffers_.erase(it);
+                        it = free_node(it);
                     }
                     else
                     {
@@ -597,6 +893,11 @@ public:
                 }
             }
 
+            if (!allow_invalidation)
+            {
+                return free_bytes_ >= required_data_size && !free_buffers_.empty();
+            }
+
             // We may have enough memory but no free buffers
             it = allocated_buffers_.begin();
             while (free_buffers_.empty() && it != allocated_buffers_.end())
@@ -606,8 +907,7 @@ public:
                 {
                     release_buffer(*it);
 
-                    free_buffers_.push_back(*it);
-                    it = allocated_buffers_.erase(it);
+                    it = free_node(it);
                 }
                 else
                 {
@@ -636,6 +936,7 @@ public:
             : global_port_(port)
             , shared_mem_manager_(shared_mem_manager)
             , is_closed_(false)
+            , buffer_pool_(std::make_shared<BufferPool>(port->max_buffer_descriptors()))
         {
             global_listener_ = global_port_->create_listener(&listener_index_);
         }
@@ -664,6 +965,7 @@ public:
             other.global_port_.reset();
             shared_mem_manager_ = other.shared_mem_manager_;
             is_closed_.exchange(other.is_closed_);
+            buffer_pool_ = std::move(other.buffer_pool_);
 
             return *this;
         }
@@ -713,10 +1015,9 @@ public:
                             static_cast<BufferNode*>(segment->get_address_from_offset(buffer_descriptor.
                                     buffer_node_offset));
 
-                    // TODO(Adolfo) : Dynamic allocation. Use foonathan to convert it to static allocation
-                    buffer_ref = std::make_shared<SharedMemBuffer>(segment, buffer_descriptor.source_segment_id,
-                                    buffer_node,
-                                    buffer_descriptor.validity_id);
+                    buffer_ref = std::allocate_shared<SharedMemBuffer>(
+                        BufferPoolAllocator<SharedMemBuffer>(buffer_pool_), segment,
+                        buffer_descriptor.source_segment_id, buffer_node, buffer_descriptor.validity_id);
 
                     // If the cell has been read by all listeners
                     global_port_->pop(*global_listener_, was_cell_freed);
@@ -799,6 +1100,8 @@ public:
 
         std::atomic<bool> is_closed_;
 
+        std::shared_ptr<BufferPool> buffer_pool_;
+
     }; // Listener
 
     /**
@@ -933,14 +1236,27 @@ public:
      * Creates a shared-memory segment
      * @param size size of the segment
      * @param max_buffers maximum, at a time, allocated buffers
+     * @param memory_options placement options for the pages of the segment
+     * @param max_size when greater than size, the segment grows on demand, adding extents of the same size,
+     * up to this total size. Idle extents are released afterwards.
+     * @param extent_idle_timeout time an extent must go without allocations before it is released
      * @return A shared_ptr to the segment
      */
     std::shared_ptr<Segment> create_segment(
             uint32_t size,
-            uint32_t max_allocations)
+            uint32_t max_allocations,
+            const SharedSegmentMemoryOptions& memory_options = SharedSegmentMemoryOptions(),
+            uint32_t max_size = 0,
+            std::chrono::milliseconds extent_idle_timeout = std::chrono::milliseconds(5000))
     {
+        uint32_t max_extents = 0;
+        if (size > 0 && max_size > size)
+        {
+            max_extents = (max_size - size) / size;
+        }
+
         return std::make_shared<Segment>(size + segment_allocation_extra_size(max_allocations), size, max_allocations,
-                       global_segment_.domain_name());
+                       global_segment_.domain_name(), memory_options, max_extents, extent_idle_timeout);
     }
 
     /**
@@ -253,8 +253,15 @@ bool SharedMemTransport::init()
     try
     {
         shared_mem_manager_ = SharedMemManager::create(SHM_MANAGER_DOMAIN);
+
+        SharedSegmentMemoryOptions memory_options;
+        memory_options.huge_pages = configuration_.huge_pages();
+        memory_options.prefault = configuration_.prefault_segment();
+        memory_options.numa_node = configuration_.numa_node();
+
         shared_mem_segment_ = shared_mem_manager_->create_segment(configuration_.segment_size(),
-                        configuration_.port_queue_capacity());
+                        configuration_.port_queue_capacity(), memory_options, configuration_.max_segment_size(),
+                        std::chrono::milliseconds(configuration_.extent_idle_timeout_ms()));
 
         // Memset the whole segment to zero in order to force physical map of the buffer
         auto buffer = shared_mem_segment_->alloc_buffer(configuration_.segment_size(),
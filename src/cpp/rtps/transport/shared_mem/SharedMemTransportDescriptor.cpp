@@ -24,6 +24,10 @@ namespace rtps {
 static constexpr uint32_t shm_default_segment_size = 0;
 static constexpr uint32_t shm_default_port_queue_capacity = 512;
 static constexpr uint32_t shm_default_healthy_check_timeout_ms = 1000;
+static constexpr uint32_t shm_default_extent_idle_timeout_ms = 5000;
+
+constexpr int32_t SharedMemTransportDescriptor::NUMA_NODE_NONE;
+constexpr int32_t SharedMemTransportDescriptor::NUMA_NODE_LOCAL;
 
 } // rtps
 } // fastdds
@@ -35,9 +39,14 @@ static constexpr uint32_t shm_default_healthy_check_timeout_ms = 1000;
 SharedMemTransportDescriptor::SharedMemTransportDescriptor()
     : TransportDescriptorInterface(shm_default_segment_size, s_maximumInitialPeersRange)
     , segment_size_(shm_default_segment_size)
+    , max_segment_size_(0)
+    , extent_idle_timeout_ms_(shm_default_extent_idle_timeout_ms)
     , port_queue_capacity_(shm_default_port_queue_capacity)
     , healthy_check_timeout_ms_(shm_default_healthy_check_timeout_ms)
     , rtps_dump_file_("")
+    , huge_pages_(false)
+    , prefault_segment_(false)
+    , numa_node_(NUMA_NODE_NONE)
 {
     maxMessageSize = s_maximumMessageSize;
 }
@@ -46,9 +55,14 @@ bool SharedMemTransportDescriptor::operator ==(
         const SharedMemTransportDescriptor& t) const
 {
     return (this->segment_size_ == t.segment_size() &&
+           this->max_segment_size_ == t.max_segment_size() &&
+           this->extent_idle_timeout_ms_ == t.extent_idle_timeout_ms() &&
            this->port_queue_capacity_ == t.port_queue_capacity() &&
            this->healthy_check_timeout_ms_ == t.healthy_check_timeout_ms() &&
            this->rtps_dump_file_ == t.rtps_dump_file() &&
+           this->huge_pages_ == t.huge_pages() &&
+           this->prefault_segment_ == t.prefault_segment() &&
+           this->numa_node_ == t.numa_node() &&
            TransportDescriptorInterface::operator ==(t));
 }
 
@@ -25,6 +25,8 @@
 #include <rtps/DataSharing/DataSharingNotifier.hpp>
 #include <rtps/DataSharing/WriterPool.hpp>
 
+#include <rtps/common/PayloadCompression.hpp>
+
 #include <rtps/participant/RTPSParticipantImpl.h>
 
 #include <fastdds/dds/log/Log.hpp>
@@ -38,7 +40,7 @@
 #include <statistics/rtps/StatisticsBase.hpp>
 #include <statistics/rtps/messages/RTPSStatisticsMessages.hpp>
 
-#include "../flowcontrol/FlowController.hpp"
+#include "../flowcontrol/FlowControllerSampleBatch.hpp"
 
 namespace eprosima {
 namespace fastrtps {
@@ -129,6 +131,9 @@ void RTPSWriter::init(
     mp_history->mp_writer = this;
     mp_history->mp_mutex = &mp_mutex;
 
+    transport_priority_ = att.transport_priority;
+    mp_RTPSParticipant->register_transport_priority(transport_priority_);
+
     flow_controller_->register_writer(this);
 
     logInfo(RTPS_WRITER, "RTPSWriter created");
@@ -164,6 +169,25 @@ void RTPSWriter::deinit()
     flow_controller_->unregister_writer(this);
 }
 
+void RTPSWriter::begin_sample_batch(
+        fastdds::rtps::FlowControllerSampleBatch& batch)
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    batch.begin(flow_controller_);
+    flow_controller_ = &batch;
+}
+
+bool RTPSWriter::end_sample_batch(
+        fastdds::rtps::FlowControllerSampleBatch& batch,
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    assert(&batch == flow_controller_);
+    bool ret = batch.flush_new_samples(this, max_blocking_time);
+    flow_controller_ = batch.end();
+    return ret;
+}
+
 CacheChange_t* RTPSWriter::new_change(
         const std::function<uint32_t()>& dataCdrSerializedSize,
         ChangeKind_t changeKind,
@@ -236,6 +260,11 @@ bool RTPSWriter::release_change(
 
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
 
+    if (!uncompressed_payloads_.empty())
+    {
+        release_uncompressed_payload_nts(change->sequenceNumber);
+    }
+
     IPayloadPool* pool = change->payload_owner();
     if (pool)
     {
@@ -270,6 +299,21 @@ SequenceNumber_t RTPSWriter::get_seq_num_max()
     }
 }
 
+void RTPSWriter::get_memory_usage(
+        EndpointMemoryUsage& usage) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+
+    usage = EndpointMemoryUsage();
+    usage.guid = m_guid;
+    change_pool_->get_memory_usage(usage.history);
+    for (auto it = mp_history->changesBegin(); it != mp_history->changesEnd(); ++it)
+    {
+        usage.payloads.reserved += (*it)->serializedPayload.max_size;
+        usage.payloads.in_use += (*it)->serializedPayload.length;
+    }
+}
+
 uint32_t RTPSWriter::getTypeMaxSerialized()
 {
     return mp_history->getTypeMaxSerialized();
@@ -392,6 +436,81 @@ const Duration_t& RTPSWriter::get_liveliness_announcement_period() const
     return liveliness_announcement_period_;
 }
 
+void RTPSWriter::store_uncompressed_payload_nts(
+        const SerializedPayload_t& payload,
+        bool keep)
+{
+    // The history assigns the next sequence number to the next change. Payloads kept with it, or a later one,
+    // belong to changes that could not be added.
+    SequenceNumber_t sequence_number = mp_history->next_sequence_number();
+    UncompressedPayload* free_slot = nullptr;
+    for (auto& slot : uncompressed_payloads_)
+    {
+        if (slot->sequence_number >= sequence_number)
+        {
+            slot->sequence_number = SequenceNumber_t::unknown();
+        }
+
+        if (SequenceNumber_t::unknown() == slot->sequence_number && nullptr == free_slot)
+        {
+            free_slot = slot.get();
+        }
+    }
+
+    if (!keep)
+    {
+        return;
+    }
+
+    if (nullptr == free_slot)
+    {
+        uncompressed_payloads_.emplace_back(new UncompressedPayload());
+        free_slot = uncompressed_payloads_.back().get();
+    }
+
+    free_slot->payload.copy(&payload, false);
+    free_slot->sequence_number = sequence_number;
+}
+
+bool RTPSWriter::get_uncompressed_change_nts(
+        const CacheChange_t& change,
+        CacheChange_t& uncompressed) const
+{
+    if (!fastdds::rtps::PayloadCompression::is_compressed(change.serializedPayload))
+    {
+        return false;
+    }
+
+    for (const auto& slot : uncompressed_payloads_)
+    {
+        if (slot->sequence_number == change.sequenceNumber)
+        {
+            uncompressed.copy_not_memcpy(&change);
+            uncompressed.serializedPayload.data = slot->payload.data;
+            uncompressed.serializedPayload.length = slot->payload.length;
+            uncompressed.serializedPayload.max_size = slot->payload.length;
+            uncompressed.serializedPayload.encapsulation = slot->payload.encapsulation;
+            uncompressed.setFragmentSize(change.getFragmentSize(), false);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void RTPSWriter::release_uncompressed_payload_nts(
+        const SequenceNumber_t& sequence_number)
+{
+    for (auto& slot : uncompressed_payloads_)
+    {
+        if (slot->sequence_number == sequence_number)
+        {
+            slot->sequence_number = SequenceNumber_t::unknown();
+            break;
+        }
+    }
+}
+
 bool RTPSWriter::is_datasharing_compatible() const
 {
     return (m_att.data_sharing_configuration().kind() != OFF);
@@ -429,6 +548,15 @@ bool RTPSWriter::is_pool_initialized() const
     return true;
 }
 
+void RTPSWriter::set_transport_priority(
+        int32_t transport_priority)
+{
+    mp_RTPSParticipant->register_transport_priority(transport_priority);
+
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    transport_priority_ = transport_priority;
+}
+
 bool RTPSWriter::send_nts(
         CDRMessage_t* message,
         const LocatorSelectorSender& locator_selector,
@@ -438,7 +566,7 @@ bool RTPSWriter::send_nts(
 
     return locator_selector.locator_selector.selected_size() == 0 ||
            participant->sendSync(message, m_guid, locator_selector.locator_selector.begin(),
-                   locator_selector.locator_selector.end(), max_blocking_time_point);
+                   locator_selector.locator_selector.end(), max_blocking_time_point, transport_priority_);
 }
 
 #ifdef FASTDDS_STATISTICS
@@ -156,6 +156,8 @@ void ReaderLocator::stop()
     guid_prefix_as_vector_.at(0) = c_GuidPrefix_Unknown;
     expects_inline_qos_ = false;
     is_local_reader_ = false;
+    time_based_filter_.stop();
+    accepted_compression_ = 0;
     local_reader_ = nullptr;
 }
 
@@ -169,13 +171,13 @@ bool ReaderLocator::send(
         {
             return participant_owner_->sendSync(message, owner_->getGuid(),
                            Locators(locator_info_.unicast.begin()), Locators(locator_info_.unicast.end()),
-                           max_blocking_time_point);
+                           max_blocking_time_point, owner_->get_transport_priority());
         }
         else
         {
             return participant_owner_->sendSync(message, owner_->getGuid(),
                            Locators(locator_info_.multicast.begin()), Locators(locator_info_.multicast.end()),
-                           max_blocking_time_point);
+                           max_blocking_time_point, owner_->get_transport_priority());
         }
     }
 
@@ -30,6 +30,7 @@
 #include <rtps/history/HistoryAttributesExtension.hpp>
 
 #include "rtps/messages/RTPSGapBuilder.hpp"
+#include <rtps/common/PayloadCompression.hpp>
 #include <rtps/DataSharing/DataSharingNotifier.hpp>
 
 #include <mutex>
@@ -91,6 +92,20 @@ bool ReaderProxy::rtps_is_relevant(
     return true;
 }
 
+bool ReaderProxy::time_based_filter_is_relevant(
+        const CacheChange_t& change)
+{
+    // Datasharing readers take the samples directly from the writer's pool
+    if (!is_datasharing_reader() && !locator_info_.time_based_filter().is_relevant(change))
+    {
+        logInfo(RTPS_READER_PROXY,
+                "Change " << change.sequenceNumber << " filtered by time for reader " << guid());
+        return false;
+    }
+
+    return true;
+}
+
 ReaderProxy::~ReaderProxy()
 {
     if (nack_supression_event_)
@@ -116,6 +131,9 @@ void ReaderProxy::start(
         reader_attributes.remote_locators().multicast,
         reader_attributes.m_expectsInlineQos,
         is_datasharing);
+    locator_info_.time_based_filter().start(reader_attributes.m_qos.m_timeBasedFilter.minimum_separation);
+    locator_info_.accepted_compression(
+        fastdds::rtps::PayloadCompression::accepted_mask(reader_attributes.accepted_compression()));
 
     is_active_ = true;
     durability_kind_ = reader_attributes.m_qos.m_durability.durabilityKind();
@@ -154,6 +172,9 @@ bool ReaderProxy::update(
         reader_attributes.remote_locators().unicast,
         reader_attributes.remote_locators().multicast,
         reader_attributes.m_expectsInlineQos);
+    locator_info_.time_based_filter().update(reader_attributes.m_qos.m_timeBasedFilter.minimum_separation);
+    locator_info_.accepted_compression(
+        fastdds::rtps::PayloadCompression::accepted_mask(reader_attributes.accepted_compression()));
 
     return true;
 }
@@ -168,6 +189,8 @@ void ReaderProxy::stop()
     last_acknack_count_ = 0;
     last_nackfrag_count_ = 0;
     changes_low_mark_ = SequenceNumber_t();
+    first_pending_request_ = std::chrono::steady_clock::time_point();
+    round_trip_time_.reset();
 }
 
 void ReaderProxy::disable_timers()
@@ -414,6 +437,10 @@ bool ReaderProxy::requested_changes_set(
     if (isSomeoneWasSetRequested)
     {
         logInfo(RTPS_READER_PROXY, "Requested Changes: " << seq_num_set);
+        if (std::chrono::steady_clock::time_point() == first_pending_request_)
+        {
+            first_pending_request_ = std::chrono::steady_clock::now();
+        }
     }
 
     return isSomeoneWasSetRequested;
@@ -502,9 +529,40 @@ bool ReaderProxy::perform_nack_supression()
 uint32_t ReaderProxy::perform_acknack_response(
         const std::function<void(ChangeForReader_t& change)>& func)
 {
+    first_pending_request_ = std::chrono::steady_clock::time_point();
     return convert_status_on_all_changes(REQUESTED, UNSENT, func);
 }
 
+bool ReaderProxy::requested_to_unsent(
+        const SequenceNumber_t& seq_num)
+{
+    ChangeIterator it = find_change(seq_num, true);
+    if (changes_for_reader_.end() != it && REQUESTED == it->getStatus())
+    {
+        it->setStatus(UNSENT);
+        return true;
+    }
+
+    return false;
+}
+
+bool ReaderProxy::unacknowledged_to_underway(
+        const SequenceNumber_t& seq_num)
+{
+    ChangeIterator it = find_change(seq_num, true);
+    if (changes_for_reader_.end() != it && UNACKNOWLEDGED == it->getStatus())
+    {
+        it->setStatus(UNDERWAY);
+        if (timers_enabled_.load())
+        {
+            nack_supression_event_->restart_timer();
+        }
+        return true;
+    }
+
+    return false;
+}
+
 uint32_t ReaderProxy::convert_status_on_all_changes(
         ChangeForReaderStatus_t previous,
         ChangeForReaderStatus_t next,
@@ -590,6 +648,10 @@ bool ReaderProxy::requested_fragment_set(
     if (changeIter->getStatus() != UNSENT)
     {
         changeIter->setStatus(REQUESTED);
+        if (std::chrono::steady_clock::time_point() == first_pending_request_)
+        {
+            first_pending_request_ = std::chrono::steady_clock::now();
+        }
     }
 
     return true;
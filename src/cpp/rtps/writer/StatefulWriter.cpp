@@ -45,14 +45,18 @@
 #include <fastdds/rtps/builtin/liveliness/WLP.h>
 
 #include <rtps/RTPSDomainImpl.hpp>
+#include <rtps/common/AdaptiveTiming.hpp>
 #include <rtps/history/CacheChangePool.h>
+#include <rtps/messages/MessageAggregator.hpp>
 #include <rtps/messages/RTPSGapBuilder.hpp>
 
 #include "../builtin/discovery/database/DiscoveryDataBase.hpp"
 
 #include "../flowcontrol/FlowController.hpp"
 
+#include <algorithm>
 #include <mutex>
+#include <sstream>
 #include <vector>
 #include <stdexcept>
 
@@ -290,6 +294,47 @@ void StatefulWriter::init(
         },
         TimeConv::Time_t2MilliSecondsDouble(m_times.nackResponseDelay));
 
+    // Repair coalescing. The value is the time, in milliseconds, the requests of readers only reachable through
+    // unicast are held back.
+    auto repair_window = PropertyPolicyHelper::find_property(att.endpoint.properties,
+                    "fastdds.repair_coalescing_window");
+    if (nullptr != repair_window)
+    {
+        uint32_t window_ms = 0;
+        std::stringstream ss(*repair_window);
+        if (ss >> window_ms)
+        {
+            coalesce_repairs_ = true;
+            repair_coalescing_window_ = std::chrono::milliseconds(window_ms);
+
+            if (0 < window_ms)
+            {
+                repair_window_event_ = new TimedEvent(
+                    pimpl->getEventResource(),
+                    [&]() -> bool
+                    {
+                        perform_nack_response();
+                        return false;
+                    },
+                    window_ms);
+            }
+        }
+        else
+        {
+            logError(RTPS_WRITER, "Wrong value '" << *repair_window
+                                                  << "' for property fastdds.repair_coalescing_window");
+        }
+    }
+
+    // Adaptive timing. Round trip times are measured with the periodic heartbeats, which are not answered by
+    // readers with positive ACKs disabled.
+    get_adaptive_timing_settings(att.endpoint.properties, adaptive_timing_);
+    if (adaptive_timing_.enabled && disable_positive_acks_)
+    {
+        logWarning(RTPS_WRITER, "Adaptive timing is not available when positive ACKs are disabled");
+        adaptive_timing_.enabled = false;
+    }
+
     if (disable_positive_acks_)
     {
         ack_event_ = new TimedEvent(
@@ -326,6 +371,12 @@ StatefulWriter::~StatefulWriter()
         nack_response_event_ = nullptr;
     }
 
+    if (repair_window_event_ != nullptr)
+    {
+        delete(repair_window_event_);
+        repair_window_event_ = nullptr;
+    }
+
     // Stop all active proxies and pass them to the pool
     {
         std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
@@ -408,7 +459,10 @@ void StatefulWriter::unsent_change_added_to_history(
                 [this, &should_be_sent, &change, &max_blocking_time](ReaderProxy* reader)
                 {
                     ChangeForReader_t changeForReader(change);
-                    bool is_revelant = reader->rtps_is_relevant(change);
+                    // The time based filter keeps state, so it is evaluated once per reader and change
+                    changeForReader.setRelevance(reader->rtps_is_relevant(change) &&
+                            reader->time_based_filter_is_relevant(*change));
+                    bool is_revelant = changeForReader.isRelevant();
 
                     if (m_pushMode || !reader->is_reliable() || reader->is_local_reader())
                     {
@@ -466,6 +520,16 @@ bool StatefulWriter::intraprocess_delivery(
         {
             change->write_params.sample_identity(change->write_params.related_sample_identity());
         }
+
+        // The readers of this process get the original payload, when it was kept before compressing it
+        CacheChange_t uncompressed;
+        if (get_uncompressed_change_nts(*change, uncompressed))
+        {
+            bool ret = reader->processDataMsg(&uncompressed);
+            uncompressed.serializedPayload.data = nullptr;
+            return ret;
+        }
+
         return reader->processDataMsg(change);
     }
     return false;
@@ -713,6 +777,13 @@ DeliveryRetCode StatefulWriter::deliver_sample_to_network(
         for (auto remote_reader = first_relevant_reader; remote_reader != matched_remote_readers_.end();
                 ++remote_reader)
         {
+            if (coalesce_repairs_)
+            {
+                // Readers which requested the change are served by this delivery, even if their NACK response
+                // has not been performed yet.
+                (*remote_reader)->requested_to_unsent(change->sequenceNumber);
+            }
+
             SequenceNumber_t gap_seq;
             FragmentNumber_t next_unsent_frag = 0;
             if ((*remote_reader)->change_is_unsent(change->sequenceNumber, next_unsent_frag, gap_seq,
@@ -722,7 +793,11 @@ DeliveryRetCode StatefulWriter::deliver_sample_to_network(
                 if (min_unsent_fragment > next_unsent_frag)
                 {
                     locator_selector.locator_selector.reset(false);
-                    first_relevant_reader = remote_reader;
+                    // Readers selected before are not part of this delivery any more
+                    for (; first_relevant_reader != remote_reader; ++first_relevant_reader)
+                    {
+                        (*first_relevant_reader)->active(false);
+                    }
                     min_unsent_fragment = next_unsent_frag;
                 }
 
@@ -833,6 +908,11 @@ DeliveryRetCode StatefulWriter::deliver_sample_to_network(
                             }
                         }
 
+                        if (coalesce_repairs_ && DeliveryRetCode::DELIVERED == ret_code)
+                        {
+                            mark_readers_covered_by_multicast_nts(change->sequenceNumber);
+                        }
+
                         send_heartbeat_piggyback_nts_(nullptr, group, locator_selector, last_processed);
                     }
                 }
@@ -1081,10 +1161,13 @@ bool StatefulWriter::matched_reader_add(
                 {
                     for (History::iterator cit = mp_history->changesBegin(); cit != mp_history->changesEnd(); ++cit)
                     {
+                        ChangeForReader_t changeForReader(*cit);
+                        changeForReader.setRelevance(rp->rtps_is_relevant(*cit) &&
+                                rp->time_based_filter_is_relevant(**cit));
+
                         // Holes are managed when deliver_sample(), sending GAP messages.
-                        if (rp->rtps_is_relevant(*cit))
+                        if (changeForReader.isRelevant())
                         {
-                            ChangeForReader_t changeForReader(*cit);
 
                             // If it is local, maintain in UNSENT status and add to flow controller.
                             if (rp->is_local_reader())
@@ -1233,6 +1316,50 @@ bool StatefulWriter::matched_reader_is_matched(
                    );
 }
 
+void StatefulWriter::keep_uncompressed_payload(
+        const SerializedPayload_t& payload)
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    store_uncompressed_payload_nts(payload, !matched_local_readers_.empty());
+}
+
+bool StatefulWriter::can_send_compressed(
+        uint8_t compression_kind) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    if (matched_remote_readers_.empty())
+    {
+        return false;
+    }
+
+    return !for_matched_readers(matched_local_readers_, matched_datasharing_readers_, matched_remote_readers_,
+                   [compression_kind](const ReaderProxy* reader)
+                   {
+                       return !reader->accepts_compression(compression_kind);
+                   }
+                   );
+}
+
+void StatefulWriter::get_memory_usage(
+        EndpointMemoryUsage& usage) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+
+    RTPSWriter::get_memory_usage(usage);
+    for_each_reader_proxy([&usage](const ReaderProxy* reader)
+            {
+                reader->get_memory_usage(usage.matched_proxies);
+            });
+
+    // Proxies kept for future matches are only reserved
+    for (const ReaderProxy* reader : matched_readers_pool_)
+    {
+        MemoryUsage pooled;
+        reader->get_memory_usage(pooled);
+        usage.matched_proxies.reserved += pooled.reserved;
+    }
+}
+
 bool StatefulWriter::matched_reader_lookup(
         GUID_t& readerGuid,
         ReaderProxy** RP)
@@ -1454,6 +1581,7 @@ bool StatefulWriter::try_remove_change(
 
     {
         std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+        flow_controller_->flush_new_samples(this, max_blocking_time_point);
         min_low_mark = next_all_acked_notify_sequence_ - 1;
     }
 
@@ -1491,6 +1619,7 @@ bool StatefulWriter::wait_for_acknowledgement(
         const std::chrono::steady_clock::time_point& max_blocking_time_point,
         std::unique_lock<RecursiveTimedMutex>& lock)
 {
+    flow_controller_->flush_new_samples(this, max_blocking_time_point);
     return may_remove_change_cond_.wait_until(lock, max_blocking_time_point,
                    [this, &seq]()
                    {
@@ -1579,6 +1708,9 @@ bool StatefulWriter::send_periodic_heartbeat(
             {
                 try
                 {
+                    // Periodic heartbeats may wait for the next tick of the participant's message aggregator,
+                    // unless they are used to measure the round trip time
+                    MessageAggregator::CollectScope aggregate(!adaptive_timing_.enabled);
                     //TODO if separating, here sends periodic for all readers, instead of ones needed it.
                     send_heartbeat_to_all_readers();
                 }
@@ -1703,6 +1835,22 @@ void StatefulWriter::send_heartbeat_nts_(
 
     incrementHBCount();
     message_group.add_heartbeat(firstSeq, lastSeq, m_heartbeatCount, final, liveliness);
+
+    if (adaptive_timing_.enabled && !final)
+    {
+        // Each reader answers the heartbeat with an ACKNACK. The readers reached are only known when they are
+        // all of them, so other heartbeats are not measured, but still recorded on all the readers so their
+        // answers are not taken for the answer to a measured one.
+        bool to_all_readers = number_of_readers >= matched_remote_readers_.size();
+        auto now = std::chrono::steady_clock::now();
+        for (ReaderProxy* reader : matched_remote_readers_)
+        {
+            if (reader->is_remote_and_reliable())
+            {
+                reader->round_trip_time().request_sent(now, to_all_readers);
+            }
+        }
+    }
     // Update calculate of heartbeat piggyback.
     currentUsageSendBufferSize_ = static_cast<int32_t>(sendBufferSize_);
 
@@ -1750,8 +1898,19 @@ void StatefulWriter::perform_nack_response()
     std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
 
     uint32_t changes_to_resend = 0;
+    bool requests_held_back = false;
+    auto now = std::chrono::steady_clock::now();
     for (ReaderProxy* reader : matched_remote_readers_)
     {
+        // Repairs only reachable through unicast wait for other readers requesting the same changes,
+        // which will be served by the same delivery.
+        if (nullptr != repair_window_event_ && reader->locator_selector_entry()->multicast.empty() &&
+                now < reader->first_pending_request() + repair_coalescing_window_)
+        {
+            requests_held_back = true;
+            continue;
+        }
+
         changes_to_resend += reader->perform_acknack_response([&](ChangeForReader_t& change)
                         {
                             // This labmda is called if the ChangeForReader_t pass from REQUESTED to UNSENT.
@@ -1761,12 +1920,87 @@ void StatefulWriter::perform_nack_response()
                         );
     }
 
+    if (requests_held_back)
+    {
+        repair_window_event_->restart_timer();
+    }
+
     lock.unlock();
 
     // Notify the statistics module
     on_resent_data(changes_to_resend);
 }
 
+void StatefulWriter::mark_readers_covered_by_multicast_nts(
+        const SequenceNumber_t& seq_num)
+{
+    repair_multicast_locators_.clear();
+    for (ReaderProxy* reader : matched_remote_readers_)
+    {
+        if (reader->active())
+        {
+            LocatorSelectorEntry* entry = reader->locator_selector_entry();
+            for (size_t index : entry->state.multicast)
+            {
+                repair_multicast_locators_.push_back(entry->multicast[index]);
+            }
+        }
+    }
+
+    if (repair_multicast_locators_.empty())
+    {
+        return;
+    }
+
+    for (ReaderProxy* reader : matched_remote_readers_)
+    {
+        if (!reader->active() && reader->is_remote_and_reliable())
+        {
+            for (const Locator_t& locator : reader->locator_selector_entry()->multicast)
+            {
+                if (repair_multicast_locators_.end() !=
+                        std::find(repair_multicast_locators_.begin(), repair_multicast_locators_.end(), locator))
+                {
+                    reader->unacknowledged_to_underway(seq_num);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void StatefulWriter::adapt_timing_to_reader_nts(
+        ReaderProxy* reader)
+{
+    const RoundTripTimeEstimator& estimation = reader->round_trip_time();
+
+    // A NACK received less than a round trip after sending the repair was sent before the repair arrived.
+    double nack_supression_ms = adaptive_timing_.bounded_millisec(estimation.smoothed_rtt());
+    reader->update_nack_supression_interval(Duration_t(nack_supression_ms * 1e-3));
+
+    // Heartbeats and NACK responses are shared by all the readers, so they follow the slowest one.
+    // Lossy links get heartbeats more often, so repairs start sooner.
+    std::chrono::duration<double, std::milli> heartbeat_period(0);
+    std::chrono::duration<double, std::milli> nack_response_delay(0);
+    for (ReaderProxy* remote_reader : matched_remote_readers_)
+    {
+        const RoundTripTimeEstimator& reader_estimation = remote_reader->round_trip_time();
+        if (reader_estimation.has_estimation())
+        {
+            std::chrono::duration<double, std::milli> reader_period = reader_estimation.timeout() * 2;
+            reader_period *= 1.0 - reader_estimation.loss_ratio() / 2;
+            heartbeat_period = std::max(heartbeat_period, reader_period);
+            nack_response_delay = std::max<std::chrono::duration<double, std::milli>>(nack_response_delay,
+                            reader_estimation.rtt_variation());
+        }
+    }
+
+    periodic_hb_event_->update_interval_millisec(adaptive_timing_.bounded_millisec(heartbeat_period));
+    nack_response_event_->update_interval_millisec(adaptive_timing_.bounded_millisec(nack_response_delay));
+
+    on_round_trip_time(reader->guid(), estimation.smoothed_rtt());
+}
+
 void StatefulWriter::perform_nack_supression(
         const GUID_t& reader_guid)
 {
@@ -1809,6 +2043,13 @@ bool StatefulWriter::process_acknack(
                         {
                             if (remote_reader->check_and_set_acknack_count(ack_count))
                             {
+                                if (adaptive_timing_.enabled &&
+                                        remote_reader->round_trip_time().answer_received(
+                                            std::chrono::steady_clock::now()))
+                                {
+                                    adapt_timing_to_reader_nts(remote_reader);
+                                }
+
                                 // Sequence numbers before Base are set as Acknowledged.
                                 remote_reader->acked_changes_set(sn_set.base());
                                 if (sn_set.base() > SequenceNumber_t(0, 0))
@@ -1995,6 +2236,11 @@ DeliveryRetCode StatefulWriter::deliver_sample_nts(
         deliver_sample_to_intraprocesses(cache_change);
     }
 
+    if (!uncompressed_payloads_.empty())
+    {
+        release_uncompressed_payload_nts(cache_change->sequenceNumber);
+    }
+
     // Process datasharing then
     if (there_are_datasharing_readers_)
     {
@@ -22,6 +22,7 @@
 #include <fastdds/rtps/history/WriterHistory.h>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <rtps/history/HistoryAttributesExtension.hpp>
+#include <rtps/common/PayloadCompression.hpp>
 #include <fastdds/rtps/builtin/BuiltinProtocols.h>
 #include <fastdds/rtps/builtin/liveliness/WLP.h>
 
@@ -348,6 +349,16 @@ bool StatelessWriter::intraprocess_delivery(
         {
             change->write_params.sample_identity(change->write_params.related_sample_identity());
         }
+
+        // The readers of this process get the original payload, when it was kept before compressing it
+        CacheChange_t uncompressed;
+        if (get_uncompressed_change_nts(*change, uncompressed))
+        {
+            bool ret = reader->processDataMsg(&uncompressed);
+            uncompressed.serializedPayload.data = nullptr;
+            return ret;
+        }
+
         return reader->processDataMsg(change);
     }
 
@@ -399,6 +410,7 @@ bool StatelessWriter::wait_for_acknowledgement(
         const std::chrono::steady_clock::time_point& max_blocking_time_point,
         std::unique_lock<RecursiveTimedMutex>& lock)
 {
+    flow_controller_->flush_new_samples(this, max_blocking_time_point);
     uint64_t sequence_number = seq.to64long();
     auto change_is_acknowledged = [this, sequence_number]()
             {
@@ -423,6 +435,9 @@ bool StatelessWriter::matched_reader_add(
                 if (reader.remote_guid() == data.guid())
                 {
                     logWarning(RTPS_WRITER, "Attempting to add existing reader, updating information.");
+                    reader.time_based_filter().update(data.m_qos.m_timeBasedFilter.minimum_separation);
+                    reader.accepted_compression(
+                        fastdds::rtps::PayloadCompression::accepted_mask(data.accepted_compression()));
                     if (reader.update(data.remote_locators().unicast,
                     data.remote_locators().multicast,
                     data.m_expectsInlineQos))
@@ -471,6 +486,11 @@ bool StatelessWriter::matched_reader_add(
             data.remote_locators().multicast,
             data.m_expectsInlineQos,
             is_datasharing_compatible_with(data));
+    if (!new_reader->is_datasharing_reader())
+    {
+        new_reader->time_based_filter().start(data.m_qos.m_timeBasedFilter.minimum_separation);
+    }
+    new_reader->accepted_compression(fastdds::rtps::PayloadCompression::accepted_mask(data.accepted_compression()));
 
     locator_selector_.locator_selector.add_entry(new_reader->locator_selector_entry());
 
@@ -590,6 +610,50 @@ bool StatelessWriter::matched_reader_is_matched(
                    );
 }
 
+void StatelessWriter::keep_uncompressed_payload(
+        const SerializedPayload_t& payload)
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    store_uncompressed_payload_nts(payload, !matched_local_readers_.empty());
+}
+
+bool StatelessWriter::can_send_compressed(
+        uint8_t compression_kind) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+
+    // Nothing is known about the readers behind fixed locators
+    if (matched_remote_readers_.empty() || !fixed_locators_.empty())
+    {
+        return false;
+    }
+
+    for (const auto* readers : {&matched_local_readers_, &matched_datasharing_readers_, &matched_remote_readers_})
+    {
+        for (const auto& reader : *readers)
+        {
+            if (!reader->accepts_compression(compression_kind))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+void StatelessWriter::get_memory_usage(
+        EndpointMemoryUsage& usage) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+
+    RTPSWriter::get_memory_usage(usage);
+    size_t matched = matched_local_readers_.size() + matched_datasharing_readers_.size() +
+            matched_remote_readers_.size();
+    usage.matched_proxies.reserved += (matched + matched_readers_pool_.size()) * sizeof(ReaderLocator);
+    usage.matched_proxies.in_use += matched * sizeof(ReaderLocator);
+}
+
 void StatelessWriter::unsent_changes_reset()
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
@@ -613,7 +677,7 @@ bool StatelessWriter::send_nts(
     return fixed_locators_.empty() ||
            mp_RTPSParticipant->sendSync(message, m_guid,
                    Locators(fixed_locators_.begin()), Locators(fixed_locators_.end()),
-                   max_blocking_time_point);
+                   max_blocking_time_point, transport_priority_);
 }
 
 DeliveryRetCode StatelessWriter::deliver_sample_nts(
@@ -637,16 +701,33 @@ DeliveryRetCode StatelessWriter::deliver_sample_nts(
     {
         for_matched_readers(matched_local_readers_, [&, cache_change](ReaderLocator& reader)
                 {
-                    intraprocess_delivery(cache_change, reader);
+                    if (reader.time_based_filter().is_relevant(*cache_change))
+                    {
+                        intraprocess_delivery(cache_change, reader);
+                    }
                     return false;
                 });
+
+        if (!uncompressed_payloads_.empty())
+        {
+            release_uncompressed_payload_nts(cache_change->sequenceNumber);
+        }
     }
 
     try
     {
         uint32_t n_fragments = cache_change->getFragmentCount();
 
-        if (m_separateSendingEnabled)
+        // Readers with a TIME_BASED_FILTER may not want the change, so it is sent to each reader separately
+        bool separate_sending = m_separateSendingEnabled ||
+                (fixed_locators_.empty() &&
+                std::any_of(matched_remote_readers_.begin(), matched_remote_readers_.end(),
+                [](const std::unique_ptr<ReaderLocator>& reader)
+                {
+                    return reader->time_based_filter().is_active();
+                }));
+
+        if (separate_sending)
         {
             std::vector<GUID_t> guids(1);
             if (0 < n_fragments)
@@ -656,6 +737,11 @@ DeliveryRetCode StatelessWriter::deliver_sample_nts(
                 {
                     for (std::unique_ptr<ReaderLocator>& it : matched_remote_readers_)
                     {
+                        if (!it->time_based_filter().is_relevant(*cache_change))
+                        {
+                            continue;
+                        }
+
                         group.sender(this, &*it);
                         num_locators = it->locators_size();
 
@@ -682,6 +768,11 @@ DeliveryRetCode StatelessWriter::deliver_sample_nts(
             {
                 for (std::unique_ptr<ReaderLocator>& it : matched_remote_readers_)
                 {
+                    if (!it->time_based_filter().is_relevant(*cache_change))
+                    {
+                        continue;
+                    }
+
                     group.sender(this, &*it);
                     num_locators = it->locators_size();
 
@@ -499,10 +499,12 @@ XMLP_ret XMLParser::parseXMLCommonTransportData(
                 strcmp(name, CALCULATE_CRC) == 0 || strcmp(name, CHECK_CRC) == 0 ||
                 strcmp(name, ENABLE_TCP_NODELAY) == 0 || strcmp(name, TLS) == 0 ||
                 strcmp(name, NON_BLOCKING_SEND) == 0  ||
-                strcmp(name, SEGMENT_SIZE) == 0 || strcmp(name, PORT_QUEUE_CAPACITY) == 0 ||
+                strcmp(name, SEGMENT_SIZE) == 0 || strcmp(name, MAX_SEGMENT_SIZE) == 0 ||
+                strcmp(name, EXTENT_IDLE_TIMEOUT_MS) == 0 || strcmp(name, PORT_QUEUE_CAPACITY) == 0 ||
                 strcmp(name, PORT_OVERFLOW_POLICY) == 0 || strcmp(name, SEGMENT_OVERFLOW_POLICY) == 0 ||
                 strcmp(name, HEALTHY_CHECK_TIMEOUT_MS) == 0 || strcmp(name, HEALTHY_CHECK_TIMEOUT_MS) == 0 ||
-                strcmp(name, RTPS_DUMP_FILE) == 0)
+                strcmp(name, RTPS_DUMP_FILE) == 0 || strcmp(name, HUGE_PAGES) == 0 ||
+                strcmp(name, PREFAULT_SEGMENT) == 0 || strcmp(name, NUMA_NODE) == 0)
         {
             // Parsed outside of this method
         }
@@ -679,9 +681,14 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 <xs:element name="maxMessageSize" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="maxInitialPeersRange" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="segment_size" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="max_segment_size" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="extent_idle_timeout_ms" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="port_queue_capacity" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="healthy_check_timeout_ms" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="rtps_dump_file" type="stringType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="huge_pages" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="prefault_segment" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="numa_node" type="int32Type" minOccurs="0" maxOccurs="1"/>
                 </xs:all>
         </xs:complexType>
      */
@@ -705,6 +712,22 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 }
                 transport_descriptor->segment_size(static_cast<uint32_t>(aux));
             }
+            else if (strcmp(name, MAX_SEGMENT_SIZE) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &aux, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->max_segment_size(static_cast<uint32_t>(aux));
+            }
+            else if (strcmp(name, EXTENT_IDLE_TIMEOUT_MS) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &aux, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->extent_idle_timeout_ms(static_cast<uint32_t>(aux));
+            }
             else if (strcmp(name, PORT_QUEUE_CAPACITY) == 0)
             {
                 if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &aux, 0))
@@ -730,6 +753,33 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 }
                 transport_descriptor->rtps_dump_file(str);
             }
+            else if (strcmp(name, HUGE_PAGES) == 0)
+            {
+                bool huge_pages = false;
+                if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &huge_pages, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->huge_pages(huge_pages);
+            }
+            else if (strcmp(name, PREFAULT_SEGMENT) == 0)
+            {
+                bool prefault = false;
+                if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &prefault, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->prefault_segment(prefault);
+            }
+            else if (strcmp(name, NUMA_NODE) == 0)
+            {
+                int numa_node = 0;
+                if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &numa_node, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->numa_node(static_cast<int32_t>(numa_node));
+            }
             else if (strcmp(name, MAX_MESSAGE_SIZE) == 0)
             {
                 // maxMessageSize - uint32Type
@@ -58,6 +58,8 @@ const char* LISTENING_PORTS = "listening_ports";
 const char* CALCULATE_CRC = "calculate_crc";
 const char* CHECK_CRC = "check_crc";
 const char* SEGMENT_SIZE = "segment_size";
+const char* MAX_SEGMENT_SIZE = "max_segment_size";
+const char* EXTENT_IDLE_TIMEOUT_MS = "extent_idle_timeout_ms";
 const char* PORT_QUEUE_CAPACITY = "port_queue_capacity";
 const char* PORT_OVERFLOW_POLICY = "port_overflow_policy";
 const char* SEGMENT_OVERFLOW_POLICY = "segment_overflow_policy";
@@ -65,6 +67,9 @@ const char* HEALTHY_CHECK_TIMEOUT_MS = "healthy_check_timeout_ms";
 const char* DISCARD = "DISCARD";
 const char* FAIL = "FAIL";
 const char* RTPS_DUMP_FILE = "rtps_dump_file";
+const char* HUGE_PAGES = "huge_pages";
+const char* PREFAULT_SEGMENT = "prefault_segment";
+const char* NUMA_NODE = "numa_node";
 const char* ON = "ON";
 
 const char* OFF = "OFF";
@@ -18,6 +18,7 @@
 
 #include <statistics/fastdds/domain/DomainParticipantImpl.hpp>
 
+#include <cstdlib>
 #include <string>
 #include <sstream>
 #include <vector>
@@ -41,6 +42,7 @@
 #include <statistics/fastdds/publisher/PublisherImpl.hpp>
 #include <statistics/fastdds/subscriber/SubscriberImpl.hpp>
 #include <statistics/rtps/GuidUtils.hpp>
+#include <statistics/rtps/StatisticsBase.hpp>
 #include <statistics/types/types.h>
 #include <statistics/types/typesPubSubTypes.h>
 #include <utils/SystemInfo.hpp>
@@ -67,6 +69,11 @@ constexpr const char* EDP_PACKETS_TOPIC_ALIAS = "EDP_PACKETS_TOPIC";
 constexpr const char* DISCOVERY_TOPIC_ALIAS = "DISCOVERY_TOPIC";
 constexpr const char* SAMPLE_DATAS_TOPIC_ALIAS = "SAMPLE_DATAS_TOPIC";
 constexpr const char* PHYSICAL_DATA_TOPIC_ALIAS = "PHYSICAL_DATA_TOPIC";
+constexpr const char* ROUND_TRIP_TIME_TOPIC_ALIAS = "ROUND_TRIP_TIME_TOPIC";
+constexpr const char* MEMORY_USAGE_TOPIC_ALIAS = "MEMORY_USAGE_TOPIC";
+
+constexpr const char* MEMORY_USAGE_PERIOD_PROPERTY = "fastdds.statistics.memory_usage_period";
+constexpr double MEMORY_USAGE_DEFAULT_PERIOD_MS = 1000.0;
 
 static constexpr uint32_t participant_statistics_mask =
         EventKind::RTPS_SENT | EventKind::RTPS_LOST | EventKind::NETWORK_LATENCY |
@@ -98,7 +105,9 @@ static const ValidEntry valid_entries[] =
     {EDP_PACKETS_TOPIC_ALIAS,             EDP_PACKETS_TOPIC,             EDP_PACKETS},
     {DISCOVERY_TOPIC_ALIAS,               DISCOVERY_TOPIC,               DISCOVERED_ENTITY},
     {SAMPLE_DATAS_TOPIC_ALIAS,            SAMPLE_DATAS_TOPIC,            SAMPLE_DATAS},
-    {PHYSICAL_DATA_TOPIC_ALIAS,           PHYSICAL_DATA_TOPIC,           PHYSICAL_DATA}
+    {PHYSICAL_DATA_TOPIC_ALIAS,           PHYSICAL_DATA_TOPIC,           PHYSICAL_DATA},
+    {ROUND_TRIP_TIME_TOPIC_ALIAS,         ROUND_TRIP_TIME_TOPIC,         ROUND_TRIP_TIME},
+    {MEMORY_USAGE_TOPIC_ALIAS,            MEMORY_USAGE_TOPIC,            MEMORY_USAGE}
 };
 
 ReturnCode_t DomainParticipantImpl::enable_statistics_datawriter(
@@ -157,6 +166,11 @@ ReturnCode_t DomainParticipantImpl::enable_statistics_datawriter(
             else
             {
                 statistics_listener_->set_datawriter(event_kind, data_writer);
+
+                if (MEMORY_USAGE_TOPIC == use_topic_name)
+                {
+                    start_memory_usage_event();
+                }
             }
         }
         return ReturnCode_t::RETCODE_OK;
@@ -180,6 +194,11 @@ ReturnCode_t DomainParticipantImpl::disable_statistics_datawriter(
     efd::DataWriter* writer = builtin_publisher_->lookup_datawriter(use_topic_name);
     if (nullptr != writer)
     {
+        if (MEMORY_USAGE_TOPIC == use_topic_name)
+        {
+            stop_memory_usage_event();
+        }
+
         // Avoid calling DataWriter from listener callback
         statistics_listener_->set_datawriter(event_kind, nullptr);
 
@@ -188,6 +207,10 @@ ReturnCode_t DomainParticipantImpl::disable_statistics_datawriter(
         {
             // Restore writer on listener before returning the error
             statistics_listener_->set_datawriter(event_kind, writer);
+            if (MEMORY_USAGE_TOPIC == use_topic_name)
+            {
+                start_memory_usage_event();
+            }
             ret = ReturnCode_t::RETCODE_ERROR;
         }
 
@@ -215,6 +238,7 @@ ReturnCode_t DomainParticipantImpl::enable()
 
 void DomainParticipantImpl::disable()
 {
+    stop_memory_usage_event();
     if (nullptr != rtps_participant_)
     {
         rtps_participant_->remove_statistics_listener(statistics_listener_, participant_statistics_mask);
@@ -348,10 +372,10 @@ bool DomainParticipantImpl::register_statistics_type_and_topic(
         const std::string& topic_name) noexcept
 {
     bool return_code = false;
-    if (HISTORY_LATENCY_TOPIC == topic_name)
+    if (HISTORY_LATENCY_TOPIC == topic_name || ROUND_TRIP_TIME_TOPIC == topic_name)
     {
-        efd::TypeSupport history_latency_type(new WriterReaderDataPubSubType);
-        return_code = find_or_create_topic_and_type(topic, topic_name, history_latency_type);
+        efd::TypeSupport writer_reader_type(new WriterReaderDataPubSubType);
+        return_code = find_or_create_topic_and_type(topic, topic_name, writer_reader_type);
     }
     else if (NETWORK_LATENCY_TOPIC == topic_name)
     {
@@ -390,6 +414,11 @@ bool DomainParticipantImpl::register_statistics_type_and_topic(
         efd::TypeSupport physical_data_type(new PhysicalDataPubSubType);
         return_code = find_or_create_topic_and_type(topic, topic_name, physical_data_type);
     }
+    else if (MEMORY_USAGE_TOPIC == topic_name)
+    {
+        efd::TypeSupport memory_usage_type(new EntityMemoryUsagePubSubType);
+        return_code = find_or_create_topic_and_type(topic, topic_name, memory_usage_type);
+    }
     return return_code;
 }
 
@@ -449,6 +478,76 @@ bool DomainParticipantImpl::delete_topic_and_type(
     return true;
 }
 
+void DomainParticipantImpl::start_memory_usage_event()
+{
+    if (memory_usage_event_)
+    {
+        return;
+    }
+
+    double period_ms = MEMORY_USAGE_DEFAULT_PERIOD_MS;
+    const std::string* property = eprosima::fastrtps::rtps::PropertyPolicyHelper::find_property(
+        get_qos().properties(), MEMORY_USAGE_PERIOD_PROPERTY);
+    if (nullptr != property)
+    {
+        double value = std::strtod(property->c_str(), nullptr);
+        if (0.0 < value)
+        {
+            period_ms = value;
+        }
+        else
+        {
+            logError(STATISTICS_DOMAIN_PARTICIPANT, "Wrong value '" << *property << "' for property " <<
+                    MEMORY_USAGE_PERIOD_PROPERTY << ". Using " << MEMORY_USAGE_DEFAULT_PERIOD_MS << " ms");
+        }
+    }
+
+    memory_usage_event_.reset(new fastrtps::rtps::TimedEvent(get_resource_event(),
+            [this]()
+            {
+                return publish_memory_usage();
+            }, period_ms));
+    memory_usage_event_->restart_timer();
+}
+
+void DomainParticipantImpl::stop_memory_usage_event()
+{
+    // The destructor waits for a running callback to finish
+    memory_usage_event_.reset();
+}
+
+bool DomainParticipantImpl::publish_memory_usage()
+{
+    fastrtps::rtps::ParticipantMemoryUsage usage;
+    if (ReturnCode_t::RETCODE_OK != get_memory_usage(usage))
+    {
+        return false;
+    }
+
+    auto notify = [this](
+        const fastrtps::rtps::GUID_t& guid,
+        const fastrtps::rtps::MemoryUsage& memory)
+            {
+                EntityMemoryUsage notification;
+                notification.guid(to_statistics_type(guid));
+                notification.reserved_bytes(memory.reserved);
+                notification.in_use_bytes(memory.in_use);
+
+                Data data;
+                data.entity_memory_usage(notification);
+                data._d(EventKind::MEMORY_USAGE);
+                statistics_listener_->on_statistics_data(data);
+            };
+
+    notify(usage.guid, usage.total());
+    for (const fastrtps::rtps::EndpointMemoryUsage& endpoint : usage.endpoints)
+    {
+        notify(endpoint.guid, endpoint.total());
+    }
+
+    return true;
+}
+
 } // dds
 } // statistics
 } // fastdds
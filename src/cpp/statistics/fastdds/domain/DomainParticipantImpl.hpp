@@ -34,6 +34,7 @@
 #include <fastdds/dds/topic/Topic.hpp>
 #include <fastdds/dds/topic/TopicDescription.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/resources/TimedEvent.h>
 #include <fastrtps/types/TypesBase.h>
 
 #include <fastdds/domain/DomainParticipantImpl.hpp>
@@ -189,9 +190,28 @@ protected:
     bool delete_topic_and_type(
             const std::string& topic_name) noexcept;
 
+    /**
+     * Auxiliary method to start publishing the memory usage periodically, with the period in milliseconds given by
+     * property fastdds.statistics.memory_usage_period (1000 by default).
+     */
+    void start_memory_usage_event();
+
+    /**
+     * Auxiliary method to stop publishing the memory usage.
+     * When it returns, no memory usage sample is being published.
+     */
+    void stop_memory_usage_event();
+
+    /**
+     * Auxiliary method to publish the memory usage of the participant and of each of its DataWriters and DataReaders.
+     * @return true, so the event is restarted.
+     */
+    bool publish_memory_usage();
+
     efd::Publisher* builtin_publisher_ = nullptr;
     PublisherImpl* builtin_publisher_impl_ = nullptr;
     std::shared_ptr<DomainParticipantStatisticsListener> statistics_listener_;
+    std::unique_ptr<fastrtps::rtps::TimedEvent> memory_usage_event_;
 
     friend class efd::DomainParticipantFactory;
 };
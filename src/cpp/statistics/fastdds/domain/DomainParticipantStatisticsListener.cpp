@@ -59,6 +59,7 @@ void DomainParticipantStatisticsListener::on_statistics_data(
         switch (data_kind)
         {
             case EventKind::HISTORY2HISTORY_LATENCY:
+            case EventKind::ROUND_TRIP_TIME:
                 data_sample = &statistics_data.writer_reader_data();
                 break;
 
@@ -98,6 +99,10 @@ void DomainParticipantStatisticsListener::on_statistics_data(
             case EventKind::PHYSICAL_DATA:
                 data_sample = &statistics_data.physical_data();
                 break;
+
+            case EventKind::MEMORY_USAGE:
+                data_sample = &statistics_data.entity_memory_usage();
+                break;
         }
 
         writer->write(const_cast<void*>(data_sample));
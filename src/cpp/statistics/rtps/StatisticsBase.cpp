@@ -178,7 +178,8 @@ bool StatisticsParticipantImpl::are_writers_involved(
             | HEARTBEAT_COUNT \
             | GAP_COUNT \
             | DATA_COUNT \
-            | SAMPLE_DATAS;
+            | SAMPLE_DATAS \
+            | ROUND_TRIP_TIME;
 
     return writers_maks & mask;
 }
@@ -191,7 +192,8 @@ bool StatisticsParticipantImpl::are_readers_involved(
     constexpr uint32_t readers_maks = HISTORY2HISTORY_LATENCY \
             | SUBSCRIPTION_THROUGHPUT \
             | ACKNACK_COUNT \
-            | NACKFRAG_COUNT;
+            | NACKFRAG_COUNT \
+            | ROUND_TRIP_TIME;
 
     return readers_maks & mask;
 }
@@ -210,3 +210,24 @@ void StatisticsWriterImpl::on_publish_throughput(
                 });
     }
 }
+
+void StatisticsWriterImpl::on_round_trip_time(
+        const fastrtps::rtps::GUID_t& reader_guid,
+        std::chrono::nanoseconds rtt)
+{
+    WriterReaderData notification;
+    notification.writer_guid(to_statistics_type(get_guid()));
+    notification.reader_guid(to_statistics_type(reader_guid));
+    notification.data(static_cast<float>(rtt.count()));
+
+    // Perform the callbacks
+    Data data;
+    // note that the setter sets HISTORY2HISTORY_LATENCY by default
+    data.writer_reader_data(std::move(notification));
+    data._d(EventKind::ROUND_TRIP_TIME);
+
+    for_each_listener([&data](const std::shared_ptr<IListener>& listener)
+            {
+                listener->on_statistics_data(data);
+            });
+}
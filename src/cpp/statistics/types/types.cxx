@@ -3022,6 +3022,233 @@ void eprosima::fastdds::statistics::PhysicalData::serializeKey(
 }
 
 
+eprosima::fastdds::statistics::EntityMemoryUsage::EntityMemoryUsage()
+{
+    // m_guid com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@b7f23d9
+
+    // m_reserved_bytes com.eprosima.idl.parser.typecode.PrimitiveTypeCode@3c19aaa5
+    m_reserved_bytes = 0;
+    // m_in_use_bytes com.eprosima.idl.parser.typecode.PrimitiveTypeCode@3c19aaa5
+    m_in_use_bytes = 0;
+
+}
+
+eprosima::fastdds::statistics::EntityMemoryUsage::~EntityMemoryUsage()
+{
+
+
+}
+
+eprosima::fastdds::statistics::EntityMemoryUsage::EntityMemoryUsage(
+        const EntityMemoryUsage& x)
+{
+    m_guid = x.m_guid;
+    m_reserved_bytes = x.m_reserved_bytes;
+    m_in_use_bytes = x.m_in_use_bytes;
+}
+
+eprosima::fastdds::statistics::EntityMemoryUsage::EntityMemoryUsage(
+        EntityMemoryUsage&& x)
+{
+    m_guid = std::move(x.m_guid);
+    m_reserved_bytes = x.m_reserved_bytes;
+    m_in_use_bytes = x.m_in_use_bytes;
+}
+
+eprosima::fastdds::statistics::EntityMemoryUsage& eprosima::fastdds::statistics::EntityMemoryUsage::operator =(
+        const EntityMemoryUsage& x)
+{
+
+    m_guid = x.m_guid;
+    m_reserved_bytes = x.m_reserved_bytes;
+    m_in_use_bytes = x.m_in_use_bytes;
+
+    return *this;
+}
+
+eprosima::fastdds::statistics::EntityMemoryUsage& eprosima::fastdds::statistics::EntityMemoryUsage::operator =(
+        EntityMemoryUsage&& x)
+{
+
+    m_guid = std::move(x.m_guid);
+    m_reserved_bytes = x.m_reserved_bytes;
+    m_in_use_bytes = x.m_in_use_bytes;
+
+    return *this;
+}
+
+size_t eprosima::fastdds::statistics::EntityMemoryUsage::getMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += eprosima::fastdds::statistics::detail::GUID_s::getMaxCdrSerializedSize(current_alignment);
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+
+    return current_alignment - initial_alignment;
+}
+
+size_t eprosima::fastdds::statistics::EntityMemoryUsage::getCdrSerializedSize(
+        const eprosima::fastdds::statistics::EntityMemoryUsage& data,
+        size_t current_alignment)
+{
+    (void)data;
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += eprosima::fastdds::statistics::detail::GUID_s::getCdrSerializedSize(data.guid(), current_alignment);
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+
+    return current_alignment - initial_alignment;
+}
+
+void eprosima::fastdds::statistics::EntityMemoryUsage::serialize(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+
+    scdr << m_guid;
+    scdr << m_reserved_bytes;
+    scdr << m_in_use_bytes;
+
+}
+
+void eprosima::fastdds::statistics::EntityMemoryUsage::deserialize(
+        eprosima::fastcdr::Cdr& dcdr)
+{
+
+    dcdr >> m_guid;
+    dcdr >> m_reserved_bytes;
+    dcdr >> m_in_use_bytes;
+}
+
+/*!
+ * @brief This function copies the value in member guid
+ * @param _guid New value to be copied in member guid
+ */
+void eprosima::fastdds::statistics::EntityMemoryUsage::guid(
+        const eprosima::fastdds::statistics::detail::GUID_s& _guid)
+{
+    m_guid = _guid;
+}
+
+/*!
+ * @brief This function moves the value in member guid
+ * @param _guid New value to be moved in member guid
+ */
+void eprosima::fastdds::statistics::EntityMemoryUsage::guid(
+        eprosima::fastdds::statistics::detail::GUID_s&& _guid)
+{
+    m_guid = std::move(_guid);
+}
+
+/*!
+ * @brief This function returns a constant reference to member guid
+ * @return Constant reference to member guid
+ */
+const eprosima::fastdds::statistics::detail::GUID_s& eprosima::fastdds::statistics::EntityMemoryUsage::guid() const
+{
+    return m_guid;
+}
+
+/*!
+ * @brief This function returns a reference to member guid
+ * @return Reference to member guid
+ */
+eprosima::fastdds::statistics::detail::GUID_s& eprosima::fastdds::statistics::EntityMemoryUsage::guid()
+{
+    return m_guid;
+}
+/*!
+ * @brief This function sets a value in member reserved_bytes
+ * @param _reserved_bytes New value for member reserved_bytes
+ */
+void eprosima::fastdds::statistics::EntityMemoryUsage::reserved_bytes(
+        uint64_t _reserved_bytes)
+{
+    m_reserved_bytes = _reserved_bytes;
+}
+
+/*!
+ * @brief This function returns the value of member reserved_bytes
+ * @return Value of member reserved_bytes
+ */
+uint64_t eprosima::fastdds::statistics::EntityMemoryUsage::reserved_bytes() const
+{
+    return m_reserved_bytes;
+}
+
+/*!
+ * @brief This function returns a reference to member reserved_bytes
+ * @return Reference to member reserved_bytes
+ */
+uint64_t& eprosima::fastdds::statistics::EntityMemoryUsage::reserved_bytes()
+{
+    return m_reserved_bytes;
+}
+
+/*!
+ * @brief This function sets a value in member in_use_bytes
+ * @param _in_use_bytes New value for member in_use_bytes
+ */
+void eprosima::fastdds::statistics::EntityMemoryUsage::in_use_bytes(
+        uint64_t _in_use_bytes)
+{
+    m_in_use_bytes = _in_use_bytes;
+}
+
+/*!
+ * @brief This function returns the value of member in_use_bytes
+ * @return Value of member in_use_bytes
+ */
+uint64_t eprosima::fastdds::statistics::EntityMemoryUsage::in_use_bytes() const
+{
+    return m_in_use_bytes;
+}
+
+/*!
+ * @brief This function returns a reference to member in_use_bytes
+ * @return Reference to member in_use_bytes
+ */
+uint64_t& eprosima::fastdds::statistics::EntityMemoryUsage::in_use_bytes()
+{
+    return m_in_use_bytes;
+}
+
+
+size_t eprosima::fastdds::statistics::EntityMemoryUsage::getKeyMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t current_align = current_alignment;
+
+
+     current_align += eprosima::fastdds::statistics::detail::GUID_s::getMaxCdrSerializedSize(current_align); 
+
+
+    return current_align;
+}
+
+bool eprosima::fastdds::statistics::EntityMemoryUsage::isKeyDefined()
+{
+    return true;
+}
+
+void eprosima::fastdds::statistics::EntityMemoryUsage::serializeKey(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+    (void) scdr;
+     scdr << m_guid;
+       
+}
+
 eprosima::fastdds::statistics::Data::Data()
 {
     m__d = HISTORY2HISTORY_LATENCY;
@@ -3041,6 +3268,8 @@ eprosima::fastdds::statistics::Data::Data()
 
     // m_physical_data com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@43bc63a3
 
+    // m_entity_memory_usage com.eprosima.fastdds.idl.parser.typecode.StructTypeCode@43bc63a3
+
 }
 
 eprosima::fastdds::statistics::Data::~Data()
@@ -3055,6 +3284,7 @@ eprosima::fastdds::statistics::Data::Data(
     switch(m__d)
     {
         case HISTORY2HISTORY_LATENCY:
+        case ROUND_TRIP_TIME:
         m_writer_reader_data = x.m_writer_reader_data;
         break;
         case NETWORK_LATENCY:
@@ -3087,6 +3317,9 @@ eprosima::fastdds::statistics::Data::Data(
         case PHYSICAL_DATA:
         m_physical_data = x.m_physical_data;
         break;
+        case MEMORY_USAGE:
+        m_entity_memory_usage = x.m_entity_memory_usage;
+        break;
         default:
         break;
     }
@@ -3100,6 +3333,7 @@ eprosima::fastdds::statistics::Data::Data(
     switch(m__d)
     {
         case HISTORY2HISTORY_LATENCY:
+        case ROUND_TRIP_TIME:
         m_writer_reader_data = std::move(x.m_writer_reader_data);
         break;
         case NETWORK_LATENCY:
@@ -3132,6 +3366,9 @@ eprosima::fastdds::statistics::Data::Data(
         case PHYSICAL_DATA:
         m_physical_data = std::move(x.m_physical_data);
         break;
+        case MEMORY_USAGE:
+        m_entity_memory_usage = std::move(x.m_entity_memory_usage);
+        break;
         default:
         break;
     }
@@ -3145,6 +3382,7 @@ eprosima::fastdds::statistics::Data& eprosima::fastdds::statistics::Data::operat
     switch(m__d)
     {
         case HISTORY2HISTORY_LATENCY:
+        case ROUND_TRIP_TIME:
         m_writer_reader_data = x.m_writer_reader_data;
         break;
         case NETWORK_LATENCY:
@@ -3177,6 +3415,9 @@ eprosima::fastdds::statistics::Data& eprosima::fastdds::statistics::Data::operat
         case PHYSICAL_DATA:
         m_physical_data = x.m_physical_data;
         break;
+        case MEMORY_USAGE:
+        m_entity_memory_usage = x.m_entity_memory_usage;
+        break;
         default:
         break;
     }
@@ -3192,6 +3433,7 @@ eprosima::fastdds::statistics::Data& eprosima::fastdds::statistics::Data::operat
     switch(m__d)
     {
         case HISTORY2HISTORY_LATENCY:
+        case ROUND_TRIP_TIME:
         m_writer_reader_data = std::move(x.m_writer_reader_data);
         break;
         case NETWORK_LATENCY:
@@ -3224,6 +3466,9 @@ eprosima::fastdds::statistics::Data& eprosima::fastdds::statistics::Data::operat
         case PHYSICAL_DATA:
         m_physical_data = std::move(x.m_physical_data);
         break;
+        case MEMORY_USAGE:
+        m_entity_memory_usage = std::move(x.m_entity_memory_usage);
+        break;
         default:
         break;
     }
@@ -3239,9 +3484,11 @@ void eprosima::fastdds::statistics::Data::_d(
     switch(m__d)
     {
         case HISTORY2HISTORY_LATENCY:
+        case ROUND_TRIP_TIME:
         switch(__d)
         {
             case HISTORY2HISTORY_LATENCY:
+            case ROUND_TRIP_TIME:
             b = true;
             break;
             default:
@@ -3336,6 +3583,16 @@ void eprosima::fastdds::statistics::Data::_d(
             break;
         }
         break;
+        case MEMORY_USAGE:
+        switch(__d)
+        {
+            case MEMORY_USAGE:
+            b = true;
+            break;
+            default:
+            break;
+        }
+        break;
     }
 
     if(!b)
@@ -3377,6 +3634,7 @@ const eprosima::fastdds::statistics::WriterReaderData& eprosima::fastdds::statis
     switch(m__d)
     {
         case HISTORY2HISTORY_LATENCY:
+        case ROUND_TRIP_TIME:
         b = true;
         break;
         default:
@@ -3397,6 +3655,7 @@ eprosima::fastdds::statistics::WriterReaderData& eprosima::fastdds::statistics::
     switch(m__d)
     {
         case HISTORY2HISTORY_LATENCY:
+        case ROUND_TRIP_TIME:
         b = true;
         break;
         default:
@@ -3799,6 +4058,60 @@ eprosima::fastdds::statistics::PhysicalData& eprosima::fastdds::statistics::Data
     return m_physical_data;
 }
 
+void eprosima::fastdds::statistics::Data::entity_memory_usage(
+        const eprosima::fastdds::statistics::EntityMemoryUsage& _entity_memory_usage)
+{
+    m_entity_memory_usage = _entity_memory_usage;
+    m__d = MEMORY_USAGE;
+}
+
+void eprosima::fastdds::statistics::Data::entity_memory_usage(
+        eprosima::fastdds::statistics::EntityMemoryUsage&& _entity_memory_usage)
+{
+    m_entity_memory_usage = std::move(_entity_memory_usage);
+    m__d = MEMORY_USAGE;
+}
+
+const eprosima::fastdds::statistics::EntityMemoryUsage& eprosima::fastdds::statistics::Data::entity_memory_usage() const
+{
+    bool b = false;
+
+    switch(m__d)
+    {
+        case MEMORY_USAGE:
+        b = true;
+        break;
+        default:
+        break;
+    }
+    if(!b)
+    {
+        throw BadParamException("This member is not been selected");
+    }
+
+    return m_entity_memory_usage;
+}
+
+eprosima::fastdds::statistics::EntityMemoryUsage& eprosima::fastdds::statistics::Data::entity_memory_usage()
+{
+    bool b = false;
+
+    switch(m__d)
+    {
+        case MEMORY_USAGE:
+        b = true;
+        break;
+        default:
+        break;
+    }
+    if(!b)
+    {
+        throw BadParamException("This member is not been selected");
+    }
+
+    return m_entity_memory_usage;
+}
+
 size_t eprosima::fastdds::statistics::Data::getMaxCdrSerializedSize(
         size_t current_alignment)
 {
@@ -3873,6 +4186,14 @@ size_t eprosima::fastdds::statistics::Data::getMaxCdrSerializedSize(
             union_max_size_serialized = reset_alignment;
 
         
+        reset_alignment = current_alignment;
+
+        reset_alignment += eprosima::fastdds::statistics::EntityMemoryUsage::getMaxCdrSerializedSize(reset_alignment);
+
+        if(union_max_size_serialized < reset_alignment)
+            union_max_size_serialized = reset_alignment;
+
+        
 
     return union_max_size_serialized - initial_alignment;
 }
@@ -3890,6 +4211,7 @@ size_t eprosima::fastdds::statistics::Data::getCdrSerializedSize(
     switch(data.m__d)
     {
         case HISTORY2HISTORY_LATENCY:
+        case ROUND_TRIP_TIME:
         current_alignment += eprosima::fastdds::statistics::WriterReaderData::getCdrSerializedSize(data.writer_reader_data(), current_alignment);
         break;
         case NETWORK_LATENCY:
@@ -3922,6 +4244,9 @@ size_t eprosima::fastdds::statistics::Data::getCdrSerializedSize(
         case PHYSICAL_DATA:
         current_alignment += eprosima::fastdds::statistics::PhysicalData::getCdrSerializedSize(data.physical_data(), current_alignment);
         break;
+        case MEMORY_USAGE:
+        current_alignment += eprosima::fastdds::statistics::EntityMemoryUsage::getCdrSerializedSize(data.entity_memory_usage(), current_alignment);
+        break;
         default:
         break;
     }
@@ -3937,6 +4262,7 @@ void eprosima::fastdds::statistics::Data::serialize(
     switch(m__d)
     {
         case HISTORY2HISTORY_LATENCY:
+        case ROUND_TRIP_TIME:
         scdr << m_writer_reader_data;
 
         break;
@@ -3976,6 +4302,10 @@ void eprosima::fastdds::statistics::Data::serialize(
         case PHYSICAL_DATA:
         scdr << m_physical_data;
 
+        break;
+        case MEMORY_USAGE:
+        scdr << m_entity_memory_usage;
+
         break;
         default:
         break;
@@ -3995,6 +4325,7 @@ void eprosima::fastdds::statistics::Data::deserialize(
     switch(m__d)
     {
         case HISTORY2HISTORY_LATENCY:
+        case ROUND_TRIP_TIME:
         dcdr >> m_writer_reader_data;
         break;
         case NETWORK_LATENCY:
@@ -4027,6 +4358,9 @@ void eprosima::fastdds::statistics::Data::deserialize(
         case PHYSICAL_DATA:
         dcdr >> m_physical_data;
         break;
+        case MEMORY_USAGE:
+        dcdr >> m_entity_memory_usage;
+        break;
         default:
         break;
     }
@@ -2398,6 +2398,178 @@ namespace eprosima {
                 std::string m_user;
                 std::string m_process;
             };
+            /*!
+             * @brief This class represents the structure EntityMemoryUsage defined by the user in the IDL file.
+             * @ingroup TYPES
+             */
+            class EntityMemoryUsage
+            {
+            public:
+
+                /*!
+                 * @brief Default constructor.
+                 */
+                eProsima_user_DllExport EntityMemoryUsage();
+
+                /*!
+                 * @brief Default destructor.
+                 */
+                eProsima_user_DllExport ~EntityMemoryUsage();
+
+                /*!
+                 * @brief Copy constructor.
+                 * @param x Reference to the object eprosima::fastdds::statistics::EntityMemoryUsage that will be copied.
+                 */
+                eProsima_user_DllExport EntityMemoryUsage(
+                        const EntityMemoryUsage& x);
+
+                /*!
+                 * @brief Move constructor.
+                 * @param x Reference to the object eprosima::fastdds::statistics::EntityMemoryUsage that will be copied.
+                 */
+                eProsima_user_DllExport EntityMemoryUsage(
+                        EntityMemoryUsage&& x);
+
+                /*!
+                 * @brief Copy assignment.
+                 * @param x Reference to the object eprosima::fastdds::statistics::EntityMemoryUsage that will be copied.
+                 */
+                eProsima_user_DllExport EntityMemoryUsage& operator =(
+                        const EntityMemoryUsage& x);
+
+                /*!
+                 * @brief Move assignment.
+                 * @param x Reference to the object eprosima::fastdds::statistics::EntityMemoryUsage that will be copied.
+                 */
+                eProsima_user_DllExport EntityMemoryUsage& operator =(
+                        EntityMemoryUsage&& x);
+
+                /*!
+                 * @brief This function copies the value in member guid
+                 * @param _guid New value to be copied in member guid
+                 */
+                eProsima_user_DllExport void guid(
+                        const eprosima::fastdds::statistics::detail::GUID_s& _guid);
+
+                /*!
+                 * @brief This function moves the value in member guid
+                 * @param _guid New value to be moved in member guid
+                 */
+                eProsima_user_DllExport void guid(
+                        eprosima::fastdds::statistics::detail::GUID_s&& _guid);
+
+                /*!
+                 * @brief This function returns a constant reference to member guid
+                 * @return Constant reference to member guid
+                 */
+                eProsima_user_DllExport const eprosima::fastdds::statistics::detail::GUID_s& guid() const;
+
+                /*!
+                 * @brief This function returns a reference to member guid
+                 * @return Reference to member guid
+                 */
+                eProsima_user_DllExport eprosima::fastdds::statistics::detail::GUID_s& guid();
+                /*!
+                 * @brief This function sets a value in member reserved_bytes
+                 * @param _reserved_bytes New value for member reserved_bytes
+                 */
+                eProsima_user_DllExport void reserved_bytes(
+                        uint64_t _reserved_bytes);
+
+                /*!
+                 * @brief This function returns the value of member reserved_bytes
+                 * @return Value of member reserved_bytes
+                 */
+                eProsima_user_DllExport uint64_t reserved_bytes() const;
+
+                /*!
+                 * @brief This function returns a reference to member reserved_bytes
+                 * @return Reference to member reserved_bytes
+                 */
+                eProsima_user_DllExport uint64_t& reserved_bytes();
+                /*!
+                 * @brief This function sets a value in member in_use_bytes
+                 * @param _in_use_bytes New value for member in_use_bytes
+                 */
+                eProsima_user_DllExport void in_use_bytes(
+                        uint64_t _in_use_bytes);
+
+                /*!
+                 * @brief This function returns the value of member in_use_bytes
+                 * @return Value of member in_use_bytes
+                 */
+                eProsima_user_DllExport uint64_t in_use_bytes() const;
+
+                /*!
+                 * @brief This function returns a reference to member in_use_bytes
+                 * @return Reference to member in_use_bytes
+                 */
+                eProsima_user_DllExport uint64_t& in_use_bytes();
+
+
+                /*!
+                 * @brief This function returns the maximum serialized size of an object
+                 * depending on the buffer alignment.
+                 * @param current_alignment Buffer alignment.
+                 * @return Maximum serialized size.
+                 */
+                eProsima_user_DllExport static size_t getMaxCdrSerializedSize(
+                        size_t current_alignment = 0);
+
+                /*!
+                 * @brief This function returns the serialized size of a data depending on the buffer alignment.
+                 * @param data Data which is calculated its serialized size.
+                 * @param current_alignment Buffer alignment.
+                 * @return Serialized size.
+                 */
+                eProsima_user_DllExport static size_t getCdrSerializedSize(
+                        const eprosima::fastdds::statistics::EntityMemoryUsage& data,
+                        size_t current_alignment = 0);
+
+
+                /*!
+                 * @brief This function serializes an object using CDR serialization.
+                 * @param cdr CDR serialization object.
+                 */
+                eProsima_user_DllExport void serialize(
+                        eprosima::fastcdr::Cdr& cdr) const;
+
+                /*!
+                 * @brief This function deserializes an object using CDR serialization.
+                 * @param cdr CDR serialization object.
+                 */
+                eProsima_user_DllExport void deserialize(
+                        eprosima::fastcdr::Cdr& cdr);
+
+
+
+                /*!
+                 * @brief This function returns the maximum serialized size of the Key of an object
+                 * depending on the buffer alignment.
+                 * @param current_alignment Buffer alignment.
+                 * @return Maximum serialized size.
+                 */
+                eProsima_user_DllExport static size_t getKeyMaxCdrSerializedSize(
+                        size_t current_alignment = 0);
+
+                /*!
+                 * @brief This function tells you if the Key has been defined for this type
+                 */
+                eProsima_user_DllExport static bool isKeyDefined();
+
+                /*!
+                 * @brief This function serializes the key members of an object using CDR serialization.
+                 * @param cdr CDR serialization object.
+                 */
+                eProsima_user_DllExport void serializeKey(
+                        eprosima::fastcdr::Cdr& cdr) const;
+
+            private:
+
+                eprosima::fastdds::statistics::detail::GUID_s m_guid;
+                uint64_t m_reserved_bytes;
+                uint64_t m_in_use_bytes;
+            };
             /*!
              * @brief This class represents the bitmask EventKind defined by the user in the IDL file.
              * @ingroup TYPES
@@ -2420,7 +2592,9 @@ namespace eprosima {
                 EDP_PACKETS = 0x01 << 13,
                 DISCOVERED_ENTITY = 0x01 << 14,
                 SAMPLE_DATAS = 0x01 << 15,
-                PHYSICAL_DATA = 0x01 << 16
+                PHYSICAL_DATA = 0x01 << 16,
+                ROUND_TRIP_TIME = 0x01 << 17,
+                MEMORY_USAGE = 0x01 << 18
             };
             /*!
              * @brief This class represents the union Data defined by the user in the IDL file.
@@ -2705,6 +2879,34 @@ namespace eprosima {
                  */
                 eProsima_user_DllExport eprosima::fastdds::statistics::PhysicalData& physical_data();
 
+                /*!
+                 * @brief This function copies the value in member entity_memory_usage
+                 * @param _entity_memory_usage New value to be copied in member entity_memory_usage
+                 */
+                eProsima_user_DllExport void entity_memory_usage(
+                        const eprosima::fastdds::statistics::EntityMemoryUsage& _entity_memory_usage);
+
+                /*!
+                 * @brief This function moves the value in member entity_memory_usage
+                 * @param _entity_memory_usage New value to be moved in member entity_memory_usage
+                 */
+                eProsima_user_DllExport void entity_memory_usage(
+                        eprosima::fastdds::statistics::EntityMemoryUsage&& _entity_memory_usage);
+
+                /*!
+                 * @brief This function returns a constant reference to member entity_memory_usage
+                 * @return Constant reference to member entity_memory_usage
+                 * @exception eprosima::fastcdr::BadParamException This exception is thrown if the requested union member is not the current selection.
+                 */
+                eProsima_user_DllExport const eprosima::fastdds::statistics::EntityMemoryUsage& entity_memory_usage() const;
+
+                /*!
+                 * @brief This function returns a reference to member entity_memory_usage
+                 * @return Reference to member entity_memory_usage
+                 * @exception eprosima::fastcdr::BadParamException This exception is thrown if the requested union member is not the current selection.
+                 */
+                eProsima_user_DllExport eprosima::fastdds::statistics::EntityMemoryUsage& entity_memory_usage();
+
                 /*!
                  * @brief This function returns the maximum serialized size of an object
                  * depending on the buffer alignment.
@@ -2754,6 +2956,7 @@ namespace eprosima {
                 eprosima::fastdds::statistics::DiscoveryTime m_discovery_time;
                 eprosima::fastdds::statistics::SampleIdentityCount m_sample_identity_count;
                 eprosima::fastdds::statistics::PhysicalData m_physical_data;
+                eprosima::fastdds::statistics::EntityMemoryUsage m_entity_memory_usage;
             };
         } // namespace statistics
     } // namespace fastdds
@@ -1969,6 +1969,144 @@ namespace eprosima {
             }
 
 
+            EntityMemoryUsagePubSubType::EntityMemoryUsagePubSubType()
+            {
+                setName("eprosima::fastdds::statistics::EntityMemoryUsage");
+                m_typeSize = static_cast<uint32_t>(EntityMemoryUsage::getMaxCdrSerializedSize()) + 4 /*encapsulation*/;
+                m_isGetKeyDefined = EntityMemoryUsage::isKeyDefined();
+                size_t keyLength = EntityMemoryUsage::getKeyMaxCdrSerializedSize() > 16 ?
+                        EntityMemoryUsage::getKeyMaxCdrSerializedSize() : 16;
+                m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+                memset(m_keyBuffer, 0, keyLength);
+            }
+
+            EntityMemoryUsagePubSubType::~EntityMemoryUsagePubSubType()
+            {
+                if (m_keyBuffer != nullptr)
+                {
+                    free(m_keyBuffer);
+                }
+            }
+
+            bool EntityMemoryUsagePubSubType::serialize(
+                    void* data,
+                    SerializedPayload_t* payload)
+            {
+                EntityMemoryUsage* p_type = static_cast<EntityMemoryUsage*>(data);
+
+                // Object that manages the raw buffer.
+                eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+                // Object that serializes the data.
+                eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+                payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+                // Serialize encapsulation
+                ser.serialize_encapsulation();
+
+                try
+                {
+                    // Serialize the object.
+                    p_type->serialize(ser);
+                }
+                catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+                {
+                    return false;
+                }
+
+                // Get the serialized length
+                payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+                return true;
+            }
+
+            bool EntityMemoryUsagePubSubType::deserialize(
+                    SerializedPayload_t* payload,
+                    void* data)
+            {
+                //Convert DATA to pointer of your type
+                EntityMemoryUsage* p_type = static_cast<EntityMemoryUsage*>(data);
+
+                // Object that manages the raw buffer.
+                eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+                // Object that deserializes the data.
+                eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+
+                // Deserialize encapsulation.
+                deser.read_encapsulation();
+                payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+                try
+                {
+                    // Deserialize the object.
+                    p_type->deserialize(deser);
+                }
+                catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+                {
+                    return false;
+                }
+
+                return true;
+            }
+
+            std::function<uint32_t()> EntityMemoryUsagePubSubType::getSerializedSizeProvider(
+                    void* data)
+            {
+                return [data]() -> uint32_t
+                       {
+                           return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<EntityMemoryUsage*>(data))) +
+                                  4u /*encapsulation*/;
+                       };
+            }
+
+            void* EntityMemoryUsagePubSubType::createData()
+            {
+                return reinterpret_cast<void*>(new EntityMemoryUsage());
+            }
+
+            void EntityMemoryUsagePubSubType::deleteData(
+                    void* data)
+            {
+                delete(reinterpret_cast<EntityMemoryUsage*>(data));
+            }
+
+            bool EntityMemoryUsagePubSubType::getKey(
+                    void* data,
+                    InstanceHandle_t* handle,
+                    bool force_md5)
+            {
+                if (!m_isGetKeyDefined)
+                {
+                    return false;
+                }
+
+                EntityMemoryUsage* p_type = static_cast<EntityMemoryUsage*>(data);
+
+                // Object that manages the raw buffer.
+                eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                        EntityMemoryUsage::getKeyMaxCdrSerializedSize());
+
+                // Object that serializes the data.
+                eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
+                p_type->serializeKey(ser);
+                if (force_md5 || EntityMemoryUsage::getKeyMaxCdrSerializedSize() > 16)
+                {
+                    m_md5.init();
+                    m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
+                    m_md5.finalize();
+                    for (uint8_t i = 0; i < 16; ++i)
+                    {
+                        handle->value[i] = m_md5.digest[i];
+                    }
+                }
+                else
+                {
+                    for (uint8_t i = 0; i < 16; ++i)
+                    {
+                        handle->value[i] = m_keyBuffer[i];
+                    }
+                }
+                return true;
+            }
+
 
 
         } //End of namespace statistics
@@ -0,0 +1,124 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file KeyHashCache.hpp
+ */
+
+#ifndef _UTILS_KEYHASHCACHE_HPP_
+#define _UTILS_KEYHASHCACHE_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+#include <fastdds/rtps/common/InstanceHandle.h>
+#include <fastrtps/utils/md5.h>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * Computes the key hash of serialized keys, as specified by the RTPS standard, remembering the MD5 digests
+ * already computed.
+ *
+ * Writers usually publish on a small set of instances, so the MD5 of the same serialized keys would be computed
+ * again and again. Looking up the key bytes in a hash table is considerably cheaper.
+ * The cache is bounded: when it is full, it is emptied before adding a new key.
+ *
+ * Not thread safe. Each writer keeps its own cache, so the keys of different topics are not mixed.
+ */
+class KeyHashCache
+{
+public:
+
+    /**
+     * @param max_entries Maximum number of keys remembered. 0 disables the cache.
+     */
+    explicit KeyHashCache(
+            size_t max_entries = 1024)
+        : max_entries_(max_entries)
+    {
+    }
+
+    /**
+     * Gets the key hash of a serialized key.
+     * @param key Serialized key, in big endian CDR.
+     * @param length Length of the serialized key.
+     * @param force_md5 Use the MD5 digest even if the key fits in a key hash.
+     * @param max_key_length Maximum length of the serialized key of the type. When it does not fit in a key hash,
+     *                       the MD5 digest is used.
+     * @param [out] handle Key hash.
+     */
+    void get_key_hash(
+            const unsigned char* key,
+            uint32_t length,
+            bool force_md5,
+            size_t max_key_length,
+            rtps::InstanceHandle_t& handle)
+    {
+        if (!force_md5 && max_key_length <= 16)
+        {
+            // The key hash is the serialized key, padded with zeros
+            memset(handle.value, 0, 16);
+            memcpy(handle.value, key, length);
+            return;
+        }
+
+        lookup_key_.assign(reinterpret_cast<const char*>(key), length);
+        auto it = cache_.find(lookup_key_);
+        if (it != cache_.end())
+        {
+            handle = it->second;
+            return;
+        }
+
+        md5_.init();
+        md5_.update(key, length);
+        md5_.finalize();
+        memcpy(handle.value, md5_.digest, 16);
+
+        if (0 < max_entries_)
+        {
+            if (cache_.size() >= max_entries_)
+            {
+                cache_.clear();
+            }
+            cache_.emplace(lookup_key_, handle);
+        }
+    }
+
+    //! @return Number of keys remembered.
+    size_t size() const
+    {
+        return cache_.size();
+    }
+
+private:
+
+    size_t max_entries_;
+
+    MD5 md5_;
+
+    //! Reused to look up keys without allocating
+    std::string lookup_key_;
+
+    std::unordered_map<std::string, rtps::InstanceHandle_t> cache_;
+};
+
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _UTILS_KEYHASHCACHE_HPP_
@@ -0,0 +1,74 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Prefetch.hpp
+ */
+
+#ifndef UTILS_PREFETCH_HPP_
+#define UTILS_PREFETCH_HPP_
+
+#include <cstddef>
+#include <iterator>
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <xmmintrin.h>
+#endif // if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+
+namespace eprosima {
+
+/**
+ * Number of elements ahead of the current one whose pointee is prefetched when scanning a collection of pointers.
+ * It should cover the latency of a cache miss with the work done on each element of a history scan.
+ */
+constexpr std::ptrdiff_t PREFETCH_DISTANCE = 8;
+
+/**
+ * Hints the processor to bring to cache the line holding the given address, which will be read soon.
+ * It never faults, so any address can be given.
+ * @param address Address to prefetch.
+ */
+inline void prefetch_for_read(
+        const void* address)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+    static_cast<void>(address);
+#endif // if defined(__GNUC__) || defined(__clang__)
+}
+
+/**
+ * Prefetches the object pointed by the element PREFETCH_DISTANCE positions after the given one on a
+ * collection of pointers, when it exists. Calling it on each step of a scan hides the cache miss of
+ * dereferencing the following elements, whose addresses are already known.
+ * @param it Iterator to the current element.
+ * @param end End iterator of the collection.
+ */
+template<class Iterator>
+inline void prefetch_ahead(
+        Iterator it,
+        Iterator end)
+{
+    if (std::distance(it, end) > PREFETCH_DISTANCE)
+    {
+        prefetch_for_read(*(it + PREFETCH_DISTANCE));
+    }
+}
+
+} // namespace eprosima
+
+#endif // UTILS_PREFETCH_HPP_
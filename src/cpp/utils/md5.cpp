@@ -34,6 +34,8 @@ documentation and/or software.
 /* interface header */
 #include <fastrtps/utils/md5.h>
 
+#include <fastrtps/config.h>
+
 /* system implementation headers */
 #include <cstdio>
 #include <stdio.h>
@@ -138,9 +140,14 @@ void MD5::init()
 // decodes input (unsigned char) into output (uint4). Assumes len is a multiple of 4.
 void MD5::decode(uint4 output[], const uint1 input[], size_type len)
 {
+#if !FASTDDS_IS_BIG_ENDIAN_TARGET
+  // MD5 words are little endian, so they can be copied as they are
+  memcpy(output, input, len);
+#else
   for (unsigned int i = 0, j = 0; j < len; i++, j += 4)
     output[i] = ((uint4)input[j]) | (((uint4)input[j+1]) << 8) |
       (((uint4)input[j+2]) << 16) | (((uint4)input[j+3]) << 24);
+#endif // if !FASTDDS_IS_BIG_ENDIAN_TARGET
 }
 
 //////////////////////////////
@@ -149,12 +156,16 @@ void MD5::decode(uint4 output[], const uint1 input[], size_type len)
 // a multiple of 4.
 void MD5::encode(uint1 output[], const uint4 input[], size_type len)
 {
+#if !FASTDDS_IS_BIG_ENDIAN_TARGET
+  memcpy(output, input, len);
+#else
   for (size_type i = 0, j = 0; j < len; i++, j += 4) {
     output[j] = input[i] & 0xff;
     output[j+1] = (input[i] >> 8) & 0xff;
     output[j+2] = (input[i] >> 16) & 0xff;
     output[j+3] = (input[i] >> 24) & 0xff;
   }
+#endif // if !FASTDDS_IS_BIG_ENDIAN_TARGET
 }
 
 //////////////////////////////
@@ -241,9 +252,6 @@ void MD5::transform(const uint1 block[blocksize])
   state[1] += b;
   state[2] += c;
   state[3] += d;
-
-  // Zeroize sensitive information.
-  memset(x, 0, sizeof x);
 }
 
 //////////////////////////////
@@ -299,30 +307,24 @@ void MD5::update(const char input[], size_type length)
 // the message digest and zeroizing the context.
 MD5& MD5::finalize()
 {
-  static unsigned char padding[64] = {
-    0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-  };
-
   if (!finalized) {
-    // Save number of bits
-    unsigned char bits[8];
-    encode(bits, count, 8);
-
-    // pad out to 56 mod 64.
-    size_type index = count[0] / 8 % 64;
-    size_type padLen = (index < 56) ? (56 - index) : (120 - index);
-    update(padding, padLen);
+    // Pad the buffered bytes in place, out to 56 mod 64, instead of feeding the padding through update()
+    size_type index = count[0] / 8 % blocksize;
+    buffer[index++] = 0x80;
+    if (index > 56) {
+      memset(&buffer[index], 0, blocksize - index);
+      transform(buffer);
+      index = 0;
+    }
+    memset(&buffer[index], 0, 56 - index);
 
     // Append length (before padding)
-    update(bits, 8);
+    encode(&buffer[56], count, 8);
+    transform(buffer);
 
     // Store state in digest
     encode(digest, state, 16);
 
-    // Zeroize sensitive information.
-    memset(buffer, 0, sizeof buffer);
     memset(count, 0, sizeof count);
 
     finalized=true;
@@ -0,0 +1,420 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTDDS_PARTICIPANT_ID_LOCK_H_
+#define _FASTDDS_PARTICIPANT_ID_LOCK_H_
+
+#ifdef  _MSC_VER
+#include <io.h>
+#include <share.h>
+#else
+#include <sys/file.h>
+#include <unistd.h>
+#endif // ifdef  _MSC_VER
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SharedDir.hpp"
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Reservation of a participant identifier of a domain, for all the processes in the same machine.
+ * As the ports of a participant are computed from its identifier, it also reserves its port block.
+ *
+ * Each identifier is reserved by an exclusive lock on its own file, so it is released when the object is destroyed,
+ * and also when the owning process dies without destroying it. These files are never removed: removing a file
+ * while another process is about to lock it would let two processes lock different files with the same name.
+ *
+ * A registry file per domain keeps a bitmap of the reserved identifiers, so the lowest free identifier is found
+ * without probing the locks one by one. The registry is only a hint: the bits left set by processes which died
+ * are reclaimed, checking their locks, when the registry seems full.
+ */
+class ParticipantIdLock
+{
+public:
+
+    ~ParticipantIdLock()
+    {
+        close_file(fd_);
+
+        // Releasing after the lock was closed keeps the bit set while another process could not take it yet.
+        Registry registry(domain_id_);
+        if (registry.is_locked() && registry.load(participant_id_ + 1))
+        {
+            registry.set(participant_id_, false);
+            registry.store();
+        }
+    }
+
+    /**
+     * Try to reserve a participant identifier.
+     * @param domain_id Domain of the participant.
+     * @param participant_id Identifier to reserve.
+     * @return The reservation, or nullptr if it is held by another participant of the machine,
+     *         or the lock could not be created.
+     */
+    static std::unique_ptr<ParticipantIdLock> try_lock(
+            uint32_t domain_id,
+            uint32_t participant_id)
+    {
+        Registry registry(domain_id);
+        if (!registry.is_locked() || !registry.load(participant_id + 1))
+        {
+            return nullptr;
+        }
+
+        int fd = lock_id_file(domain_id, participant_id);
+        if (-1 == fd)
+        {
+            return nullptr;
+        }
+
+        registry.set(participant_id, true);
+        registry.store();
+        return std::unique_ptr<ParticipantIdLock>(new ParticipantIdLock(domain_id, participant_id, fd));
+    }
+
+    /**
+     * Reserve the lowest participant identifier not used by any participant of the machine.
+     * @param domain_id Domain of the participant.
+     * @param max_ids Number of valid identifiers.
+     * @param local_ids Identifiers already used by participants of this process, which are skipped.
+     * @return The reservation, or nullptr if there are no free identifiers, or the registry could not be used.
+     */
+    static std::unique_ptr<ParticipantIdLock> lock_lowest_free(
+            uint32_t domain_id,
+            uint32_t max_ids,
+            const std::set<uint32_t>& local_ids)
+    {
+        Registry registry(domain_id);
+        if (!registry.is_locked() || !registry.load(max_ids))
+        {
+            return nullptr;
+        }
+
+        for (bool reclaimed = false;; reclaimed = true)
+        {
+            uint32_t id = 0;
+            while (registry.lowest_clear(max_ids, local_ids, id))
+            {
+                // Taken by this process or by another one that found the bit cleared. Keep it set either way.
+                registry.set(id, true);
+
+                int fd = lock_id_file(domain_id, id);
+                if (-1 != fd)
+                {
+                    registry.store();
+                    return std::unique_ptr<ParticipantIdLock>(new ParticipantIdLock(domain_id, id, fd));
+                }
+            }
+
+            if (reclaimed)
+            {
+                break;
+            }
+
+            // The registry is full. Clear the bits of the identifiers no longer locked by anyone.
+            for (id = 0; id < max_ids; ++id)
+            {
+                if (registry.is_set(id) && local_ids.end() == local_ids.find(id))
+                {
+                    int fd = lock_id_file(domain_id, id);
+                    if (-1 != fd)
+                    {
+                        close_file(fd);
+                        registry.set(id, false);
+                    }
+                }
+            }
+        }
+
+        registry.store();
+        return nullptr;
+    }
+
+    /**
+     * @return The reserved participant identifier.
+     */
+    uint32_t participant_id() const
+    {
+        return participant_id_;
+    }
+
+private:
+
+    ParticipantIdLock(
+            uint32_t domain_id,
+            uint32_t participant_id,
+            int fd)
+        : domain_id_(domain_id)
+        , participant_id_(participant_id)
+        , fd_(fd)
+    {
+    }
+
+    /**
+     * Try to lock the file of an identifier.
+     * @return The descriptor of the locked file, or -1 if it is locked by another participant or cannot be opened.
+     */
+    static int lock_id_file(
+            uint32_t domain_id,
+            uint32_t participant_id)
+    {
+        return open_and_try_lock(SharedDir::get_lock_path(
+                           "fastdds_participant_" + std::to_string(domain_id) + "_" +
+                           std::to_string(participant_id)));
+    }
+
+    /**
+     * Bitmap of the reserved identifiers of a domain, locked for the lifetime of the object.
+     */
+    class Registry
+    {
+    public:
+
+        Registry(
+                uint32_t domain_id)
+            : fd_(open_and_lock(SharedDir::get_lock_path("fastdds_participant_ids_" + std::to_string(domain_id))))
+        {
+        }
+
+        ~Registry()
+        {
+            close_file(fd_);
+        }
+
+        bool is_locked() const
+        {
+            return -1 != fd_;
+        }
+
+        /**
+         * Read the bitmap from the file, with room for at least @c num_ids identifiers.
+         * The bits never written on the file are cleared.
+         */
+        bool load(
+                uint32_t num_ids)
+        {
+            words_.assign((num_ids + 63) / 64, 0);
+            return read_words(fd_, words_);
+        }
+
+        bool store()
+        {
+            return write_words(fd_, words_);
+        }
+
+        bool is_set(
+                uint32_t id) const
+        {
+            return 0 != (words_[id / 64] & (uint64_t(1) << (id % 64)));
+        }
+
+        void set(
+                uint32_t id,
+                bool value)
+        {
+            if (value)
+            {
+                words_[id / 64] |= uint64_t(1) << (id % 64);
+            }
+            else
+            {
+                words_[id / 64] &= ~(uint64_t(1) << (id % 64));
+            }
+        }
+
+        /**
+         * Find the lowest identifier with its bit cleared, skipping full words at once.
+         */
+        bool lowest_clear(
+                uint32_t max_ids,
+                const std::set<uint32_t>& skipped_ids,
+                uint32_t& id) const
+        {
+            for (size_t word = 0; word < words_.size(); ++word)
+            {
+                if (~uint64_t(0) == words_[word])
+                {
+                    continue;
+                }
+
+                for (id = static_cast<uint32_t>(word * 64); id < max_ids && id < (word + 1) * 64; ++id)
+                {
+                    if (!is_set(id) && skipped_ids.end() == skipped_ids.find(id))
+                    {
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+    private:
+
+        int fd_;
+
+        std::vector<uint64_t> words_;
+    };
+
+#ifdef _MSC_VER
+
+    static int open_and_try_lock(
+            const std::string& file_path)
+    {
+        // Exclusive sharing mode works as the lock
+        int fd;
+        if (0 != _sopen_s(&fd, file_path.c_str(), _O_CREAT | _O_RDWR, _SH_DENYRW, _S_IREAD | _S_IWRITE))
+        {
+            return -1;
+        }
+
+        return fd;
+    }
+
+    static int open_and_lock(
+            const std::string& file_path)
+    {
+        // The registry is only held while reserving or releasing an identifier
+        for (int tries = 0; tries < 1000; ++tries)
+        {
+            int fd = open_and_try_lock(file_path);
+            if (-1 != fd)
+            {
+                return fd;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return -1;
+    }
+
+    static void close_file(
+            int fd)
+    {
+        if (-1 != fd)
+        {
+            _close(fd);
+        }
+    }
+
+    static bool read_words(
+            int fd,
+            std::vector<uint64_t>& words)
+    {
+        unsigned int size = static_cast<unsigned int>(words.size() * sizeof(uint64_t));
+        return 0 == _lseek(fd, 0, SEEK_SET) && -1 != _read(fd, words.data(), size);
+    }
+
+    static bool write_words(
+            int fd,
+            const std::vector<uint64_t>& words)
+    {
+        unsigned int size = static_cast<unsigned int>(words.size() * sizeof(uint64_t));
+        return 0 == _lseek(fd, 0, SEEK_SET) && static_cast<int>(size) == _write(fd, words.data(), size);
+    }
+
+#else
+
+    static int open_and_try_lock(
+            const std::string& file_path)
+    {
+        int fd = open(file_path.c_str(), O_CREAT | O_RDWR, 0666);
+        if (-1 == fd)
+        {
+            return -1;
+        }
+
+        if (0 != flock(fd, LOCK_EX | LOCK_NB))
+        {
+            close(fd);
+            return -1;
+        }
+
+        return fd;
+    }
+
+    static int open_and_lock(
+            const std::string& file_path)
+    {
+        int fd = open(file_path.c_str(), O_CREAT | O_RDWR, 0666);
+        if (-1 == fd)
+        {
+            return -1;
+        }
+
+        // The registry is only held while reserving or releasing an identifier
+        if (0 != flock(fd, LOCK_EX))
+        {
+            close(fd);
+            return -1;
+        }
+
+        return fd;
+    }
+
+    static void close_file(
+            int fd)
+    {
+        if (-1 != fd)
+        {
+            // Closing the file releases its lock
+            close(fd);
+        }
+    }
+
+    static bool read_words(
+            int fd,
+            std::vector<uint64_t>& words)
+    {
+        // A short read leaves the bits not written yet cleared
+        return -1 != pread(fd, words.data(), words.size() * sizeof(uint64_t), 0);
+    }
+
+    static bool write_words(
+            int fd,
+            const std::vector<uint64_t>& words)
+    {
+        size_t size = words.size() * sizeof(uint64_t);
+        return static_cast<ssize_t>(size) == pwrite(fd, words.data(), size, 0);
+    }
+
+#endif // ifdef _MSC_VER
+
+    uint32_t domain_id_;
+
+    uint32_t participant_id_;
+
+    int fd_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_PARTICIPANT_ID_LOCK_H_
@@ -0,0 +1,230 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTDDS_SHAREDMEM_PAGES_H_
+#define _FASTDDS_SHAREDMEM_PAGES_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // ifdef __linux__
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Placement options for the pages of a shared memory segment.
+ * All of them are best effort: when the OS does not support them the segment keeps the default placement.
+ */
+struct SharedSegmentMemoryOptions
+{
+    //! Do not bind the pages to any NUMA node
+    static constexpr int32_t NUMA_NODE_NONE = -1;
+    //! Bind the pages to the NUMA node of the thread creating the segment
+    static constexpr int32_t NUMA_NODE_LOCAL = -2;
+
+    //! Ask the OS to back the segment with huge pages
+    bool huge_pages = false;
+
+    //! Fault in all the pages of the segment when it is created
+    bool prefault = false;
+
+    //! NUMA node where the pages are placed
+    int32_t numa_node = NUMA_NODE_NONE;
+
+    bool is_default() const
+    {
+        return !huge_pages && !prefault && NUMA_NODE_NONE == numa_node;
+    }
+
+};
+
+/**
+ * Helpers applying SharedSegmentMemoryOptions to a mapped memory region
+ */
+class SharedMemPages
+{
+public:
+
+    /**
+     * @return The size of the huge pages of the system, or 0 if it does not have them.
+     */
+    static size_t huge_page_size()
+    {
+        static size_t size = read_huge_page_size();
+        return size;
+    }
+
+    /**
+     * Rounds a segment size up, so the segment can be fully backed by huge pages.
+     */
+    static size_t round_to_huge_page_size(
+            size_t size)
+    {
+        size_t page_size = huge_page_size();
+        return (0 == page_size) ? size : ((size + page_size - 1) / page_size) * page_size;
+    }
+
+    /**
+     * Applies the options to a mapped region.
+     * Pages already faulted in keep their huge page setting, so it should be called before the bulk of the region
+     * is written for the first time.
+     * @return false if any of the options could not be applied.
+     */
+    static bool apply(
+            void* address,
+            size_t size,
+            const SharedSegmentMemoryOptions& options)
+    {
+        if (options.is_default())
+        {
+            return true;
+        }
+
+        bool ret = true;
+
+#ifdef __linux__
+        // The region may not start on a page boundary
+        uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+        uintptr_t begin = reinterpret_cast<uintptr_t>(address) & ~(page_size - 1);
+        size_t length = static_cast<size_t>(reinterpret_cast<uintptr_t>(address) + size - begin);
+        void* region = reinterpret_cast<void*>(begin);
+
+#ifdef MADV_HUGEPAGE
+        // Transparent huge pages for shmem / file mappings, when enabled on the system
+        if (options.huge_pages && 0 != madvise(region, length, MADV_HUGEPAGE))
+        {
+            ret = false;
+        }
+#endif // ifdef MADV_HUGEPAGE
+
+        if (SharedSegmentMemoryOptions::NUMA_NODE_NONE != options.numa_node)
+        {
+            ret &= bind_to_numa_node(region, length, options.numa_node);
+        }
+
+        if (options.prefault)
+        {
+            prefault(region, length, page_size);
+        }
+#else
+        static_cast<void>(address);
+        static_cast<void>(size);
+        ret = false;
+#endif // ifdef __linux__
+
+        return ret;
+    }
+
+private:
+
+    static size_t read_huge_page_size()
+    {
+        size_t size = 0;
+#ifdef __linux__
+        FILE* meminfo = fopen("/proc/meminfo", "r");
+        if (nullptr != meminfo)
+        {
+            char line[128];
+            while (nullptr != fgets(line, sizeof(line), meminfo))
+            {
+                unsigned long kb = 0;
+                if (1 == sscanf(line, "Hugepagesize: %lu kB", &kb))
+                {
+                    size = static_cast<size_t>(kb) * 1024u;
+                    break;
+                }
+            }
+            fclose(meminfo);
+        }
+#endif // ifdef __linux__
+        return size;
+    }
+
+#ifdef __linux__
+    static bool bind_to_numa_node(
+            void* region,
+            size_t length,
+            int32_t numa_node)
+    {
+#if defined(SYS_mbind) && defined(SYS_getcpu)
+        if (SharedSegmentMemoryOptions::NUMA_NODE_LOCAL == numa_node)
+        {
+            unsigned cpu = 0;
+            unsigned node = 0;
+            if (0 != syscall(SYS_getcpu, &cpu, &node, nullptr))
+            {
+                return false;
+            }
+            numa_node = static_cast<int32_t>(node);
+        }
+
+        constexpr size_t bits_per_mask = sizeof(unsigned long) * 8;
+        if (numa_node < 0 || static_cast<size_t>(numa_node) >= bits_per_mask * 16)
+        {
+            return false;
+        }
+
+        // Values from <numaif.h>, so libnuma is not needed
+        constexpr int mpol_bind = 2;
+        constexpr unsigned mpol_mf_move = 1u << 1;
+
+        unsigned long node_mask[16] = {};
+        node_mask[numa_node / bits_per_mask] = 1ul << (numa_node % bits_per_mask);
+        return 0 == syscall(SYS_mbind, region, length, mpol_bind, node_mask, bits_per_mask * 16 + 1, mpol_mf_move);
+#else
+        static_cast<void>(region);
+        static_cast<void>(length);
+        static_cast<void>(numa_node);
+        return false;
+#endif // if defined(SYS_mbind) && defined(SYS_getcpu)
+    }
+
+    static void prefault(
+            void* region,
+            size_t length,
+            uintptr_t page_size)
+    {
+#ifdef MADV_POPULATE_WRITE
+        if (0 == madvise(region, length, MADV_POPULATE_WRITE))
+        {
+            return;
+        }
+#endif // ifdef MADV_POPULATE_WRITE
+
+        // Older kernels: touch every page, preserving its contents
+        volatile char* page = static_cast<volatile char*>(region);
+        volatile char* end = page + length;
+        for (; page < end; page += page_size)
+        {
+            *page = *page;
+        }
+    }
+
+#endif // ifdef __linux__
+
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_SHAREDMEM_PAGES_H_
@@ -41,6 +41,7 @@
 #include <boost/thread/thread_time.hpp>
 
 #include "RobustInterprocessCondition.hpp"
+#include "SharedMemPages.hpp"
 #include "SharedMemUUID.hpp"
 
 namespace eprosima {
@@ -371,6 +372,30 @@ public:
         return segment_->check_sanity();
     }
 
+    /**
+     * Applies the placement options to the pages of the segment.
+     * Should be called right after creating the segment. Boost has already written the segment header by then,
+     * so the pages holding it may keep the default placement, but the memory allocated afterwards is affected.
+     * @return false if any of the options could not be applied.
+     */
+    bool apply_memory_options(
+            const SharedSegmentMemoryOptions& options)
+    {
+        return SharedMemPages::apply(segment_->get_address(), segment_->get_size(), options);
+    }
+
+    /**
+     * Computes the size to request on creation so the whole segment is covered by huge pages, if requested.
+     */
+    static size_t size_for_memory_options(
+            size_t size,
+            const SharedSegmentMemoryOptions& options)
+    {
+        return options.huge_pages ?
+               SharedMemPages::round_to_huge_page_size(size + EXTRA_SEGMENT_SIZE) - EXTRA_SEGMENT_SIZE :
+               size;
+    }
+
     /**
      * @return The segment's size in bytes, including internal structures overhead.
      */
@@ -668,7 +668,8 @@ public:
         return ret_value;
     }
 
-    void wait_writer_undiscovery()
+    void wait_writer_undiscovery(
+            unsigned int matched = 0)
     {
         std::unique_lock<std::mutex> lock(mutexDiscovery_);
 
@@ -676,7 +677,7 @@ public:
 
         cvDiscovery_.wait(lock, [&]()
                 {
-                    return matched_ == 0;
+                    return matched_ <= matched;
                 });
 
         std::cout << "Reader removal finished..." << std::endl;
@@ -817,6 +818,13 @@ public:
         return *this;
     }
 
+    PubSubReader& time_based_filter(
+            const eprosima::fastrtps::Duration_t minimum_separation)
+    {
+        datareader_qos_.time_based_filter().minimum_separation = minimum_separation;
+        return *this;
+    }
+
     bool update_deadline_period(
             const eprosima::fastrtps::Duration_t& deadline_period)
     {
@@ -827,6 +835,12 @@ public:
         return (datareader_->set_qos(datareader_qos) == ReturnCode_t::RETCODE_OK);
     }
 
+    PubSubReader& ownership_exclusive()
+    {
+        datareader_qos_.ownership().kind = eprosima::fastdds::dds::EXCLUSIVE_OWNERSHIP_QOS;
+        return *this;
+    }
+
     PubSubReader& liveliness_kind(
             const eprosima::fastrtps::LivelinessQosPolicyKind& kind)
     {
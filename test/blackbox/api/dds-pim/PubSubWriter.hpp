@@ -758,6 +758,19 @@ public:
         return *this;
     }
 
+    PubSubWriter& ownership_exclusive()
+    {
+        datawriter_qos_.ownership().kind = eprosima::fastdds::dds::EXCLUSIVE_OWNERSHIP_QOS;
+        return *this;
+    }
+
+    PubSubWriter& ownership_strength(
+            uint32_t strength)
+    {
+        datawriter_qos_.ownership_strength().value = strength;
+        return *this;
+    }
+
     PubSubWriter& liveliness_kind(
             const eprosima::fastrtps::LivelinessQosPolicyKind kind)
     {
@@ -21,6 +21,13 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <set>
+#include <tuple>
+#include <vector>
+
 #include <fastrtps/utils/TimeConversion.h>
 #include <rtps/transport/test_UDPv4Transport.h>
 
@@ -160,3 +167,225 @@ TEST(AcknackQos, NotRecoverAfterLosingCommunicationWithDisablePositiveAck)
     // Block reader until reception finished or timeout.
     ASSERT_EQ(reader.block_for_all(std::chrono::seconds(1)), 0u);
 }
+
+/**
+ * Counts the submessages of a kind that are sent between the same writer and reader than a previous one on the
+ * same message.
+ */
+static uint32_t count_repeated_submessages(
+        const CDRMessage_t& msg,
+        octet submessage_id)
+{
+    uint32_t count = 0;
+    GuidPrefix_t destination;
+    std::set<std::tuple<GuidPrefix_t, std::vector<octet>>> seen;
+    uint32_t pos = RTPSMESSAGE_HEADER_SIZE;
+    while (pos + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE <= msg.length)
+    {
+        bool little_endian = 0 != (msg.buffer[pos + 1] & 0x01);
+        uint16_t length = little_endian ?
+                static_cast<uint16_t>(msg.buffer[pos + 2] | (msg.buffer[pos + 3] << 8)) :
+                static_cast<uint16_t>((msg.buffer[pos + 2] << 8) | msg.buffer[pos + 3]);
+        const octet* body = &msg.buffer[pos + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE];
+
+        if (INFO_DST == msg.buffer[pos] && length >= GuidPrefix_t::size)
+        {
+            memcpy(destination.value, body, GuidPrefix_t::size);
+        }
+        else if (submessage_id == msg.buffer[pos] && length >= 8)
+        {
+            // Reader and writer ids
+            if (!seen.emplace(destination, std::vector<octet>(body, body + 8)).second)
+            {
+                ++count;
+            }
+        }
+
+        if (0 == length)
+        {
+            break;
+        }
+        pos += RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + length;
+    }
+
+    return count;
+}
+
+TEST(AcknackQos, AggregatedHeartbeatsAndAcknacks)
+{
+    // This test enables the aggregation of periodic control messages on both participants, with an aggregation
+    // period much bigger than the heartbeat period.
+    // The ACKNACKs of the reader are dropped for a while, so the writer keeps sending periodic heartbeats.
+    // Only the latest HEARTBEAT and ACKNACK between the same writer and reader should be sent on each tick, and
+    // the reader should receive all the samples once the ACKNACKs are allowed again.
+
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    std::atomic<bool> drop_acknacks(false);
+    std::atomic<uint32_t> heartbeats(0);
+    std::atomic<uint32_t> repeated_heartbeats(0);
+    std::atomic<uint32_t> repeated_acknacks(0);
+
+    PropertyPolicy participant_policy;
+    participant_policy.properties().emplace_back("fastdds.message_aggregation_period", "100");
+
+    auto writer_transport = std::make_shared<test_UDPv4TransportDescriptor>();
+    writer_transport->drop_heartbeat_messages_filter_ = [&heartbeats, &repeated_heartbeats](CDRMessage_t& msg)
+            {
+                ++heartbeats;
+                repeated_heartbeats += count_repeated_submessages(msg, HEARTBEAT);
+                return false;
+            };
+
+    auto reader_transport = std::make_shared<test_UDPv4TransportDescriptor>();
+    reader_transport->drop_ack_nack_messages_filter_ = [&drop_acknacks, &repeated_acknacks](CDRMessage_t& msg)
+            {
+                repeated_acknacks += count_repeated_submessages(msg, ACKNACK);
+                return drop_acknacks.load();
+            };
+
+    writer.history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS)
+            .reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS)
+            .heartbeat_period_seconds(0)
+            .heartbeat_period_nanosec(10 * 1000 * 1000)
+            .property_policy(participant_policy)
+            .disable_builtin_transport()
+            .add_user_transport_to_pparams(writer_transport)
+            .init();
+
+    reader.history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS)
+            .reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS)
+            .property_policy(participant_policy)
+            .disable_builtin_transport()
+            .add_user_transport_to_pparams(reader_transport)
+            .init();
+
+    ASSERT_TRUE(reader.isInitialized());
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    drop_acknacks = true;
+
+    std::list<HelloWorld> data = default_helloworld_data_generator();
+    reader.startReception(data);
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    drop_acknacks = false;
+
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+    EXPECT_TRUE(writer.waitForAllAcked(std::chrono::seconds(5)));
+
+    // The writer kept sending periodic heartbeats while the ACKNACKs were dropped
+    EXPECT_LT(0u, heartbeats.load());
+    EXPECT_EQ(0u, repeated_heartbeats.load());
+    EXPECT_EQ(0u, repeated_acknacks.load());
+}
+
+TEST(AcknackQos, CoalescedRepairsToMulticastReaders)
+{
+    // This test enables repair coalescing on a writer matched with several readers listening on the same multicast
+    // locator. The first transmission of some samples is lost, so the readers ask for the same samples at almost the
+    // same time.
+    // All the readers should receive all the samples, and the lost samples should be repaired with fewer DATA
+    // messages than one per reader.
+
+    PubSubReader<HelloWorldType> reader_1(TEST_TOPIC_NAME);
+    PubSubReader<HelloWorldType> reader_2(TEST_TOPIC_NAME);
+    PubSubReader<HelloWorldType> reader_3(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    PropertyPolicy writer_policy;
+    writer_policy.properties().emplace_back("fastdds.repair_coalescing_window", "20");
+
+    std::mutex sends_mutex;
+    std::map<SequenceNumber_t, uint32_t> sends;
+    uint32_t lost = 0;
+    uint32_t repairs = 0;
+
+    auto writer_transport = std::make_shared<test_UDPv4TransportDescriptor>();
+    writer_transport->drop_data_messages_filter_ = [&](CDRMessage_t& msg)
+            {
+                auto old_pos = msg.pos;
+                EntityId_t writer_id;
+                SequenceNumber_t sequence_number;
+                msg.pos += 8;
+                CDRMessage::readEntityId(&msg, &writer_id);
+                CDRMessage::readInt32(&msg, &sequence_number.high);
+                CDRMessage::readUInt32(&msg, &sequence_number.low);
+                msg.pos = old_pos;
+
+                // Only the samples of the user writer
+                if (0xC0 == (writer_id.value[3] & 0xC0))
+                {
+                    return false;
+                }
+
+                std::lock_guard<std::mutex> guard(sends_mutex);
+                uint32_t& count = sends[sequence_number];
+                if (0 == sequence_number.low % 4)
+                {
+                    if (0 == count++)
+                    {
+                        ++lost;
+                        return true;
+                    }
+                    ++repairs;
+                }
+                return false;
+            };
+
+    writer.history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS)
+            .reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS)
+            .heartbeat_period_seconds(0)
+            .heartbeat_period_nanosec(50 * 1000 * 1000)
+            .entity_property_policy(writer_policy)
+            .disable_builtin_transport()
+            .add_user_transport_to_pparams(writer_transport)
+            .init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    for (PubSubReader<HelloWorldType>* reader : {&reader_1, &reader_2, &reader_3})
+    {
+        reader->history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS)
+                .reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS)
+                .add_to_multicast_locator_list("239.255.1.4", global_port)
+                .init();
+        ASSERT_TRUE(reader->isInitialized());
+    }
+
+    // Wait for discovery.
+    writer.wait_discovery(3u);
+    reader_1.wait_discovery();
+    reader_2.wait_discovery();
+    reader_3.wait_discovery();
+
+    std::list<HelloWorld> data = default_helloworld_data_generator();
+    reader_1.startReception(data);
+    reader_2.startReception(data);
+    reader_3.startReception(data);
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+
+    // Block readers until reception finished or timeout.
+    reader_1.block_for_all();
+    reader_2.block_for_all();
+    reader_3.block_for_all();
+    EXPECT_TRUE(writer.waitForAllAcked(std::chrono::seconds(5)));
+
+    std::lock_guard<std::mutex> guard(sends_mutex);
+    EXPECT_LT(0u, lost);
+    EXPECT_LE(lost, repairs);
+    EXPECT_LT(repairs, 3u * lost);
+}
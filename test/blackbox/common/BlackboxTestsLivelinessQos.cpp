@@ -1891,6 +1891,72 @@ TEST_P(LivelinessQos, AssertLivelinessParticipant)
     EXPECT_EQ(publishers.pub_times_liveliness_lost(), 2u);
 }
 
+//! Tests that liveliness is lost and recovered as expected when the builtin endpoints of the
+//! participants are created lazily (property fastdds.lazy_builtin_endpoints)
+//! Writer is reliable, and MANUAL_BY_PARTICIPANT
+//! Reader is reliable, and MANUAL_BY_PARTICIPANT
+TEST_P(LivelinessQos, LazyBuiltinEndpoints_ManualByParticipant_Reliable)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    config_pdp(writer, reader);
+
+    PropertyPolicy participant_policy;
+    participant_policy.properties().emplace_back("fastdds.lazy_builtin_endpoints", "true");
+
+    // Number of samples to write
+    unsigned int num_samples = 2;
+
+    // Liveliness lease duration and announcement period, in milliseconds
+    unsigned int lease_duration_ms = 1500;
+    unsigned int announcement_period_ms = 1;
+
+    reader.reliability(RELIABLE_RELIABILITY_QOS)
+            .liveliness_kind(MANUAL_BY_PARTICIPANT_LIVELINESS_QOS)
+            .liveliness_lease_duration(lease_duration_ms * 1e-3)
+            .property_policy(participant_policy)
+            .init();
+    writer.reliability(RELIABLE_RELIABILITY_QOS)
+            .liveliness_kind(MANUAL_BY_PARTICIPANT_LIVELINESS_QOS)
+            .liveliness_announcement_period(announcement_period_ms * 1e-3)
+            .liveliness_lease_duration(lease_duration_ms * 1e-3)
+            .property_policy(participant_policy)
+            .init();
+
+    ASSERT_TRUE(reader.isInitialized());
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator(num_samples);
+    reader.startReception(data);
+
+    unsigned int count = 0;
+    for (auto data_sample : data)
+    {
+        ++count;
+        writer.send_sample(data_sample);
+        reader.wait_liveliness_recovered(count);
+        reader.wait_liveliness_lost(count);
+        writer.wait_liveliness_lost(count);
+    }
+
+    for (count = 0; count < num_samples; count++)
+    {
+        writer.assert_liveliness();
+        reader.wait_liveliness_recovered(count + num_samples + 1);
+        reader.wait_liveliness_lost(count + num_samples + 1);
+        writer.wait_liveliness_lost(count + num_samples + 1);
+    }
+
+    EXPECT_EQ(writer.times_liveliness_lost(), num_samples * 2);
+    EXPECT_EQ(reader.times_liveliness_lost(), num_samples * 2);
+    EXPECT_EQ(reader.times_liveliness_recovered(), num_samples * 2);
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z, w) INSTANTIATE_TEST_SUITE_P(x, y, z, w)
 #else
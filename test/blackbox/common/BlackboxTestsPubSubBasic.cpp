@@ -666,6 +666,45 @@ TEST_P(PubSubBasic, unique_flows_one_writer_two_readers)
     EXPECT_TRUE(writer.waitForAllAcked(std::chrono::seconds(30)));
 }
 
+TEST_P(PubSubBasic, SharedTransportsOneWriterTwoReaders)
+{
+    // All the participants share their transports and event thread, so the readers listen on the same locators.
+    // Each reader should receive all the samples.
+    PubSubReader<HelloWorldType> reader_1(TEST_TOPIC_NAME);
+    PubSubReader<HelloWorldType> reader_2(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    PropertyPolicy participant_policy;
+    participant_policy.properties().emplace_back("fastdds.shared_transports", "true");
+    participant_policy.properties().emplace_back("fastdds.shared_event_thread", "true");
+
+    reader_1.history_depth(100).reliability(RELIABLE_RELIABILITY_QOS).property_policy(participant_policy).init();
+    reader_2.history_depth(100).reliability(RELIABLE_RELIABILITY_QOS).property_policy(participant_policy).init();
+    writer.history_depth(100).property_policy(participant_policy).init();
+
+    ASSERT_TRUE(reader_1.isInitialized());
+    ASSERT_TRUE(reader_2.isInitialized());
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery(2u);
+    reader_1.wait_discovery();
+    reader_2.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+    reader_1.startReception(data);
+    reader_2.startReception(data);
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block readers until reception finished or timeout.
+    reader_1.block_for_all();
+    reader_2.block_for_all();
+    EXPECT_TRUE(writer.waitForAllAcked(std::chrono::seconds(30)));
+}
+
 template<typename T>
 static void two_consecutive_writers(
         PubSubReader<T>& reader,
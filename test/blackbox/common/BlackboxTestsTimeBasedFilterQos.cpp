@@ -0,0 +1,123 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BlackboxTests.hpp"
+
+#include "PubSubReader.hpp"
+#include "PubSubWriter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/transport/test_UDPv4TransportDescriptor.h>
+
+#include <atomic>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using test_UDPv4TransportDescriptor = eprosima::fastdds::rtps::test_UDPv4TransportDescriptor;
+
+// Number of samples written, one per millisecond
+static constexpr size_t num_samples = 2500u;
+
+/*!
+ * Checks that the writer only sends the samples that pass the TIME_BASED_FILTER of the reader.
+ * @param reliability Reliability of both the reader and the writer.
+ * @param expect_gaps Whether the writer should send GAPs for the samples filtered.
+ */
+static void check_writer_side_time_based_filter(
+        ReliabilityQosPolicyKind reliability,
+        bool expect_gaps)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    std::atomic<uint32_t> data_sent(0);
+    std::atomic<uint32_t> gaps_sent(0);
+
+    auto is_user_writer = [](
+        CDRMessage_t& msg)
+            {
+                auto old_pos = msg.pos;
+                EntityId_t writer_id;
+                msg.pos += 8;
+                CDRMessage::readEntityId(&msg, &writer_id);
+                msg.pos = old_pos;
+                return 0xC0 != (writer_id.value[3] & 0xC0);
+            };
+
+    auto writer_transport = std::make_shared<test_UDPv4TransportDescriptor>();
+    writer_transport->drop_data_messages_filter_ = [&](CDRMessage_t& msg)
+            {
+                if (is_user_writer(msg))
+                {
+                    ++data_sent;
+                }
+                return false;
+            };
+    writer_transport->drop_gap_messages_filter_ = [&](CDRMessage_t& msg)
+            {
+                if (is_user_writer(msg))
+                {
+                    ++gaps_sent;
+                }
+                return false;
+            };
+
+    reader.reliability(reliability)
+            .time_based_filter(Duration_t(1, 0))
+            .init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.reliability(reliability)
+            .disable_builtin_transport()
+            .add_user_transport_to_pparams(writer_transport)
+            .init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator(num_samples);
+    reader.startReception(data);
+    writer.send(data, 1);
+    ASSERT_TRUE(data.empty());
+
+    if (RELIABLE_RELIABILITY_QOS == reliability)
+    {
+        // The filtered samples are acknowledged through GAPs
+        EXPECT_TRUE(writer.waitForAllAcked(std::chrono::seconds(10)));
+    }
+
+    // One sample per second should have been sent, instead of one per millisecond.
+    // Room is left for some repairs.
+    size_t received = reader.block_for_at_least(2u);
+    EXPECT_LE(2u, received);
+    EXPECT_GE(2u * (1u + num_samples / 1000u), data_sent.load());
+    EXPECT_LE(received, data_sent.load());
+
+    if (expect_gaps)
+    {
+        EXPECT_LT(0u, gaps_sent.load());
+    }
+}
+
+TEST(TimeBasedFilterQos, WriterSideFilterReliable)
+{
+    check_writer_side_time_based_filter(RELIABLE_RELIABILITY_QOS, true);
+}
+
+TEST(TimeBasedFilterQos, WriterSideFilterBestEffort)
+{
+    check_writer_side_time_based_filter(BEST_EFFORT_RELIABILITY_QOS, false);
+}
@@ -21,6 +21,9 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <thread>
+
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 
@@ -159,6 +162,109 @@ TEST_P(DDSDataReader, LivelinessChangedStatusGet)
 
 }
 
+// Samples are drained with take_to_ring into a ring smaller than the history, so the free slots wrap around.
+TEST_P(DDSDataReader, TakeToRing)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.reliability(RELIABLE_RELIABILITY_QOS).history_kind(KEEP_ALL_HISTORY_QOS).init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.reliability(RELIABLE_RELIABILITY_QOS).history_kind(KEEP_ALL_HISTORY_QOS).init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator(20);
+    auto expected = data;
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+    ASSERT_TRUE(writer.waitForAllAcked(std::chrono::seconds(10)));
+
+    std::vector<HelloWorld> samples(8);
+    std::vector<void*> slots;
+    for (HelloWorld& sample : samples)
+    {
+        slots.push_back(&sample);
+    }
+    eprosima::fastdds::dds::SampleRing ring(slots);
+
+    auto& native_reader = reader.get_native_reader();
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, native_reader.take_to_ring(ring, 5));
+    EXPECT_EQ(5, ring.size());
+
+    while (!expected.empty())
+    {
+        // Consume only some samples each time, so the next call fills both ends of the ring
+        ReturnCode_t ret = native_reader.take_to_ring(ring);
+        ASSERT_TRUE(ReturnCode_t::RETCODE_OK == ret || ReturnCode_t::RETCODE_NO_DATA == ret);
+        ASSERT_FALSE(ring.empty());
+
+        for (int n = 0; n < 3 && !ring.empty(); ++n)
+        {
+            ASSERT_TRUE(ring.info().valid_data);
+            EXPECT_EQ(expected.front(), *static_cast<HelloWorld*>(ring.data()));
+            expected.pop_front();
+            ring.pop();
+        }
+    }
+
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(ReturnCode_t::RETCODE_NO_DATA, native_reader.take_to_ring(ring));
+}
+
+// Samples are taken into an attached ring on reception.
+TEST_P(DDSDataReader, SampleRingFilledOnReception)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.reliability(RELIABLE_RELIABILITY_QOS).history_kind(KEEP_ALL_HISTORY_QOS).init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.reliability(RELIABLE_RELIABILITY_QOS).history_kind(KEEP_ALL_HISTORY_QOS).init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    std::vector<HelloWorld> samples(10);
+    std::vector<void*> slots;
+    for (HelloWorld& sample : samples)
+    {
+        slots.push_back(&sample);
+    }
+    eprosima::fastdds::dds::SampleRing ring(slots);
+
+    auto& native_reader = reader.get_native_reader();
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, native_reader.set_sample_ring(&ring));
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator(10);
+    auto expected = data;
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+    ASSERT_TRUE(writer.waitForAllAcked(std::chrono::seconds(10)));
+
+    // The history is drained on reception
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (ring.size() < 10 && std::chrono::steady_clock::now() < timeout)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(10, ring.size());
+    EXPECT_EQ(0u, native_reader.get_unread_count());
+    for (const HelloWorld& sample : expected)
+    {
+        ASSERT_FALSE(ring.empty());
+        EXPECT_EQ(sample, *static_cast<HelloWorld*>(ring.data()));
+        ring.pop();
+    }
+
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, native_reader.set_sample_ring(nullptr));
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z, w) INSTANTIATE_TEST_SUITE_P(x, y, z, w)
 #else
@@ -683,4 +683,91 @@ TEST(DDSDataSharing, DataSharingDefaultDirectory)
     ASSERT_TRUE(data.empty());
     // Block reader until reception finished or timeout.
     reader.block_for_all();
-}
\ No newline at end of file
+}
+
+// Same as StringType, but announced as unbounded so the writer uses a variable-size payload pool
+class UnboundedStringType : public StringType
+{
+public:
+
+    bool is_bounded() const override
+    {
+        return false;
+    }
+
+};
+
+TEST(DDSDataSharing, UnboundedPayloadsChangingSize)
+{
+    PubSubReader<UnboundedStringType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<UnboundedStringType> writer(TEST_TOPIC_NAME);
+
+    // Disable transports to ensure we are using datasharing
+    auto testTransport = std::make_shared<test_UDPv4TransportDescriptor>();
+    testTransport->dropDataMessagesPercentage = 100;
+
+    // Small enough for the sizes below to need split and merged nodes
+    PropertyPolicy properties;
+    properties.properties().emplace_back("fastdds.datasharing.max_payload_memory", "49152");
+
+    PropertyPolicy reader_properties;
+    reader_properties.properties().emplace_back("fastdds.datasharing.unbounded", "true");
+
+    reader.history_kind(KEEP_ALL_HISTORY_QOS)
+            .add_user_transport_to_pparams(testTransport)
+            .entity_property_policy(reader_properties)
+            .datasharing_on(".")
+            .reliability(RELIABLE_RELIABILITY_QOS).init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(3)
+            .add_user_transport_to_pparams(testTransport)
+            .entity_property_policy(properties)
+            .datasharing_on(".")
+            .reliability(RELIABLE_RELIABILITY_QOS).init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    std::list<String> data;
+    auto add_samples = [&data](const std::vector<size_t>& sizes, size_t repetitions)
+            {
+                for (size_t n = 0; n < repetitions; ++n)
+                {
+                    for (size_t size : sizes)
+                    {
+                        String str;
+                        str.message(std::to_string(data.size()) + std::string(size, 'a'));
+                        data.push_back(str);
+                    }
+                }
+            };
+
+    // Many size classes, then tiny samples so the region is mostly free before the large ones
+    add_samples({100, 600, 1200, 2300, 4500, 7800}, 3);
+    add_samples({100}, 6);
+    // Only fit after merging the free nodes of the previous phase
+    add_samples({9500}, 12);
+    // Split the large nodes again
+    add_samples({100, 600, 1200, 2300, 4500, 7800}, 3);
+
+    reader.startReception(data);
+    writer.send(data, 5);
+    ASSERT_TRUE(data.empty());
+    reader.block_for_all();
+}
+
+TEST(DDSDataSharing, UnboundedPayloadsInvalidMemory)
+{
+    PubSubWriter<UnboundedStringType> writer(TEST_TOPIC_NAME);
+
+    // Not a plain number, so the variable-size pool is not used and data sharing cannot be forced
+    PropertyPolicy properties;
+    properties.properties().emplace_back("fastdds.datasharing.max_payload_memory", "48k");
+
+    writer.entity_property_policy(properties)
+            .datasharing_on(".")
+            .init();
+    ASSERT_FALSE(writer.isInitialized());
+}
@@ -0,0 +1,271 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <atomic>
+
+#include "BlackboxTests.hpp"
+
+#include "PubSubReader.hpp"
+#include "PubSubWriter.hpp"
+#include <fastrtps/xmlparser/XMLProfileManager.h>
+#include <rtps/transport/test_UDPv4Transport.h>
+
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+using test_UDPv4TransportDescriptor = eprosima::fastdds::rtps::test_UDPv4TransportDescriptor;
+
+enum communication_type
+{
+    TRANSPORT,
+    INTRAPROCESS,
+    DATASHARING
+};
+
+class DDSDataWriter : public testing::TestWithParam<communication_type>
+{
+public:
+
+    void SetUp() override
+    {
+        LibrarySettingsAttributes library_settings;
+        switch (GetParam())
+        {
+            case INTRAPROCESS:
+                library_settings.intraprocess_delivery = IntraprocessDeliveryType::INTRAPROCESS_FULL;
+                xmlparser::XMLProfileManager::library_settings(library_settings);
+                break;
+            case DATASHARING:
+                enable_datasharing = true;
+                break;
+            case TRANSPORT:
+            default:
+                break;
+        }
+    }
+
+    void TearDown() override
+    {
+        LibrarySettingsAttributes library_settings;
+        switch (GetParam())
+        {
+            case INTRAPROCESS:
+                library_settings.intraprocess_delivery = IntraprocessDeliveryType::INTRAPROCESS_OFF;
+                xmlparser::XMLProfileManager::library_settings(library_settings);
+                break;
+            case DATASHARING:
+                enable_datasharing = false;
+                break;
+            case TRANSPORT:
+            default:
+                break;
+        }
+    }
+
+    void write_batch_and_check(
+            PubSubWriter<HelloWorldType>& writer,
+            PubSubReader<HelloWorldType>& reader,
+            size_t samples_count)
+    {
+        writer.wait_discovery();
+        reader.wait_discovery();
+
+        auto data = default_helloworld_data_generator(samples_count);
+        reader.startReception(data);
+
+        std::vector<void*> batch;
+        for (auto& sample : data)
+        {
+            batch.push_back(&sample);
+        }
+
+        ASSERT_EQ(ReturnCode_t::RETCODE_OK, writer.get_native_writer().write_batch(batch));
+
+        reader.block_for_all();
+    }
+
+};
+
+TEST_P(DDSDataWriter, WriteBatchReliable)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.reliability(RELIABLE_RELIABILITY_QOS).history_kind(KEEP_ALL_HISTORY_QOS).init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.reliability(RELIABLE_RELIABILITY_QOS).history_kind(KEEP_ALL_HISTORY_QOS).init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    write_batch_and_check(writer, reader, 100);
+}
+
+TEST_P(DDSDataWriter, WriteBatchReliableAsync)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.reliability(RELIABLE_RELIABILITY_QOS).history_kind(KEEP_ALL_HISTORY_QOS).init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.reliability(RELIABLE_RELIABILITY_QOS).history_kind(KEEP_ALL_HISTORY_QOS)
+            .asynchronously(ASYNCHRONOUS_PUBLISH_MODE).init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    write_batch_and_check(writer, reader, 100);
+}
+
+// The batch is bigger than the writer history, so the writer has to wait for acknowledgements in the middle of it.
+TEST_P(DDSDataWriter, WriteBatchBiggerThanHistory)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.reliability(RELIABLE_RELIABILITY_QOS).history_kind(KEEP_ALL_HISTORY_QOS).init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.reliability(RELIABLE_RELIABILITY_QOS).history_kind(KEEP_ALL_HISTORY_QOS)
+            .resource_limits_max_samples(10).resource_limits_allocated_samples(10)
+            .heartbeat_period_seconds(0).heartbeat_period_nanosec(20 * 1000 * 1000)
+            .max_blocking_time({10, 0}).init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    write_batch_and_check(writer, reader, 50);
+}
+
+TEST_P(DDSDataWriter, WriteBatchInvalidSamples)
+{
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    writer.init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    std::vector<void*> batch {nullptr};
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, writer.get_native_writer().write_batch(batch));
+
+    // No sample is written when any of them is not valid
+    HelloWorld valid_sample;
+    batch = {&valid_sample, nullptr};
+    size_t written = 1;
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, writer.get_native_writer().write_batch(batch, written));
+    EXPECT_EQ(0u, written);
+
+    batch.clear();
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, writer.get_native_writer().write_batch(batch));
+}
+
+// The memory reported for the writer accounts for the samples kept on its history and for its matched reader.
+TEST_P(DDSDataWriter, MemoryUsage)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.reliability(RELIABLE_RELIABILITY_QOS).history_kind(KEEP_ALL_HISTORY_QOS).init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.reliability(RELIABLE_RELIABILITY_QOS).history_kind(KEEP_ALL_HISTORY_QOS).init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    write_batch_and_check(writer, reader, 10);
+
+    ParticipantMemoryUsage usage;
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, writer.getParticipant()->get_memory_usage(usage));
+    EXPECT_EQ(writer.participant_guid(), usage.guid);
+
+    MemoryUsage total = usage.total();
+    EXPECT_LT(0u, total.in_use);
+    EXPECT_LE(total.in_use, total.reserved);
+
+    auto endpoint = std::find_if(usage.endpoints.begin(), usage.endpoints.end(),
+                    [&writer](const EndpointMemoryUsage& endpoint_usage)
+                    {
+                        return endpoint_usage.guid == writer.datawriter_guid();
+                    });
+    ASSERT_NE(usage.endpoints.end(), endpoint);
+    EXPECT_LT(0u, endpoint->history.in_use);
+    EXPECT_LE(endpoint->history.in_use, endpoint->history.reserved);
+    EXPECT_LT(0u, endpoint->payloads.in_use);
+    EXPECT_LT(0u, endpoint->matched_proxies.in_use);
+}
+
+#if HAVE_LZ4 || HAVE_ZSTD
+// Samples bigger than the fragment size are compressed, so they reach a reader announcing support in a single DATA.
+TEST_P(DDSDataWriter, CompressedPayloads)
+{
+    PubSubReader<Data64kbType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<Data64kbType> writer(TEST_TOPIC_NAME);
+
+    reader.reliability(RELIABLE_RELIABILITY_QOS).history_kind(KEEP_ALL_HISTORY_QOS).init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    std::atomic<uint32_t> data_frags{0};
+    auto test_transport = std::make_shared<test_UDPv4TransportDescriptor>();
+    test_transport->drop_data_frag_messages_filter_ = [&data_frags](CDRMessage_t&)
+            {
+                ++data_frags;
+                return false;
+            };
+
+    PropertyPolicy properties;
+    properties.properties().emplace_back("fastdds.compression", HAVE_LZ4 ? "lz4" : "zstd");
+    writer.reliability(RELIABLE_RELIABILITY_QOS).history_kind(KEEP_ALL_HISTORY_QOS)
+            .disable_builtin_transport().add_user_transport_to_pparams(test_transport)
+            .entity_property_policy(properties).init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_data64kb_data_generator(5);
+    reader.startReception(data);
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+    reader.block_for_all();
+
+    if (TRANSPORT == GetParam())
+    {
+        EXPECT_EQ(0u, data_frags.load());
+    }
+}
+
+#endif // if HAVE_LZ4 || HAVE_ZSTD
+
+#ifdef INSTANTIATE_TEST_SUITE_P
+#define GTEST_INSTANTIATE_TEST_MACRO(x, y, z, w) INSTANTIATE_TEST_SUITE_P(x, y, z, w)
+#else
+#define GTEST_INSTANTIATE_TEST_MACRO(x, y, z, w) INSTANTIATE_TEST_CASE_P(x, y, z, w)
+#endif // ifdef INSTANTIATE_TEST_SUITE_P
+
+GTEST_INSTANTIATE_TEST_MACRO(DDSDataWriter,
+        DDSDataWriter,
+        testing::Values(TRANSPORT, INTRAPROCESS, DATASHARING),
+        [](const testing::TestParamInfo<DDSDataWriter::ParamType>& info)
+        {
+            switch (info.param)
+            {
+                case INTRAPROCESS:
+                    return "Intraprocess";
+                    break;
+                case DATASHARING:
+                    return "Datasharing";
+                    break;
+                case TRANSPORT:
+                default:
+                    return "Transport";
+            }
+
+        });
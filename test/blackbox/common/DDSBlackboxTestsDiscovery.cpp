@@ -12,18 +12,24 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
 #include <chrono>
 #include <cstdlib>
 #include <ctime>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "BlackboxTests.hpp"
 #include "PubSubParticipant.hpp"
 #include "PubSubReader.hpp"
+#include "PubSubWriter.hpp"
 
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
 #include <fastdds/rtps/common/Locator.h>
 #include <utils/SystemInfo.hpp>
 
@@ -168,3 +174,107 @@ TEST(DDSDiscovery, AddDiscoveryServerToList)
     server_2.wait_discovery(std::chrono::seconds::zero(), 2, true);
 }
 
+
+/**
+ * This test checks that the periodic announcements of a participant which did not change are not notified as
+ * QoS updates, while a real change still is.
+ */
+TEST(DDSDiscovery, UnchangedAnnouncementsAreIgnored)
+{
+    eprosima::fastdds::dds::WireProtocolConfigQos wire_protocol;
+    wire_protocol.builtin.discovery_config.leaseDuration_announcementperiod =
+            eprosima::fastrtps::Duration_t(0, 100000000);
+
+    PubSubParticipant<HelloWorldType> participant_1(0u, 0u, 0u, 0u);
+    ASSERT_TRUE(participant_1.wire_protocol(wire_protocol).user_data({'a'}).init_participant());
+
+    std::atomic<uint32_t> qos_updates(0u);
+    PubSubParticipant<HelloWorldType> participant_2(0u, 0u, 0u, 0u);
+    participant_2.set_on_participant_qos_update_function(
+        [&qos_updates](const eprosima::fastrtps::rtps::ParticipantDiscoveryInfo& info) -> bool
+        {
+            ++qos_updates;
+            return info.info.m_userData == std::vector<eprosima::fastrtps::rtps::octet>({'b'});
+        });
+    ASSERT_TRUE(participant_2.init_participant());
+
+    participant_1.wait_discovery();
+    participant_2.wait_discovery();
+
+    // Let several announcements arrive
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    EXPECT_EQ(0u, qos_updates.load());
+
+    ASSERT_TRUE(participant_1.update_user_data({'b'}));
+    participant_2.wait_qos_update();
+
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    EXPECT_EQ(1u, qos_updates.load());
+}
+
+// Endpoints created after the announcements of remote endpoints on their topics were kept aside by the EDP interest
+// filter still match them.
+TEST(DDSDiscovery, LateEndpointsOnFilteredTopicsMatch)
+{
+    eprosima::fastrtps::rtps::PropertyPolicy properties;
+    properties.properties().emplace_back("fastdds.edp_interest_filter", "true");
+
+    const std::string late_writer_topic = TEST_TOPIC_NAME + "_late_writer";
+
+    PubSubParticipant<HelloWorldType> filtered(1u, 1u, 0u, 0u);
+    filtered.property_policy(properties)
+            .sub_topic_name(TEST_TOPIC_NAME)
+            .pub_topic_name(late_writer_topic);
+    ASSERT_TRUE(filtered.init_participant());
+
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+    writer.init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    PubSubReader<HelloWorldType> reader(late_writer_topic);
+    reader.init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    // Let the announcements of the remote endpoints arrive while there are no local endpoints on their topics
+    ASSERT_TRUE(filtered.wait_discovery(std::chrono::seconds(10), 2));
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    EXPECT_FALSE(writer.is_matched());
+    EXPECT_FALSE(reader.is_matched());
+
+    ASSERT_TRUE(filtered.init_subscriber(0));
+    writer.wait_discovery(std::chrono::seconds(10));
+    EXPECT_TRUE(writer.is_matched());
+    filtered.sub_wait_discovery(1u, std::chrono::seconds(10));
+
+    ASSERT_TRUE(filtered.init_publisher(0));
+    reader.wait_discovery(std::chrono::seconds(10));
+    EXPECT_TRUE(reader.is_matched());
+    filtered.pub_wait_discovery(1u, std::chrono::seconds(10));
+}
+
+// The host-wide identifier reserved when a participant is created is kept when it is enabled, so its guid does not
+// change.
+TEST(DDSDiscovery, HostWideIdKeptOnEnable)
+{
+    using namespace eprosima::fastdds::dds;
+
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    DomainParticipantFactoryQos factory_qos;
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, factory->get_qos(factory_qos));
+    factory_qos.entity_factory().autoenable_created_entities = false;
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, factory->set_qos(factory_qos));
+
+    DomainParticipantQos qos = PARTICIPANT_QOS_DEFAULT;
+    qos.properties().properties().emplace_back("fastdds.host_participant_id", "true");
+    DomainParticipant* participant =
+            factory->create_participant(static_cast<uint32_t>(GET_PID()) % 230, qos);
+    ASSERT_NE(nullptr, participant);
+
+    eprosima::fastrtps::rtps::GUID_t guid = participant->guid();
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, participant->enable());
+    EXPECT_EQ(guid, participant->guid());
+
+    factory_qos.entity_factory().autoenable_created_entities = true;
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, factory->set_qos(factory_qos));
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, factory->delete_participant(participant));
+}
@@ -0,0 +1,194 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BlackboxTests.hpp"
+
+#include "PubSubReader.hpp"
+#include "PubSubWriter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+/**
+ * Takes all the samples available in the reader.
+ * @return the indexes of the valid samples taken, in reception order.
+ */
+static std::vector<uint16_t> take_indexes(
+        PubSubReader<HelloWorldType>& reader)
+{
+    std::vector<uint16_t> indexes;
+    HelloWorld data;
+    eprosima::fastdds::dds::SampleInfo info;
+    while (ReturnCode_t::RETCODE_OK == reader.get_native_reader().take_next_sample(&data, &info))
+    {
+        if (info.valid_data)
+        {
+            indexes.push_back(data.index());
+        }
+    }
+    return indexes;
+}
+
+/**
+ * Sends a sample with the given index and waits until the reader acknowledges it.
+ */
+static void send_index(
+        PubSubWriter<HelloWorldType>& writer,
+        uint16_t index)
+{
+    HelloWorld data;
+    data.index(index);
+    data.message("HelloWorld");
+    ASSERT_TRUE(writer.send_sample(data));
+    ASSERT_TRUE(writer.waitForAllAcked(std::chrono::seconds(10)));
+}
+
+class OwnershipQos : public testing::Test
+{
+public:
+
+    void SetUp() override
+    {
+        reader_.reliability(RELIABLE_RELIABILITY_QOS)
+                .history_kind(KEEP_ALL_HISTORY_QOS)
+                .ownership_exclusive();
+        weak_writer_.reliability(RELIABLE_RELIABILITY_QOS)
+                .ownership_exclusive()
+                .ownership_strength(10);
+        strong_writer_.reliability(RELIABLE_RELIABILITY_QOS)
+                .ownership_exclusive()
+                .ownership_strength(20);
+    }
+
+    void init()
+    {
+        reader_.init();
+        ASSERT_TRUE(reader_.isInitialized());
+        weak_writer_.init();
+        ASSERT_TRUE(weak_writer_.isInitialized());
+        strong_writer_.init();
+        ASSERT_TRUE(strong_writer_.isInitialized());
+
+        reader_.wait_discovery(std::chrono::seconds::zero(), 2);
+        weak_writer_.wait_discovery();
+        strong_writer_.wait_discovery();
+    }
+
+protected:
+
+    PubSubReader<HelloWorldType> reader_{TEST_TOPIC_NAME};
+    PubSubWriter<HelloWorldType> weak_writer_{TEST_TOPIC_NAME};
+    PubSubWriter<HelloWorldType> strong_writer_{TEST_TOPIC_NAME};
+};
+
+// The strongest writer takes the ownership and the samples of weaker writers are discarded.
+TEST_F(OwnershipQos, StrongestWriterWins)
+{
+    init();
+
+    // Without owner, any writer takes the ownership.
+    send_index(weak_writer_, 1);
+    EXPECT_EQ(std::vector<uint16_t>({1}), take_indexes(reader_));
+
+    send_index(strong_writer_, 2);
+    EXPECT_EQ(std::vector<uint16_t>({2}), take_indexes(reader_));
+
+    send_index(weak_writer_, 3);
+    EXPECT_TRUE(take_indexes(reader_).empty());
+
+    send_index(strong_writer_, 4);
+    EXPECT_EQ(std::vector<uint16_t>({4}), take_indexes(reader_));
+}
+
+// Between writers with the same strength, the one with the lowest GUID owns the instance.
+TEST_F(OwnershipQos, TieBrokenByGuid)
+{
+    strong_writer_.ownership_strength(10);
+    init();
+
+    bool weak_is_lower = weak_writer_.datawriter_guid() < strong_writer_.datawriter_guid();
+    PubSubWriter<HelloWorldType>& lower = weak_is_lower ? weak_writer_ : strong_writer_;
+    PubSubWriter<HelloWorldType>& higher = weak_is_lower ? strong_writer_ : weak_writer_;
+
+    send_index(higher, 1);
+    EXPECT_EQ(std::vector<uint16_t>({1}), take_indexes(reader_));
+
+    send_index(lower, 2);
+    EXPECT_EQ(std::vector<uint16_t>({2}), take_indexes(reader_));
+
+    send_index(higher, 3);
+    EXPECT_TRUE(take_indexes(reader_).empty());
+}
+
+// The ownership is handed over to a weaker writer when the owner is unmatched.
+TEST_F(OwnershipQos, HandoverOnUnmatch)
+{
+    init();
+
+    send_index(strong_writer_, 1);
+    send_index(weak_writer_, 2);
+    EXPECT_EQ(std::vector<uint16_t>({1}), take_indexes(reader_));
+
+    strong_writer_.destroy();
+    reader_.wait_writer_undiscovery(1);
+
+    send_index(weak_writer_, 3);
+    EXPECT_EQ(std::vector<uint16_t>({3}), take_indexes(reader_));
+}
+
+// The ownership is handed over to a weaker writer when the owner loses its liveliness.
+TEST_F(OwnershipQos, HandoverOnLivelinessLost)
+{
+    strong_writer_.liveliness_kind(MANUAL_BY_TOPIC_LIVELINESS_QOS)
+            .liveliness_lease_duration(Duration_t(0, 500000000));
+    init();
+
+    send_index(strong_writer_, 1);
+    send_index(weak_writer_, 2);
+    EXPECT_EQ(std::vector<uint16_t>({1}), take_indexes(reader_));
+
+    reader_.wait_liveliness_lost();
+
+    send_index(weak_writer_, 3);
+    EXPECT_EQ(std::vector<uint16_t>({3}), take_indexes(reader_));
+}
+
+// The ownership is handed over to a weaker writer when the instance misses its deadline.
+TEST_F(OwnershipQos, HandoverOnDeadlineMissed)
+{
+    reader_.deadline_period(Duration_t(0, 500000000));
+    weak_writer_.deadline_period(Duration_t(0, 500000000));
+    strong_writer_.deadline_period(Duration_t(0, 500000000));
+    init();
+
+    send_index(strong_writer_, 1);
+    send_index(weak_writer_, 2);
+    EXPECT_EQ(std::vector<uint16_t>({1}), take_indexes(reader_));
+
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (0u == reader_.missed_deadlines() && std::chrono::steady_clock::now() < timeout)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    ASSERT_LT(0u, reader_.missed_deadlines());
+
+    send_index(weak_writer_, 3);
+    EXPECT_EQ(std::vector<uint16_t>({3}), take_indexes(reader_));
+}
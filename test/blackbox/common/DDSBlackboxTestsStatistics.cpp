@@ -130,8 +130,12 @@ TEST(DDSStatistics, simple_statistics_datareaders)
 
     // Reader should be reliable so ACKNACK messages are generated (and accounted)
     data_reader.reliability(RELIABLE_RELIABILITY_QOS).history_depth(depth).init();
+    // Adaptive timing makes the writer measure, and report, the round trip time to the reader
+    eprosima::fastrtps::rtps::PropertyPolicy writer_properties;
+    writer_properties.properties().emplace_back("fastdds.adaptive_timing", "true");
     // Enforce synchronous writer to force RTPS_SENT to have at least num_samples
-    data_writer.asynchronously(SYNCHRONOUS_PUBLISH_MODE).history_depth(depth).init();
+    data_writer.asynchronously(SYNCHRONOUS_PUBLISH_MODE).history_depth(depth)
+            .entity_property_policy(writer_properties).init();
 
     // Ensure discovery traffic is not included on statistics
     data_reader.wait_discovery();
@@ -173,7 +177,9 @@ TEST(DDSStatistics, simple_statistics_datareaders)
         {"DISCOVERY_TOPIC",                 statistics::DISCOVERY_TOPIC,                1},
         {"PDP_PACKETS_TOPIC",               statistics::PDP_PACKETS_TOPIC,              1},
         {"EDP_PACKETS_TOPIC",               statistics::EDP_PACKETS_TOPIC,              1},
-        {"PHYSICAL_DATA_TOPIC",             statistics::PHYSICAL_DATA_TOPIC,            1}
+        {"PHYSICAL_DATA_TOPIC",             statistics::PHYSICAL_DATA_TOPIC,            1},
+        {"MEMORY_USAGE_TOPIC",              statistics::MEMORY_USAGE_TOPIC,             1},
+        {"ROUND_TRIP_TIME_TOPIC",           statistics::ROUND_TRIP_TIME_TOPIC,          1}
     };
 
     std::vector<std::tuple<std::string, std::string, std::size_t>> reader_statistics_kinds = {
@@ -21,6 +21,7 @@
 #include <fastrtps/xmlparser/XMLProfileManager.h>
 #include <fastrtps/transport/test_UDPv4TransportDescriptor.h>
 #include <rtps/transport/test_UDPv4Transport.h>
+#include <utils/shared_memory/ParticipantIdLock.hpp>
 
 #include <gtest/gtest.h>
 
@@ -568,6 +569,44 @@ TEST_P(RTPS, RTPSAsReliableTransientLocalTwoWritersConsecutives)
     writer.destroy();
 }
 
+// Participants with host-wide identifiers skip the identifiers reserved by other processes of the host.
+TEST(RTPSParticipant, HostWideIdSkipsReservedIds)
+{
+    using eprosima::fastdds::rtps::ParticipantIdLock;
+
+    uint32_t domain_id = static_cast<uint32_t>(GET_PID()) % 230;
+
+    // Emulate another process of the host holding the first identifiers
+    std::unique_ptr<ParticipantIdLock> id_0 = ParticipantIdLock::try_lock(domain_id, 0);
+    std::unique_ptr<ParticipantIdLock> id_1 = ParticipantIdLock::try_lock(domain_id, 1);
+    ASSERT_TRUE(id_0 && id_1);
+
+    // A reserved identifier cannot be reserved again
+    EXPECT_FALSE(ParticipantIdLock::try_lock(domain_id, 0));
+
+    RTPSParticipantAttributes attributes;
+    attributes.properties.properties().emplace_back("fastdds.host_participant_id", "true");
+
+    RTPSParticipant* participant = RTPSDomain::createParticipant(domain_id, attributes);
+    ASSERT_NE(nullptr, participant);
+    EXPECT_EQ(2, participant->getRTPSParticipantAttributes().participantID);
+
+    // The participant holds the reservation of its identifier
+    EXPECT_FALSE(ParticipantIdLock::try_lock(domain_id, 2));
+
+    // The lowest free identifier is taken
+    id_0.reset();
+    RTPSParticipant* second_participant = RTPSDomain::createParticipant(domain_id, attributes);
+    ASSERT_NE(nullptr, second_participant);
+    EXPECT_EQ(0, second_participant->getRTPSParticipantAttributes().participantID);
+
+    // Removing the participant releases its reservation
+    ASSERT_TRUE(RTPSDomain::removeRTPSParticipant(participant));
+    EXPECT_TRUE(ParticipantIdLock::try_lock(domain_id, 2));
+
+    ASSERT_TRUE(RTPSDomain::removeRTPSParticipant(second_participant));
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z, w) INSTANTIATE_TEST_SUITE_P(x, y, z, w)
 #else
@@ -56,6 +56,12 @@ class DomainParticipantListener;
 class PublisherListener;
 class TopicDescription;
 
+namespace recording {
+
+class Recorder;
+
+} // namespace recording
+
 class DomainParticipantImpl
 {
     friend class DomainParticipantFactory;
@@ -443,6 +449,18 @@ public:
         return ReturnCode_t::RETCODE_OK;
     }
 
+    ReturnCode_t get_memory_usage(
+            fastrtps::rtps::ParticipantMemoryUsage& usage) const
+    {
+        if (nullptr == rtps_participant_)
+        {
+            return ReturnCode_t::RETCODE_NOT_ENABLED;
+        }
+
+        rtps_participant_->get_memory_usage(usage);
+        return ReturnCode_t::RETCODE_OK;
+    }
+
     DomainParticipant* get_participant() const
     {
         return participant_;
@@ -493,6 +511,11 @@ public:
         return rtps_participant_->get_resource_event();
     }
 
+    recording::Recorder* recorder() const
+    {
+        return nullptr;
+    }
+
     fastrtps::rtps::SampleIdentity get_type_dependencies(
             const fastrtps::types::TypeIdentifierSeq& in) const
     {
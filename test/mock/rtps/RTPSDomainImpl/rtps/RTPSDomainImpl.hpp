@@ -12,7 +12,17 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <memory>
+
 namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+class ParticipantIdLock;
+
+} // namespace rtps
+} // namespace fastdds
+
 namespace fastrtps {
 namespace rtps {
 
@@ -53,6 +63,19 @@ public:
     {
     }
 
+    static bool use_host_wide_participant_id(
+            const RTPSParticipantAttributes& /*attrs*/)
+    {
+        return false;
+    }
+
+    static std::unique_ptr<fastdds::rtps::ParticipantIdLock> reserve_participant_id(
+            uint32_t /*domain_id*/,
+            const RTPSParticipantAttributes& /*attrs*/)
+    {
+        return nullptr;
+    }
+
 };
 
 } // namespace rtps
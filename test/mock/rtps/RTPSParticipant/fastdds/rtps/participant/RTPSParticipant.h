@@ -20,6 +20,7 @@
 #include <memory>
 #include <fastrtps/fastrtps_dll.h>
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/reader/StatefulReader.h>
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
 #include <fastdds/rtps/resources/ResourceEvent.h>
@@ -170,6 +171,13 @@ public:
         return true;
     }
 
+    void get_memory_usage(
+            ParticipantMemoryUsage& usage) const
+    {
+        usage = ParticipantMemoryUsage();
+        usage.guid = m_guid;
+    }
+
 #if HAVE_SECURITY
 
     MOCK_METHOD1(is_security_enabled_for_writer, bool(
@@ -31,6 +31,15 @@
 #include <gmock/gmock.h>
 
 namespace eprosima {
+
+namespace fastdds {
+namespace rtps {
+
+class FlowControllerSampleBatch;
+
+} // namespace rtps
+} // namespace fastdds
+
 namespace fastrtps {
 namespace rtps {
 
@@ -116,8 +125,14 @@ public:
 
     MOCK_METHOD1(set_separate_sending, void(bool));
 
+    MOCK_METHOD1(set_transport_priority, void(int32_t));
+
     MOCK_METHOD0(getRTPSParticipant, RTPSParticipantImpl* ());
 
+    MOCK_CONST_METHOD1(can_send_compressed, bool(uint8_t));
+
+    MOCK_METHOD1(keep_uncompressed_payload, void(const SerializedPayload_t&));
+
     MOCK_METHOD0 (getTypeMaxSerialized, uint32_t());
 
     MOCK_METHOD1(calculateMaxDataSize, uint32_t(uint32_t));
@@ -160,6 +175,18 @@ public:
     {
     }
 
+    void begin_sample_batch(
+            fastdds::rtps::FlowControllerSampleBatch&)
+    {
+    }
+
+    bool end_sample_batch(
+            fastdds::rtps::FlowControllerSampleBatch&,
+            const std::chrono::time_point<std::chrono::steady_clock>&)
+    {
+        return true;
+    }
+
     virtual bool try_remove_change(
             const std::chrono::steady_clock::time_point&,
             std::unique_lock<RecursiveTimedMutex>&)
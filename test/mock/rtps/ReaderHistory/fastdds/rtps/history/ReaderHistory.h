@@ -79,6 +79,17 @@ public:
         return true;
     }
 
+    virtual bool can_change_be_added_nts(
+            CacheChange_t*)
+    {
+        return true;
+    }
+
+    virtual void writer_unmatched(
+            const GUID_t&)
+    {
+    }
+
     bool remove_change(
             CacheChange_t* change)
     {
@@ -28,6 +28,7 @@
 #include <fastrtps/rtps/common/SequenceNumber.h>
 #include <fastrtps/rtps/messages/RTPSMessageGroup.h>
 #include <fastrtps/rtps/common/LocatorSelectorEntry.hpp>
+#include <fastdds/rtps/writer/ReaderTimeBasedFilter.hpp>
 
 
 namespace eprosima {
@@ -233,11 +234,30 @@ public:
         return 0;
     }
 
+    ReaderTimeBasedFilter& time_based_filter()
+    {
+        return time_based_filter_;
+    }
+
+    void accepted_compression(
+            uint8_t mask)
+    {
+        accepted_compression_ = mask;
+    }
+
+    bool accepts_compression(
+            uint8_t compression_kind) const
+    {
+        return 0 != (accepted_compression_ & (1u << compression_kind));
+    }
+
 private:
 
     GUID_t remote_guid_;
     std::vector<GuidPrefix_t> guid_prefix_as_vector_;
     std::vector<GUID_t> guid_as_vector_;
+    ReaderTimeBasedFilter time_based_filter_;
+    uint8_t accepted_compression_ = 0;
 };
 
 } /* namespace rtps */
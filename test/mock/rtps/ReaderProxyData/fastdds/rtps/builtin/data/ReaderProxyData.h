@@ -92,6 +92,17 @@ public:
         return false;
     }
 
+    void accepted_compression(
+            const std::string& algorithms)
+    {
+        accepted_compression_ = algorithms;
+    }
+
+    std::string accepted_compression() const
+    {
+        return accepted_compression_;
+    }
+
     void add_unicast_locator(
             const Locator_t& locator)
     {
@@ -361,6 +372,7 @@ private:
     InstanceHandle_t m_RTPSParticipantKey;
     uint16_t m_userDefinedId;
 
+    std::string accepted_compression_;
 };
 
 } // namespace rtps
@@ -62,6 +62,28 @@ typedef struct SharedMemTransportDescriptor : public TransportDescriptorInterfac
         segment_size_ = segment_size;
     }
 
+    RTPS_DllAPI uint32_t max_segment_size() const
+    {
+        return max_segment_size_;
+    }
+
+    RTPS_DllAPI void max_segment_size(
+            uint32_t max_segment_size)
+    {
+        max_segment_size_ = max_segment_size;
+    }
+
+    RTPS_DllAPI uint32_t extent_idle_timeout_ms() const
+    {
+        return extent_idle_timeout_ms_;
+    }
+
+    RTPS_DllAPI void extent_idle_timeout_ms(
+            uint32_t extent_idle_timeout_ms)
+    {
+        extent_idle_timeout_ms_ = extent_idle_timeout_ms;
+    }
+
     virtual uint32_t max_message_size() const override
     {
         return maxMessageSize;
@@ -106,12 +128,50 @@ typedef struct SharedMemTransportDescriptor : public TransportDescriptorInterfac
         rtps_dump_file_ = rtps_dump_file;
     }
 
+    RTPS_DllAPI bool huge_pages() const
+    {
+        return huge_pages_;
+    }
+
+    RTPS_DllAPI void huge_pages(
+            bool huge_pages)
+    {
+        huge_pages_ = huge_pages;
+    }
+
+    RTPS_DllAPI bool prefault_segment() const
+    {
+        return prefault_segment_;
+    }
+
+    RTPS_DllAPI void prefault_segment(
+            bool prefault_segment)
+    {
+        prefault_segment_ = prefault_segment;
+    }
+
+    RTPS_DllAPI int32_t numa_node() const
+    {
+        return numa_node_;
+    }
+
+    RTPS_DllAPI void numa_node(
+            int32_t numa_node)
+    {
+        numa_node_ = numa_node;
+    }
+
 private:
 
     uint32_t segment_size_;
+    uint32_t max_segment_size_ = 0;
+    uint32_t extent_idle_timeout_ms_ = 5000;
     uint32_t port_queue_capacity_;
     uint32_t healthy_check_timeout_ms_;
     std::string rtps_dump_file_;
+    bool huge_pages_ = false;
+    bool prefault_segment_ = false;
+    int32_t numa_node_ = -1;
 
 }SharedMemTransportDescriptor;
 
@@ -77,17 +77,14 @@ public:
 
     MOCK_METHOD0(send_periodic_heartbeat, bool());
 
+    MOCK_METHOD0(get_seq_num_min, SequenceNumber_t());
+
 
     RTPSParticipantImpl* getRTPSParticipant()
     {
         return participant_;
     }
 
-    SequenceNumber_t get_seq_num_min()
-    {
-        return SequenceNumber_t(0, 0);
-    }
-
     SequenceNumber_t next_sequence_number() const
     {
         return mp_history->next_sequence_number();
@@ -112,7 +109,7 @@ private:
 
     WriterHistory* mp_history;
 
-    fastdds::rtps::IReaderDataFilter* reader_data_filter_;
+    fastdds::rtps::IReaderDataFilter* reader_data_filter_ = nullptr;
 
 };
 
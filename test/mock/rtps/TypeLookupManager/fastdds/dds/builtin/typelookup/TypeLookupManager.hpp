@@ -65,10 +65,10 @@ public:
     {
     }
 
-    MOCK_CONST_METHOD1(get_type_dependencies, fastrtps::rtps::SampleIdentity(
+    MOCK_METHOD1(get_type_dependencies, fastrtps::rtps::SampleIdentity(
                 const fastrtps::types::TypeIdentifierSeq&));
 
-    MOCK_CONST_METHOD1(get_types, fastrtps::rtps::SampleIdentity(
+    MOCK_METHOD1(get_types, fastrtps::rtps::SampleIdentity(
                 const fastrtps::types::TypeIdentifierSeq&));
 
 };
@@ -15,6 +15,8 @@
 #ifndef UDP_TRANSPORT_DESCRIPTOR
 #define UDP_TRANSPORT_DESCRIPTOR
 
+#include <map>
+
 #include <fastrtps/transport/SocketTransportDescriptor.h>
 
 namespace eprosima{
@@ -54,6 +56,8 @@ typedef struct UDPTransportDescriptor: public SocketTransportDescriptor
    uint16_t m_output_udp_socket;
    
    bool non_blocking_send = false;
+
+   std::map<int32_t, uint8_t> transport_priority_dscp;
 } UDPTransportDescriptor;
 
 } // namespace rtps
@@ -0,0 +1,374 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_ControlAggregationTest.cpp
+ *
+ * Measures the packet rate and the CPU time saved by aggregating the periodic HEARTBEATs and ACKNACKs of a
+ * participant (property fastdds.message_aggregation_period).
+ * A participant with many reliable writers, each one on its own topic, publishes to a participant with a reader on
+ * each topic, first without aggregation and then with it. For each run, the UDP datagrams sent per second by the
+ * host and the CPU time used by the process are reported.
+ * Only the UDPv4 transport is used, and intraprocess delivery is disabled, so all the traffic goes through the
+ * network stack. The datagram count is read from /proc/net/snmp, so it is only available on Linux, and it includes
+ * the traffic of other processes of the host.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+#include <fastrtps/xmlparser/XMLProfileManager.h>
+
+using namespace eprosima::fastdds::dds;
+
+using clock_type = std::chrono::steady_clock;
+
+//! Sample made of a single counter
+class CounterType : public TopicDataType
+{
+public:
+
+    CounterType()
+    {
+        setName("ControlAggregationCounter");
+        m_typeSize = 4u + 4u;
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void* data,
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload) override
+    {
+        // Encapsulation (CDR_LE) followed by the counter
+        payload->data[0] = 0;
+        payload->data[1] = 1;
+        payload->data[2] = 0;
+        payload->data[3] = 0;
+        memcpy(&payload->data[4], data, sizeof(uint32_t));
+        payload->length = 8u;
+        return true;
+    }
+
+    bool deserialize(
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+            void* data) override
+    {
+        if (payload->length < 8u)
+        {
+            return false;
+        }
+        memcpy(data, &payload->data[4], sizeof(uint32_t));
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void*) override
+    {
+        return []() -> uint32_t
+               {
+                   return 8u;
+               };
+    }
+
+    void* createData() override
+    {
+        return new uint32_t(0);
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<uint32_t*>(data);
+    }
+
+    bool getKey(
+            void*,
+            eprosima::fastrtps::rtps::InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+//! Counts the samples received and the writers matched by all the readers
+class CounterReaderListener : public DataReaderListener
+{
+public:
+
+    void on_data_available(
+            DataReader* reader) override
+    {
+        uint32_t counter = 0;
+        SampleInfo info;
+        while (ReturnCode_t::RETCODE_OK == reader->take_next_sample(&counter, &info))
+        {
+            if (info.valid_data)
+            {
+                ++received;
+            }
+        }
+    }
+
+    void on_subscription_matched(
+            DataReader*,
+            const SubscriptionMatchedStatus& info) override
+    {
+        matched += info.current_count_change;
+    }
+
+    std::atomic<uint64_t> received{0};
+    std::atomic<int32_t> matched{0};
+};
+
+//! @return The UDP datagrams sent by the host, or 0 when they are not available.
+static uint64_t udp_out_datagrams()
+{
+    std::ifstream snmp("/proc/net/snmp");
+    std::string header;
+    std::string values;
+    while (std::getline(snmp, header))
+    {
+        if (0 == header.compare(0, 4, "Udp:") && std::getline(snmp, values))
+        {
+            std::stringstream header_stream(header);
+            std::stringstream values_stream(values);
+            std::string name;
+            std::string value;
+            while (header_stream >> name && values_stream >> value)
+            {
+                if ("OutDatagrams" == name)
+                {
+                    return std::strtoull(value.c_str(), nullptr, 10);
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+static DomainParticipant* create_participant(
+        uint32_t domain_id,
+        uint32_t aggregation_period_ms)
+{
+    DomainParticipantQos qos = PARTICIPANT_QOS_DEFAULT;
+    qos.transport().use_builtin_transports = false;
+    qos.transport().user_transports.push_back(std::make_shared<eprosima::fastdds::rtps::UDPv4TransportDescriptor>());
+    if (0 < aggregation_period_ms)
+    {
+        qos.properties().properties().emplace_back("fastdds.message_aggregation_period",
+                std::to_string(aggregation_period_ms));
+    }
+    return DomainParticipantFactory::get_instance()->create_participant(domain_id, qos);
+}
+
+//! Publishes on every topic for the given time and prints the traffic and CPU time measured
+static bool run(
+        uint32_t domain_id,
+        uint32_t num_topics,
+        uint32_t heartbeat_period_ms,
+        uint32_t write_period_ms,
+        uint32_t seconds,
+        uint32_t aggregation_period_ms)
+{
+    TypeSupport type(new CounterType());
+    CounterReaderListener listener;
+    DomainParticipant* writer_participant = create_participant(domain_id, aggregation_period_ms);
+    DomainParticipant* reader_participant = create_participant(domain_id, aggregation_period_ms);
+    bool ok = nullptr != writer_participant && nullptr != reader_participant;
+
+    std::vector<DataWriter*> writers;
+    if (ok)
+    {
+        type.register_type(writer_participant);
+        type.register_type(reader_participant);
+        Publisher* publisher = writer_participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+        Subscriber* subscriber = reader_participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+
+        DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+        writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+        writer_qos.reliable_writer_qos().times.heartbeatPeriod =
+                eprosima::fastrtps::Duration_t(static_cast<long double>(heartbeat_period_ms) / 1000.0L);
+        DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+        reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+
+        for (uint32_t n = 0; ok && n < num_topics; ++n)
+        {
+            std::string topic_name = "ControlAggregationTopic_" + std::to_string(n);
+            Topic* writer_topic = writer_participant->create_topic(topic_name, type.get_type_name(),
+                            TOPIC_QOS_DEFAULT);
+            Topic* reader_topic = reader_participant->create_topic(topic_name, type.get_type_name(),
+                            TOPIC_QOS_DEFAULT);
+            DataWriter* writer = publisher->create_datawriter(writer_topic, writer_qos);
+            ok = nullptr != writer &&
+                    nullptr != subscriber->create_datareader(reader_topic, reader_qos, &listener);
+            writers.push_back(writer);
+        }
+    }
+
+    auto deadline = clock_type::now() + std::chrono::seconds(30);
+    while (ok && listener.matched < static_cast<int32_t>(num_topics) && clock_type::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ok = ok && listener.matched == static_cast<int32_t>(num_topics);
+
+    if (ok)
+    {
+        uint64_t datagrams_start = udp_out_datagrams();
+        std::clock_t cpu_start = std::clock();
+        auto start = clock_type::now();
+        uint64_t written = 0;
+
+        std::chrono::milliseconds write_period(write_period_ms);
+        uint32_t rounds = seconds * 1000u / write_period_ms;
+        for (uint32_t round = 0; round < rounds; ++round)
+        {
+            std::this_thread::sleep_until(start + write_period * round);
+            for (DataWriter* writer : writers)
+            {
+                uint32_t counter = round;
+                writer->write(&counter);
+                ++written;
+            }
+        }
+        std::this_thread::sleep_until(start + std::chrono::seconds(seconds));
+
+        std::chrono::duration<double> elapsed = clock_type::now() - start;
+        double cpu_seconds = static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+        uint64_t datagrams = udp_out_datagrams() - datagrams_start;
+
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "Aggregation period (ms): " << aggregation_period_ms << std::endl;
+        std::cout << "  Samples written: " << written << std::endl;
+        std::cout << "  Samples received: " << listener.received << std::endl;
+        if (0 < datagrams_start)
+        {
+            std::cout << "  UDP datagrams/s: " << static_cast<double>(datagrams) / elapsed.count() << std::endl;
+        }
+        std::cout << "  CPU time/s: " << cpu_seconds / elapsed.count() << std::endl;
+    }
+    else
+    {
+        std::cout << "Error creating or matching the endpoints" << std::endl;
+    }
+
+    for (DomainParticipant* participant : {writer_participant, reader_participant})
+    {
+        if (nullptr != participant)
+        {
+            participant->delete_contained_entities();
+            DomainParticipantFactory::get_instance()->delete_participant(participant);
+        }
+    }
+    return ok;
+}
+
+static void usage(
+        const char* name)
+{
+    std::cout << "Usage: " << name << " [--topics <n>] [--heartbeat <ms>] [--write <ms>] [--aggregation <ms>]"
+              << " [--seconds <s>] [--domain <id>]" << std::endl;
+    std::cout << "  --topics       Number of topics, each one with a writer and a reader (default 200)." <<
+        std::endl;
+    std::cout << "  --heartbeat    Heartbeat period of the writers (default 100)." << std::endl;
+    std::cout << "  --write        Period of the samples published on each topic (default 1000)." << std::endl;
+    std::cout << "  --aggregation  Aggregation period of the second run (default 100)." << std::endl;
+    std::cout << "  --seconds      Duration of each run (default 10)." << std::endl;
+    std::cout << "  --domain       Domain of the participants (default 0)." << std::endl;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_topics = 200;
+    uint32_t heartbeat_period_ms = 100;
+    uint32_t write_period_ms = 1000;
+    uint32_t aggregation_period_ms = 100;
+    uint32_t seconds = 10;
+    uint32_t domain_id = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (i + 1 < argc && 0 == strcmp(argv[i], "--topics"))
+        {
+            num_topics = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--heartbeat"))
+        {
+            heartbeat_period_ms = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--write"))
+        {
+            write_period_ms = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--aggregation"))
+        {
+            aggregation_period_ms = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--seconds"))
+        {
+            seconds = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--domain"))
+        {
+            domain_id = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (0 == num_topics || 0 == heartbeat_period_ms || 0 == write_period_ms || 0 == aggregation_period_ms ||
+            0 == seconds)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // All the traffic between the participants should go through the network
+    eprosima::fastrtps::LibrarySettingsAttributes library_settings;
+    library_settings.intraprocess_delivery = eprosima::fastrtps::INTRAPROCESS_OFF;
+    eprosima::fastrtps::xmlparser::XMLProfileManager::library_settings(library_settings);
+
+    bool ok = run(domain_id, num_topics, heartbeat_period_ms, write_period_ms, seconds, 0);
+    ok = ok && run(domain_id, num_topics, heartbeat_period_ms, write_period_ms, seconds, aggregation_period_ms);
+    return ok ? 0 : 1;
+}
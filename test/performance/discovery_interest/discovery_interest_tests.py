@@ -0,0 +1,94 @@
+# Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Launch a DiscoveryInterestTest domain, and measure a sensor on it with and without the interest filter."""
+
+import argparse
+import os
+import subprocess
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter
+    )
+    parser.add_argument(
+        '-n',
+        '--participants',
+        help='The number of participants of the domain',
+        required=False,
+        default='10'
+    )
+    parser.add_argument(
+        '-e',
+        '--endpoints',
+        help='The number of endpoints of each participant of the domain',
+        required=False,
+        default='300'
+    )
+    parser.add_argument(
+        '-d',
+        '--domain',
+        help='The domain of the participants',
+        required=False,
+        default='0'
+    )
+    parser.add_argument(
+        '-s',
+        '--settle',
+        help='Milliseconds each sensor waits for the discovery of the domain',
+        required=False,
+        default='5000'
+    )
+
+    args = parser.parse_args()
+
+    discovery_interest_test = os.environ.get(
+        'DISCOVERY_INTEREST_TEST_BIN', 'DiscoveryInterestTest')
+
+    domain = subprocess.Popen(
+        [
+            discovery_interest_test,
+            '--role', 'domain',
+            '--participants', args.participants,
+            '--endpoints', args.endpoints,
+            '--domain', args.domain,
+            '--hold', '3600000',
+        ],
+        stdout=subprocess.PIPE,
+        universal_newlines=True)
+
+    # Wait until all the endpoints of the domain have been created
+    line = domain.stdout.readline()
+    print(line.strip())
+    ret = 0 if line.startswith('Domain ready') else 1
+
+    if ret == 0:
+        for interest_filter in (False, True):
+            command = [
+                discovery_interest_test,
+                '--role', 'sensor',
+                '--domain', args.domain,
+                '--settle', args.settle,
+            ]
+            if interest_filter:
+                command.append('--interest_filter')
+            sensor = subprocess.run(
+                command, stdout=subprocess.PIPE, universal_newlines=True)
+            ret |= sensor.returncode
+            print(sensor.stdout.strip())
+
+    domain.terminate()
+    domain.wait()
+
+    exit(ret)
@@ -0,0 +1,413 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_DiscoveryInterestTest.cpp
+ *
+ * Measures the cost of discovering a large domain for a participant that is only interested in a few topics.
+ *  - The domain role creates participants with many writers and readers, each one on its own topic, plus a writer
+ *    on the topic of the sensor.
+ *  - The sensor role creates a participant with a single reader, waits until the domain has been discovered, and
+ *    reports the CPU time and the resident memory spent on it, and the discovery memory of the participant.
+ *    Then it creates a reader on one of the topics of the domain, and reports the time until it is matched.
+ * The sensor is meant to be run with and without property fastdds.edp_interest_filter, against the same domain
+ * (see discovery_interest_tests.py).
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/ReaderAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
+#include <fastdds/rtps/history/ReaderHistory.h>
+#include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/reader/ReaderListener.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastrtps/attributes/TopicAttributes.h>
+#include <fastrtps/qos/ReaderQos.h>
+#include <fastrtps/qos/WriterQos.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+using clock_type = std::chrono::steady_clock;
+
+static const char* const sensor_topic = "DiscoveryInterestSensor";
+
+static void usage(
+        const char* name)
+{
+    std::cout << "Usage: " << name << " --role <domain|sensor> [--participants <n>] [--endpoints <n>]" <<
+        " [--domain <id>] [--hold <ms>] [--settle <ms>] [--interest_filter]" << std::endl;
+    std::cout << "  --role          domain: create the endpoints of the domain and keep them for --hold ms." <<
+        std::endl;
+    std::cout << "                  sensor: create a single reader and measure the discovery of the domain." <<
+        std::endl;
+    std::cout << "  --participants  Number of participants of the domain role (default 10)." << std::endl;
+    std::cout << "  --endpoints     Number of endpoints of each participant of the domain role, half of them" <<
+        " writers (default 300)." << std::endl;
+    std::cout << "  --domain        Domain of the participants (default 0)." << std::endl;
+    std::cout << "  --hold          Milliseconds the domain role keeps its endpoints (default 60000)." << std::endl;
+    std::cout << "  --settle        Milliseconds the sensor role waits for the discovery of the domain" <<
+        " (default 5000)." << std::endl;
+    std::cout << "  --interest_filter  Skip the announcements of topics without local endpoints" <<
+        " (fastdds.edp_interest_filter)." << std::endl;
+}
+
+//! Returns the resident memory of the process in kB, from /proc/self/status
+static uint64_t resident_memory_kb()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (0 == line.compare(0, 6, "VmRSS:"))
+        {
+            return std::strtoull(line.c_str() + 6, nullptr, 10);
+        }
+    }
+    return 0;
+}
+
+//! CPU time consumed by all the threads of the process, in milliseconds
+static double cpu_time_ms()
+{
+    return 1000.0 * static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+}
+
+static std::string domain_topic(
+        uint32_t index)
+{
+    return "DiscoveryInterestTopic_" + std::to_string(index);
+}
+
+//! Reader listener that lets waiting for the first match of the reader
+class MatchListener : public ReaderListener
+{
+public:
+
+    void onReaderMatched(
+            RTPSReader*,
+            MatchingInfo& info) override
+    {
+        if (MATCHED_MATCHING == info.status)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            matched_ = true;
+            cv_.notify_all();
+        }
+    }
+
+    void onNewCacheChangeAdded(
+            RTPSReader* reader,
+            const CacheChange_t* const change) override
+    {
+        reader->getHistory()->remove_change(const_cast<CacheChange_t*>(change));
+    }
+
+    bool wait_matched(
+            std::chrono::milliseconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [this]()
+                       {
+                           return matched_;
+                       });
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool matched_ = false;
+};
+
+//! Reader registered on a topic, with the objects it uses
+struct Reader
+{
+    std::unique_ptr<ReaderHistory> history;
+    MatchListener listener;
+    RTPSReader* reader = nullptr;
+};
+
+//! Writer registered on a topic, with the objects it uses
+struct Writer
+{
+    std::unique_ptr<WriterHistory> history;
+    RTPSWriter* writer = nullptr;
+};
+
+static bool create_reader(
+        RTPSParticipant* participant,
+        const std::string& topic_name,
+        Reader& reader)
+{
+    HistoryAttributes history_att;
+    history_att.payloadMaxSize = 64;
+    reader.history.reset(new ReaderHistory(history_att));
+
+    ReaderAttributes reader_att;
+    reader.reader = RTPSDomain::createRTPSReader(participant, reader_att, reader.history.get(), &reader.listener);
+    if (nullptr == reader.reader)
+    {
+        return false;
+    }
+
+    TopicAttributes topic_att;
+    topic_att.topicKind = NO_KEY;
+    topic_att.topicDataType = "DiscoveryInterestType";
+    topic_att.topicName = topic_name;
+    ReaderQos qos;
+    return participant->registerReader(reader.reader, topic_att, qos);
+}
+
+static bool create_writer(
+        RTPSParticipant* participant,
+        const std::string& topic_name,
+        Writer& writer)
+{
+    HistoryAttributes history_att;
+    history_att.payloadMaxSize = 64;
+    writer.history.reset(new WriterHistory(history_att));
+
+    WriterAttributes writer_att;
+    writer.writer = RTPSDomain::createRTPSWriter(participant, writer_att, writer.history.get());
+    if (nullptr == writer.writer)
+    {
+        return false;
+    }
+
+    TopicAttributes topic_att;
+    topic_att.topicKind = NO_KEY;
+    topic_att.topicDataType = "DiscoveryInterestType";
+    topic_att.topicName = topic_name;
+    WriterQos qos;
+    return participant->registerWriter(writer.writer, topic_att, qos);
+}
+
+static int run_domain(
+        uint32_t domain_id,
+        uint32_t num_participants,
+        uint32_t num_endpoints,
+        uint32_t hold_ms)
+{
+    RTPSParticipantAttributes attributes;
+    std::vector<RTPSParticipant*> participants;
+    std::vector<std::unique_ptr<Reader>> readers;
+    std::vector<std::unique_ptr<Writer>> writers;
+    bool ok = true;
+
+    uint32_t index = 0;
+    for (uint32_t n = 0; ok && n < num_participants; ++n)
+    {
+        RTPSParticipant* participant = RTPSDomain::createParticipant(domain_id, attributes);
+        if (nullptr == participant)
+        {
+            std::cout << "Error creating participant " << n << std::endl;
+            ok = false;
+            break;
+        }
+        participants.push_back(participant);
+
+        if (0 == n)
+        {
+            writers.emplace_back(new Writer());
+            ok = create_writer(participant, sensor_topic, *writers.back());
+        }
+
+        // Even topics have a writer, odd ones a reader
+        for (uint32_t e = 0; ok && e < num_endpoints; ++e, ++index)
+        {
+            if (0 == index % 2)
+            {
+                writers.emplace_back(new Writer());
+                ok = create_writer(participant, domain_topic(index), *writers.back());
+            }
+            else
+            {
+                readers.emplace_back(new Reader());
+                ok = create_reader(participant, domain_topic(index), *readers.back());
+            }
+        }
+    }
+
+    if (ok)
+    {
+        std::cout << "Domain ready: " << participants.size() << " participants, " << index << " endpoints" <<
+            std::endl;
+        std::this_thread::sleep_for(std::chrono::milliseconds(hold_ms));
+    }
+    else
+    {
+        std::cout << "Error creating the endpoints of the domain" << std::endl;
+    }
+
+    for (RTPSParticipant* participant : participants)
+    {
+        RTPSDomain::removeRTPSParticipant(participant);
+    }
+
+    return ok ? 0 : 1;
+}
+
+static int run_sensor(
+        uint32_t domain_id,
+        uint32_t settle_ms,
+        bool interest_filter)
+{
+    RTPSParticipantAttributes attributes;
+    if (interest_filter)
+    {
+        attributes.properties.properties().emplace_back("fastdds.edp_interest_filter", "true");
+    }
+
+    RTPSParticipant* participant = RTPSDomain::createParticipant(domain_id, attributes);
+    if (nullptr == participant)
+    {
+        std::cout << "Error creating participant" << std::endl;
+        return 1;
+    }
+
+    int ret = 1;
+    Reader sensor_reader;
+    Reader late_reader;
+    uint64_t start_rss = resident_memory_kb();
+    double start_cpu = cpu_time_ms();
+
+    if (!create_reader(participant, sensor_topic, sensor_reader))
+    {
+        std::cout << "Error creating the sensor reader" << std::endl;
+    }
+    else if (!sensor_reader.listener.wait_matched(std::chrono::milliseconds(settle_ms)))
+    {
+        std::cout << "The writer of the sensor topic was not discovered" << std::endl;
+    }
+    else
+    {
+        // Let the rest of the domain be discovered
+        std::this_thread::sleep_for(std::chrono::milliseconds(settle_ms));
+
+        double cpu = cpu_time_ms() - start_cpu;
+        uint64_t rss = resident_memory_kb();
+        ParticipantMemoryUsage usage;
+        participant->get_memory_usage(usage);
+
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "Interest filter: " << (interest_filter ? "enabled" : "disabled") << std::endl;
+        std::cout << "Discovery CPU time (ms): " << cpu << std::endl;
+        std::cout << "Resident memory increase (kB): " << static_cast<int64_t>(rss - start_rss) << std::endl;
+        std::cout << "Discovery memory reserved (kB): " << usage.discovery.reserved / 1024 << std::endl;
+        std::cout << "Discovery memory in use (kB): " << usage.discovery.in_use / 1024 << std::endl;
+
+        // A reader created later on a topic of the domain should still discover its writer
+        auto late_start = clock_type::now();
+        if (!create_reader(participant, domain_topic(0), late_reader))
+        {
+            std::cout << "Error creating the late reader" << std::endl;
+        }
+        else if (!late_reader.listener.wait_matched(std::chrono::milliseconds(settle_ms)))
+        {
+            std::cout << "The late reader was not matched" << std::endl;
+        }
+        else
+        {
+            std::chrono::duration<double, std::milli> elapsed = clock_type::now() - late_start;
+            std::cout << "Late reader match time (ms): " << elapsed.count() << std::endl;
+            ret = 0;
+        }
+    }
+
+    RTPSDomain::removeRTPSParticipant(participant);
+    return ret;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    std::string role;
+    uint32_t domain_id = 0;
+    uint32_t num_participants = 10;
+    uint32_t num_endpoints = 300;
+    uint32_t hold_ms = 60000;
+    uint32_t settle_ms = 5000;
+    bool interest_filter = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (0 == strcmp(argv[i], "--interest_filter"))
+        {
+            interest_filter = true;
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--role"))
+        {
+            role = argv[++i];
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--participants"))
+        {
+            num_participants = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--endpoints"))
+        {
+            num_endpoints = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--domain"))
+        {
+            domain_id = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--hold"))
+        {
+            hold_ms = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--settle"))
+        {
+            settle_ms = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ("domain" == role && 0 < num_participants && 0 < num_endpoints)
+    {
+        return run_domain(domain_id, num_participants, num_endpoints, hold_ms);
+    }
+    else if ("sensor" == role)
+    {
+        return run_sensor(domain_id, settle_ms, interest_filter);
+    }
+
+    usage(argv[0]);
+    return 1;
+}
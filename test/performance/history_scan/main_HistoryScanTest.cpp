@@ -0,0 +1,219 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_HistoryScanTest.cpp
+ *
+ * Measures the cost per element of scanning a history, for several depths:
+ *  - History::get_change looking for the last change (prefetching the following changes).
+ *  - The same scan without prefetching, as it was done before.
+ *  - A scan checking only the isRead flag, as done when looking for unread changes, with and without prefetching.
+ * Changes are allocated in an order different from the one on the history, as happens when they come from a pool
+ * that has been in use for a while, so each element scanned is a potential cache miss.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/history/History.h>
+
+#include <utils/Prefetch.hpp>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+using clock_type = std::chrono::steady_clock;
+
+//! History whose changes are added directly by the test
+class ScanHistory : public History
+{
+public:
+
+    ScanHistory()
+        : History(HistoryAttributes())
+    {
+        mp_mutex = &mutex_;
+    }
+
+    ~ScanHistory()
+    {
+        m_changes.clear();
+    }
+
+    void set_changes(
+            const std::vector<CacheChange_t*>& changes)
+    {
+        m_changes = changes;
+    }
+
+    //! Scan done by get_change_nts before it prefetched the following changes
+    CacheChange_t* plain_get_change(
+            const SequenceNumber_t& seq,
+            const GUID_t& guid) const
+    {
+        for (const CacheChange_t* change : m_changes)
+        {
+            if (change->writerGUID == guid)
+            {
+                if (change->sequenceNumber == seq)
+                {
+                    return const_cast<CacheChange_t*>(change);
+                }
+                else if (change->sequenceNumber > seq)
+                {
+                    break;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    //! Scan looking for the first unread change, as done by StatefulReader::nextUnreadCache
+    CacheChange_t* first_unread(
+            bool prefetch) const
+    {
+        for (auto it = m_changes.begin(); it != m_changes.end(); ++it)
+        {
+            if (prefetch)
+            {
+                eprosima::prefetch_ahead(it, m_changes.end());
+            }
+
+            if (!(*it)->isRead)
+            {
+                return *it;
+            }
+        }
+        return nullptr;
+    }
+
+protected:
+
+    bool do_reserve_cache(
+            CacheChange_t**,
+            uint32_t) override
+    {
+        return false;
+    }
+
+    void do_release_cache(
+            CacheChange_t*) override
+    {
+    }
+
+private:
+
+    RecursiveTimedMutex mutex_;
+};
+
+template<class Function>
+static double ns_per_element(
+        uint32_t depth,
+        uint32_t iterations,
+        Function scan)
+{
+    auto start = clock_type::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        if (!scan())
+        {
+            std::cout << "Change not found" << std::endl;
+            std::exit(1);
+        }
+    }
+    std::chrono::duration<double, std::nano> elapsed = clock_type::now() - start;
+    return elapsed.count() / (static_cast<double>(iterations) * depth);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t max_depth = 1000000;
+    if (argc > 1)
+    {
+        max_depth = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+        if (max_depth < 10000)
+        {
+            std::cout << "Usage: " << argv[0] << " [max_depth (at least 10000)]" << std::endl;
+            return 1;
+        }
+    }
+
+    GUID_t guid;
+    guid.guidPrefix.value[0] = 1;
+    guid.entityId.value[3] = 3;
+
+    std::cout << "Nanoseconds per element scanned" << std::endl;
+    std::cout << std::setw(10) << "Depth" << std::setw(20) << "get_change" << std::setw(24) <<
+        "get_change (no prefetch)" << std::setw(16) << "first unread" << std::setw(26) <<
+        "first unread (no prefetch)" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    std::mt19937 random(42);
+    for (uint32_t depth = 10000; depth <= max_depth; depth *= 10)
+    {
+        // Allocate the changes, then give them sequence numbers in a random order
+        std::vector<CacheChange_t> storage(depth);
+        std::vector<CacheChange_t*> changes(depth);
+        for (uint32_t n = 0; n < depth; ++n)
+        {
+            changes[n] = &storage[n];
+        }
+        std::shuffle(changes.begin(), changes.end(), random);
+        for (uint32_t n = 0; n < depth; ++n)
+        {
+            changes[n]->writerGUID = guid;
+            changes[n]->sequenceNumber = SequenceNumber_t(0, n + 1);
+            changes[n]->isRead = n + 1 < depth;
+        }
+
+        ScanHistory history;
+        history.set_changes(changes);
+
+        // Enough scans to touch about 10M elements
+        uint32_t iterations = (std::max)(1u, 10000000u / depth);
+        SequenceNumber_t last(0, depth);
+
+        double get_change_ns = ns_per_element(depth, iterations, [&]()
+                        {
+                            CacheChange_t* change = nullptr;
+                            return history.get_change(last, guid, &change);
+                        });
+        double plain_ns = ns_per_element(depth, iterations, [&]()
+                        {
+                            return nullptr != history.plain_get_change(last, guid);
+                        });
+        double unread_ns = ns_per_element(depth, iterations, [&]()
+                        {
+                            return nullptr != history.first_unread(true);
+                        });
+        double plain_unread_ns = ns_per_element(depth, iterations, [&]()
+                        {
+                            return nullptr != history.first_unread(false);
+                        });
+
+        std::cout << std::setw(10) << depth << std::setw(20) << get_change_ns << std::setw(24) << plain_ns <<
+            std::setw(16) << unread_ns << std::setw(26) << plain_unread_ns << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,173 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_KeyHashTest.cpp
+ *
+ * Measures the cost of computing the instance handle of keyed samples, for several key sizes:
+ *  - getKey, which always computes the MD5.
+ *  - The cache of key hashes of the writers, on the same sample (the key hash is found on the cache).
+ *  - The cache of key hashes of the writers, on more distinct samples than it can hold (the MD5 is always computed).
+ *  - MD5 of the serialized key alone.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeBuilderPtr.h>
+#include <fastrtps/types/TypesBase.h>
+#include <fastrtps/utils/md5.h>
+
+#include <utils/KeyHashCache.hpp>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::types;
+
+using clock_type = std::chrono::steady_clock;
+
+//! More than the entries of the cache of key hashes of a writer
+static const size_t num_distinct_keys = 2048;
+
+/*
+   struct KeyHashTest
+   {
+    @Key string<key_length> key;
+    unsigned long value;
+   };
+ */
+static DynamicType_ptr create_type(
+        uint32_t key_length)
+{
+    DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+    DynamicTypeBuilder_ptr struct_builder = factory->create_struct_builder();
+    DynamicTypeBuilder_ptr string_builder = factory->create_string_builder(key_length);
+    string_builder->apply_annotation(ANNOTATION_KEY_ID, "value", "true");
+    struct_builder->add_member(0, "key", string_builder->build());
+    struct_builder->add_member(1, "value", factory->create_uint32_type());
+    struct_builder->apply_annotation(ANNOTATION_KEY_ID, "value", "true");
+    struct_builder->set_name("KeyHashTest_" + std::to_string(key_length));
+    return struct_builder->build();
+}
+
+static std::string make_key(
+        uint32_t key_length,
+        size_t index)
+{
+    std::string key = std::to_string(index);
+    key.insert(0, key_length - key.length(), 'k');
+    return key;
+}
+
+static double ns_per_call(
+        const clock_type::time_point& start,
+        uint32_t iterations)
+{
+    std::chrono::duration<double, std::nano> elapsed = clock_type::now() - start;
+    return elapsed.count() / iterations;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t iterations = 100000;
+    if (argc > 1)
+    {
+        iterations = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+        if (0 == iterations)
+        {
+            std::cout << "Usage: " << argv[0] << " [iterations]" << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "Nanoseconds per operation, " << iterations << " iterations" << std::endl;
+    std::cout << std::setw(12) << "Key length" << std::setw(12) << "getKey" << std::setw(16) << "cache (same)" <<
+        std::setw(20) << "cache (distinct)" << std::setw(12) << "MD5" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+
+    const std::vector<uint32_t> key_lengths = {8, 16, 32, 64, 128, 256, 1024};
+    for (uint32_t key_length : key_lengths)
+    {
+        DynamicType_ptr type = create_type(key_length);
+        DynamicPubSubType pst(type);
+        eprosima::fastrtps::rtps::InstanceHandle_t handle;
+        eprosima::fastrtps::rtps::SerializedPayload_t key_buffer;
+        size_t max_key_length = 0;
+
+        std::vector<DynamicData*> samples(num_distinct_keys);
+        for (size_t n = 0; n < num_distinct_keys; ++n)
+        {
+            samples[n] = DynamicDataFactory::get_instance()->create_data(type);
+            samples[n]->set_string_value(make_key(key_length, n), 0);
+        }
+
+        // What writers without a cache do
+        auto start = clock_type::now();
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            pst.getKey(samples[0], &handle);
+        }
+        double get_key_ns = ns_per_call(start, iterations);
+
+        // Same key over and over, as DataWriterImpl does
+        KeyHashCache cache;
+        start = clock_type::now();
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            pst.serialize_key(samples[0], &key_buffer, max_key_length);
+            cache.get_key_hash(key_buffer.data, key_buffer.length, false, max_key_length, handle);
+        }
+        double same_ns = ns_per_call(start, iterations);
+
+        // Cycling through more keys than the cache holds
+        start = clock_type::now();
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            pst.serialize_key(samples[i % num_distinct_keys], &key_buffer, max_key_length);
+            cache.get_key_hash(key_buffer.data, key_buffer.length, false, max_key_length, handle);
+        }
+        double distinct_ns = ns_per_call(start, iterations);
+
+        // MD5 of a serialized key of the same length (length prefix + characters + null terminator)
+        std::string serialized_key(key_length + 5, 'k');
+        MD5 md5;
+        start = clock_type::now();
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            md5.init();
+            md5.update(serialized_key.c_str(), static_cast<MD5::size_type>(serialized_key.length()));
+            md5.finalize();
+        }
+        double md5_ns = ns_per_call(start, iterations);
+
+        std::cout << std::setw(12) << key_length << std::setw(12) << get_key_ns << std::setw(16) << same_ns <<
+            std::setw(20) << distinct_ns << std::setw(12) << md5_ns << std::endl;
+
+        for (DynamicData* sample : samples)
+        {
+            DynamicDataFactory::get_instance()->delete_data(sample);
+        }
+    }
+
+    return 0;
+}
@@ -18,7 +18,9 @@
  */
 #include "LatencyTestSubscriber.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
 
 #include <fastdds/dds/domain/DomainParticipant.hpp>
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
@@ -261,6 +263,19 @@ bool LatencyTestSubscriber::init(
             dw_qos_.resource_limits().extra_samples = 30;
             dr_qos_.resource_limits().extra_samples = 30;
         }
+
+        // Dynamic types are unbounded, so data sharing needs a memory budget for the variable-size payloads
+        if (dynamic_types_ && Arg::EnablerValue::ON == data_sharing_ && !data_size_sub_.empty())
+        {
+            // Twice the space required by the history, as payload sizes are rounded up
+            uint64_t max_payload = *std::max_element(data_size_sub_.begin(), data_size_sub_.end()) + 4u;
+            uint64_t history_samples = dw_qos_.history().depth + dw_qos_.resource_limits().extra_samples + 1;
+            uint64_t payload_memory = std::min<uint64_t>(2u * max_payload * history_samples,
+                            std::numeric_limits<uint32_t>::max() / 2u);
+            dw_qos_.properties().properties().emplace_back(
+                "fastdds.datasharing.max_payload_memory", std::to_string(payload_memory));
+            dr_qos_.properties().properties().emplace_back("fastdds.datasharing.unbounded", "true");
+        }
     }
 
     /* Create Topics */
@@ -0,0 +1,539 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_OwnershipTest.cpp
+ *
+ * Measures the cost of redundant publishers for readers with EXCLUSIVE and SHARED ownership.
+ * Several writers with different ownership strengths, each one on its own participant, publish the same set of
+ * instances in rounds. An EXCLUSIVE reader should only store and take the samples of the strongest writer, while a
+ * SHARED reader stores and takes the samples of all of them.
+ * Halfway through the publication the strongest writer is deleted, and the time the EXCLUSIVE reader takes to
+ * receive samples from the next one is reported.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+using namespace eprosima::fastdds::dds;
+
+using clock_type = std::chrono::steady_clock;
+
+static const char* TOPIC_NAME = "OwnershipTopic";
+
+//! Sample of an instance, identified by its key, followed by an opaque payload
+struct OwnershipSample
+{
+    uint32_t key = 0;
+    uint32_t round = 0;
+    std::vector<uint8_t> data;
+};
+
+//! Plain serialization of OwnershipSample, whose key is the first field
+class OwnershipSampleType : public TopicDataType
+{
+public:
+
+    OwnershipSampleType(
+            uint32_t sample_size)
+    {
+        setName("OwnershipSample");
+        m_typeSize = sample_size + 4u + 8u;
+        m_isGetKeyDefined = true;
+    }
+
+    bool serialize(
+            void* data,
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload) override
+    {
+        OwnershipSample* sample = static_cast<OwnershipSample*>(data);
+        uint32_t length = static_cast<uint32_t>(sample->data.size()) + 8u;
+        if (payload->max_size < length + 4u)
+        {
+            return false;
+        }
+        // Encapsulation (CDR_LE) followed by the key, the round and the raw data
+        payload->data[0] = 0;
+        payload->data[1] = 1;
+        payload->data[2] = 0;
+        payload->data[3] = 0;
+        memcpy(&payload->data[4], &sample->key, sizeof(sample->key));
+        memcpy(&payload->data[8], &sample->round, sizeof(sample->round));
+        memcpy(&payload->data[12], sample->data.data(), sample->data.size());
+        payload->length = length + 4u;
+        return true;
+    }
+
+    bool deserialize(
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+            void* data) override
+    {
+        OwnershipSample* sample = static_cast<OwnershipSample*>(data);
+        if (payload->length < 12u)
+        {
+            return false;
+        }
+        memcpy(&sample->key, &payload->data[4], sizeof(sample->key));
+        memcpy(&sample->round, &payload->data[8], sizeof(sample->round));
+        sample->data.assign(&payload->data[12], &payload->data[payload->length]);
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        return [data]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(static_cast<OwnershipSample*>(data)->data.size()) + 12u;
+               };
+    }
+
+    void* createData() override
+    {
+        return new OwnershipSample();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<OwnershipSample*>(data);
+    }
+
+    bool getKey(
+            void* data,
+            eprosima::fastrtps::rtps::InstanceHandle_t* handle,
+            bool) override
+    {
+        OwnershipSample* sample = static_cast<OwnershipSample*>(data);
+        *handle = eprosima::fastrtps::rtps::InstanceHandle_t();
+        memcpy(handle->value, &sample->key, sizeof(sample->key));
+        return true;
+    }
+
+};
+
+//! Takes the samples received, counting them per writer and measuring the time spent taking them
+class OwnershipReaderListener : public DataReaderListener
+{
+public:
+
+    void on_data_available(
+            DataReader* reader) override
+    {
+        OwnershipSample sample;
+        SampleInfo info;
+        auto start = clock_type::now();
+        uint64_t taken = 0;
+        while (ReturnCode_t::RETCODE_OK == reader->take_next_sample(&sample, &info))
+        {
+            if (info.valid_data)
+            {
+                ++taken;
+                std::lock_guard<std::mutex> guard(mutex_);
+                ++received_[info.publication_handle];
+                if (sample.round >= handover_round)
+                {
+                    handover_received_.emplace(info.publication_handle, clock_type::now());
+                }
+            }
+        }
+        std::lock_guard<std::mutex> guard(mutex_);
+        taken_ += taken;
+        take_time_ += clock_type::now() - start;
+    }
+
+    void on_subscription_matched(
+            DataReader*,
+            const SubscriptionMatchedStatus& info) override
+    {
+        matched = info.current_count;
+    }
+
+    //! @return Samples taken from the given writer
+    uint64_t received_from(
+            const InstanceHandle_t& writer)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = received_.find(writer);
+        return it == received_.end() ? 0u : it->second;
+    }
+
+    //! @return Time when the first sample of the given writer after the handover was taken, or false if none was
+    bool first_received_after_handover(
+            const InstanceHandle_t& writer,
+            clock_type::time_point& time)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = handover_received_.find(writer);
+        if (it == handover_received_.end())
+        {
+            return false;
+        }
+        time = it->second;
+        return true;
+    }
+
+    uint64_t taken()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return taken_;
+    }
+
+    double take_time_us()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return std::chrono::duration<double, std::micro>(take_time_).count();
+    }
+
+    std::atomic<int32_t> matched{0};
+    std::atomic<uint32_t> handover_round{0};
+
+private:
+
+    std::mutex mutex_;
+    std::map<InstanceHandle_t, uint64_t> received_;
+    std::map<InstanceHandle_t, clock_type::time_point> handover_received_;
+    uint64_t taken_ = 0;
+    clock_type::duration take_time_{};
+};
+
+//! Reader with the given ownership, on its own participant
+class OwnershipReader
+{
+public:
+
+    bool init(
+            uint32_t domain_id,
+            OwnershipQosPolicyKind kind,
+            uint32_t instances,
+            TypeSupport& type)
+    {
+        participant_ = DomainParticipantFactory::get_instance()->create_participant(domain_id,
+                        PARTICIPANT_QOS_DEFAULT);
+        if (nullptr == participant_)
+        {
+            return false;
+        }
+        type.register_type(participant_);
+        Topic* topic = participant_->create_topic(TOPIC_NAME, type.get_type_name(), TOPIC_QOS_DEFAULT);
+        Subscriber* subscriber = participant_->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+        DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+        reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+        reader_qos.ownership().kind = kind;
+        reader_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+        reader_qos.history().depth = 1;
+        reader_qos.resource_limits().max_instances = static_cast<int32_t>(instances);
+        reader_qos.resource_limits().max_samples_per_instance = 1;
+        reader_qos.resource_limits().max_samples = static_cast<int32_t>(instances);
+        return nullptr != subscriber->create_datareader(topic, reader_qos, &listener_);
+    }
+
+    ~OwnershipReader()
+    {
+        if (nullptr != participant_)
+        {
+            participant_->delete_contained_entities();
+            DomainParticipantFactory::get_instance()->delete_participant(participant_);
+        }
+    }
+
+    OwnershipReaderListener& listener()
+    {
+        return listener_;
+    }
+
+private:
+
+    DomainParticipant* participant_ = nullptr;
+    OwnershipReaderListener listener_;
+};
+
+//! Writer with the given ownership strength, on its own participant
+class RedundantWriter
+{
+public:
+
+    bool init(
+            uint32_t domain_id,
+            OwnershipQosPolicyKind kind,
+            uint32_t strength,
+            uint32_t instances,
+            TypeSupport& type)
+    {
+        strength_ = strength;
+        participant_ = DomainParticipantFactory::get_instance()->create_participant(domain_id,
+                        PARTICIPANT_QOS_DEFAULT);
+        if (nullptr == participant_)
+        {
+            return false;
+        }
+        type.register_type(participant_);
+        Topic* topic = participant_->create_topic(TOPIC_NAME, type.get_type_name(), TOPIC_QOS_DEFAULT);
+        Publisher* publisher = participant_->create_publisher(PUBLISHER_QOS_DEFAULT);
+        DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+        writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+        writer_qos.ownership().kind = kind;
+        writer_qos.ownership_strength().value = strength;
+        writer_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+        writer_qos.history().depth = 1;
+        writer_qos.resource_limits().max_instances = static_cast<int32_t>(instances);
+        writer_qos.resource_limits().max_samples_per_instance = 1;
+        writer_qos.resource_limits().max_samples = static_cast<int32_t>(instances);
+        writer_ = publisher->create_datawriter(topic, writer_qos);
+        return nullptr != writer_;
+    }
+
+    ~RedundantWriter()
+    {
+        destroy();
+    }
+
+    void destroy()
+    {
+        if (nullptr != participant_)
+        {
+            participant_->delete_contained_entities();
+            DomainParticipantFactory::get_instance()->delete_participant(participant_);
+            participant_ = nullptr;
+            writer_ = nullptr;
+        }
+    }
+
+    bool write(
+            OwnershipSample& sample)
+    {
+        return nullptr != writer_ && writer_->write(&sample);
+    }
+
+    InstanceHandle_t handle() const
+    {
+        return handle_;
+    }
+
+    void save_handle()
+    {
+        handle_ = writer_->get_instance_handle();
+    }
+
+    uint32_t strength() const
+    {
+        return strength_;
+    }
+
+private:
+
+    DomainParticipant* participant_ = nullptr;
+    DataWriter* writer_ = nullptr;
+    InstanceHandle_t handle_;
+    uint32_t strength_ = 0;
+};
+
+static void usage(
+        const char* name)
+{
+    std::cout << "Usage: " << name << " [--writers <n>] [--instances <n>] [--rounds <n>] [--period <ms>]"
+              << " [--size <bytes>] [--domain <id>]" << std::endl;
+    std::cout << "  --writers    Redundant writers, with increasing ownership strength (default 2)." << std::endl;
+    std::cout << "  --instances  Instances published by each writer on each round (default 10000)." << std::endl;
+    std::cout << "  --rounds     Rounds of publication (default 20)." << std::endl;
+    std::cout << "  --period     Milliseconds between rounds (default 100)." << std::endl;
+    std::cout << "  --size       Bytes of each sample (default 64)." << std::endl;
+    std::cout << "  --domain     Domain of the participants (default 0)." << std::endl;
+}
+
+static void report(
+        const char* name,
+        OwnershipReader& reader,
+        const std::vector<std::unique_ptr<RedundantWriter>>& writers)
+{
+    OwnershipReaderListener& listener = reader.listener();
+    uint64_t taken = listener.taken();
+    std::cout << name << " samples taken: " << taken << std::endl;
+    for (const auto& writer : writers)
+    {
+        std::cout << name << " samples taken from writer with strength " << writer->strength() << ": " <<
+            listener.received_from(writer->handle()) << std::endl;
+    }
+    std::cout << name << " take time per sample (us): " << (taken ? listener.take_time_us() / taken : 0.0) <<
+        std::endl;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_writers = 2;
+    uint32_t instances = 10000;
+    uint32_t rounds = 20;
+    uint32_t period_ms = 100;
+    uint32_t sample_size = 64;
+    uint32_t domain_id = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (i + 1 < argc && 0 == strcmp(argv[i], "--writers"))
+        {
+            num_writers = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--instances"))
+        {
+            instances = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--rounds"))
+        {
+            rounds = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--period"))
+        {
+            period_ms = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--size"))
+        {
+            sample_size = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--domain"))
+        {
+            domain_id = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (num_writers < 2 || 0 == instances || rounds < 2)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    TypeSupport type(new OwnershipSampleType(sample_size));
+
+    OwnershipReader exclusive_reader;
+    OwnershipReader shared_reader;
+    std::vector<std::unique_ptr<RedundantWriter>> exclusive_writers;
+    std::vector<std::unique_ptr<RedundantWriter>> shared_writers;
+    bool ok = exclusive_reader.init(domain_id, EXCLUSIVE_OWNERSHIP_QOS, instances, type) &&
+            shared_reader.init(domain_id, SHARED_OWNERSHIP_QOS, instances, type);
+    for (uint32_t n = 0; ok && n < num_writers; ++n)
+    {
+        // Writers of each ownership kind only match the readers of the same kind
+        uint32_t strength = 10 * (n + 1);
+        exclusive_writers.emplace_back(new RedundantWriter());
+        ok &= exclusive_writers.back()->init(domain_id, EXCLUSIVE_OWNERSHIP_QOS, strength, instances, type);
+        shared_writers.emplace_back(new RedundantWriter());
+        ok &= shared_writers.back()->init(domain_id, SHARED_OWNERSHIP_QOS, strength, instances, type);
+    }
+
+    if (!ok)
+    {
+        std::cout << "Error creating entities" << std::endl;
+        return 1;
+    }
+
+    auto deadline = clock_type::now() + std::chrono::seconds(10);
+    while ((exclusive_reader.listener().matched < static_cast<int32_t>(num_writers) ||
+            shared_reader.listener().matched < static_cast<int32_t>(num_writers)) &&
+            clock_type::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    if (exclusive_reader.listener().matched < static_cast<int32_t>(num_writers) ||
+            shared_reader.listener().matched < static_cast<int32_t>(num_writers))
+    {
+        std::cout << "Error matching readers" << std::endl;
+        return 1;
+    }
+
+    for (uint32_t n = 0; n < num_writers; ++n)
+    {
+        exclusive_writers[n]->save_handle();
+        shared_writers[n]->save_handle();
+    }
+    exclusive_reader.listener().handover_round = rounds / 2;
+    shared_reader.listener().handover_round = rounds / 2;
+
+    OwnershipSample sample;
+    sample.data.assign(sample_size, 0xAA);
+    clock_type::time_point handover_start;
+    auto start = clock_type::now();
+    for (uint32_t round = 0; round < rounds; ++round)
+    {
+        std::this_thread::sleep_until(start + std::chrono::milliseconds(period_ms) * round);
+
+        if (round == rounds / 2)
+        {
+            // The strongest writer leaves, so the next one should take the instances over
+            handover_start = clock_type::now();
+            exclusive_writers.back()->destroy();
+            shared_writers.back()->destroy();
+        }
+
+        sample.round = round;
+        for (uint32_t key = 0; key < instances; ++key)
+        {
+            sample.key = key;
+            for (uint32_t n = num_writers; n > 0; --n)
+            {
+                exclusive_writers[n - 1]->write(sample);
+                shared_writers[n - 1]->write(sample);
+            }
+        }
+    }
+
+    // Let the last samples arrive
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    uint64_t published = uint64_t(instances) * rounds * num_writers - uint64_t(instances) * (rounds - rounds / 2);
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "Samples published per ownership kind: " << published << std::endl;
+    report("EXCLUSIVE", exclusive_reader, exclusive_writers);
+    report("SHARED", shared_reader, shared_writers);
+
+    clock_type::time_point handover_end;
+    if (exclusive_reader.listener().first_received_after_handover(exclusive_writers[num_writers - 2]->handle(),
+            handover_end))
+    {
+        std::chrono::duration<double, std::milli> handover = handover_end - handover_start;
+        std::cout << "EXCLUSIVE handover time (ms): " << handover.count() << std::endl;
+    }
+    else
+    {
+        std::cout << "EXCLUSIVE handover did not happen" << std::endl;
+    }
+
+    return 0;
+}
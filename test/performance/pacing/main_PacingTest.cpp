@@ -0,0 +1,350 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_PacingTest.cpp
+ *
+ * Sends large fragmented samples through a best-effort asynchronous writer limited by a flow controller, and counts
+ * the samples lost by a reader of the same process (intraprocess delivery is disabled, so samples go through
+ * UDPv4). The flow controller either sends each period in a burst (max_bytes_per_period only) or paces the
+ * fragments with a token bucket (max_burst_bytes).
+ *
+ * It is meant to be run on a constrained link, like a loopback shaped with netem (see pacing_tests.py).
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/flowcontrol/FlowControllerDescriptor.hpp>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+#include <fastrtps/utils/IPLocator.h>
+#include <fastrtps/xmlparser/XMLProfileManager.h>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastdds::rtps;
+using eprosima::fastrtps::rtps::Locator_t;
+using eprosima::fastrtps::rtps::IPLocator;
+
+using clock_type = std::chrono::steady_clock;
+
+//! Sample with a sequence number followed by an opaque payload
+struct PacingSample
+{
+    uint32_t index = 0;
+    std::vector<uint8_t> data;
+};
+
+//! Plain serialization of PacingSample, so the size on the wire is exactly the requested one
+class PacingSampleType : public TopicDataType
+{
+public:
+
+    PacingSampleType(
+            uint32_t sample_size)
+    {
+        setName("PacingSample");
+        m_typeSize = sample_size + 4u + 4u;
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void* data,
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload) override
+    {
+        PacingSample* sample = static_cast<PacingSample*>(data);
+        uint32_t length = static_cast<uint32_t>(sample->data.size()) + 4u;
+        if (payload->max_size < length + 4u)
+        {
+            return false;
+        }
+        // Encapsulation (CDR_LE) followed by the index and the raw data
+        payload->data[0] = 0;
+        payload->data[1] = 1;
+        payload->data[2] = 0;
+        payload->data[3] = 0;
+        memcpy(&payload->data[4], &sample->index, sizeof(sample->index));
+        memcpy(&payload->data[8], sample->data.data(), sample->data.size());
+        payload->length = length + 4u;
+        return true;
+    }
+
+    bool deserialize(
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+            void* data) override
+    {
+        PacingSample* sample = static_cast<PacingSample*>(data);
+        if (payload->length < 8u)
+        {
+            return false;
+        }
+        memcpy(&sample->index, &payload->data[4], sizeof(sample->index));
+        sample->data.assign(&payload->data[8], &payload->data[payload->length]);
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        return [data]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(static_cast<PacingSample*>(data)->data.size()) + 8u;
+               };
+    }
+
+    void* createData() override
+    {
+        return new PacingSample();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<PacingSample*>(data);
+    }
+
+    bool getKey(
+            void*,
+            eprosima::fastrtps::rtps::InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+//! Counts the samples received and the matched writers
+class PacingReaderListener : public DataReaderListener
+{
+public:
+
+    void on_data_available(
+            DataReader* reader) override
+    {
+        PacingSample sample;
+        SampleInfo info;
+        while (ReturnCode_t::RETCODE_OK == reader->take_next_sample(&sample, &info))
+        {
+            if (info.valid_data)
+            {
+                ++received;
+            }
+        }
+    }
+
+    void on_subscription_matched(
+            DataReader*,
+            const SubscriptionMatchedStatus& info) override
+    {
+        matched = info.current_count;
+    }
+
+    std::atomic<uint32_t> received{0};
+    std::atomic<int32_t> matched{0};
+};
+
+static void usage(
+        const char* name)
+{
+    std::cout << "Usage: " << name << " [--samples <n>] [--size <bytes>] [--interval <ms>] [--rate <bytes/s>]" <<
+        " [--period <ms>] [--burst <bytes>] [--domain <id>]" << std::endl;
+    std::cout << "  --samples   Number of samples sent (default 100)." << std::endl;
+    std::cout << "  --size      Bytes of each sample (default 262144)." << std::endl;
+    std::cout << "  --interval  Milliseconds between samples (default 50)." << std::endl;
+    std::cout << "  --rate      Bytes per second allowed by the flow controller (default 12500000)." << std::endl;
+    std::cout << "  --period    Period of the flow controller in milliseconds (default 100)." << std::endl;
+    std::cout << "  --burst     Depth of the token bucket in bytes. With 0 the bytes of each period are sent in a" <<
+        " burst (default 0)." << std::endl;
+    std::cout << "  --domain    Domain of the participants (default 0)." << std::endl;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_samples = 100;
+    uint32_t sample_size = 262144;
+    uint32_t interval_ms = 50;
+    uint64_t rate = 12500000;
+    uint32_t period_ms = 100;
+    uint32_t burst = 0;
+    uint32_t domain_id = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (i + 1 < argc && 0 == strcmp(argv[i], "--samples"))
+        {
+            num_samples = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--size"))
+        {
+            sample_size = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--interval"))
+        {
+            interval_ms = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--rate"))
+        {
+            rate = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--period"))
+        {
+            period_ms = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--burst"))
+        {
+            burst = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--domain"))
+        {
+            domain_id = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (0 == period_ms || 0 == rate)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // Samples have to go through the network
+    eprosima::fastrtps::LibrarySettingsAttributes library_settings;
+    library_settings.intraprocess_delivery = eprosima::fastrtps::INTRAPROCESS_OFF;
+    eprosima::fastrtps::xmlparser::XMLProfileManager::library_settings(library_settings);
+
+    static const std::string flow_controller_name("PacingFlowController");
+    auto flow_controller = std::make_shared<FlowControllerDescriptor>();
+    flow_controller->name = flow_controller_name.c_str();
+    flow_controller->max_bytes_per_period = static_cast<int32_t>(rate * period_ms / 1000u);
+    flow_controller->period_ms = period_ms;
+    flow_controller->max_burst_bytes = static_cast<int32_t>(burst);
+
+    // UDPv4 only, discovering each other through the loopback, as the network namespace may have no multicast
+    DomainParticipantQos participant_qos;
+    participant_qos.transport().use_builtin_transports = false;
+    participant_qos.transport().user_transports.push_back(std::make_shared<UDPv4TransportDescriptor>());
+    Locator_t peer;
+    IPLocator::setIPv4(peer, 127, 0, 0, 1);
+    participant_qos.wire_protocol().builtin.initialPeersList.push_back(peer);
+    participant_qos.flow_controllers().push_back(flow_controller);
+
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    DomainParticipant* pub_participant = factory->create_participant(domain_id, participant_qos);
+    DomainParticipant* sub_participant = factory->create_participant(domain_id, participant_qos);
+    if (nullptr == pub_participant || nullptr == sub_participant)
+    {
+        std::cout << "Error creating participants" << std::endl;
+        return 1;
+    }
+
+    TypeSupport type(new PacingSampleType(sample_size));
+    type.register_type(pub_participant);
+    type.register_type(sub_participant);
+    Topic* pub_topic = pub_participant->create_topic("PacingTopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    Topic* sub_topic = sub_participant->create_topic("PacingTopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+
+    Publisher* publisher = pub_participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+    writer_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    writer_qos.publish_mode().kind = ASYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.publish_mode().flow_controller_name = flow_controller_name.c_str();
+    DataWriter* writer = publisher->create_datawriter(pub_topic, writer_qos);
+
+    PacingReaderListener listener;
+    Subscriber* subscriber = sub_participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    DataReader* reader = subscriber->create_datareader(sub_topic, reader_qos, &listener);
+
+    if (nullptr == writer || nullptr == reader)
+    {
+        std::cout << "Error creating endpoints" << std::endl;
+        return 1;
+    }
+
+    auto match_deadline = clock_type::now() + std::chrono::seconds(10);
+    while (0 == listener.matched && clock_type::now() < match_deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    if (0 == listener.matched)
+    {
+        std::cout << "Endpoints not matched" << std::endl;
+        return 1;
+    }
+
+    PacingSample sample;
+    sample.data.assign(sample_size, 0xAA);
+
+    uint32_t sent = 0;
+    auto start = clock_type::now();
+    for (uint32_t n = 0; n < num_samples; ++n)
+    {
+        sample.index = n;
+        if (writer->write(&sample))
+        {
+            ++sent;
+        }
+        std::this_thread::sleep_until(start + std::chrono::milliseconds(interval_ms * (n + 1)));
+    }
+
+    // Let the flow controller drain the history
+    writer->wait_for_acknowledgments(eprosima::fastrtps::Duration_t(10, 0));
+    auto last_received = listener.received.load();
+    do
+    {
+        last_received = listener.received.load();
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    } while (last_received != listener.received.load());
+    std::chrono::duration<double, std::milli> elapsed = clock_type::now() - start;
+
+    uint32_t received = listener.received.load();
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "Samples sent: " << sent << std::endl;
+    std::cout << "Samples received: " << received << std::endl;
+    std::cout << "Samples lost: " << (sent > received ? sent - received : 0) << std::endl;
+    std::cout << "Elapsed time (ms): " << elapsed.count() << std::endl;
+
+    pub_participant->delete_contained_entities();
+    sub_participant->delete_contained_entities();
+    factory->delete_participant(pub_participant);
+    factory->delete_participant(sub_participant);
+
+    return sent == num_samples ? 0 : 1;
+}
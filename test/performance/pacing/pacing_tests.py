@@ -0,0 +1,132 @@
+# Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Run PacingTest on a loopback shaped with netem, with and without token-bucket pacing.
+
+A network namespace is created so the shaping does not affect the loopback of the host. It requires root
+privileges (or CAP_NET_ADMIN and CAP_SYS_ADMIN).
+"""
+
+import argparse
+import os
+import subprocess
+
+NAMESPACE = 'fastdds_pacing'
+
+
+def run_test(binary, args, burst):
+    """Run PacingTest inside the namespace and return its results."""
+    command = [
+        'ip', 'netns', 'exec', NAMESPACE, binary,
+        '--samples', args.samples,
+        '--size', args.size,
+        '--interval', args.interval,
+        '--rate', args.rate,
+        '--period', args.period,
+        '--burst', burst,
+    ]
+    process = subprocess.run(command, stdout=subprocess.PIPE, universal_newlines=True)
+    results = {}
+    for line in process.stdout.splitlines():
+        key, _, value = line.partition(':')
+        results[key] = value.strip()
+    return process.returncode, results
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter
+    )
+    parser.add_argument(
+        '-n',
+        '--samples',
+        help='The number of samples sent',
+        required=False,
+        default='100'
+    )
+    parser.add_argument(
+        '-s',
+        '--size',
+        help='The size of the samples in bytes',
+        required=False,
+        default='262144'
+    )
+    parser.add_argument(
+        '-i',
+        '--interval',
+        help='The milliseconds between samples',
+        required=False,
+        default='50'
+    )
+    parser.add_argument(
+        '-r',
+        '--rate',
+        help='The bytes per second allowed by the flow controller',
+        required=False,
+        default='6250000'
+    )
+    parser.add_argument(
+        '-p',
+        '--period',
+        help='The period of the flow controller in milliseconds',
+        required=False,
+        default='100'
+    )
+    parser.add_argument(
+        '-b',
+        '--burst',
+        help='The depth of the token bucket in bytes on the paced run',
+        required=False,
+        default='65536'
+    )
+    parser.add_argument(
+        '--link_rate',
+        help='The rate of the shaped loopback (netem syntax)',
+        required=False,
+        default='100mbit'
+    )
+    parser.add_argument(
+        '--link_limit',
+        help='The packets queued by netem before dropping',
+        required=False,
+        default='100'
+    )
+
+    args = parser.parse_args()
+
+    pacing_test = os.environ.get('PACING_TEST_BIN', 'PacingTest')
+
+    subprocess.run(['ip', 'netns', 'add', NAMESPACE], check=True)
+    ret = 0
+    try:
+        subprocess.run(['ip', 'netns', 'exec', NAMESPACE, 'ip', 'link', 'set', 'lo', 'up'], check=True)
+        subprocess.run(
+            ['ip', 'netns', 'exec', NAMESPACE, 'tc', 'qdisc', 'add', 'dev', 'lo', 'root', 'netem',
+             'rate', args.link_rate, 'limit', args.link_limit],
+            check=True)
+
+        for name, burst in [('Burst', '0'), ('Paced', args.burst)]:
+            returncode, results = run_test(pacing_test, args, burst)
+            ret |= returncode
+            print('{}: sent {}, received {}, lost {}, elapsed {} ms'.format(
+                name,
+                results.get('Samples sent', '-'),
+                results.get('Samples received', '-'),
+                results.get('Samples lost', '-'),
+                results.get('Elapsed time (ms)', '-')))
+    finally:
+        subprocess.run(['ip', 'netns', 'delete', NAMESPACE])
+
+    exit(ret)
@@ -0,0 +1,477 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_RecordingTest.cpp
+ *
+ * Measures the throughput of the recording and the replay of samples:
+ *   - Baseline: a reliable writer sends the samples as fast as possible to a reader of another participant.
+ *   - Record: the same, with the reader participant recording the topic (fastdds.recorder properties).
+ *   - Replay: a Replayer republishes the recording as fast as possible (or at the given speed) to a reader.
+ * The difference between the first two runs is the cost of the capture on the reception path.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/recording/Replayer.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+using namespace eprosima::fastdds::dds;
+
+using clock_type = std::chrono::steady_clock;
+
+static const char* TOPIC_NAME = "RecordingTopic";
+
+//! Sample with a sequence number followed by an opaque payload
+struct RecordingSample
+{
+    uint32_t index = 0;
+    std::vector<uint8_t> data;
+};
+
+//! Plain serialization of RecordingSample, so the size of the payload is exactly the requested one
+class RecordingSampleType : public TopicDataType
+{
+public:
+
+    RecordingSampleType(
+            uint32_t sample_size)
+    {
+        setName("RecordingSample");
+        m_typeSize = sample_size + 4u + 4u;
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void* data,
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload) override
+    {
+        RecordingSample* sample = static_cast<RecordingSample*>(data);
+        uint32_t length = static_cast<uint32_t>(sample->data.size()) + 4u;
+        if (payload->max_size < length + 4u)
+        {
+            return false;
+        }
+        // Encapsulation (CDR_LE) followed by the index and the raw data
+        payload->data[0] = 0;
+        payload->data[1] = 1;
+        payload->data[2] = 0;
+        payload->data[3] = 0;
+        memcpy(&payload->data[4], &sample->index, sizeof(sample->index));
+        memcpy(&payload->data[8], sample->data.data(), sample->data.size());
+        payload->length = length + 4u;
+        return true;
+    }
+
+    bool deserialize(
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+            void* data) override
+    {
+        RecordingSample* sample = static_cast<RecordingSample*>(data);
+        if (payload->length < 8u)
+        {
+            return false;
+        }
+        memcpy(&sample->index, &payload->data[4], sizeof(sample->index));
+        sample->data.assign(&payload->data[8], &payload->data[payload->length]);
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        return [data]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(static_cast<RecordingSample*>(data)->data.size()) + 8u;
+               };
+    }
+
+    void* createData() override
+    {
+        return new RecordingSample();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<RecordingSample*>(data);
+    }
+
+    bool getKey(
+            void*,
+            eprosima::fastrtps::rtps::InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+//! Counts the samples received and the matched writers
+class RecordingReaderListener : public DataReaderListener
+{
+public:
+
+    void on_data_available(
+            DataReader* reader) override
+    {
+        RecordingSample sample;
+        SampleInfo info;
+        while (ReturnCode_t::RETCODE_OK == reader->take_next_sample(&sample, &info))
+        {
+            if (info.valid_data)
+            {
+                ++received;
+            }
+        }
+    }
+
+    void on_subscription_matched(
+            DataReader*,
+            const SubscriptionMatchedStatus& info) override
+    {
+        matched = info.current_count;
+    }
+
+    std::atomic<uint32_t> received{0};
+    std::atomic<int32_t> matched{0};
+};
+
+//! Reader on its own participant
+class CountingReader
+{
+public:
+
+    bool init(
+            uint32_t domain_id,
+            const DomainParticipantQos& participant_qos,
+            TypeSupport& type)
+    {
+        participant_ = DomainParticipantFactory::get_instance()->create_participant(domain_id, participant_qos);
+        if (nullptr == participant_)
+        {
+            return false;
+        }
+        type.register_type(participant_);
+        Topic* topic = participant_->create_topic(TOPIC_NAME, type.get_type_name(), TOPIC_QOS_DEFAULT);
+        Subscriber* subscriber = participant_->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+        DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+        reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+        reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+        return nullptr != subscriber->create_datareader(topic, reader_qos, &listener_);
+    }
+
+    ~CountingReader()
+    {
+        if (nullptr != participant_)
+        {
+            participant_->delete_contained_entities();
+            DomainParticipantFactory::get_instance()->delete_participant(participant_);
+        }
+    }
+
+    bool wait_matched(
+            int32_t count)
+    {
+        auto deadline = clock_type::now() + std::chrono::seconds(10);
+        while (listener_.matched < count && clock_type::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return listener_.matched >= count;
+    }
+
+    //! Waits for the given number of samples, or until no more samples arrive
+    void wait_samples(
+            uint32_t count)
+    {
+        uint32_t last_received = 0;
+        auto last_change = clock_type::now();
+        while (listener_.received < count && clock_type::now() - last_change < std::chrono::seconds(2))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            if (last_received != listener_.received)
+            {
+                last_received = listener_.received;
+                last_change = clock_type::now();
+            }
+        }
+    }
+
+    uint32_t received() const
+    {
+        return listener_.received;
+    }
+
+private:
+
+    DomainParticipant* participant_ = nullptr;
+    RecordingReaderListener listener_;
+};
+
+static DataWriterQos writer_qos()
+{
+    DataWriterQos qos = DATAWRITER_QOS_DEFAULT;
+    qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    qos.reliability().max_blocking_time = eprosima::fastrtps::Duration_t(10, 0);
+    qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    return qos;
+}
+
+static void print_results(
+        const std::string& name,
+        uint32_t sent,
+        uint32_t received,
+        uint32_t sample_size,
+        std::chrono::duration<double> elapsed)
+{
+    double seconds = elapsed.count();
+    std::cout << name << " samples sent: " << sent << std::endl;
+    std::cout << name << " samples received: " << received << std::endl;
+    std::cout << name << " elapsed time (ms): " << seconds * 1000.0 << std::endl;
+    std::cout << name << " throughput (samples/s): " << (seconds > 0 ? received / seconds : 0.0) << std::endl;
+    std::cout << name << " throughput (MB/s): " <<
+        (seconds > 0 ? double(received) * sample_size / seconds / 1e6 : 0.0) << std::endl;
+}
+
+/**
+ * Sends the samples from a writer to a reader, with the reader participant recording them when record_file is
+ * not empty.
+ * @return false on error.
+ */
+static bool publish_run(
+        const std::string& name,
+        uint32_t domain_id,
+        uint32_t num_samples,
+        uint32_t sample_size,
+        const std::string& record_file,
+        uint32_t buffer_size)
+{
+    TypeSupport type(new RecordingSampleType(sample_size));
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+
+    DomainParticipant* participant = factory->create_participant(domain_id, PARTICIPANT_QOS_DEFAULT);
+    if (nullptr == participant)
+    {
+        std::cout << "Error creating participant" << std::endl;
+        return false;
+    }
+    type.register_type(participant);
+    Topic* topic = participant->create_topic(TOPIC_NAME, type.get_type_name(), TOPIC_QOS_DEFAULT);
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    DataWriter* writer = publisher->create_datawriter(topic, writer_qos());
+
+    uint32_t sent = 0;
+    uint32_t received = 0;
+    std::chrono::duration<double> elapsed(0);
+    bool ok = nullptr != writer;
+
+    if (ok)
+    {
+        DomainParticipantQos reader_participant_qos;
+        if (!record_file.empty())
+        {
+            reader_participant_qos.properties().properties().emplace_back("fastdds.recorder.file", record_file);
+            reader_participant_qos.properties().properties().emplace_back("fastdds.recorder.buffer_size",
+                    std::to_string(buffer_size));
+        }
+
+        // The reader participant is deleted before leaving, so the recording is complete
+        CountingReader reader;
+        ok = reader.init(domain_id, reader_participant_qos, type) && reader.wait_matched(1);
+        if (ok)
+        {
+            RecordingSample sample;
+            sample.data.assign(sample_size, 0xAA);
+
+            auto start = clock_type::now();
+            for (uint32_t n = 0; n < num_samples; ++n)
+            {
+                sample.index = n;
+                if (writer->write(&sample))
+                {
+                    ++sent;
+                }
+            }
+            reader.wait_samples(sent);
+            elapsed = clock_type::now() - start;
+            received = reader.received();
+        }
+        else
+        {
+            std::cout << "Error creating reader" << std::endl;
+        }
+    }
+
+    participant->delete_contained_entities();
+    factory->delete_participant(participant);
+
+    if (ok)
+    {
+        print_results(name, sent, received, sample_size, elapsed);
+    }
+    return ok;
+}
+
+/**
+ * Replays the recording to a reader.
+ * @return false on error.
+ */
+static bool replay_run(
+        uint32_t domain_id,
+        uint32_t sample_size,
+        const std::string& record_file,
+        double speed)
+{
+    TypeSupport type(new RecordingSampleType(sample_size));
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+
+    DomainParticipant* participant = factory->create_participant(domain_id, PARTICIPANT_QOS_DEFAULT);
+    if (nullptr == participant)
+    {
+        std::cout << "Error creating participant" << std::endl;
+        return false;
+    }
+    type.register_type(participant);
+
+    bool ok = false;
+    {
+        Replayer replayer(participant, record_file, writer_qos());
+        CountingReader reader;
+        if (!replayer.enable())
+        {
+            std::cout << "Error opening the recording" << std::endl;
+        }
+        else if (!reader.init(domain_id, PARTICIPANT_QOS_DEFAULT, type) || !reader.wait_matched(1))
+        {
+            std::cout << "Error creating reader" << std::endl;
+        }
+        else
+        {
+            auto start = clock_type::now();
+            ok = !!replayer.replay(speed);
+            uint32_t replayed = static_cast<uint32_t>(replayer.replayed_samples());
+            reader.wait_samples(replayed);
+            std::chrono::duration<double> elapsed = clock_type::now() - start;
+
+            print_results("Replay", replayed, reader.received(), sample_size, elapsed);
+            std::cout << "Recording duration (ms): " << replayer.duration().to_ns() / 1e6 << std::endl;
+        }
+    }
+
+    participant->delete_contained_entities();
+    factory->delete_participant(participant);
+    return ok;
+}
+
+static void usage(
+        const char* name)
+{
+    std::cout << "Usage: " << name << " [--samples <n>] [--size <bytes>] [--buffer <bytes>] [--speed <factor>]" <<
+        " [--file <path>] [--domain <id>]" << std::endl;
+    std::cout << "  --samples  Number of samples sent (default 10000)." << std::endl;
+    std::cout << "  --size     Bytes of each sample (default 1024)." << std::endl;
+    std::cout << "  --buffer   Bytes of the capture buffers of the recorder (default 4194304)." << std::endl;
+    std::cout << "  --speed    Pace of the replay relative to the recording. 0 replays as fast as possible" <<
+        " (default 0)." << std::endl;
+    std::cout << "  --file     Path of the recording (default RecordingTest). Its segments are removed at the end." <<
+        std::endl;
+    std::cout << "  --domain   Domain of the participants (default 0)." << std::endl;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_samples = 10000;
+    uint32_t sample_size = 1024;
+    uint32_t buffer_size = 4194304;
+    double speed = 0;
+    std::string file = "RecordingTest";
+    uint32_t domain_id = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (i + 1 < argc && 0 == strcmp(argv[i], "--samples"))
+        {
+            num_samples = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--size"))
+        {
+            sample_size = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--buffer"))
+        {
+            buffer_size = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--speed"))
+        {
+            speed = std::strtod(argv[++i], nullptr);
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--file"))
+        {
+            file = argv[++i];
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--domain"))
+        {
+            domain_id = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(3);
+
+    bool ok = publish_run("Baseline", domain_id, num_samples, sample_size, "", buffer_size) &&
+            publish_run("Record", domain_id, num_samples, sample_size, file, buffer_size) &&
+            replay_run(domain_id, sample_size, file, speed);
+
+    // Segment files are named <file>_NNNN.fddsrec
+    for (uint32_t n = 0;; ++n)
+    {
+        char segment[32];
+        snprintf(segment, sizeof(segment), "_%04u.fddsrec", n);
+        std::string segment_file = file + segment;
+        if (!std::ifstream(segment_file).good())
+        {
+            break;
+        }
+        std::remove(segment_file.c_str());
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,198 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_StartupTest.cpp
+ *
+ * Measures the creation time of participants with automatic identifiers, and counts the participants whose
+ * metatraffic unicast port is not the one of their identifier (the port was taken by a participant of another
+ * process, so it was mutated).
+ * On Linux, the number of threads and the resident memory of the process with all the participants created are
+ * also reported.
+ *
+ * Several instances are meant to be launched at the same time (see startup_tests.py).
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+
+using namespace eprosima::fastrtps::rtps;
+
+using clock_type = std::chrono::steady_clock;
+
+static void usage(
+        const char* name)
+{
+    std::cout << "Usage: " << name << " [--participants <n>] [--domain <id>] [--hold <ms>] [--host_ids]" <<
+        " [--shared_transports] [--shared_event_thread] [--lazy_builtin_endpoints]" << std::endl;
+    std::cout << "  --participants  Number of participants created by this process (default 10)." << std::endl;
+    std::cout << "  --domain        Domain of the participants (default 0)." << std::endl;
+    std::cout << "  --hold          Milliseconds the participants are kept alive after creating all of them," <<
+        " so concurrent instances overlap (default 2000)." << std::endl;
+    std::cout << "  --host_ids      Reserve participant identifiers host-wide (fastdds.host_participant_id)." <<
+        std::endl;
+    std::cout << "  --shared_transports    Share the reception channels (fastdds.shared_transports)." << std::endl;
+    std::cout << "  --shared_event_thread  Share the event thread (fastdds.shared_event_thread)." << std::endl;
+    std::cout << "  --lazy_builtin_endpoints  Create the optional builtin endpoints on demand" <<
+        " (fastdds.lazy_builtin_endpoints)." << std::endl;
+}
+
+//! Prints the lines of /proc/self/status with the number of threads and the resident memory
+static void print_process_status()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (0 == line.compare(0, 8, "Threads:") || 0 == line.compare(0, 6, "VmRSS:"))
+        {
+            std::cout << line << std::endl;
+        }
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_participants = 10;
+    uint32_t domain_id = 0;
+    uint32_t hold_ms = 2000;
+    bool host_ids = false;
+    bool shared_transports = false;
+    bool shared_event_thread = false;
+    bool lazy_builtin_endpoints = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (0 == strcmp(argv[i], "--host_ids"))
+        {
+            host_ids = true;
+        }
+        else if (0 == strcmp(argv[i], "--shared_transports"))
+        {
+            shared_transports = true;
+        }
+        else if (0 == strcmp(argv[i], "--shared_event_thread"))
+        {
+            shared_event_thread = true;
+        }
+        else if (0 == strcmp(argv[i], "--lazy_builtin_endpoints"))
+        {
+            lazy_builtin_endpoints = true;
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--participants"))
+        {
+            num_participants = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--domain"))
+        {
+            domain_id = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--hold"))
+        {
+            hold_ms = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    RTPSParticipantAttributes attributes;
+    if (host_ids)
+    {
+        attributes.properties.properties().emplace_back("fastdds.host_participant_id", "true");
+    }
+    if (shared_transports)
+    {
+        attributes.properties.properties().emplace_back("fastdds.shared_transports", "true");
+    }
+    if (shared_event_thread)
+    {
+        attributes.properties.properties().emplace_back("fastdds.shared_event_thread", "true");
+    }
+    if (lazy_builtin_endpoints)
+    {
+        attributes.properties.properties().emplace_back("fastdds.lazy_builtin_endpoints", "true");
+    }
+
+    std::vector<RTPSParticipant*> participants;
+    uint32_t unexpected_ports = 0;
+    double max_ms = 0;
+
+    auto start = clock_type::now();
+    for (uint32_t n = 0; n < num_participants; ++n)
+    {
+        auto participant_start = clock_type::now();
+        RTPSParticipant* participant = RTPSDomain::createParticipant(domain_id, attributes);
+        std::chrono::duration<double, std::milli> elapsed = clock_type::now() - participant_start;
+        if (nullptr == participant)
+        {
+            std::cout << "Error creating participant " << n << std::endl;
+            break;
+        }
+        participants.push_back(participant);
+        max_ms = std::max(max_ms, elapsed.count());
+
+        const RTPSParticipantAttributes& att = participant->getRTPSParticipantAttributes();
+        uint32_t expected_port = att.port.getUnicastPort(domain_id, static_cast<uint32_t>(att.participantID));
+        for (const Locator_t& locator : att.builtin.metatrafficUnicastLocatorList)
+        {
+            if (LOCATOR_KIND_UDPv4 == locator.kind || LOCATOR_KIND_UDPv6 == locator.kind)
+            {
+                if (expected_port != locator.port)
+                {
+                    ++unexpected_ports;
+                }
+                break;
+            }
+        }
+    }
+    std::chrono::duration<double, std::milli> total = clock_type::now() - start;
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "Participants: " << participants.size() << std::endl;
+    std::cout << "Total creation time (ms): " << total.count() << std::endl;
+    if (!participants.empty())
+    {
+        std::cout << "Mean creation time (ms): " << total.count() / participants.size() << std::endl;
+    }
+    std::cout << "Max creation time (ms): " << max_ms << std::endl;
+    std::cout << "Unexpected ports: " << unexpected_ports << std::endl;
+    print_process_status();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(hold_ms));
+
+    for (RTPSParticipant* participant : participants)
+    {
+        RTPSDomain::removeRTPSParticipant(participant);
+    }
+
+    return participants.size() == num_participants ? 0 : 1;
+}
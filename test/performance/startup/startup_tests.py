@@ -0,0 +1,129 @@
+# Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Launch several StartupTest processes at the same time and aggregate their results."""
+
+import argparse
+import os
+import subprocess
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter
+    )
+    parser.add_argument(
+        '-p',
+        '--processes',
+        help='The number of processes launched concurrently',
+        required=False,
+        default='20'
+    )
+    parser.add_argument(
+        '-n',
+        '--participants',
+        help='The number of participants created by each process',
+        required=False,
+        default='5'
+    )
+    parser.add_argument(
+        '-d',
+        '--domain',
+        help='The domain of the participants',
+        required=False,
+        default='0'
+    )
+    parser.add_argument(
+        '--host_ids',
+        action='store_true',
+        help='Reserve participant identifiers host-wide (Defaults: disable)',
+        required=False
+    )
+    parser.add_argument(
+        '--shared_transports',
+        action='store_true',
+        help='Share the reception channels of the participants of each process (Defaults: disable)',
+        required=False
+    )
+    parser.add_argument(
+        '--shared_event_thread',
+        action='store_true',
+        help='Share the event thread of the participants of each process (Defaults: disable)',
+        required=False
+    )
+    parser.add_argument(
+        '--lazy_builtin_endpoints',
+        action='store_true',
+        help='Create the optional builtin endpoints on demand (Defaults: disable)',
+        required=False
+    )
+
+    args = parser.parse_args()
+
+    startup_test = os.environ.get('STARTUP_TEST_BIN', 'StartupTest')
+
+    command = [
+        startup_test,
+        '--participants', args.participants,
+        '--domain', args.domain,
+    ]
+    if args.host_ids:
+        command.append('--host_ids')
+    if args.shared_transports:
+        command.append('--shared_transports')
+    if args.shared_event_thread:
+        command.append('--shared_event_thread')
+    if args.lazy_builtin_endpoints:
+        command.append('--lazy_builtin_endpoints')
+
+    processes = [
+        subprocess.Popen(command, stdout=subprocess.PIPE, universal_newlines=True)
+        for _ in range(int(args.processes))
+    ]
+
+    participants = 0
+    unexpected_ports = 0
+    max_ms = 0.0
+    total_ms = 0.0
+    threads = 0
+    rss_kb = 0
+    ret = 0
+    for process in processes:
+        output, _ = process.communicate()
+        ret |= process.returncode
+        for line in output.splitlines():
+            key, _, value = line.partition(':')
+            if key == 'Participants':
+                participants += int(value)
+            elif key == 'Unexpected ports':
+                unexpected_ports += int(value)
+            elif key == 'Max creation time (ms)':
+                max_ms = max(max_ms, float(value))
+            elif key == 'Total creation time (ms)':
+                total_ms += float(value)
+            elif key == 'Threads':
+                threads += int(value)
+            elif key == 'VmRSS':
+                rss_kb += int(value.split()[0])
+
+    print('Participants: {}'.format(participants))
+    if participants > 0:
+        print('Mean creation time (ms): {:.3f}'.format(
+            total_ms / participants))
+    print('Max creation time (ms): {:.3f}'.format(max_ms))
+    print('Unexpected ports: {}'.format(unexpected_ports))
+    if threads > 0:
+        print('Threads: {}'.format(threads))
+        print('Resident memory (kB): {}'.format(rss_kb))
+
+    exit(ret)
@@ -125,13 +125,15 @@ bool ThroughputPublisher::init(
         Arg::EnablerValue data_sharing,
         bool data_loans,
         Arg::EnablerValue shared_memory,
-        int forced_domain)
+        int forced_domain,
+        bool write_batch)
 {
     pid_ = pid;
     hostname_ = hostname;
     dynamic_types_ = dynamic_types;
     data_sharing_ = data_sharing;
     data_loans_ = data_loans;
+    write_batch_ = write_batch;
     shared_memory_ = shared_memory;
     reliable_ = reliable;
     forced_domain_ = forced_domain;
@@ -592,6 +594,15 @@ void ThroughputPublisher::run(
             {
                 // Create the data sample
                 throughput_data_ = static_cast<ThroughputType*>(throughput_data_type_.create_data());
+
+                // A different sample for each one of the burst, so they can be written at once
+                if (write_batch_)
+                {
+                    for (uint32_t i = 0; i < max_demand; ++i)
+                    {
+                        throughput_batch_.push_back(throughput_data_type_.create_data());
+                    }
+                }
             }
         }
 
@@ -647,6 +658,12 @@ void ThroughputPublisher::run(
             if (!data_loans_)
             {
                 throughput_data_type_.delete_data(throughput_data_);
+
+                for (void* sample : throughput_batch_)
+                {
+                    throughput_data_type_.delete_data(sample);
+                }
+                throughput_batch_.clear();
             }
             throughput_data_ = nullptr;
 
@@ -731,8 +748,18 @@ bool ThroughputPublisher::test(
     {
         // Get start time
         batch_start = std::chrono::steady_clock::now();
+        // Send a batch of size demand with a single call
+        if (!throughput_batch_.empty())
+        {
+            std::vector<void*> batch(throughput_batch_.begin(), throughput_batch_.begin() + demand);
+            for (void* sample : batch)
+            {
+                static_cast<ThroughputType*>(sample)->seqnum = ++seqnum;
+            }
+            data_writer_->write_batch(batch);
+        }
         // Send a batch of size demand
-        for (uint32_t sample = 0; sample < demand; sample++)
+        for (uint32_t sample = 0; throughput_batch_.empty() && sample < demand; sample++)
         {
             if (dynamic_types_)
             {
@@ -69,7 +69,8 @@ public:
             Arg::EnablerValue data_sharing,
             bool data_loans,
             Arg::EnablerValue shared_memory,
-            int forced_domain);
+            int forced_domain,
+            bool write_batch = false);
 
     ~ThroughputPublisher();
 
@@ -133,6 +134,8 @@ private:
     eprosima::fastdds::dds::TypeSupport throughput_command_type_;
     // Static Data
     ThroughputType* throughput_data_ = nullptr;
+    // Static Data, one per sample of the burst, when using write_batch
+    std::vector<void*> throughput_batch_;
     eprosima::fastdds::dds::TypeSupport throughput_data_type_;
     // Dynamic Data
     eprosima::fastrtps::types::DynamicData* dynamic_data_ = nullptr;
@@ -147,6 +150,7 @@ private:
     bool dynamic_types_ = false;
     Arg::EnablerValue data_sharing_ = Arg::EnablerValue::NO_SET;
     bool data_loans_ = false;
+    bool write_batch_ = false;
     Arg::EnablerValue shared_memory_ = Arg::EnablerValue::NO_SET;
     bool ready_ = true;
     bool reliable_ = false;
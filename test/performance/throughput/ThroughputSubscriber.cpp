@@ -134,6 +134,31 @@ void ThroughputSubscriber::DataReaderListener::on_data_available(
             return;
         }
     }
+    else if (sub.ring_)
+    {
+        // The ring is filled on reception. Samples not fitting in it are taken once it has been consumed.
+        SampleRing& ring = *sub.ring_;
+        do
+        {
+            while (!ring.empty())
+            {
+                if (ring.info().valid_data)
+                {
+                    uint32_t seq_num = static_cast<ThroughputType*>(ring.data())->seqnum;
+                    if ((last_seq_num_ + 1) < seq_num)
+                    {
+                        lost_samples_ += seq_num - last_seq_num_ - 1;
+                    }
+                    last_seq_num_ = seq_num;
+                }
+                else
+                {
+                    std::cout << "invalid data received" << std::endl;
+                }
+                ring.pop();
+            }
+        } while (ReturnCode_t::RETCODE_OK == reader->take_to_ring(ring));
+    }
     else
     {
         void* data = sub.dynamic_types_ ? (void*)sub.dynamic_data_ : (void*)sub.throughput_data_;
@@ -265,7 +290,8 @@ bool ThroughputSubscriber::init(
         Arg::EnablerValue data_sharing,
         bool data_loans,
         Arg::EnablerValue shared_memory,
-        int forced_domain)
+        int forced_domain,
+        bool sample_ring)
 {
     pid_ = pid;
     hostname_ = hostname;
@@ -273,6 +299,7 @@ bool ThroughputSubscriber::init(
     data_sharing_ = data_sharing;
     shared_memory_ = shared_memory;
     data_loans_ = data_loans;
+    sample_ring_ = sample_ring;
     reliable_ = reliable;
     forced_domain_ = forced_domain;
     xml_config_file_ = xml_config_file;
@@ -600,6 +627,12 @@ int ThroughputSubscriber::process_message()
                                 throughput_data_ = static_cast<ThroughputType*>(throughput_data_type_.create_data());
                             }
 
+                            if (sample_ring_ && !create_sample_ring(max_demand))
+                            {
+                                logError(THROUGHPUTSUBSCRIBER, "Iteration failed: Failed to create the sample ring");
+                                return 2;
+                            }
+
                             // wait for data endpoint discovery
                             {
                                 std::cout << "Waiting for data discovery" << std::endl;
@@ -641,6 +674,10 @@ int ThroughputSubscriber::process_message()
                             }
                         }
                     }
+                    if (ring_)
+                    {
+                        ring_->pop(ring_->size());
+                    }
                     data_reader_listener_.reset();
 
                     ThroughputCommandType command_sample(BEGIN);
@@ -908,6 +945,8 @@ bool ThroughputSubscriber::destroy_data_endpoints()
     assert(nullptr != participant_);
     assert(nullptr != subscriber_);
 
+    destroy_sample_ring();
+
     // Delete the endpoint
     if (nullptr == data_reader_
             || ReturnCode_t::RETCODE_OK != subscriber_->delete_datareader(data_reader_))
@@ -954,3 +993,38 @@ int ThroughputSubscriber::total_matches() const
     assert(count >= 0 && count <= 3 );
     return count;
 }
+
+bool ThroughputSubscriber::create_sample_ring(
+        uint32_t capacity)
+{
+    assert(nullptr != data_reader_);
+    assert(!ring_);
+
+    for (uint32_t i = 0; i < capacity; ++i)
+    {
+        ring_samples_.push_back(throughput_data_type_.create_data());
+    }
+    ring_.reset(new SampleRing(ring_samples_));
+
+    return ReturnCode_t::RETCODE_OK == data_reader_->set_sample_ring(ring_.get());
+}
+
+void ThroughputSubscriber::destroy_sample_ring()
+{
+    if (!ring_)
+    {
+        return;
+    }
+
+    if (nullptr != data_reader_)
+    {
+        data_reader_->set_sample_ring(nullptr);
+    }
+    ring_.reset();
+
+    for (void* sample : ring_samples_)
+    {
+        throughput_data_type_.delete_data(sample);
+    }
+    ring_samples_.clear();
+}
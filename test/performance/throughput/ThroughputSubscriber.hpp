@@ -24,6 +24,8 @@
 #include <condition_variable>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <vector>
 
 #include <asio.hpp>
 #include <fastdds/dds/publisher/DataWriterListener.hpp>
@@ -31,6 +33,7 @@
 #include <fastdds/dds/subscriber/DataReaderListener.hpp>
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/SampleRing.hpp>
 #include <fastdds/dds/subscriber/Subscriber.hpp>
 #include <fastrtps/rtps/attributes/PropertyPolicy.h>
 #include <fastrtps/types/DynamicData.h>
@@ -63,7 +66,8 @@ public:
             Arg::EnablerValue data_sharing,
             bool data_loans,
             Arg::EnablerValue shared_memory,
-            int forced_domain);
+            int forced_domain,
+            bool sample_ring);
 
     ~ThroughputSubscriber();
 
@@ -83,6 +87,11 @@ private:
 
     bool destroy_data_endpoints();
 
+    bool create_sample_ring(
+            uint32_t capacity);
+
+    void destroy_sample_ring();
+
     // return value: 0 - Continuing test, 1 - End of a test, 2 - Finish application
     int process_message();
 
@@ -121,6 +130,9 @@ private:
     // Dynamic Data
     eprosima::fastrtps::types::DynamicData* dynamic_data_ = nullptr;
     eprosima::fastdds::dds::TypeSupport dynamic_pub_sub_type_;
+    // Sample ring
+    std::vector<void*> ring_samples_;
+    std::unique_ptr<eprosima::fastdds::dds::SampleRing> ring_;
     // QoS Profiles
     eprosima::fastdds::dds::DataReaderQos dr_qos_;
 
@@ -128,6 +140,7 @@ private:
     bool dynamic_types_ = false;
     Arg::EnablerValue data_sharing_ = Arg::EnablerValue::NO_SET;
     bool data_loans_ = false;
+    bool sample_ring_ = false;
     Arg::EnablerValue shared_memory_ = Arg::EnablerValue::NO_SET;
     bool ready_ = true;
     bool reliable_ = false;
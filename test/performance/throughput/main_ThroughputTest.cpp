@@ -64,7 +64,9 @@ enum  optionIndex
     SUBSCRIBERS,
     DATA_SHARING,
     DATA_LOAN,
-    SHARED_MEMORY
+    SHARED_MEMORY,
+    WRITE_BATCH,
+    SAMPLE_RING
 };
 
 enum TestAgent
@@ -120,6 +122,10 @@ const option::Descriptor usage[] = {
       "  -d <num>,  --demand=<num>           Number of samples sent in block (Defaults: 10000)." },
     { MSG_SIZE,      0, "s", "msg_size",        Arg::Numeric,
       "  -s <num>,  --msg_size=<num>         Size of the message in bytes (Defaults: 1024)." },
+    { WRITE_BATCH,   0, "",  "write_batch",     Arg::None,
+      "             --write_batch            Write each burst with a single DataWriter::write_batch call." },
+    { SAMPLE_RING,   0, "",  "sample_ring",     Arg::None,
+      "             --sample_ring            Receive the samples into a SampleRing attached to the DataReader." },
     { FILE_R,        0, "f", "file",            Arg::Required,
       "  -f <arg>,  --file=<arg>             File to read the payload demands from." },
     { EXPORT_CSV,    0, "",  "export_csv",      Arg::String,
@@ -173,6 +179,8 @@ int main(
 #endif // if HAVE_SECURITY
     Arg::EnablerValue data_sharing = Arg::EnablerValue::NO_SET;
     bool data_loans = false;
+    bool write_batch = false;
+    bool sample_ring = false;
     Arg::EnablerValue shared_memory = Arg::EnablerValue::NO_SET;
 
     argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
@@ -343,6 +351,12 @@ int main(
             case DATA_LOAN:
                 data_loans = true;
                 break;
+            case WRITE_BATCH:
+                write_batch = true;
+                break;
+            case SAMPLE_RING:
+                sample_ring = true;
+                break;
             case SHARED_MEMORY:
                 if (0 == strncasecmp(opt.arg, "on", 2))
                 {
@@ -380,6 +394,18 @@ int main(
         return 1;
     }
 
+    if (write_batch && (data_loans || dynamic_types))
+    {
+        logError(ThroughputTest, "Batched writes NOT supported with data loans or dynamic types");
+        return 1;
+    }
+
+    if (sample_ring && (data_loans || dynamic_types))
+    {
+        logError(ThroughputTest, "Sample rings NOT supported with data loans or dynamic types");
+        return 1;
+    }
+
     PropertyPolicy pub_part_property_policy;
     PropertyPolicy sub_part_property_policy;
     PropertyPolicy pub_property_policy;
@@ -482,7 +508,8 @@ int main(
                     data_sharing,
                     data_loans,
                     shared_memory,
-                    forced_domain)
+                    forced_domain,
+                    write_batch)
                 )
         {
             throughput_publisher.run(test_time_sec, recovery_time_ms, demand, msg_size, subscribers);
@@ -508,7 +535,8 @@ int main(
                     data_sharing,
                     data_loans,
                     shared_memory,
-                    forced_domain))
+                    forced_domain,
+                    sample_ring))
         {
             throughput_subscriber.run();
         }
@@ -539,7 +567,8 @@ int main(
                     data_sharing,
                     data_loans,
                     shared_memory,
-                    forced_domain))
+                    forced_domain,
+                    write_batch))
         {
             return_code = 1;
             return return_code;
@@ -564,7 +593,8 @@ int main(
                 data_sharing,
                 data_loans,
                 shared_memory,
-                forced_domain);
+                forced_domain,
+                sample_ring);
         }
 
         // Spawn run threads
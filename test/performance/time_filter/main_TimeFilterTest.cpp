@@ -0,0 +1,396 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_TimeFilterTest.cpp
+ *
+ * Measures the traffic saved by applying the TIME_BASED_FILTER of the readers on the writer side.
+ * A writer publishes at a fixed rate to readers with different minimum separations, each one on its own
+ * participant, and the samples and bytes received by each reader are reported. Without writer side filtering,
+ * every reader would receive every sample.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+using namespace eprosima::fastdds::dds;
+
+using clock_type = std::chrono::steady_clock;
+
+static const char* TOPIC_NAME = "TimeFilterTopic";
+
+//! Sample with a sequence number followed by an opaque payload
+struct TimeFilterSample
+{
+    uint32_t index = 0;
+    std::vector<uint8_t> data;
+};
+
+//! Plain serialization of TimeFilterSample, so the size of the payload is exactly the requested one
+class TimeFilterSampleType : public TopicDataType
+{
+public:
+
+    TimeFilterSampleType(
+            uint32_t sample_size)
+    {
+        setName("TimeFilterSample");
+        m_typeSize = sample_size + 4u + 4u;
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void* data,
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload) override
+    {
+        TimeFilterSample* sample = static_cast<TimeFilterSample*>(data);
+        uint32_t length = static_cast<uint32_t>(sample->data.size()) + 4u;
+        if (payload->max_size < length + 4u)
+        {
+            return false;
+        }
+        // Encapsulation (CDR_LE) followed by the index and the raw data
+        payload->data[0] = 0;
+        payload->data[1] = 1;
+        payload->data[2] = 0;
+        payload->data[3] = 0;
+        memcpy(&payload->data[4], &sample->index, sizeof(sample->index));
+        memcpy(&payload->data[8], sample->data.data(), sample->data.size());
+        payload->length = length + 4u;
+        return true;
+    }
+
+    bool deserialize(
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+            void* data) override
+    {
+        TimeFilterSample* sample = static_cast<TimeFilterSample*>(data);
+        if (payload->length < 8u)
+        {
+            return false;
+        }
+        memcpy(&sample->index, &payload->data[4], sizeof(sample->index));
+        sample->data.assign(&payload->data[8], &payload->data[payload->length]);
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        return [data]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(static_cast<TimeFilterSample*>(data)->data.size()) + 8u;
+               };
+    }
+
+    void* createData() override
+    {
+        return new TimeFilterSample();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<TimeFilterSample*>(data);
+    }
+
+    bool getKey(
+            void*,
+            eprosima::fastrtps::rtps::InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+//! Counts the samples received and the matched writers
+class TimeFilterReaderListener : public DataReaderListener
+{
+public:
+
+    void on_data_available(
+            DataReader* reader) override
+    {
+        TimeFilterSample sample;
+        SampleInfo info;
+        while (ReturnCode_t::RETCODE_OK == reader->take_next_sample(&sample, &info))
+        {
+            if (info.valid_data)
+            {
+                ++received;
+            }
+        }
+    }
+
+    void on_subscription_matched(
+            DataReader*,
+            const SubscriptionMatchedStatus& info) override
+    {
+        matched = info.current_count;
+    }
+
+    std::atomic<uint32_t> received{0};
+    std::atomic<int32_t> matched{0};
+};
+
+//! Reader with a minimum separation, on its own participant
+class FilteredReader
+{
+public:
+
+    bool init(
+            uint32_t domain_id,
+            uint32_t separation_ms,
+            bool reliable,
+            TypeSupport& type)
+    {
+        separation_ms_ = separation_ms;
+        participant_ = DomainParticipantFactory::get_instance()->create_participant(domain_id,
+                        PARTICIPANT_QOS_DEFAULT);
+        if (nullptr == participant_)
+        {
+            return false;
+        }
+        type.register_type(participant_);
+        Topic* topic = participant_->create_topic(TOPIC_NAME, type.get_type_name(), TOPIC_QOS_DEFAULT);
+        Subscriber* subscriber = participant_->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+        DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+        reader_qos.reliability().kind = reliable ? RELIABLE_RELIABILITY_QOS : BEST_EFFORT_RELIABILITY_QOS;
+        reader_qos.time_based_filter().minimum_separation =
+                eprosima::fastrtps::Duration_t(static_cast<long double>(separation_ms) / 1000.0L);
+        return nullptr != subscriber->create_datareader(topic, reader_qos, &listener_);
+    }
+
+    ~FilteredReader()
+    {
+        if (nullptr != participant_)
+        {
+            participant_->delete_contained_entities();
+            DomainParticipantFactory::get_instance()->delete_participant(participant_);
+        }
+    }
+
+    bool is_matched() const
+    {
+        return 0 < listener_.matched;
+    }
+
+    uint32_t received() const
+    {
+        return listener_.received;
+    }
+
+    uint32_t separation_ms() const
+    {
+        return separation_ms_;
+    }
+
+private:
+
+    DomainParticipant* participant_ = nullptr;
+    TimeFilterReaderListener listener_;
+    uint32_t separation_ms_ = 0;
+};
+
+static void usage(
+        const char* name)
+{
+    std::cout << "Usage: " << name << " [--rate <Hz>] [--seconds <s>] [--size <bytes>] [--separations <ms,ms,...>]"
+              << " [--best-effort] [--domain <id>]" << std::endl;
+    std::cout << "  --rate         Samples per second published (default 1000)." << std::endl;
+    std::cout << "  --seconds      Duration of the publication (default 5)." << std::endl;
+    std::cout << "  --size         Bytes of each sample (default 1024)." << std::endl;
+    std::cout << "  --separations  Minimum separation of each reader in ms, 0 receives every sample" <<
+        " (default 0,10,100,1000)." << std::endl;
+    std::cout << "  --best-effort  Use best effort instead of reliable endpoints." << std::endl;
+    std::cout << "  --domain       Domain of the participants (default 0)." << std::endl;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t rate = 1000;
+    uint32_t seconds = 5;
+    uint32_t sample_size = 1024;
+    std::vector<uint32_t> separations = {0, 10, 100, 1000};
+    bool reliable = true;
+    uint32_t domain_id = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (i + 1 < argc && 0 == strcmp(argv[i], "--rate"))
+        {
+            rate = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--seconds"))
+        {
+            seconds = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--size"))
+        {
+            sample_size = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--separations"))
+        {
+            separations.clear();
+            std::stringstream stream(argv[++i]);
+            std::string separation;
+            while (std::getline(stream, separation, ','))
+            {
+                separations.push_back(static_cast<uint32_t>(std::strtoul(separation.c_str(), nullptr, 10)));
+            }
+        }
+        else if (0 == strcmp(argv[i], "--best-effort"))
+        {
+            reliable = false;
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--domain"))
+        {
+            domain_id = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (0 == rate || 0 == seconds || separations.empty())
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    TypeSupport type(new TimeFilterSampleType(sample_size));
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+
+    DomainParticipant* participant = factory->create_participant(domain_id, PARTICIPANT_QOS_DEFAULT);
+    if (nullptr == participant)
+    {
+        std::cout << "Error creating participant" << std::endl;
+        return 1;
+    }
+    type.register_type(participant);
+    Topic* topic = participant->create_topic(TOPIC_NAME, type.get_type_name(), TOPIC_QOS_DEFAULT);
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.reliability().kind = reliable ? RELIABLE_RELIABILITY_QOS : BEST_EFFORT_RELIABILITY_QOS;
+    writer_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    writer_qos.history().depth = 100;
+    DataWriter* writer = publisher->create_datawriter(topic, writer_qos);
+
+    int ret = 1;
+    if (nullptr != writer)
+    {
+        std::vector<std::unique_ptr<FilteredReader>> readers;
+        bool ok = true;
+        for (uint32_t separation : separations)
+        {
+            readers.emplace_back(new FilteredReader());
+            ok &= readers.back()->init(domain_id, separation, reliable, type);
+        }
+
+        auto deadline = clock_type::now() + std::chrono::seconds(10);
+        auto all_matched = [&readers]()
+                {
+                    for (const auto& reader : readers)
+                    {
+                        if (!reader->is_matched())
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                };
+        while (ok && !all_matched() && clock_type::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        if (ok && all_matched())
+        {
+            TimeFilterSample sample;
+            sample.data.assign(sample_size, 0xAA);
+            uint32_t num_samples = rate * seconds;
+            std::chrono::nanoseconds period(1000000000ull / rate);
+
+            auto start = clock_type::now();
+            for (uint32_t n = 0; n < num_samples; ++n)
+            {
+                std::this_thread::sleep_until(start + period * n);
+                sample.index = n;
+                writer->write(&sample);
+            }
+
+            // Let the last samples arrive
+            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+            std::chrono::duration<double> elapsed = clock_type::now() - start;
+
+            uint64_t total_received = 0;
+            std::cout << std::fixed << std::setprecision(3);
+            std::cout << "Samples sent: " << num_samples << std::endl;
+            for (const auto& reader : readers)
+            {
+                uint32_t received = reader->received();
+                total_received += received;
+                std::cout << "Reader " << reader->separation_ms() << " ms samples received: " << received <<
+                    std::endl;
+                std::cout << "Reader " << reader->separation_ms() << " ms bandwidth (KB/s): " <<
+                    double(received) * sample_size / elapsed.count() / 1e3 << std::endl;
+            }
+
+            uint64_t unfiltered = uint64_t(num_samples) * readers.size();
+            std::cout << "Samples delivered: " << total_received << std::endl;
+            std::cout << "Samples delivered without writer filtering: " << unfiltered << std::endl;
+            std::cout << "Traffic saved (%): " << 100.0 * double(unfiltered - total_received) / unfiltered <<
+                std::endl;
+            ret = 0;
+        }
+        else
+        {
+            std::cout << "Error matching readers" << std::endl;
+        }
+    }
+    else
+    {
+        std::cout << "Error creating writer" << std::endl;
+    }
+
+    participant->delete_contained_entities();
+    factory->delete_participant(participant);
+    return ret;
+}
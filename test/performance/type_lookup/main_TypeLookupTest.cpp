@@ -0,0 +1,333 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_TypeLookupTest.cpp
+ *
+ * Measures the resolution of remote types through the TypeLookup service when many writers of the same type are
+ * discovered at once.
+ *  - The publisher role creates a dynamic type made of nested structures, and many writers of it, each one on its
+ *    own topic.
+ *  - The subscriber role calls register_remote_type for every writer discovered, and reports the number of
+ *    TypeLookup requests sent and the time from the first type information received until the type is resolved
+ *    for the first and for the last writer.
+ * The publisher and the subscriber should run on different processes, so the types are not already known by the
+ * subscriber (see type_lookup_tests.py).
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/domain/DomainParticipantListener.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicType.h>
+#include <fastrtps/types/DynamicTypeBuilder.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeBuilderPtr.h>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::types;
+
+using clock_type = std::chrono::steady_clock;
+
+static void usage(
+        const char* name)
+{
+    std::cout << "Usage: " << name << " --role <publisher|subscriber> [--writers <n>] [--depth <n>]" <<
+        " [--domain <id>] [--hold <ms>] [--timeout <ms>]" << std::endl;
+    std::cout << "  --role     publisher: create the writers and keep them for --hold ms." << std::endl;
+    std::cout << "             subscriber: resolve the type of every writer discovered." << std::endl;
+    std::cout << "  --writers  Number of writers of the publisher role (default 200)." << std::endl;
+    std::cout << "  --depth    Number of nested structures of the type of the publisher role (default 4)." <<
+        std::endl;
+    std::cout << "  --domain   Domain of the participants (default 0)." << std::endl;
+    std::cout << "  --hold     Milliseconds the publisher role keeps its writers (default 60000)." << std::endl;
+    std::cout << "  --timeout  Milliseconds the subscriber role waits for the writers (default 10000)." <<
+        std::endl;
+}
+
+//! Creates a structure holding a sequence of the structure of the level below, down to depth levels
+static DynamicType_ptr create_nested_type(
+        uint32_t depth)
+{
+    DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+    DynamicType_ptr type;
+    for (uint32_t level = 0; level < depth; ++level)
+    {
+        DynamicTypeBuilder_ptr builder = factory->create_struct_builder();
+        builder->set_name("TypeLookupTestLevel" + std::to_string(depth - level - 1));
+        builder->add_member(0, "value", factory->create_int32_type());
+        builder->add_member(1, "name", factory->create_string_type(64));
+        if (nullptr != type)
+        {
+            DynamicTypeBuilder_ptr sequence = factory->create_sequence_builder(type, 4);
+            builder->add_member(2, "children", sequence->build());
+        }
+        type = builder->build();
+    }
+    return type;
+}
+
+static int run_publisher(
+        uint32_t domain_id,
+        uint32_t num_writers,
+        uint32_t depth,
+        uint32_t hold_ms)
+{
+    DomainParticipantQos qos;
+    qos.wire_protocol().builtin.typelookup_config.use_server = true;
+    DomainParticipant* participant = DomainParticipantFactory::get_instance()->create_participant(domain_id, qos);
+    if (nullptr == participant)
+    {
+        std::cout << "Error creating participant" << std::endl;
+        return 1;
+    }
+
+    TypeSupport type(new DynamicPubSubType(create_nested_type(depth)));
+    type->auto_fill_type_information(true);
+    type->auto_fill_type_object(true);
+    bool ok = ReturnCode_t::RETCODE_OK == type.register_type(participant);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ok = ok && nullptr != publisher;
+    for (uint32_t n = 0; ok && n < num_writers; ++n)
+    {
+        Topic* topic = participant->create_topic("TypeLookupTestTopic_" + std::to_string(n), type.get_type_name(),
+                        TOPIC_QOS_DEFAULT);
+        ok = nullptr != topic && nullptr != publisher->create_datawriter(topic, DATAWRITER_QOS_DEFAULT);
+    }
+
+    if (ok)
+    {
+        std::cout << "Publisher ready: " << num_writers << " writers of " << type.get_type_name() << std::endl;
+        std::this_thread::sleep_for(std::chrono::milliseconds(hold_ms));
+    }
+    else
+    {
+        std::cout << "Error creating the writers" << std::endl;
+    }
+
+    participant->delete_contained_entities();
+    DomainParticipantFactory::get_instance()->delete_participant(participant);
+    return ok ? 0 : 1;
+}
+
+//! Participant listener registering the type of every writer discovered
+class TypeResolutionListener : public DomainParticipantListener
+{
+public:
+
+    TypeResolutionListener()
+    {
+        callback_ = [this](const std::string&, const DynamicType_ptr)
+                {
+                    std::lock_guard<std::mutex> guard(mutex_);
+                    if (0 == resolved_++)
+                    {
+                        first_resolved_ = clock_type::now();
+                    }
+                    last_resolved_ = clock_type::now();
+                    cv_.notify_all();
+                };
+    }
+
+    void on_type_information_received(
+            DomainParticipant* participant,
+            const string_255 topic_name,
+            const string_255 type_name,
+            const TypeInformation& type_information) override
+    {
+        static_cast<void>(topic_name);
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            if (0 == informations_++)
+            {
+                first_information_ = clock_type::now();
+            }
+        }
+        participant->register_remote_type(type_information, type_name.to_string(), callback_);
+    }
+
+    void on_type_discovery(
+            DomainParticipant*,
+            const rtps::SampleIdentity& request_sample_id,
+            const string_255&,
+            const TypeIdentifier*,
+            const TypeObject*,
+            DynamicType_ptr) override
+    {
+        on_reply(request_sample_id);
+    }
+
+    void on_type_dependencies_reply(
+            DomainParticipant*,
+            const rtps::SampleIdentity& request_sample_id,
+            const TypeIdentifierWithSizeSeq&) override
+    {
+        on_reply(request_sample_id);
+    }
+
+    bool wait_resolved(
+            uint32_t expected,
+            std::chrono::milliseconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [this, expected]()
+                       {
+                           return resolved_ >= expected;
+                       });
+    }
+
+    void print_results()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "Type informations received: " << informations_ << std::endl;
+        std::cout << "Types resolved: " << resolved_ << std::endl;
+        std::cout << "Requests sent: " << requests_ << std::endl;
+        if (0 < resolved_)
+        {
+            std::chrono::duration<double, std::milli> first = first_resolved_ - first_information_;
+            std::chrono::duration<double, std::milli> last = last_resolved_ - first_information_;
+            std::cout << "Time to first resolution (ms): " << first.count() << std::endl;
+            std::cout << "Time to last resolution (ms): " << last.count() << std::endl;
+        }
+    }
+
+private:
+
+    //! Requests are numbered consecutively by the TypeLookup request writer, so the highest sequence number
+    //! replied is the number of requests sent
+    void on_reply(
+            const rtps::SampleIdentity& request_sample_id)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        requests_ = (std::max)(requests_, request_sample_id.sequence_number().to64long());
+    }
+
+    std::function<void(const std::string&, const DynamicType_ptr)> callback_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    uint32_t informations_ = 0;
+    uint32_t resolved_ = 0;
+    uint64_t requests_ = 0;
+    clock_type::time_point first_information_;
+    clock_type::time_point first_resolved_;
+    clock_type::time_point last_resolved_;
+};
+
+static int run_subscriber(
+        uint32_t domain_id,
+        uint32_t num_writers,
+        uint32_t timeout_ms)
+{
+    TypeResolutionListener listener;
+    DomainParticipantQos qos;
+    qos.wire_protocol().builtin.typelookup_config.use_client = true;
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(domain_id, qos, &listener);
+    if (nullptr == participant)
+    {
+        std::cout << "Error creating participant" << std::endl;
+        return 1;
+    }
+
+    bool ok = listener.wait_resolved(num_writers, std::chrono::milliseconds(timeout_ms));
+    if (!ok)
+    {
+        std::cout << "Not every type was resolved" << std::endl;
+    }
+    listener.print_results();
+
+    DomainParticipantFactory::get_instance()->delete_participant(participant);
+    return ok ? 0 : 1;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    std::string role;
+    uint32_t domain_id = 0;
+    uint32_t num_writers = 200;
+    uint32_t depth = 4;
+    uint32_t hold_ms = 60000;
+    uint32_t timeout_ms = 10000;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (i + 1 < argc && 0 == strcmp(argv[i], "--role"))
+        {
+            role = argv[++i];
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--writers"))
+        {
+            num_writers = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--depth"))
+        {
+            depth = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--domain"))
+        {
+            domain_id = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--hold"))
+        {
+            hold_ms = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--timeout"))
+        {
+            timeout_ms = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (0 == num_writers || 0 == depth)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+    else if ("publisher" == role)
+    {
+        return run_publisher(domain_id, num_writers, depth, hold_ms);
+    }
+    else if ("subscriber" == role)
+    {
+        return run_subscriber(domain_id, num_writers, timeout_ms);
+    }
+
+    usage(argv[0]);
+    return 1;
+}
@@ -0,0 +1,93 @@
+# Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Launch a TypeLookupTest publisher, and measure the resolution of its type on a subscriber."""
+
+import argparse
+import os
+import subprocess
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter
+    )
+    parser.add_argument(
+        '-w',
+        '--writers',
+        help='The number of writers of the publisher',
+        required=False,
+        default='200'
+    )
+    parser.add_argument(
+        '-l',
+        '--depth',
+        help='The number of nested structures of the type of the writers',
+        required=False,
+        default='4'
+    )
+    parser.add_argument(
+        '-d',
+        '--domain',
+        help='The domain of the participants',
+        required=False,
+        default='0'
+    )
+    parser.add_argument(
+        '-t',
+        '--timeout',
+        help='Milliseconds the subscriber waits for the resolution of every writer',
+        required=False,
+        default='10000'
+    )
+
+    args = parser.parse_args()
+
+    type_lookup_test = os.environ.get(
+        'TYPE_LOOKUP_TEST_BIN', 'TypeLookupTest')
+
+    publisher = subprocess.Popen(
+        [
+            type_lookup_test,
+            '--role', 'publisher',
+            '--writers', args.writers,
+            '--depth', args.depth,
+            '--domain', args.domain,
+            '--hold', '3600000',
+        ],
+        stdout=subprocess.PIPE,
+        universal_newlines=True)
+
+    # Wait until all the writers of the publisher have been created
+    line = publisher.stdout.readline()
+    print(line.strip())
+    ret = 0 if line.startswith('Publisher ready') else 1
+
+    if ret == 0:
+        subscriber = subprocess.run(
+            [
+                type_lookup_test,
+                '--role', 'subscriber',
+                '--writers', args.writers,
+                '--domain', args.domain,
+                '--timeout', args.timeout,
+            ],
+            stdout=subprocess.PIPE,
+            universal_newlines=True)
+        ret = subscriber.returncode
+        print(subscriber.stdout.strip())
+
+    publisher.terminate()
+    publisher.wait()
+
+    exit(ret)
@@ -25,7 +25,11 @@
 #include <sstream>
 #include "osrf_testing_tools_cpp/memory_tools/memory_tools.hpp"
 
+#include <fastdds/rtps/common/RealtimeMonitor.hpp>
+
 using MemoryToolsService = osrf_testing_tools_cpp::memory_tools::MemoryToolsService;
+using RealtimeMonitor = eprosima::fastrtps::rtps::RealtimeMonitor;
+using RealtimeViolation = eprosima::fastrtps::rtps::RealtimeViolation;
 
 namespace eprosima_profiling
 {
@@ -53,12 +57,25 @@ static bool g_print_results = true;
 static std::atomic_size_t g_allocations[4];
 static std::atomic_size_t g_deallocations[4];
 
+static std::atomic_size_t g_realtime_violations(0u);
+
 static std::atomic_size_t g_phase(0u);
 static std::atomic<std::atomic_size_t*> g_allocationsPtr(g_allocations);
 static std::atomic<std::atomic_size_t*> g_deallocationsPtr(g_deallocations);
 
 const std::regex is_fastrtps("fastrtps");
 
+static void realtime_violation(
+        const RealtimeViolation& violation)
+{
+    g_realtime_violations++;
+    if (g_print_alloc_traces)
+    {
+        std::cerr << "Real-time violation on " << violation.path << std::endl;
+        RealtimeMonitor::print_stack_trace(violation, 2);
+    }
+}
+
 static void allocation_account(MemoryToolsService & service)
 {
     // It makes no sense to track allocations if they don't come from our library
@@ -68,6 +85,8 @@ static void allocation_account(MemoryToolsService & service)
         (*g_allocationsPtr.load())++;
         if (g_print_alloc_traces) service.print_backtrace();
     }
+    // Only reported when happening on a real-time path of a participant with property fastdds.realtime_mode
+    RealtimeMonitor::report_allocation(0u);
     service.ignore();
 }
 
@@ -103,6 +122,9 @@ void entities_created(
     g_print_alloc_traces = print_alloc_traces;
     g_print_dealloc_traces = print_dealloc_traces;
 
+    // Before monitoring starts, as installing the hook may allocate
+    RealtimeMonitor::set_violation_hook(realtime_violation);
+
     // Initialize profiling library
     osrf_testing_tools_cpp::memory_tools::initialize();
 
@@ -206,6 +228,8 @@ void print_results(
 
     outFile << output_stream.str();
     outFile.close();
+
+    std::cout << "Real-time violations: " << g_realtime_violations.load() << std::endl;
 }
 
 }   // namespace eprosima_profiling
@@ -121,6 +121,28 @@ public:
 
 };
 
+class KeyedTopicDataTypeMock : public TopicDataTypeMock
+{
+public:
+
+    KeyedTopicDataTypeMock()
+        : TopicDataTypeMock()
+    {
+        m_isGetKeyDefined = true;
+        setName("keyedfootype");
+    }
+
+    bool getKey(
+            void* /*data*/,
+            fastrtps::rtps::InstanceHandle_t* ihandle,
+            bool /*force_md5*/) override
+    {
+        ihandle->value[0] = 1;
+        return true;
+    }
+
+};
+
 class BoundedTopicDataTypeMock : public TopicDataType
 {
 public:
@@ -483,6 +505,41 @@ TEST(DataWriterTests, Write)
     ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
 }
 
+TEST(DataWriterTests, WriteWithInstanceHandle)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    TypeSupport type(new KeyedTopicDataTypeMock());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("keyedfootopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    DataWriter* datawriter = publisher->create_datawriter(topic, DATAWRITER_QOS_DEFAULT);
+    ASSERT_NE(datawriter, nullptr);
+
+    FooType data;
+    data.message("HelloWorld");
+    fastrtps::rtps::InstanceHandle_t handle;
+    handle.value[0] = 1;
+    fastrtps::rtps::InstanceHandle_t wrong_handle;
+    wrong_handle.value[0] = 2;
+
+    // The key of the sample is checked against the handle on every build type
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, datawriter->write(&data, handle));
+    EXPECT_EQ(ReturnCode_t::RETCODE_PRECONDITION_NOT_MET, datawriter->write(&data, wrong_handle));
+
+    ASSERT_TRUE(publisher->delete_datawriter(datawriter) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(participant->delete_topic(topic) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(participant->delete_publisher(publisher) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
+}
+
 void set_listener_test (
         DataWriter* writer,
         DataWriterListener* listener,
@@ -0,0 +1,247 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastdds/recording/Recorder.hpp>
+#include <fastdds/recording/RecordingFile.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::dds::recording;
+
+class RecordingTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        base_name_ = std::string("RecordingTests_") + ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        remove_recording();
+    }
+
+    void TearDown() override
+    {
+        remove_recording();
+    }
+
+    void remove_recording()
+    {
+        for (uint32_t n = 0; std::ifstream(segment_file_name(base_name_, n)).good(); ++n)
+        {
+            std::remove(segment_file_name(base_name_, n).c_str());
+        }
+    }
+
+    //! Fills a change whose payload and metadata depend on the sequence number.
+    static void fill_change(
+            CacheChange_t& change,
+            uint32_t sequence,
+            uint32_t length)
+    {
+        change.kind = ALIVE;
+        change.writerGUID.guidPrefix.value[0] = 0x01;
+        change.writerGUID.entityId.value[3] = 0x03;
+        change.sequenceNumber = SequenceNumber_t(0, sequence);
+        change.sourceTimestamp.from_ns(1000000000 + int64_t(sequence) * 1000);
+        change.reader_info.receptionTimestamp.from_ns(2000000000 + int64_t(sequence) * 1000);
+        change.instanceHandle.value[0] = static_cast<octet>(sequence);
+        change.serializedPayload.length = length;
+        for (uint32_t i = 0; i < length; ++i)
+        {
+            change.serializedPayload.data[i] = static_cast<octet>(sequence + i);
+        }
+    }
+
+    static void check_sample(
+            const RecordedSample& sample,
+            uint16_t topic_id,
+            uint32_t sequence,
+            uint32_t length)
+    {
+        EXPECT_EQ(topic_id, sample.topic_id);
+        EXPECT_EQ(ALIVE, sample.kind);
+        EXPECT_EQ(0x01, sample.writer_guid.guidPrefix.value[0]);
+        EXPECT_EQ(0x03, sample.writer_guid.entityId.value[3]);
+        EXPECT_EQ(SequenceNumber_t(0, sequence), sample.sequence_number);
+        EXPECT_EQ(1000000000 + int64_t(sequence) * 1000, sample.source_timestamp.to_ns());
+        EXPECT_EQ(2000000000 + int64_t(sequence) * 1000, sample.reception_timestamp.to_ns());
+        EXPECT_EQ(2000000000 + int64_t(sequence) * 1000, sample.timestamp);
+        EXPECT_EQ(static_cast<octet>(sequence), sample.instance_handle.value[0]);
+        ASSERT_EQ(length, sample.payload_length);
+        for (uint32_t i = 0; i < length; ++i)
+        {
+            ASSERT_EQ(static_cast<octet>(sequence + i), sample.payload[i]);
+        }
+    }
+
+    std::string base_name_;
+};
+
+/*!
+ * This test checks that the samples captured by a Recorder are read back in order with their metadata.
+ */
+TEST_F(RecordingTests, record_and_read)
+{
+    const uint32_t num_samples = 100;
+    uint16_t first_topic = 0;
+    uint16_t second_topic = 0;
+
+    {
+        Recorder recorder(base_name_, {}, DEFAULT_SEGMENT_SIZE, Recorder::DEFAULT_BUFFER_SIZE);
+        ASSERT_TRUE(recorder.start());
+        first_topic = recorder.register_topic("first", "FirstType");
+        second_topic = recorder.register_topic("second", "SecondType");
+        EXPECT_NE(first_topic, second_topic);
+        EXPECT_EQ(first_topic, recorder.register_topic("first", "FirstType"));
+
+        CacheChange_t change(1024);
+        for (uint32_t n = 1; n <= num_samples; ++n)
+        {
+            fill_change(change, n, n * 10);
+            EXPECT_TRUE(recorder.record(n % 2 ? first_topic : second_topic, change));
+        }
+    }
+
+    RecordingFileReader reader(base_name_);
+    ASSERT_TRUE(reader.open());
+    ASSERT_EQ(2u, reader.topics().size());
+    EXPECT_EQ("first", reader.topics().at(first_topic).name);
+    EXPECT_EQ("FirstType", reader.topics().at(first_topic).type_name);
+    EXPECT_EQ("second", reader.topics().at(second_topic).name);
+    EXPECT_EQ("SecondType", reader.topics().at(second_topic).type_name);
+    EXPECT_EQ(2000001000, reader.first_timestamp());
+    EXPECT_EQ(2000000000 + int64_t(num_samples) * 1000, reader.last_timestamp());
+
+    RecordedSample sample;
+    for (uint32_t n = 1; n <= num_samples; ++n)
+    {
+        ASSERT_TRUE(reader.next(sample));
+        check_sample(sample, n % 2 ? first_topic : second_topic, n, n * 10);
+    }
+    EXPECT_FALSE(reader.next(sample));
+}
+
+/*!
+ * This test checks that a recording is split in segments, each one repeating the topics, and that the time index
+ * positions the reader on any of them.
+ */
+TEST_F(RecordingTests, segments_and_seek)
+{
+    const uint32_t num_samples = 500;
+    const uint32_t length = 1000;
+
+    {
+        RecordingFileWriter writer(base_name_, 64 * 1024);
+        ASSERT_TRUE(writer.open());
+
+        std::vector<octet> record(topic_record_size("topic", "Type"));
+        fill_topic_record(record.data(), 7, "topic", "Type");
+        ASSERT_TRUE(writer.append(record.data()));
+
+        CacheChange_t change(length);
+        record.resize(sample_record_size(length));
+        for (uint32_t n = 1; n <= num_samples; ++n)
+        {
+            fill_change(change, n, length);
+            fill_sample_record(record.data(), 7, change.reader_info.receptionTimestamp.to_ns(), change);
+            ASSERT_TRUE(writer.append(record.data()));
+        }
+
+        // A record bigger than a segment is rejected
+        CacheChange_t big_change(128 * 1024);
+        fill_change(big_change, num_samples + 1, 128 * 1024);
+        record.resize(sample_record_size(128 * 1024));
+        fill_sample_record(record.data(), 7, 0, big_change);
+        EXPECT_FALSE(writer.append(record.data()));
+    }
+
+    EXPECT_TRUE(std::ifstream(segment_file_name(base_name_, 7)).good());
+
+    RecordingFileReader reader(base_name_);
+    ASSERT_TRUE(reader.open());
+    ASSERT_EQ(1u, reader.topics().size());
+    EXPECT_EQ("topic", reader.topics().at(7).name);
+
+    RecordedSample sample;
+    for (uint32_t n = 1; n <= num_samples; ++n)
+    {
+        ASSERT_TRUE(reader.next(sample));
+        check_sample(sample, 7, n, length);
+    }
+    EXPECT_FALSE(reader.next(sample));
+
+    for (uint32_t n : {1u, 2u, 63u, 64u, 65u, 250u, 499u, 500u})
+    {
+        reader.seek(2000000000 + int64_t(n) * 1000);
+        ASSERT_TRUE(reader.next(sample));
+        check_sample(sample, 7, n, length);
+    }
+
+    // Timestamps between samples position the reader on the following one
+    reader.seek(2000000000 + 100 * 1000 - 1);
+    ASSERT_TRUE(reader.next(sample));
+    check_sample(sample, 7, 100, length);
+
+    reader.seek(2000000000 + int64_t(num_samples + 1) * 1000);
+    EXPECT_FALSE(reader.next(sample));
+}
+
+/*!
+ * This test checks the recorder is only created when the file property is present, and the topic filter.
+ */
+TEST_F(RecordingTests, create_from_properties)
+{
+    PropertyPolicy properties;
+    EXPECT_EQ(nullptr, Recorder::create(properties));
+
+    properties.properties().emplace_back("fastdds.recorder.file", base_name_);
+    properties.properties().emplace_back("fastdds.recorder.topics", "first;third");
+    std::unique_ptr<Recorder> recorder = Recorder::create(properties);
+    ASSERT_NE(nullptr, recorder);
+    EXPECT_TRUE(recorder->records("first"));
+    EXPECT_FALSE(recorder->records("second"));
+    EXPECT_TRUE(recorder->records("third"));
+    EXPECT_TRUE(std::ifstream(segment_file_name(base_name_, 0)).good());
+}
+
+/*!
+ * This test checks that samples which do not fit on the capture buffer are dropped instead of blocking.
+ */
+TEST_F(RecordingTests, drop_when_buffer_full)
+{
+    Recorder recorder(base_name_, {}, DEFAULT_SEGMENT_SIZE, 1024);
+    ASSERT_TRUE(recorder.start());
+    uint16_t topic = recorder.register_topic("topic", "Type");
+
+    CacheChange_t change(2048);
+    fill_change(change, 1, 2048);
+    EXPECT_FALSE(recorder.record(topic, change));
+    EXPECT_EQ(1u, recorder.dropped_samples());
+
+    fill_change(change, 2, 100);
+    EXPECT_TRUE(recorder.record(topic, change));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -37,6 +37,14 @@
 #include <fastdds/rtps/writer/RTPSWriter.h>
 #include <fastdds/rtps/participant/RTPSParticipant.h>
 
+#include <fastrtps/types/TypeObject.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+
 
 using ::testing::StrictMock;
 using ::testing::NiceMock;
@@ -1557,6 +1565,65 @@ TEST_F(UserListeners, data_available)
     verify_expectations_on_data_available(participant_listener_, subscriber_listener_, datareader_listener_);
 }
 
+/*
+ * Several calls to register_remote_type for a type unknown locally share a single request of the type.
+ * A resolution whose reply never arrives expires, so later calls request the type again.
+ */
+TEST(RemoteTypeResolution, requests_shared_until_expired)
+{
+    using ::testing::_;
+    using ::testing::Return;
+
+    NiceMock<RTPSParticipantMock> participant_mock;
+    NiceMock<builtin::TypeLookupManager> typelookup_mock(nullptr);
+    RTPSDomain::participant_ = &participant_mock;
+    ON_CALL(participant_mock, typelookup_manager()).WillByDefault(Return(&typelookup_mock));
+
+    DomainParticipantQos qos;
+    qos.properties().properties().emplace_back("fastdds.type_lookup.resolution_timeout", "100");
+    DomainParticipant* participant = DomainParticipantFactory::get_instance()->create_participant(0, qos);
+    ASSERT_NE(participant, nullptr);
+
+    // A complete type with no dependencies, whose TypeObject is not known locally
+    fastrtps::types::TypeIdentifier type_id;
+    type_id._d(fastrtps::types::EK_COMPLETE);
+    std::fill_n(type_id.equivalence_hash(), 14, static_cast<fastrtps::rtps::octet>(0x5A));
+    fastrtps::types::TypeInformation type_information;
+    type_information.complete().typeid_with_size().type_id(type_id);
+
+    auto request = [](int32_t sequence)
+            {
+                fastrtps::rtps::SampleIdentity identity;
+                identity.writer_guid(fastrtps::rtps::GUID_t(fastrtps::rtps::GuidPrefix_t(),
+                        fastrtps::rtps::c_EntityId_TypeLookup_request_writer));
+                identity.sequence_number(fastrtps::rtps::SequenceNumber_t(0, sequence));
+                return identity;
+            };
+
+    std::function<void(const std::string&, const fastrtps::types::DynamicType_ptr)> callback =
+            [](const std::string&, const fastrtps::types::DynamicType_ptr)
+            {
+            };
+
+    EXPECT_CALL(typelookup_mock, get_type_dependencies(_)).Times(0);
+    EXPECT_CALL(typelookup_mock, get_types(_)).WillOnce(Return(request(1)));
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_EQ(ReturnCode_t::RETCODE_OK,
+                participant->register_remote_type(type_information, "remote_type_" + std::to_string(i), callback));
+    }
+    Mock::VerifyAndClearExpectations(&typelookup_mock);
+
+    // No reply arrives, so the next call after the timeout issues the request again
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    EXPECT_CALL(typelookup_mock, get_types(_)).WillOnce(Return(request(2)));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, participant->register_remote_type(type_information, "remote_type", callback));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, participant->register_remote_type(type_information, "remote_type", callback));
+    Mock::VerifyAndClearExpectations(&typelookup_mock);
+
+    ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), ReturnCode_t::RETCODE_OK);
+}
+
 } // namespace dds
 } // namespace fastdds
 } // namespace eprosima
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <cassert>
+#include <cstring>
 #include <thread>
 
 #include <gmock/gmock.h>
@@ -47,6 +48,7 @@
 #include <fastdds/dds/subscriber/qos/SubscriberQos.hpp>
 
 #include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/common/SerializedPayload.h>
 #include <fastrtps/utils/IPLocator.h>
 
 #include "FooBoundedType.hpp"
@@ -1467,6 +1469,61 @@ TEST_F(DataReaderTests, read_unread)
     }
 }
 
+/*
+ * This test checks that samples written with write_serialized are taken with take_serialized without changes,
+ * that their instance is computed from the payload when no handle is given, and that a given handle has to
+ * correspond to the payload.
+ */
+TEST_F(DataReaderTests, write_and_take_serialized)
+{
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+
+    create_instance_handles();
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+
+    FooType data;
+    data.index(1);
+    data.message()[0] = 'A';
+    data.message()[1] = '\0';
+
+    fastrtps::rtps::SerializedPayload_t payload(type_->getSerializedSizeProvider(&data)());
+    ASSERT_TRUE(type_.serialize(&data, &payload));
+
+    // Write it without handle and with the precomputed one
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, data_writer_->write_serialized(payload));
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, data_writer_->write_serialized(payload, handle_ok_));
+    EXPECT_EQ(ReturnCode_t::RETCODE_PRECONDITION_NOT_MET, data_writer_->write_serialized(payload, handle_wrong_));
+
+    fastrtps::rtps::SerializedPayload_t empty_payload;
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, data_writer_->write_serialized(empty_payload));
+
+    for (int i = 0; i < 2; ++i)
+    {
+        // A too small payload has to grow
+        fastrtps::rtps::SerializedPayload_t taken(1);
+        SampleInfo info;
+        ASSERT_EQ(ReturnCode_t::RETCODE_OK, data_reader_->take_serialized(&taken, &info));
+        EXPECT_TRUE(info.valid_data);
+        EXPECT_EQ(handle_ok_, info.instance_handle);
+        ASSERT_EQ(payload.length, taken.length);
+        EXPECT_EQ(0, memcmp(payload.data, taken.data, payload.length));
+
+        FooType taken_data;
+        ASSERT_TRUE(type_.deserialize(&taken, &taken_data));
+        EXPECT_EQ(data, taken_data);
+    }
+
+    fastrtps::rtps::SerializedPayload_t taken;
+    SampleInfo info;
+    EXPECT_EQ(ReturnCode_t::RETCODE_NO_DATA, data_reader_->take_serialized(&taken, &info));
+}
+
 /*
  * This type fails deserialization on odd samples
  */
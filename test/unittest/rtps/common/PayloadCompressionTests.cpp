@@ -0,0 +1,234 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/common/PayloadCompression.hpp>
+
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::rtps;
+
+class PayloadCompressionTests : public ::testing::TestWithParam<PayloadCompressionKind>
+{
+protected:
+
+    //! Fills the payload with a CDR_LE encapsulation followed by repetitive data.
+    static void fill_compressible(
+            SerializedPayload_t& payload)
+    {
+        payload.data[0] = 0;
+        payload.data[1] = 1;
+        payload.data[2] = 0;
+        payload.data[3] = 0;
+        for (uint32_t i = 4; i < payload.max_size; ++i)
+        {
+            payload.data[i] = static_cast<octet>((i / 64) % 8);
+        }
+        payload.length = payload.max_size;
+    }
+
+};
+
+/*!
+ * @fn TEST(PayloadCompression, from_string)
+ * @brief This test checks the names accepted for the compression algorithms.
+ */
+TEST(PayloadCompression, from_string)
+{
+    PayloadCompressionKind kind = PayloadCompressionKind::NONE;
+
+    ASSERT_TRUE(PayloadCompression::from_string("lz4", kind));
+    ASSERT_EQ(PayloadCompressionKind::LZ4, kind);
+    ASSERT_TRUE(PayloadCompression::from_string("zstd", kind));
+    ASSERT_EQ(PayloadCompressionKind::ZSTD, kind);
+    ASSERT_TRUE(PayloadCompression::from_string("none", kind));
+    ASSERT_EQ(PayloadCompressionKind::NONE, kind);
+    ASSERT_FALSE(PayloadCompression::from_string("gzip", kind));
+}
+
+/*!
+ * @fn TEST(PayloadCompression, from_properties)
+ * @brief This test checks the compression settings are read from the properties of a writer.
+ */
+TEST(PayloadCompression, from_properties)
+{
+    PayloadCompressionKind kind = PayloadCompressionKind::LZ4;
+    int32_t level = 0;
+    uint32_t threshold = 1024;
+
+    // No compression configured
+    PropertyPolicy properties;
+    ASSERT_TRUE(PayloadCompression::from_properties(properties, kind, level, threshold));
+    ASSERT_EQ(PayloadCompressionKind::NONE, kind);
+
+    properties.properties().emplace_back("fastdds.compression", "gzip");
+    ASSERT_FALSE(PayloadCompression::from_properties(properties, kind, level, threshold));
+    ASSERT_EQ(PayloadCompressionKind::NONE, kind);
+
+    if (PayloadCompression::is_supported(PayloadCompressionKind::ZSTD))
+    {
+        properties.properties().clear();
+        properties.properties().emplace_back("fastdds.compression", "zstd");
+        properties.properties().emplace_back("fastdds.compression.level", "5");
+        properties.properties().emplace_back("fastdds.compression.threshold", "4096");
+        ASSERT_TRUE(PayloadCompression::from_properties(properties, kind, level, threshold));
+        ASSERT_EQ(PayloadCompressionKind::ZSTD, kind);
+        ASSERT_EQ(5, level);
+        ASSERT_EQ(4096u, threshold);
+    }
+}
+
+/*!
+ * @fn TEST(PayloadCompression, accepted_mask)
+ * @brief This test checks the algorithms announced by a reader are parsed, ignoring the unknown ones.
+ */
+TEST(PayloadCompression, accepted_mask)
+{
+    const uint8_t lz4 = 1u << static_cast<uint8_t>(PayloadCompressionKind::LZ4);
+    const uint8_t zstd = 1u << static_cast<uint8_t>(PayloadCompressionKind::ZSTD);
+
+    ASSERT_EQ(0u, PayloadCompression::accepted_mask(""));
+    ASSERT_EQ(0u, PayloadCompression::accepted_mask("none"));
+    ASSERT_EQ(lz4, PayloadCompression::accepted_mask("lz4"));
+    ASSERT_EQ(zstd, PayloadCompression::accepted_mask("gzip,zstd"));
+    ASSERT_EQ(lz4 | zstd, PayloadCompression::accepted_mask("zstd,lz4"));
+
+    // The value added to readers lists every algorithm of this build
+    ASSERT_EQ(PayloadCompression::accepted_mask(PayloadCompression::supported_algorithms()),
+            (PayloadCompression::is_supported(PayloadCompressionKind::LZ4) ? lz4 : 0u) |
+            (PayloadCompression::is_supported(PayloadCompressionKind::ZSTD) ? zstd : 0u));
+}
+
+/*!
+ * @fn TEST_P(PayloadCompressionTests, round_trip)
+ * @brief This test checks a compressed payload is recognized and restored to its original content.
+ */
+TEST_P(PayloadCompressionTests, round_trip)
+{
+    PayloadCompressionKind kind = GetParam();
+    if (!PayloadCompression::is_supported(kind))
+    {
+        return;
+    }
+
+    SerializedPayload_t original(16384);
+    fill_compressible(original);
+    SerializedPayload_t payload(16384);
+    payload.copy(&original);
+
+    std::vector<octet> buffer;
+    ASSERT_FALSE(PayloadCompression::is_compressed(payload));
+    ASSERT_TRUE(PayloadCompression::compress(kind, 0, payload, buffer));
+    ASSERT_TRUE(PayloadCompression::is_compressed(payload));
+    ASSERT_LT(payload.length, original.length);
+    ASSERT_EQ(original.length, PayloadCompression::decompressed_size(payload));
+
+    SerializedPayload_t restored(original.length);
+    ASSERT_TRUE(PayloadCompression::decompress(payload, restored));
+    ASSERT_EQ(original.length, restored.length);
+    ASSERT_EQ(0, memcmp(original.data, restored.data, original.length));
+
+    // Not enough room for the original content
+    SerializedPayload_t small(original.length - 1);
+    ASSERT_FALSE(PayloadCompression::decompress(payload, small));
+}
+
+/*!
+ * @fn TEST_P(PayloadCompressionTests, forged_size)
+ * @brief This test checks an original size the compressed data cannot produce is rejected.
+ */
+TEST_P(PayloadCompressionTests, forged_size)
+{
+    PayloadCompressionKind kind = GetParam();
+    if (!PayloadCompression::is_supported(kind))
+    {
+        return;
+    }
+
+    SerializedPayload_t payload(1024);
+    fill_compressible(payload);
+    std::vector<octet> buffer;
+    ASSERT_TRUE(PayloadCompression::compress(kind, 0, payload, buffer));
+
+    uint32_t max_size = PayloadCompression::max_decompressed_size(payload);
+    ASSERT_GE(max_size, PayloadCompression::decompressed_size(payload));
+    ASSERT_LT(max_size, std::numeric_limits<uint32_t>::max());
+
+    // Claim the largest original size, as a malformed sample would
+    payload.data[4] = 0xFF;
+    payload.data[5] = 0xFF;
+    payload.data[6] = 0xFF;
+    payload.data[7] = 0xFF;
+    ASSERT_GT(PayloadCompression::decompressed_size(payload), max_size);
+
+    SerializedPayload_t restored(1024);
+    ASSERT_FALSE(PayloadCompression::decompress(payload, restored));
+}
+
+/*!
+ * @fn TEST_P(PayloadCompressionTests, incompressible_payload)
+ * @brief This test checks a payload is left untouched when compressing it does not save space.
+ */
+TEST_P(PayloadCompressionTests, incompressible_payload)
+{
+    PayloadCompressionKind kind = GetParam();
+    if (!PayloadCompression::is_supported(kind))
+    {
+        return;
+    }
+
+    SerializedPayload_t payload(1024);
+    payload.data[0] = 0;
+    payload.data[1] = 1;
+    payload.data[2] = 0;
+    payload.data[3] = 0;
+    std::srand(0);
+    for (uint32_t i = 4; i < payload.max_size; ++i)
+    {
+        payload.data[i] = static_cast<octet>(std::rand());
+    }
+    payload.length = payload.max_size;
+
+    SerializedPayload_t original(1024);
+    original.copy(&payload);
+
+    std::vector<octet> buffer;
+    ASSERT_FALSE(PayloadCompression::compress(kind, 0, payload, buffer));
+    ASSERT_FALSE(PayloadCompression::is_compressed(payload));
+    ASSERT_EQ(original.length, payload.length);
+    ASSERT_EQ(0, memcmp(original.data, payload.data, original.length));
+}
+
+#ifdef INSTANTIATE_TEST_SUITE_P
+#define GTEST_INSTANTIATE_TEST_MACRO(x, y, z) INSTANTIATE_TEST_SUITE_P(x, y, z)
+#else
+#define GTEST_INSTANTIATE_TEST_MACRO(x, y, z) INSTANTIATE_TEST_CASE_P(x, y, z, )
+#endif // ifdef INSTANTIATE_TEST_SUITE_P
+
+GTEST_INSTANTIATE_TEST_MACRO(
+    PayloadCompression,
+    PayloadCompressionTests,
+    ::testing::Values(PayloadCompressionKind::LZ4, PayloadCompressionKind::ZSTD));
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,166 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastdds/rtps/common/RealtimeMonitor.hpp>
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps::rtps;
+
+static std::vector<RealtimeViolation> violations;
+static std::vector<std::string> violation_paths;
+
+static void record_violation(
+        const RealtimeViolation& violation)
+{
+    violations.push_back(violation);
+    violation_paths.push_back(violation.path);
+}
+
+static void reentrant_violation(
+        const RealtimeViolation& violation)
+{
+    record_violation(violation);
+    // Allocations of the hook itself are not reported again
+    RealtimeMonitor::report_allocation(1u);
+}
+
+class RealtimeMonitorTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        violations.clear();
+        violation_paths.clear();
+        RealtimeMonitor::set_violation_hook(record_violation, std::chrono::milliseconds(10));
+    }
+
+    void TearDown() override
+    {
+        RealtimeMonitor::set_violation_hook(nullptr);
+    }
+
+};
+
+TEST_F(RealtimeMonitorTests, allocations_only_reported_on_realtime_paths)
+{
+    RealtimeMonitor::report_allocation(16u);
+    {
+        RealtimeMonitor::Scope scope(false, "Disabled");
+        EXPECT_EQ(nullptr, RealtimeMonitor::current_path());
+        RealtimeMonitor::report_allocation(16u);
+    }
+    EXPECT_TRUE(violations.empty());
+
+    {
+        RealtimeMonitor::Scope scope(true, "Enabled");
+        RealtimeMonitor::report_allocation(32u);
+    }
+    RealtimeMonitor::report_allocation(16u);
+
+    ASSERT_EQ(1u, violations.size());
+    EXPECT_EQ(RealtimeViolation::ALLOCATION, violations[0].kind);
+    EXPECT_EQ(32u, violations[0].size);
+    EXPECT_EQ("Enabled", violation_paths[0]);
+    EXPECT_EQ(nullptr, RealtimeMonitor::current_path());
+}
+
+TEST_F(RealtimeMonitorTests, nested_scopes_keep_outermost_path)
+{
+    {
+        RealtimeMonitor::Scope outer(true, "Outer");
+        {
+            RealtimeMonitor::Scope inner(true, "Inner");
+            RealtimeMonitor::report_allocation(8u);
+        }
+        // The inner scope does not end the outer path
+        RealtimeMonitor::report_allocation(8u);
+    }
+
+    ASSERT_EQ(2u, violations.size());
+    EXPECT_EQ("Outer", violation_paths[0]);
+    EXPECT_EQ("Outer", violation_paths[1]);
+}
+
+TEST_F(RealtimeMonitorTests, hook_allocations_not_reported)
+{
+    RealtimeMonitor::set_violation_hook(reentrant_violation);
+    {
+        RealtimeMonitor::Scope scope(true, "Path");
+        RealtimeMonitor::report_allocation(8u);
+    }
+
+    EXPECT_EQ(1u, violations.size());
+}
+
+TEST_F(RealtimeMonitorTests, no_reports_without_hook)
+{
+    RealtimeMonitor::set_violation_hook(nullptr);
+    {
+        RealtimeMonitor::Scope scope(true, "Path");
+        RealtimeMonitor::report_allocation(8u);
+        RealtimeMonitor::report_lock_wait(std::chrono::seconds(1));
+    }
+
+    EXPECT_TRUE(violations.empty());
+}
+
+TEST_F(RealtimeMonitorTests, lock_waits_over_budget_reported)
+{
+    std::timed_mutex mutex;
+
+    {
+        RealtimeMonitor::Scope scope(true, "Path");
+        RealtimeMonitor::report_lock_wait(std::chrono::milliseconds(1));
+        std::unique_lock<std::timed_mutex> lock(mutex, std::defer_lock);
+        RealtimeMonitor::lock(lock);
+        EXPECT_TRUE(lock.owns_lock());
+    }
+    EXPECT_TRUE(violations.empty());
+
+    std::unique_lock<std::timed_mutex> holder(mutex);
+    std::thread releaser([&holder]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                holder.unlock();
+            });
+
+    {
+        RealtimeMonitor::Scope scope(true, "Path");
+        auto max_blocking_time = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        std::unique_lock<std::timed_mutex> lock(mutex, std::defer_lock);
+        EXPECT_TRUE(RealtimeMonitor::try_lock_until(lock, max_blocking_time));
+    }
+    releaser.join();
+
+    ASSERT_EQ(1u, violations.size());
+    EXPECT_EQ(RealtimeViolation::LOCK_WAIT, violations[0].kind);
+    EXPECT_GT(violations[0].wait_ns, std::chrono::nanoseconds(std::chrono::milliseconds(10)).count());
+    EXPECT_EQ("Path", violation_paths[0]);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -144,6 +144,51 @@ TEST(FlowControllerFactory, register_flow_controllers)
             FlowControllerPriorityWithReservationSchedule>* async_limited_reserv_flow = dynamic_cast<FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
                     FlowControllerPriorityWithReservationSchedule>*>(flow_controller);
     ASSERT_TRUE(nullptr != async_limited_reserv_flow);
+
+    flow_controller_descr.max_burst_bytes = 1;
+
+    // TokenBucketFlowController with Fifo scheduler
+    const char* token_bucket_fifo = "TokenBucketFlowControllerFifo";
+    flow_controller_descr.name = token_bucket_fifo;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::FIFO;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(token_bucket_fifo, writer_attributes);
+    FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+            FlowControllerFifoSchedule>* token_bucket_fifo_flow = dynamic_cast<FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                    FlowControllerFifoSchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != token_bucket_fifo_flow);
+    // A bucket smaller than a RTPS message is raised to fit one.
+    ASSERT_EQ(static_cast<uint32_t>(RTPSMESSAGE_COMMON_RTPS_PAYLOAD_SIZE), token_bucket_fifo_flow->get_max_payload());
+
+    const char* token_bucket_robin = "TokenBucketFlowControllerRobin";
+    flow_controller_descr.name = token_bucket_robin;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::ROUND_ROBIN;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(token_bucket_robin, writer_attributes);
+    FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+            FlowControllerRoundRobinSchedule>* token_bucket_robin_flow = dynamic_cast<FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                    FlowControllerRoundRobinSchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != token_bucket_robin_flow);
+
+    const char* token_bucket_high = "TokenBucketFlowControllerHigh";
+    flow_controller_descr.name = token_bucket_high;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::HIGH_PRIORITY;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(token_bucket_high, writer_attributes);
+    FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+            FlowControllerHighPrioritySchedule>* token_bucket_high_flow = dynamic_cast<FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                    FlowControllerHighPrioritySchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != token_bucket_high_flow);
+
+    const char* token_bucket_reserv = "TokenBucketFlowControllerReservation";
+    flow_controller_descr.name = token_bucket_reserv;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(token_bucket_reserv, writer_attributes);
+    FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+            FlowControllerPriorityWithReservationSchedule>* token_bucket_reserv_flow = dynamic_cast<FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                    FlowControllerPriorityWithReservationSchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != token_bucket_reserv_flow);
 }
 
 int main(
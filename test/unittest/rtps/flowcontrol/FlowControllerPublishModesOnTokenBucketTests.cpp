@@ -0,0 +1,128 @@
+#include "FlowControllerPublishModesTests.hpp"
+
+using namespace eprosima::fastdds::rtps;
+using namespace testing;
+
+struct FlowControllerTokenBucketPublishModeMock : FlowControllerTokenBucketPublishMode
+{
+    FlowControllerTokenBucketPublishModeMock(
+            eprosima::fastrtps::rtps::RTPSParticipantImpl* participant,
+            const FlowControllerDescriptor* descriptor)
+        : FlowControllerTokenBucketPublishMode(participant, descriptor)
+    {
+        group_mock = &group;
+    }
+
+    static eprosima::fastrtps::rtps::RTPSMessageGroup* get_group()
+    {
+        return group_mock;
+    }
+
+    static eprosima::fastrtps::rtps::RTPSMessageGroup* group_mock;
+};
+eprosima::fastrtps::rtps::RTPSMessageGroup* FlowControllerTokenBucketPublishModeMock::group_mock = nullptr;
+
+TYPED_TEST(FlowControllerPublishModes, token_bucket_publish_mode)
+{
+    // The bucket is refilled at 1 byte per microsecond and has room for a single sample.
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.max_bytes_per_period = 10000;
+    flow_controller_descr.period_ms = 10;
+    flow_controller_descr.max_burst_bytes = 10000;
+    FlowControllerImpl<FlowControllerTokenBucketPublishModeMock, TypeParam> async(nullptr,
+            &flow_controller_descr);
+    async.init();
+
+    ASSERT_EQ(10000u, async.get_max_payload());
+
+    // Instantiate writers.
+    eprosima::fastrtps::rtps::RTPSWriter writer1;
+
+    std::vector<std::chrono::steady_clock::time_point> delivery_times;
+
+    // Initialize callback to get info.
+    auto send_functor = [&](
+        eprosima::fastrtps::rtps::CacheChange_t* change,
+        eprosima::fastrtps::rtps::RTPSMessageGroup&,
+        eprosima::fastrtps::rtps::LocatorSelectorSender&,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                this->last_thread_delivering_sample = std::this_thread::get_id();
+                this->current_bytes_processed += change->serializedPayload.length;
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->changes_delivered.push_back(change);
+                    delivery_times.push_back(std::chrono::steady_clock::now());
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    // Register writers.
+    async.register_writer(&writer1);
+
+    EXPECT_CALL(*FlowControllerTokenBucketPublishModeMock::get_group(),
+            get_current_bytes_processed()).WillRepeatedly(ReturnPointee(&this->current_bytes_processed));
+    EXPECT_CALL(*FlowControllerTokenBucketPublishModeMock::get_group(),
+            reset_current_bytes_processed()).WillRepeatedly([&]()
+            {
+                this->current_bytes_processed = 0;
+            });
+
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1;
+    INIT_CACHE_CHANGE(change_writer1, writer1, 1);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer2;
+    INIT_CACHE_CHANGE(change_writer2, writer1, 2);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer3;
+    INIT_CACHE_CHANGE(change_writer3, writer1, 3);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer4;
+    INIT_CACHE_CHANGE(change_writer4, writer1, 4);
+
+    // Samples are spaced the time needed to refill the bucket with one sample (10ms).
+    EXPECT_CALL(writer1,
+            deliver_sample_nts(&change_writer1, _, Ref(writer1.async_locator_selector_), _)).
+            WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    EXPECT_CALL(writer1,
+            deliver_sample_nts(&change_writer2, _, Ref(writer1.async_locator_selector_), _)).
+            WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    EXPECT_CALL(writer1,
+            deliver_sample_nts(&change_writer3, _, Ref(writer1.async_locator_selector_), _)).
+            WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    EXPECT_CALL(writer1,
+            deliver_sample_nts(&change_writer4, _, Ref(writer1.async_locator_selector_), _)).
+            WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    writer1.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer3,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer4,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer1.getMutex().unlock();
+    this->wait_changes_was_delivered(4);
+    EXPECT_NE(std::this_thread::get_id(), this->last_thread_delivering_sample);
+    ASSERT_EQ(4u, delivery_times.size());
+    for (size_t i = 1; i < delivery_times.size(); ++i)
+    {
+        EXPECT_LE(std::chrono::milliseconds(9), delivery_times[i] - delivery_times[i - 1]);
+    }
+    this->changes_delivered.clear();
+    delivery_times.clear();
+
+    // Delivery exceeding the limitation is retried when the bucket is refilled.
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_CALL(writer1,
+            deliver_sample_nts(&change_writer1, _, Ref(writer1.async_locator_selector_), _)).
+            WillOnce(Return(eprosima::fastrtps::rtps::DeliveryRetCode::EXCEEDED_LIMIT)).
+            WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    writer1.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer1.getMutex().unlock();
+    this->wait_changes_was_delivered(1);
+    EXPECT_NE(std::this_thread::get_id(), this->last_thread_delivering_sample);
+    this->changes_delivered.clear();
+
+    async.unregister_writer(&writer1);
+}
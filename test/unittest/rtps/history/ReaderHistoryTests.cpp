@@ -218,6 +218,53 @@ TEST_F(ReaderHistoryTests, remove_changes_with_guid)
     ASSERT_EQ(history->getHistorySize(), num_changes - num_sequence_numbers);
 }
 
+// Scans over a history longer than the prefetch distance find every change, up to the last one.
+TEST_F(ReaderHistoryTests, find_changes_in_long_history)
+{
+    const uint32_t long_writers = 3;
+    const uint32_t long_sequence_numbers = 10;
+    uint32_t first_change = static_cast<uint32_t>(changes_list.size());
+
+    // Changes of the writers are interleaved
+    uint32_t t = 0;
+    for (uint32_t j = 1; j <= long_sequence_numbers; j++)
+    {
+        for (uint32_t i = 1; i <= long_writers; i++)
+        {
+            CacheChange_t* ch = new CacheChange_t(0);
+            ch->writerGUID = GUID_t(GuidPrefix_t::unknown(), 10U + i);
+            ch->sequenceNumber = SequenceNumber_t(0, j);
+            ch->sourceTimestamp = rtps::Time_t(1, t++);
+            changes_list.push_back(ch);
+            ASSERT_TRUE(history->add_change(ch));
+        }
+    }
+
+    ASSERT_EQ(history->getHistorySize(), long_writers * long_sequence_numbers);
+
+    for (uint32_t n = first_change; n < changes_list.size(); n++)
+    {
+        CacheChange_t* expected = changes_list[n];
+
+        auto it = history->find_change(expected);
+        ASSERT_NE(it, history->changesEnd());
+        ASSERT_EQ(*it, expected);
+
+        CacheChange_t* ch = nullptr;
+        ASSERT_TRUE(history->get_change(expected->sequenceNumber, expected->writerGUID, &ch));
+        ASSERT_EQ(ch, expected);
+    }
+
+    // Changes not in the history are not found
+    CacheChange_t missing(0);
+    missing.writerGUID = GUID_t(GuidPrefix_t::unknown(), 10U + long_writers);
+    missing.sequenceNumber = SequenceNumber_t(0, long_sequence_numbers + 1);
+    ASSERT_EQ(history->find_change(&missing), history->changesEnd());
+
+    CacheChange_t* ch = nullptr;
+    ASSERT_FALSE(history->get_change(missing.sequenceNumber, missing.writerGUID, &ch));
+}
+
 int main(
         int argc,
         char** argv)
@@ -15,11 +15,15 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <thread>
+
 #define TEST_FRIENDS \
     FRIEND_TEST(WriterProxyTests, MissingChangesUpdate); \
     FRIEND_TEST(WriterProxyTests, LostChangesUpdate); \
     FRIEND_TEST(WriterProxyTests, ReceivedChangeSet); \
-    FRIEND_TEST(WriterProxyTests, IrrelevantChangeSet);
+    FRIEND_TEST(WriterProxyTests, IrrelevantChangeSet); \
+    FRIEND_TEST(WriterProxyTests, RoundTripTimeEstimation);
 
 #include <rtps/reader/WriterProxy.h>
 #include <rtps/participant/RTPSParticipantImpl.h>
@@ -696,6 +700,52 @@ TEST(WriterProxyTests, IrrelevantChangeSet)
     ASSERT_EQ(wproxy.unknown_missing_changes_up_to(SequenceNumber_t(0, 9)), 0u);
 }
 
+TEST(WriterProxyTests, RoundTripTimeEstimation)
+{
+    WriterProxyData wattr(4u, 1u);
+    StatefulReader readerMock;
+    WriterProxy wproxy(&readerMock, RemoteLocatorsAllocationAttributes(), ResourceLimitedContainerConfig());
+    EXPECT_CALL(*wproxy.initial_acknack_, update_interval(readerMock.getTimes().initialAcknackDelay)).Times(1u);
+    EXPECT_CALL(*wproxy.heartbeat_response_, update_interval(readerMock.getTimes().heartbeatResponseDelay)).Times(1u);
+    EXPECT_CALL(*wproxy.initial_acknack_, restart_timer()).Times(1u);
+    wproxy.start(wattr, SequenceNumber_t());
+
+    // 1. Nothing has been requested yet
+    ASSERT_FALSE(wproxy.nack_answered());
+    ASSERT_FALSE(wproxy.round_trip_time().has_estimation());
+
+    // 2. Sequence number 1 is requested. Receiving another change does not end the measurement
+    wproxy.nack_sent(SequenceNumber_t(0, 1));
+    wproxy.received_change_set(SequenceNumber_t(0, 2));
+    ASSERT_FALSE(wproxy.nack_answered());
+    ASSERT_FALSE(wproxy.round_trip_time().has_estimation());
+
+    // 3. Sequence number 1 is received
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    wproxy.received_change_set(SequenceNumber_t(0, 1));
+    ASSERT_TRUE(wproxy.nack_answered());
+    ASSERT_TRUE(wproxy.round_trip_time().has_estimation());
+    ASSERT_GE(wproxy.round_trip_time().smoothed_rtt(), std::chrono::milliseconds(10));
+
+    // 4. The measurement has ended
+    ASSERT_FALSE(wproxy.nack_answered());
+
+    // 5. A GAP also answers a request
+    wproxy.nack_sent(SequenceNumber_t(0, 3));
+    wproxy.irrelevant_change_set(SequenceNumber_t(0, 3));
+    ASSERT_TRUE(wproxy.nack_answered());
+
+    // 6. The answer to a request repeated before the timeout could be for any of both, so it is not measured
+    wproxy.nack_sent(SequenceNumber_t(0, 4));
+    wproxy.nack_sent(SequenceNumber_t(0, 4));
+    wproxy.received_change_set(SequenceNumber_t(0, 4));
+    ASSERT_FALSE(wproxy.nack_answered());
+
+    // 7. Stopping the proxy forgets the estimation
+    wproxy.stop();
+    ASSERT_FALSE(wproxy.round_trip_time().has_estimation());
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
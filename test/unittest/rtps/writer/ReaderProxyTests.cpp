@@ -111,6 +111,119 @@ TEST(ReaderProxyTests, find_change_removed_test)
     ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, 4)));
 }
 
+TEST(ReaderProxyTests, repair_coalescing_test)
+{
+    StatefulWriter writerMock;
+    WriterTimes wTimes;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(wTimes, alloc, &writerMock);
+    GUID_t writer_guid;
+    ON_CALL(writerMock, getGuid()).WillByDefault(::testing::ReturnRef(writer_guid));
+    // As a writer with an empty history
+    ON_CALL(writerMock, get_seq_num_min()).WillByDefault(::testing::Return(SequenceNumber_t::unknown()));
+
+    ReaderProxyData reader_attributes(0, 0);
+    reader_attributes.m_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+    reader_attributes.m_qos.m_durability.kind = TRANSIENT_LOCAL_DURABILITY_QOS;
+    rproxy.start(reader_attributes);
+
+    CacheChange_t seq1; seq1.sequenceNumber = {0, 1};
+    CacheChange_t seq2; seq2.sequenceNumber = {0, 2};
+    rproxy.add_change(ChangeForReader_t(&seq1), true, false);
+    rproxy.add_change(ChangeForReader_t(&seq2), true, false);
+    rproxy.from_unsent_to_status(seq1.sequenceNumber, UNACKNOWLEDGED, false);
+    rproxy.from_unsent_to_status(seq2.sequenceNumber, UNACKNOWLEDGED, false);
+
+    // Nothing has been requested yet
+    EXPECT_FALSE(rproxy.requested_to_unsent(seq1.sequenceNumber));
+    EXPECT_EQ(std::chrono::steady_clock::time_point(), rproxy.first_pending_request());
+
+    // A NACK_FRAG requests the first change
+    FragmentNumberSet_t fragments(1);
+    fragments.add(1);
+    ASSERT_TRUE(rproxy.process_nack_frag(rproxy.guid(), 1, seq1.sequenceNumber, fragments));
+    EXPECT_NE(std::chrono::steady_clock::time_point(), rproxy.first_pending_request());
+
+    // A delivery in progress serves the request
+    EXPECT_TRUE(rproxy.requested_to_unsent(seq1.sequenceNumber));
+    EXPECT_FALSE(rproxy.requested_to_unsent(seq1.sequenceNumber));
+    FragmentNumber_t next_unsent_frag = 0;
+    SequenceNumber_t gap_seq;
+    bool need_reactivate_periodic_heartbeat = false;
+    EXPECT_TRUE(rproxy.change_is_unsent(seq1.sequenceNumber, next_unsent_frag, gap_seq,
+            need_reactivate_periodic_heartbeat));
+
+    // A multicast repair covers the second change
+    EXPECT_TRUE(rproxy.unacknowledged_to_underway(seq2.sequenceNumber));
+    EXPECT_FALSE(rproxy.unacknowledged_to_underway(seq2.sequenceNumber));
+    EXPECT_FALSE(rproxy.unacknowledged_to_underway(SequenceNumber_t(0, 3)));
+    EXPECT_TRUE(rproxy.perform_nack_supression());
+    EXPECT_TRUE(rproxy.unacknowledged_to_underway(seq2.sequenceNumber));
+
+    // Performing the NACK response clears the pending requests
+    EXPECT_EQ(0u, rproxy.perform_acknack_response(nullptr));
+    EXPECT_EQ(std::chrono::steady_clock::time_point(), rproxy.first_pending_request());
+}
+
+TEST(ReaderProxyTests, time_based_filter_test)
+{
+    StatefulWriter writerMock;
+    WriterTimes wTimes;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(wTimes, alloc, &writerMock);
+    GUID_t writer_guid;
+    ON_CALL(writerMock, getGuid()).WillByDefault(::testing::ReturnRef(writer_guid));
+    // As a writer with an empty history
+    ON_CALL(writerMock, get_seq_num_min()).WillByDefault(::testing::Return(SequenceNumber_t::unknown()));
+
+    ReaderProxyData reader_attributes(0, 0);
+    reader_attributes.m_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+    reader_attributes.m_qos.m_durability.kind = TRANSIENT_LOCAL_DURABILITY_QOS;
+    reader_attributes.m_qos.m_timeBasedFilter.minimum_separation = Duration_t(0, 100000000);
+    rproxy.start(reader_attributes);
+
+    InstanceHandle_t first_instance;
+    first_instance.value[0] = 1;
+    InstanceHandle_t second_instance;
+    second_instance.value[0] = 2;
+
+    std::vector<CacheChange_t> changes(8);
+    auto fill_change = [&changes](
+        size_t index,
+        const InstanceHandle_t& instance,
+        int64_t milliseconds,
+        ChangeKind_t kind)
+            {
+                changes[index].sequenceNumber = SequenceNumber_t(0, static_cast<uint32_t>(index + 1));
+                changes[index].instanceHandle = instance;
+                changes[index].sourceTimestamp.from_ns(milliseconds * 1000000);
+                changes[index].kind = kind;
+                return &changes[index];
+            };
+
+    // First sample of each instance is always sent
+    EXPECT_TRUE(rproxy.time_based_filter_is_relevant(*fill_change(0, first_instance, 1000, ALIVE)));
+    EXPECT_TRUE(rproxy.time_based_filter_is_relevant(*fill_change(1, second_instance, 1010, ALIVE)));
+    // Within the separation of its instance
+    EXPECT_FALSE(rproxy.time_based_filter_is_relevant(*fill_change(2, first_instance, 1050, ALIVE)));
+    // Evaluating it again gives the same result
+    EXPECT_FALSE(rproxy.time_based_filter_is_relevant(changes[2]));
+    // The writer's data filter does not look at the time
+    EXPECT_TRUE(rproxy.rtps_is_relevant(&changes[2]));
+    // Once the separation has elapsed
+    EXPECT_TRUE(rproxy.time_based_filter_is_relevant(*fill_change(3, first_instance, 1100, ALIVE)));
+    // Changes in the state of the instance are always sent
+    EXPECT_TRUE(rproxy.time_based_filter_is_relevant(*fill_change(4, second_instance, 1020, NOT_ALIVE_UNREGISTERED)));
+    // The unregistered instance starts again
+    EXPECT_TRUE(rproxy.time_based_filter_is_relevant(*fill_change(5, second_instance, 1030, ALIVE)));
+
+    // Removing the filter sends everything
+    reader_attributes.m_qos.m_timeBasedFilter.minimum_separation = Duration_t(0, 0);
+    rproxy.update(reader_attributes);
+    EXPECT_TRUE(rproxy.time_based_filter_is_relevant(*fill_change(6, first_instance, 1101, ALIVE)));
+    EXPECT_TRUE(rproxy.time_based_filter_is_relevant(*fill_change(7, first_instance, 1102, ALIVE)));
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
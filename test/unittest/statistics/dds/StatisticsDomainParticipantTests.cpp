@@ -269,6 +269,7 @@ TEST_F(StatisticsDomainParticipantTests, EnableDisableStatisticsDataWriterTest)
     eprosima::fastdds::dds::TypeSupport discovery_type(new DiscoveryTimePubSubType);
     eprosima::fastdds::dds::TypeSupport sample_identity_count_type(new SampleIdentityCountPubSubType);
     eprosima::fastdds::dds::TypeSupport physical_data_type(new PhysicalDataPubSubType);
+    eprosima::fastdds::dds::TypeSupport memory_usage_type(new EntityMemoryUsagePubSubType);
     eprosima::fastdds::dds::TypeSupport null_type(nullptr);
 
     // 4. Check that the types are not registered yet
@@ -280,6 +281,7 @@ TEST_F(StatisticsDomainParticipantTests, EnableDisableStatisticsDataWriterTest)
     EXPECT_EQ(null_type, statistics_participant->find_type(discovery_type.get_type_name()));
     EXPECT_EQ(null_type, statistics_participant->find_type(sample_identity_count_type.get_type_name()));
     EXPECT_EQ(null_type, statistics_participant->find_type(physical_data_type.get_type_name()));
+    EXPECT_EQ(null_type, statistics_participant->find_type(memory_usage_type.get_type_name()));
 
     // 5. Check that the topics do not exist
     EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription(HISTORY_LATENCY_TOPIC));
@@ -299,6 +301,8 @@ TEST_F(StatisticsDomainParticipantTests, EnableDisableStatisticsDataWriterTest)
     EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription(DISCOVERY_TOPIC));
     EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription(SAMPLE_DATAS_TOPIC));
     EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription(PHYSICAL_DATA_TOPIC));
+    EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription(ROUND_TRIP_TIME_TOPIC));
+    EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription(MEMORY_USAGE_TOPIC));
 
     // 6. Enable each statistics DataWriter checking that topics are created and types are registered.
     EXPECT_EQ(ReturnCode_t::RETCODE_OK, statistics_participant->enable_statistics_datawriter(HISTORY_LATENCY_TOPIC,
@@ -387,6 +391,16 @@ TEST_F(StatisticsDomainParticipantTests, EnableDisableStatisticsDataWriterTest)
     EXPECT_NE(nullptr, statistics_participant->lookup_topicdescription(PHYSICAL_DATA_TOPIC));
     EXPECT_TRUE(physical_data_type == statistics_participant->find_type(physical_data_type.get_type_name()));
 
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, statistics_participant->enable_statistics_datawriter(ROUND_TRIP_TIME_TOPIC,
+            STATISTICS_DATAWRITER_QOS));
+    EXPECT_NE(nullptr, statistics_participant->lookup_topicdescription(ROUND_TRIP_TIME_TOPIC));
+    EXPECT_TRUE(history_latency_type == statistics_participant->find_type(history_latency_type.get_type_name()));
+
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, statistics_participant->enable_statistics_datawriter(MEMORY_USAGE_TOPIC,
+            STATISTICS_DATAWRITER_QOS));
+    EXPECT_NE(nullptr, statistics_participant->lookup_topicdescription(MEMORY_USAGE_TOPIC));
+    EXPECT_TRUE(memory_usage_type == statistics_participant->find_type(memory_usage_type.get_type_name()));
+
     // 7. Enable an already enabled statistics DataWriter
     EXPECT_EQ(ReturnCode_t::RETCODE_OK, statistics_participant->enable_statistics_datawriter(SAMPLE_DATAS_TOPIC,
             STATISTICS_DATAWRITER_QOS));
@@ -397,6 +411,11 @@ TEST_F(StatisticsDomainParticipantTests, EnableDisableStatisticsDataWriterTest)
     EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription("INVALID_TOPIC"));
 
     // 9. Disable statistics DataWriter
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, statistics_participant->disable_statistics_datawriter(ROUND_TRIP_TIME_TOPIC));
+    EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription(ROUND_TRIP_TIME_TOPIC));
+    // The type is being used by another topic yet
+    EXPECT_TRUE(history_latency_type == statistics_participant->find_type(history_latency_type.get_type_name()));
+
     EXPECT_EQ(ReturnCode_t::RETCODE_OK, statistics_participant->disable_statistics_datawriter(HISTORY_LATENCY_TOPIC));
     EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription(HISTORY_LATENCY_TOPIC));
     EXPECT_NE(nullptr, statistics_participant->lookup_topicdescription(PDP_PACKETS_TOPIC));
@@ -494,6 +513,10 @@ TEST_F(StatisticsDomainParticipantTests, EnableDisableStatisticsDataWriterTest)
     EXPECT_EQ(ReturnCode_t::RETCODE_OK, statistics_participant->disable_statistics_datawriter(PHYSICAL_DATA_TOPIC));
     EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription(PHYSICAL_DATA_TOPIC));
     EXPECT_EQ(null_type, statistics_participant->find_type(physical_data_type.get_type_name()));
+
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, statistics_participant->disable_statistics_datawriter(MEMORY_USAGE_TOPIC));
+    EXPECT_EQ(nullptr, statistics_participant->lookup_topicdescription(MEMORY_USAGE_TOPIC));
+    EXPECT_EQ(null_type, statistics_participant->find_type(memory_usage_type.get_type_name()));
 #endif // FASTDDS_STATISTICS
 
     EXPECT_EQ(ReturnCode_t::RETCODE_OK, eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->
@@ -536,6 +559,7 @@ TEST_F(StatisticsDomainParticipantTests, CreateParticipantWithInvalidTopicName)
     eprosima::fastdds::dds::TypeSupport discovery_type(new DiscoveryTimePubSubType);
     eprosima::fastdds::dds::TypeSupport sample_identity_count_type(new SampleIdentityCountPubSubType);
     eprosima::fastdds::dds::TypeSupport physical_data_type(new PhysicalDataPubSubType);
+    eprosima::fastdds::dds::TypeSupport memory_usage_type(new EntityMemoryUsagePubSubType);
     eprosima::fastdds::dds::TypeSupport null_type(nullptr);
 
     EXPECT_EQ(null_type, participant->find_type(history_latency_type.get_type_name()));
@@ -546,6 +570,7 @@ TEST_F(StatisticsDomainParticipantTests, CreateParticipantWithInvalidTopicName)
     EXPECT_EQ(null_type, participant->find_type(discovery_type.get_type_name()));
     EXPECT_EQ(null_type, participant->find_type(sample_identity_count_type.get_type_name()));
     EXPECT_EQ(null_type, participant->find_type(physical_data_type.get_type_name()));
+    EXPECT_EQ(null_type, participant->find_type(memory_usage_type.get_type_name()));
 
     EXPECT_EQ(nullptr, participant->lookup_topicdescription(HISTORY_LATENCY_TOPIC));
     EXPECT_EQ(nullptr, participant->lookup_topicdescription(NETWORK_LATENCY_TOPIC));
@@ -564,6 +589,8 @@ TEST_F(StatisticsDomainParticipantTests, CreateParticipantWithInvalidTopicName)
     EXPECT_EQ(nullptr, participant->lookup_topicdescription(DISCOVERY_TOPIC));
     EXPECT_EQ(nullptr, participant->lookup_topicdescription(SAMPLE_DATAS_TOPIC));
     EXPECT_EQ(nullptr, participant->lookup_topicdescription(PHYSICAL_DATA_TOPIC));
+    EXPECT_EQ(nullptr, participant->lookup_topicdescription(ROUND_TRIP_TIME_TOPIC));
+    EXPECT_EQ(nullptr, participant->lookup_topicdescription(MEMORY_USAGE_TOPIC));
 
     // 3. Wait until logError entries are captured
     helper_block_for_at_least_entries(2);
@@ -1619,6 +1619,99 @@ TEST_F(SHMTransportTests, buffer_recover)
     thread_listener2.join();
 }
 
+TEST_F(SHMTransportTests, segment_growth)
+{
+    const std::string domain_name("SHMTests");
+
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+
+    // Up to 3 extents of 16 bytes can be added to the original segment.
+    // Extents are released as soon as they are idle, so the test does not wait for the default timeout.
+    auto segment = shared_mem_manager->create_segment(16u, 2u, SharedSegmentMemoryOptions(), 64u,
+                    std::chrono::milliseconds(0));
+    uint64_t initial_mem_size = segment->mem_size();
+
+    shared_mem_manager->remove_port(0);
+    auto port = shared_mem_manager->open_port(0, 8, 1000);
+    auto listener = port->create_listener();
+
+    std::vector<std::shared_ptr<SharedMemManager::Buffer>> buffers;
+
+    // Buffers kept by the sender are not recovered, the segment grows instead
+    for (uint32_t i = 0; i < 4u; i++)
+    {
+        buffers.push_back(segment->alloc_buffer(16u,
+                std::chrono::steady_clock::now() + std::chrono::milliseconds(100)));
+        memset(buffers.back()->data(), static_cast<int>(i), buffers.back()->size());
+    }
+
+    ASSERT_EQ(3u, segment->extents_count());
+    ASSERT_GT(segment->mem_size(), initial_mem_size);
+
+    // Buffers allocated in the extents are readable by the listeners
+    for (uint32_t i = 0; i < 4u; i++)
+    {
+        ASSERT_TRUE(port->try_push(buffers[i]));
+        auto received = listener->pop();
+        ASSERT_TRUE(received != nullptr);
+        ASSERT_EQ(16u, received->size());
+        ASSERT_EQ(static_cast<uint8_t>(i), static_cast<uint8_t*>(received->data())[15]);
+    }
+
+    // The maximum size is reached
+    ASSERT_THROW(segment->alloc_buffer(16u,
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(100)), std::exception);
+
+    buffers.clear();
+
+    // Idle extents are released on next allocations
+    auto buffer = segment->alloc_buffer(16u, std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+    ASSERT_EQ(0u, segment->extents_count());
+    ASSERT_EQ(initial_mem_size, segment->mem_size());
+}
+
+TEST_F(SHMTransportTests, segment_memory_options)
+{
+    const std::string domain_name("SHMTests");
+
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+
+    auto default_segment = shared_mem_manager->create_segment(4096u, 2u);
+
+    // Every option is best effort, so the segment is created even when the system does not support them
+    SharedSegmentMemoryOptions memory_options;
+    memory_options.huge_pages = true;
+    memory_options.prefault = true;
+    memory_options.numa_node = SharedSegmentMemoryOptions::NUMA_NODE_LOCAL;
+    auto segment = shared_mem_manager->create_segment(4096u, 2u, memory_options);
+
+    // The whole segment is covered by huge pages, when the system has them
+    size_t huge_page_size = SharedMemPages::huge_page_size();
+    if (0u != huge_page_size)
+    {
+        ASSERT_EQ(0u, segment->mem_size() % huge_page_size);
+        ASSERT_GE(segment->mem_size(), default_segment->mem_size());
+    }
+    else
+    {
+        ASSERT_EQ(default_segment->mem_size(), segment->mem_size());
+    }
+
+    // Prefaulting keeps the segment usable
+    shared_mem_manager->remove_port(0);
+    auto port = shared_mem_manager->open_port(0, 8, 1000);
+    auto listener = port->create_listener();
+
+    auto buffer = segment->alloc_buffer(4096u, std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+    memset(buffer->data(), 0xAB, buffer->size());
+    ASSERT_TRUE(port->try_push(buffer));
+
+    auto received = listener->pop();
+    ASSERT_TRUE(received != nullptr);
+    ASSERT_EQ(4096u, received->size());
+    ASSERT_EQ(0xABu, static_cast<uint8_t*>(received->data())[4095]);
+}
+
 TEST_F(SHMTransportTests, remote_segments_free)
 {
     const std::string domain_name("SHMTests");
@@ -25,6 +25,12 @@
 #include <fastrtps/utils/IPLocator.h>
 #include <rtps/transport/UDPv4Transport.h>
 
+#ifdef __linux__
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif // ifdef __linux__
+
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 using UDPv4Transport = eprosima::fastdds::rtps::UDPv4Transport;
@@ -680,6 +686,90 @@ TEST_F(UDPv4Tests, simple_throughput)
             , std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count() / (num_samples_per_batch * 1000.0));
 }
 
+#ifdef __linux__
+TEST_F(UDPv4Tests, send_with_transport_priority_marks_dscp)
+{
+    const uint8_t dscp = 46; // Expedited forwarding
+
+    UDPv4TransportDescriptor my_descriptor;
+    my_descriptor.transport_priority_dscp[10] = dscp;
+    UDPv4Transport transportUnderTest(my_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    // The TOS of the datagrams received on loopback is captured with IP_RECVTOS
+    int capture_socket = socket(AF_INET, SOCK_DGRAM, 0);
+    ASSERT_LE(0, capture_socket);
+    int enable = 1;
+    ASSERT_EQ(0, setsockopt(capture_socket, IPPROTO_IP, IP_RECVTOS, &enable, sizeof(enable)));
+    timeval timeout{1, 0};
+    ASSERT_EQ(0, setsockopt(capture_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)));
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t address_length = sizeof(address);
+    ASSERT_EQ(0, bind(capture_socket, reinterpret_cast<sockaddr*>(&address), address_length));
+    ASSERT_EQ(0, getsockname(capture_socket, reinterpret_cast<sockaddr*>(&address), &address_length));
+
+    Locator_t destination;
+    destination.kind = LOCATOR_KIND_UDPv4;
+    destination.port = ntohs(address.sin_port);
+    IPLocator::setIPv4(destination, 127, 0, 0, 1);
+
+    auto send_and_capture_tos = [&](SendResourceList& send_resource_list) -> int
+            {
+                octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+                LocatorList_t locator_list;
+                locator_list.push_back(destination);
+                for (auto& send_resource : send_resource_list)
+                {
+                    Locators locators_begin(locator_list.begin());
+                    Locators locators_end(locator_list.end());
+                    send_resource->send(message, 5, &locators_begin, &locators_end,
+                            (std::chrono::steady_clock::now() + std::chrono::milliseconds(100)));
+                }
+
+                octet buffer[16];
+                iovec iov{buffer, sizeof(buffer)};
+                char control[CMSG_SPACE(sizeof(int))];
+                msghdr msg{};
+                msg.msg_iov = &iov;
+                msg.msg_iovlen = 1;
+                msg.msg_control = control;
+                msg.msg_controllen = sizeof(control);
+                if (5 != recvmsg(capture_socket, &msg, 0))
+                {
+                    return -1;
+                }
+                for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); nullptr != cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg))
+                {
+                    if (IPPROTO_IP == cmsg->cmsg_level && IP_TOS == cmsg->cmsg_type)
+                    {
+                        return *CMSG_DATA(cmsg);
+                    }
+                }
+                return -1;
+            };
+
+    // Default sockets are not marked
+    SendResourceList default_resources;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(default_resources, destination));
+    EXPECT_EQ(0, send_and_capture_tos(default_resources));
+
+    // Sockets of a configured priority are marked with its DSCP
+    SendResourceList priority_resources;
+    ASSERT_TRUE(transportUnderTest.open_priority_output_channel(priority_resources, destination, 10));
+    ASSERT_FALSE(priority_resources.empty());
+    EXPECT_EQ(dscp << 2, send_and_capture_tos(priority_resources));
+
+    // Priorities without DSCP use the default sockets
+    SendResourceList unconfigured_resources;
+    EXPECT_FALSE(transportUnderTest.open_priority_output_channel(unconfigured_resources, destination, 20));
+    EXPECT_TRUE(unconfigured_resources.empty());
+
+    close(capture_socket);
+}
+#endif // ifdef __linux__
+
 void UDPv4Tests::HELPER_SetDescriptorDefaults()
 {
     descriptor.maxMessageSize = 5;
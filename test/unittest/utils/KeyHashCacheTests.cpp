@@ -0,0 +1,145 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/utils/md5.h>
+#include <gtest/gtest.h>
+#include <utils/KeyHashCache.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+
+static std::string to_hex(
+        const unsigned char* digest)
+{
+    static const char* hex_chars = "0123456789abcdef";
+    std::string ret;
+    for (size_t i = 0; i < 16; ++i)
+    {
+        ret.push_back(hex_chars[digest[i] >> 4]);
+        ret.push_back(hex_chars[digest[i] & 0x0F]);
+    }
+    return ret;
+}
+
+// Test suite of RFC 1321, plus lengths around the padding boundary
+TEST(KeyHashCacheTests, md5_digests)
+{
+    std::vector<std::pair<std::string, std::string>> vectors =
+    {
+        {"", "d41d8cd98f00b204e9800998ecf8427e"},
+        {"a", "0cc175b9c0f1b6a831c399e269772661"},
+        {"abc", "900150983cd24fb0d6963f7d28e17f72"},
+        {"message digest", "f96b697d7cb7938d525a2f31aaf161d0"},
+        {"abcdefghijklmnopqrstuvwxyz", "c3fcd3d76192e4007dfb496cca67e13b"},
+        {"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", "d174ab98d277d9f5a5611c2c9f419d9f"},
+        {"12345678901234567890123456789012345678901234567890123456789012345678901234567890",
+         "57edf4a22be3c955ac49da2e2107b67a"},
+        {std::string(55, 'x'), "04364420e25c512fd958a70738aa8f72"},
+        {std::string(56, 'x'), "668a72d5ba17f08e62dabcafad6db14b"},
+        {std::string(63, 'x'), "7dc2ca208106a2f703567bdff99d8981"},
+        {std::string(64, 'x'), "c1bb4f81d892b2d57947682aeb252456"}
+    };
+
+    MD5 md5;
+    for (const auto& vector : vectors)
+    {
+        EXPECT_EQ(vector.second, MD5(vector.first).hexdigest());
+
+        // Reusing the object
+        md5.init();
+        md5.update(vector.first.c_str(), static_cast<MD5::size_type>(vector.first.length()));
+        md5.finalize();
+        EXPECT_EQ(vector.second, to_hex(md5.digest));
+    }
+}
+
+TEST(KeyHashCacheTests, short_keys_are_not_hashed)
+{
+    KeyHashCache cache;
+    const unsigned char key[] = {0, 0, 0, 4, 'a', 'b', 'c', 0};
+
+    rtps::InstanceHandle_t handle;
+    cache.get_key_hash(key, sizeof(key), false, 16, handle);
+    for (size_t i = 0; i < 16; ++i)
+    {
+        EXPECT_EQ(i < sizeof(key) ? key[i] : 0, handle.value[i]);
+    }
+    EXPECT_EQ(0u, cache.size());
+
+    // Forcing the MD5
+    cache.get_key_hash(key, sizeof(key), true, 16, handle);
+    MD5 md5;
+    md5.update(key, sizeof(key));
+    md5.finalize();
+    EXPECT_EQ(to_hex(md5.digest), to_hex(handle.value));
+    EXPECT_EQ(1u, cache.size());
+}
+
+TEST(KeyHashCacheTests, cached_digests)
+{
+    KeyHashCache cache(2);
+    std::string key_1(100, '1');
+    std::string key_2(100, '2');
+    std::string key_3(100, '3');
+
+    auto expected = [](const std::string& key)
+            {
+                return MD5(key).hexdigest();
+            };
+
+    auto get = [&cache](const std::string& key)
+            {
+                rtps::InstanceHandle_t handle;
+                cache.get_key_hash(reinterpret_cast<const unsigned char*>(key.c_str()),
+                        static_cast<uint32_t>(key.length()), false, 200, handle);
+                return to_hex(handle.value);
+            };
+
+    EXPECT_EQ(expected(key_1), get(key_1));
+    EXPECT_EQ(expected(key_2), get(key_2));
+    EXPECT_EQ(2u, cache.size());
+
+    // Hits give the same result
+    EXPECT_EQ(expected(key_1), get(key_1));
+    EXPECT_EQ(expected(key_2), get(key_2));
+    EXPECT_EQ(2u, cache.size());
+
+    // The cache is emptied when full
+    EXPECT_EQ(expected(key_3), get(key_3));
+    EXPECT_EQ(1u, cache.size());
+    EXPECT_EQ(expected(key_1), get(key_1));
+    EXPECT_EQ(2u, cache.size());
+}
+
+TEST(KeyHashCacheTests, disabled_cache)
+{
+    KeyHashCache cache(0);
+    std::string key(100, 'k');
+    rtps::InstanceHandle_t handle;
+    cache.get_key_hash(reinterpret_cast<const unsigned char*>(key.c_str()), static_cast<uint32_t>(key.length()),
+            false, 200, handle);
+    EXPECT_EQ(MD5(key).hexdigest(), to_hex(handle.value));
+    EXPECT_EQ(0u, cache.size());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -988,11 +988,16 @@ TEST_F(XMLProfileParserTests, SHM_transport_descriptors_config)
 
     ASSERT_NE(descriptor, nullptr);
     ASSERT_EQ(descriptor->segment_size(), std::numeric_limits<uint32_t>::max());
+    ASSERT_EQ(descriptor->max_segment_size(), std::numeric_limits<uint32_t>::max());
+    ASSERT_EQ(descriptor->extent_idle_timeout_ms(), std::numeric_limits<uint32_t>::max());
     ASSERT_EQ(descriptor->port_queue_capacity(), std::numeric_limits<uint32_t>::max());
     ASSERT_EQ(descriptor->healthy_check_timeout_ms(), std::numeric_limits<uint32_t>::max());
     ASSERT_EQ(descriptor->rtps_dump_file(), "test_file.dump");
     ASSERT_EQ(descriptor->maxMessageSize, 128000u);
     ASSERT_EQ(descriptor->max_message_size(), 128000u);
+    ASSERT_TRUE(descriptor->huge_pages());
+    ASSERT_TRUE(descriptor->prefault_segment());
+    ASSERT_EQ(descriptor->numa_node(), 1);
 }
 
 /*